@@ -24,9 +24,10 @@ variable. This phase is handled by two functions: pre_optimize() and
 cfg_optimize().
 
 pre_optimize() runs before the construction of the CFG begins. It calls
-strength_reduce() to perform simple strength reduction, and if_branch()
+strength_reduce() to perform simple strength reduction, if_branch()
 to rewrite certain if/branch/label constructs (for details, see
-if_branch() below).
+if_branch() below), and superinstructions() to fuse common op pairs
+into the ops of the super_ops dynamic oplib, when it is loaded.
 
 [pre_optimize() may also be called later, during the main optimization
  phase, but this is not guaranteed.]
@@ -141,6 +142,11 @@ static int strength_reduce(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*unit);
 
+static int superinstructions(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*unit);
+
 PARROT_WARN_UNUSED_RESULT
 static int unused_label(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
@@ -183,6 +189,9 @@ static int used_once(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_strength_reduce __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_superinstructions __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_unused_label __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(unit))
@@ -211,8 +220,10 @@ pre_optimize(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
     if (IMCC_INFO(interp)->optimizer_level & OPT_PRE) {
         IMCC_info(interp, 2, "pre_optimize\n");
         changed += strength_reduce(interp, unit);
-        if (!IMCC_INFO(interp)->dont_optimize)
+        if (!IMCC_INFO(interp)->dont_optimize) {
             changed += if_branch(interp, unit);
+            changed += superinstructions(interp, unit);
+        }
     }
     return changed;
 }
@@ -390,6 +401,125 @@ if_branch(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static int superinstructions(PARROT_INTERP, IMC_Unit *unit)>
+
+Fuses an integer update followed by a conditional branch on the updated
+register into a single superinstruction:
+
+  inc Ix                => inc_lt Ix, y, L
+  lt Ix, y, L
+
+  sub Ix, y             => sub_if Ix, y, L
+  if Ix, L
+
+The fused ops live in the C<super_ops> dynamic oplib, so nothing is
+rewritten unless the program loaded it.  As labels are instructions of
+their own, the branch can't be a branch target if it directly follows
+the update.
+
+=cut
+
+*/
+
+static int
+superinstructions(PARROT_INTERP, ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(superinstructions)
+    PARROT_OBSERVER static const int updates[] = {
+        PARROT_OP_inc_i, PARROT_OP_dec_i,
+        PARROT_OP_add_i_i, PARROT_OP_add_i_ic,
+        PARROT_OP_sub_i_i, PARROT_OP_sub_i_ic
+    };
+    /* there are no gt and ge ops, IMCC emits lt and le with swapped
+     * operands instead; the fused ops need the updated register first */
+    PARROT_OBSERVER static const struct br_fuse {
+        int op;
+        PARROT_OBSERVER const char * const name;
+        PARROT_OBSERVER const char * const swapped;
+    } branches[] = {
+        { PARROT_OP_lt_i_i_ic,   "lt",     "gt" },
+        { PARROT_OP_lt_i_ic_ic,  "lt",     NULL },
+        { PARROT_OP_lt_ic_i_ic,  NULL,     "gt" },
+        { PARROT_OP_le_i_i_ic,   "le",     "ge" },
+        { PARROT_OP_le_i_ic_ic,  "le",     NULL },
+        { PARROT_OP_le_ic_i_ic,  NULL,     "ge" },
+        { PARROT_OP_eq_i_i_ic,   "eq",     "eq" },
+        { PARROT_OP_eq_i_ic_ic,  "eq",     NULL },
+        { PARROT_OP_eq_ic_i_ic,  NULL,     "eq" },
+        { PARROT_OP_ne_i_i_ic,   "ne",     "ne" },
+        { PARROT_OP_ne_i_ic_ic,  "ne",     NULL },
+        { PARROT_OP_ne_ic_i_ic,  NULL,     "ne" },
+        { PARROT_OP_if_i_ic,     "if",     NULL },
+        { PARROT_OP_unless_i_ic, "unless", NULL }
+    };
+    op_lib_t    *core_ops = PARROT_GET_CORE_OPLIB(interp);
+    Instruction *ins, *tmp;
+    int          changes  = 0;
+
+    IMCC_info(interp, 2, "\tsuperinstructions\n");
+    for (ins = unit->instructions; ins && ins->next; ins = ins->next) {
+        Instruction * const next   = ins->next;
+        SymReg      * const reg    = ins->symregs[0];
+        const char         *branch = NULL;
+        int                 is_update = 0;
+        SymReg             *regs[IMCC_MAX_FIX_REGS];
+        op_info_t          *op;
+        char                name[32], fullname[64];
+        size_t              i;
+        int                 j, n;
+
+        if (!ins->op || !next->op)
+            continue;
+
+        for (i = 0; i < sizeof (updates) / sizeof (*updates); i++)
+            if (ins->op == &core_ops->op_info_table[updates[i]])
+                is_update = 1;
+        if (!is_update)
+            continue;
+
+        /* the update's operands followed by the branch's remaining ones */
+        n = 0;
+        for (j = 0; j < ins->opsize - 1; j++)
+            regs[n++] = ins->symregs[j];
+
+        for (i = 0; i < sizeof (branches) / sizeof (*branches); i++) {
+            if (next->op != &core_ops->op_info_table[branches[i].op])
+                continue;
+            if (branches[i].name && next->symregs[0] == reg) {
+                branch = branches[i].name;
+                for (j = 1; j < next->opsize - 1; j++)
+                    regs[n++] = next->symregs[j];
+            }
+            else if (branches[i].swapped && next->symregs[1] == reg) {
+                branch    = branches[i].swapped;
+                regs[n++] = next->symregs[0];
+                regs[n++] = next->symregs[2];
+            }
+            break;
+        }
+        if (!branch)
+            continue;
+
+        snprintf(name, sizeof (name), "%s_%s", ins->op->name, branch);
+        check_op(interp, &op, fullname, name, regs, n, 0);
+        if (!op)
+            continue;
+
+        IMCC_debug(interp, DEBUG_OPT1, "superinstruction %s %s => %s\n",
+                ins->op->full_name, next->op->full_name, fullname);
+        --reg->use_count;
+        tmp = INS(interp, unit, name, "", regs, n, 0, 0);
+        subst_ins(unit, ins, tmp, 1);
+        ins     = tmp;
+        changes = 1;
+        if (!delete_ins(unit, next))
+            break;
+    }
+    return changes;
+}
+
+/*
+
 =item C<static int strength_reduce(PARROT_INTERP, IMC_Unit *unit)>
 
 strength_reduce ... rewrites e.g add Ix, Ix, y => add Ix, y
@@ -79,7 +79,8 @@ method print_c_header_files() {
     self.emit_c_op_func_header($fh);
     $fh.close();
 
-    if self.ops_file<core> {
+    # Op enums are shared by every runcore, only emit them once.
+    if self.ops_file<core> && self<suffix> eq '' {
         $fh := pir::new__Ps('FileHandle');
         $fh.open(self<enum_header>, 'w')
             || die("Can't open "~ self<enum_header>);
@@ -213,6 +214,7 @@ method _emit_source_preamble($fh) {
 #include "{self<include>}"
 #include "pmc/pmc_parrotlibrary.h"
 #include "pmc/pmc_callcontext.h"
+#include <math.h>
 
 {self.trans.defines(self)}
 
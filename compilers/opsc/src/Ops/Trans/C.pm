@@ -117,7 +117,7 @@ method defines($emitter) {
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
-#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
 
 static int get_op(PARROT_INTERP, const char * name, int full);
 |;
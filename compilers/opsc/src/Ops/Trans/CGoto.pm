@@ -0,0 +1,239 @@
+#! nqp
+# Copyright (C) 2010, Parrot Foundation.
+
+class Ops::Trans::CGoto is Ops::Trans::C;
+
+=begin
+
+Computed goto transformation.
+
+Every op body becomes a labelled block inside a single runloop function,
+C<cg_core>.  Instead of returning to a dispatch loop, each op jumps directly
+to the label of the next op.  Op numbers in bytecode are local to their code
+segment, so each segment gets a table mapping its op numbers to labels,
+built the first time the segment runs.  Ops which only advance to the next
+op dispatch through that table directly; branching ops also switch tables
+when the code segment changes, and fall back to the op function table while
+event checking is enabled.  Ops from dynamic oplibs always run through the
+op function table.
+
+The op info table, op function table and op lookup are shared with the
+function core, so this transformation only emits the runloop itself.
+
+=end
+
+method new() {
+    # Storage for generated labelled op bodies.
+    self<op_funcs>  := list();
+    # Storage for the label address table.
+    self<op_labels> := list();
+
+    self<num_entries> := 0;
+
+    self<arg_maps> := hash(
+        :op("cur_opcode[NUM]"),
+
+        :i("IREG(NUM)"),
+        :n("NREG(NUM)"),
+        :p("PREG(NUM)"),
+        :s("SREG(NUM)"),
+        :k("PREG(NUM)"),
+        :ki("IREG(NUM)"),
+
+        :ic("ICONST(NUM)"),
+        :nc("NCONST(NUM)"),
+        :pc("PCONST(NUM)"),
+        :sc("SCONST(NUM)"),
+        :kc("PCONST(NUM)"),
+        :kic("ICONST(NUM)")
+    );
+
+    self;
+}
+
+method suffix() { '_cg' };
+
+method core_type() { 'PARROT_CGOTO_CORE' }
+
+method prepare_ops($emitter, $ops_file) {
+
+    my $index := 0;
+    my @op_labels;
+    my @op_funcs;
+
+    for $ops_file.ops -> $op {
+        my $src := $op.source( self );
+
+        @op_labels.push(sprintf( "        %-50s /* %6ld */\n", "&&PC_$index,", $index ));
+
+        my $body := join('', "PC_$index:", ' { /* ', $op.full_name, " */\n", $src, '}', "\n\n");
+        @op_funcs.push($body);
+        $index++;
+    }
+
+    self<bs>          := $emitter.bs;
+    self<op_funcs>    := @op_funcs;
+    self<op_labels>   := @op_labels;
+    self<num_entries> := +@op_funcs;
+}
+
+method emit_c_op_funcs_header_part($fh) {
+    $fh.print(q|
+#include "parrot/oplib/core_ops.h"
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+opcode_t * cg_core(opcode_t *cur_opcode, PARROT_INTERP);
+#endif
+|);
+}
+
+method goto_address($addr) { "CG_BRANCH($addr)"; }
+
+method goto_offset($offset) {
+    # NEXT() is always a literal op size; everything else is a real branch.
+    $offset ~~ /^\d+$/
+        ?? "CG_NEXT($offset)"
+        !! "CG_BRANCH(cur_opcode + $offset)";
+}
+
+=begin
+
+=item C<defines()>
+
+Returns the C C<#define> macros for register access and label dispatch.
+
+=end
+
+method defines($emitter) {
+    return q|
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) (CUR_CTX->bp.regs_i[cur_opcode[i]])
+#define NREG(i) (CUR_CTX->bp.regs_n[-1L - cur_opcode[i]])
+#define PREG(i) (CUR_CTX->bp_ps.regs_p[-1L - cur_opcode[i]])
+#define SREG(i) (CUR_CTX->bp_ps.regs_s[cur_opcode[i]])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
+
+/* label of the op at pc in the current segment, rebuilding the table as needed */
+#define CG_LABEL(pc) \\
+    ((size_t)*(pc) < cg_seg->op_addr_count ? cg_seg->op_addr_table[*(pc)] : &&cg_branch)
+
+/* fall through to the op following the current one */
+#define CG_NEXT(n) \\
+    do { \\
+        cur_opcode += (n); \\
+        goto *CG_LABEL(cur_opcode); \\
+    } while (0)
+
+/* jump anywhere, leaving the runloop on a NULL address */
+#define CG_BRANCH(addr) \\
+    do { \\
+        cur_opcode = (opcode_t *)(addr); \\
+        goto cg_branch; \\
+    } while (0)
+|;
+}
+
+method op_info($emitter) { 'NULL' }
+method op_func($emitter) { 'NULL' }
+method getop($emitter)   { '( int (*)(PARROT_INTERP, const char *, int) )NULL' };
+
+method init_func_init1() {
+    my $res := q|
+        if (![[BS]]op_lib.op_info_table) {
+            const op_lib_t * const core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+            [[BS]]op_lib.op_info_table = core_lib->op_info_table;
+            [[BS]]op_lib.op_func_table = core_lib->op_func_table;
+            [[BS]]op_lib._op_code      = core_lib->_op_code;
+        }|;
+
+    subst($res, /'[[' BS ']]'/, self<bs>, :global);
+}
+
+method emit_source_part($emitter, $fh) {
+    $fh.print(qq|
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+#define CG_OP_COUNT {self<num_entries>}
+
+/*
+** Computed goto runloop:
+*/
+
+opcode_t *
+cg_core(opcode_t *cur_opcode, PARROT_INTERP)
+| ~ q|{
+    static void * const cg_ops_addr[] = {
+|);
+
+    for self<op_labels> {
+        $fh.print($_)
+    }
+
+    $fh.print(q|    };
+
+    PackFile_ByteCode *cg_seg = interp->code;
+
+    goto cg_branch;
+
+    /* Ops outside the core oplib, and every op while event checking is
+     * enabled, run through the op function table of the code segment. */
+  cg_function_op:
+    cur_opcode = (interp->code->op_func_table)[*cur_opcode](cur_opcode, interp);
+
+  cg_branch:
+    if (!cur_opcode)
+        return NULL;
+    if (interp->code->save_func_table)
+        goto cg_function_op;
+
+    cg_seg = interp->code;
+
+    /* map the op numbers of new ops in this segment to their labels */
+    if (cg_seg->op_addr_count < cg_seg->op_count) {
+        const op_lib_t * const core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+        size_t i;
+
+        cg_seg->op_addr_table = cg_seg->op_addr_table
+            ? mem_gc_realloc_n_typed_zeroed(interp, cg_seg->op_addr_table,
+                    cg_seg->op_count, cg_seg->op_addr_count, void *)
+            : mem_gc_allocate_n_zeroed_typed(interp, cg_seg->op_count, void *);
+
+        for (i = cg_seg->op_addr_count; i < cg_seg->op_count; i++) {
+            const op_info_t * const info = cg_seg->op_info_table[i];
+            const size_t            op   = info ? (size_t)(info - core_lib->op_info_table) : 0;
+
+            cg_seg->op_addr_table[i] = info && info->lib == core_lib && op < CG_OP_COUNT
+                ? cg_ops_addr[op]
+                : &&cg_function_op;
+        }
+
+        cg_seg->op_addr_count = cg_seg->op_count;
+    }
+
+    goto *cg_seg->op_addr_table[*cur_opcode];
+
+|);
+
+    for self<op_funcs> -> $op {
+        $fh.print($op);
+    }
+
+    $fh.print(q|}
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+|);
+}
+
+method emit_op_lookup($emitter, $fh) {
+    $fh.print(q|static void hop_deinit(SHIM_INTERP) {}|);
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -97,7 +97,12 @@ sub _list_extra_headers {
     # the header.
     my @extra_headers = qw(malloc.h fcntl.h setjmp.h pthread.h signal.h
         sys/types.h sys/socket.h netinet/in.h arpa/inet.h
-        sys/stat.h sysexit.h limits.h sys/sysctl.h);
+        sys/stat.h sysexit.h limits.h sys/sysctl.h sys/epoll.h
+        sys/sendfile.h);
+
+    # io_uring needs no library, just the kernel's definitions
+    push @extra_headers, 'linux/io_uring.h'
+        unless $conf->options->get('without-io-uring');
 
     # more extra_headers needed on mingw/msys; *BSD fails if they are present
     if ( $conf->data->get('OSNAME_provisional') eq "msys" ) {
@@ -25,6 +25,27 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/*
+ * inline cache of a method call site: the methods found for the last few
+ * receiver types, see Parrot_find_method_at_site.  Attribute access sites
+ * remember attribute slots instead, see Parrot_oo_get_attribute_at_site.
+ */
+#define METHOD_SITE_WAYS 4
+
+typedef struct _method_site_entry {
+    VTABLE * vtable;    /* receiver vtable, NULL if unused */
+    PMC    * _class;    /* receiver class for Objects, else NULL */
+    STRING * name;      /* method or attribute name */
+    PMC    * pmc;       /* the method sub pmc, PMCNULL at attribute sites */
+    INTVAL   slot;      /* the attribute slot at attribute sites */
+} Method_site_entry;
+
+typedef struct _method_site {
+    const opcode_t   *pc;       /* call site opcode, NULL if unused */
+    UINTVAL           epoch;    /* entries are stale unless this is current */
+    Method_site_entry entries[METHOD_SITE_WAYS];
+} Method_site;
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +53,10 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    Method_site *sites;         /* call site caches, open addressed by pc */
+    UINTVAL site_mask;          /* number of sites - 1 */
+    UINTVAL site_count;         /* sites in use */
+    UINTVAL site_epoch;         /* bumped to invalidate all sites */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
@@ -36,7 +36,9 @@ typedef struct parrot_runloop_t {
 typedef parrot_runloop_t Parrot_runloop;
 
 typedef enum {
-    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG /* last element */
+    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG,
+    /* context may be resumed after its frame has been popped */
+    CALLSIGNATURE_escaped_FLAG           = PObj_private1_FLAG /* last element */
 } callsignature_flags_enum;
 
 #define CALLSIGNATURE_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -49,6 +51,29 @@ typedef enum {
 #define CALLSIGNATURE_is_exception_SET(o)   CALLSIGNATURE_flag_SET(is_exception, (o))
 #define CALLSIGNATURE_is_exception_CLEAR(o) CALLSIGNATURE_flag_CLEAR(is_exception, (o))
 
+/* Mark if a continuation, closure or introspection may outlive the frame */
+#define CALLSIGNATURE_escaped_TEST(o)  CALLSIGNATURE_flag_TEST(escaped, (o))
+#define CALLSIGNATURE_escaped_SET(o)   CALLSIGNATURE_flag_SET(escaped, (o))
+
+/* A positional argument of a CallContext.  Multiple dispatch reads the types
+ * of the arguments from them directly. */
+typedef struct Pcc_cell
+{
+    union u {
+        PMC     *p;
+        STRING  *s;
+        INTVAL   i;
+        FLOATVAL n;
+    } u;
+    INTVAL type;
+} Pcc_cell;
+
+#define NOCELL     0
+#define INTCELL    1
+#define FLOATCELL  2
+#define STRINGCELL 3
+#define PMCCELL    4
+
 /* HEADERIZER BEGIN: src/call/pcc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -215,6 +240,26 @@ void Parrot_pcc_fill_params_from_varargs(PARROT_INTERP,
         FUNC_MODIFIES(*call_object)
         FUNC_MODIFIES(*args);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC* Parrot_pcc_build_direct_call_from_op(PARROT_INTERP,
+    ARGIN(PMC *raw_sig),
+    ARGIN(opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+opcode_t* Parrot_pcc_fill_params_direct(PARROT_INTERP,
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *caller_ctx),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 void Parrot_pcc_merge_signature_for_tailcall(PARROT_INTERP,
     ARGMOD_NULLOK(PMC * parent),
     ARGMOD_NULLOK(PMC * tailcall))
@@ -277,6 +322,16 @@ void Parrot_pcc_split_signature_string(
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_Parrot_pcc_build_direct_call_from_op \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args))
+#define ASSERT_ARGS_Parrot_pcc_fill_params_direct __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(caller_ctx) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_Parrot_pcc_merge_signature_for_tailcall \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -306,7 +361,8 @@ void Parrot_pcc_split_signature_string(
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_results_pc)    \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_params_pc)     \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_set_returns_pc)) { \
-        PMC * const sig = (seg)->const_table->pmc.constants[(pc)[1]]; \
+        PMC * const sig = PackFile_ConstTable_get_pmc((interp), \
+                (seg)->const_table, (pc)[1]); \
         (n) += VTABLE_elements((interp), sig); \
     } \
 } while (0)
@@ -316,6 +372,13 @@ void Parrot_pcc_split_signature_string(
 /* HEADERIZER BEGIN: src/call/context.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_EXPORT
+void Parrot_pcc_capture_context(PARROT_INTERP, ARGIN_NULLOK(PMC *pmcctx))
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_pcc_escape_context(SHIM_INTERP, ARGIN_NULLOK(PMC *pmcctx));
+
 PARROT_EXPORT
 PARROT_PURE_FUNCTION
 PARROT_CANNOT_RETURN_NULL
@@ -440,6 +503,13 @@ PMC * Parrot_pcc_allocate_empty_context(PARROT_INTERP,
     ARGIN_NULLOK(PMC *old))
         __attribute__nonnull__(1);
 
+void Parrot_pcc_allocate_frame(PARROT_INTERP,
+    ARGIN(PMC *pmcctx),
+    ARGIN(const UINTVAL *number_regs_used))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 void Parrot_pcc_allocate_registers(PARROT_INTERP,
     ARGIN(PMC *pmcctx),
     ARGIN(const UINTVAL *number_regs_used))
@@ -447,6 +517,18 @@ void Parrot_pcc_allocate_registers(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pcc_cell_type(PARROT_INTERP, ARGIN(const Pcc_cell *cell))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_pcc_destroy_frame_stack(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_pcc_free_frame(PARROT_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 void Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -458,6 +540,14 @@ PMC * Parrot_pcc_init_context(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+void Parrot_pcc_push_frame(PARROT_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_pcc_release_frames(PARROT_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC * Parrot_set_new_context(PARROT_INTERP,
@@ -465,6 +555,9 @@ PMC * Parrot_set_new_context(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_Parrot_pcc_capture_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_escape_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_pcc_get_FLOATVAL_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
@@ -516,16 +609,35 @@ PMC * Parrot_set_new_context(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_pcc_allocate_empty_context \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_allocate_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx) \
+    , PARROT_ASSERT_ARG(number_regs_used))
 #define ASSERT_ARGS_Parrot_pcc_allocate_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx) \
     , PARROT_ASSERT_ARG(number_regs_used))
+#define ASSERT_ARGS_Parrot_pcc_cell_type __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cell))
+#define ASSERT_ARGS_Parrot_pcc_destroy_frame_stack \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_free_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_pcc_free_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_pcc_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_pcc_push_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_Parrot_pcc_release_frames __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_set_new_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(number_regs_used))
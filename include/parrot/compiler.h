@@ -99,6 +99,12 @@
 #  define __attribute__cold__
 #endif
 
+/* Labels as values ("computed goto") is a GCC extension, also understood by
+ * clang and icc.  It is required by the cgoto runcore. */
+#if defined(__GNUC__) && !defined(PARROT_NO_COMPUTED_GOTO)
+#  define PARROT_HAS_COMPUTED_GOTO 1
+#endif
+
 
 /* Shim arguments are arguments that must be included in your function,
  * but serve no purpose inside.  Mark them with the SHIM() macro so that
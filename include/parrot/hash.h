@@ -20,9 +20,25 @@ typedef enum {
 /* A BucketIndex is an index into the pool of available buckets. */
 typedef UINTVAL BucketIndex;
 
-#define N_BUCKETS(n) ((n))
+/* The index is probed one group of control bytes at a time */
+#ifdef __SSE2__
+#  define HASH_GROUP_WIDTH 16
+#else
+#  define HASH_GROUP_WIDTH 8
+#endif
+
+/* Control bytes of index slots. Free slots have the high bit set, full slots
+ * hold seven bits of the hash value of their key */
+#define HASH_CTRL_EMPTY    ((unsigned char)0x80)
+#define HASH_CTRL_DELETED  ((unsigned char)0xFE)
+#define HASH_CTRL_IS_FULL(c) (!((c) & 0x80))
+
+/* A single group may fill up completely, larger indexes up to 7/8 */
+#define N_BUCKETS(n) ((n) <= HASH_GROUP_WIDTH ? (n) : (n) - (n) / 8)
+#define HASH_CTRL_SIZE(n) ((n) < HASH_GROUP_WIDTH ? HASH_GROUP_WIDTH : (n))
 #define HASH_ALLOC_SIZE(n) (N_BUCKETS(n) * sizeof (HashBucket) + \
-                                     (n) * sizeof (HashBucket *))
+                                     (n) * sizeof (HashBucket *) + \
+                                     HASH_CTRL_SIZE(n))
 
 /* &gen_from_enum(hash_key_type.pasm) */
 typedef enum {
@@ -36,8 +52,8 @@ typedef enum {
 } Hash_key_type;
 /* &end_gen */
 
+/* Unused buckets have a NULL key, the free list is linked through value */
 typedef struct _hashbucket {
-    struct _hashbucket *next;
     void *key;
     void *value;
 } HashBucket;
@@ -46,15 +62,21 @@ struct _hash {
     /* Large slab store of buckets */
     HashBucket *buckets;
 
-    /* List of Bucket pointers */
+    /* Open addressed index of Bucket pointers */
     HashBucket **index;
 
+    /* Control bytes of the index slots */
+    unsigned char *control;
+
     /* Store for empty buckets */
     HashBucket *free_list;
 
     /* Number of values stored in hashtable */
     UINTVAL entries;
 
+    /* Number of deleted slots in index */
+    UINTVAL deleted;
+
     /* alloced - 1 */
     UINTVAL mask;
 
@@ -89,10 +111,9 @@ struct _hash {
     if ((_hash)->entries) {                                                 \
         UINTVAL _loc;                                                       \
         for (_loc = 0; _loc <= (_hash)->mask; ++_loc) {                     \
-            HashBucket *_bucket = (_hash)->index[_loc];                     \
-            while (_bucket) {                                               \
+            if (HASH_CTRL_IS_FULL((_hash)->control[_loc])) {                \
+                HashBucket *_bucket = (_hash)->index[_loc];                 \
                 _code                                                       \
-                _bucket = _bucket->next;                                    \
             }                                                               \
         }                                                                   \
     }                                                                       \
@@ -17,6 +17,30 @@
 /* preallocate freeze image for aggregates with this estimation */
 #define FREEZE_BYTES_PER_ITEM 9
 
+/* Images made by Parrot_freeze start with this header instead of a packfile
+ * header: the magic, the format version, the size of FLOATVAL, the byte
+ * order of the floats, the bytecode version of the freezing parrot and a
+ * reserved byte.  Integers follow as zigzag encoded varints,
+ * floats as raw FLOATVALs, and strings as a varint of their encoding and
+ * flags (0 for a NULL string), a varint byte length and the bytes.
+ * Images of interpreter snapshots store each string once, so a string takes
+ * a varint first: 0 for a NULL string, 1 for a new string in the form above,
+ * N for the string stored (N - 1)th.
+ * Images in packfiles keep the packfile format. */
+#define IMAGE_COMPACT_MAGIC         "\376PFZ"
+#define IMAGE_COMPACT_HEADER_BYTES  10
+#define IMAGE_COMPACT_VERSION       1
+
+/* longest varint of an UINTVAL */
+#define IMAGE_VARINT_MAX_BYTES      (sizeof (UINTVAL) * 8 / 7 + 1)
+
+#define IMAGE_ZIGZAG(v)   (((UINTVAL)(v) << 1) ^ ((v) < 0 ? ~(UINTVAL)0 : 0))
+#define IMAGE_UNZIGZAG(u) ((INTVAL)((u) >> 1) ^ -(INTVAL)((u) & 1))
+
+/* images streamed to a handle are written in chunks of at most this many
+ * bytes, each preceded by its varint length; a 0 length ends the image */
+#define IMAGE_CHUNK_BYTES           65536
+
 enum {
     enum_PackID_normal     = 0,
     enum_PackID_seen       = 1
@@ -57,6 +57,7 @@ typedef enum {
     PARROT_SLOW_CORE,                       /* slow bounds/trace/profile core */
     PARROT_FUNCTION_CORE    = PARROT_SLOW_CORE,
     PARROT_FAST_CORE        = 0x01,         /* fast DO_OP core */
+    PARROT_CGOTO_CORE       = 0x02,         /* computed goto core */
     PARROT_EXEC_CORE        = 0x20,         /* TODO Parrot_exec_run variants */
     PARROT_GC_DEBUG_CORE    = 0x40,         /* run GC before each op */
     PARROT_DEBUGGER_CORE    = 0x80,         /* used by parrot debugger */
@@ -159,11 +160,22 @@ typedef struct _context_mem {
     int n_free_slots;               /* amount of allocated */
 } context_mem;
 
+struct _frame_chunk;    /* in src/call/context.c */
+
+typedef struct _frame_stack {
+    struct _frame_chunk *chunk;     /* chunk holding the topmost frame */
+    struct _frame_chunk *spare;     /* emptied chunk kept for reuse */
+    UINTVAL height;                 /* bytes of frames currently pushed */
+    UINTVAL floor;                  /* frames below belong to an outer runloop */
+} frame_stack;
+
 struct _handler_node_t; /* forward def - exit.h */
 
 /* The actual interpreter structure */
 struct parrot_interp_t {
     PMC           *ctx;                       /* current Context */
+    frame_stack    frames;                    /* registers of non-escaping
+                                               * contexts, popped LIFO */
 
     struct Memory_Pools *mem_pools;                /* Pointer to this interpreter's
                                                * arena */
@@ -172,6 +184,14 @@ struct parrot_interp_t {
                                                   to current GC subsystem*/
     UINTVAL gc_threshold;                     /* maximum percentage of memory
                                                  wasted by GC */
+    UINTVAL gc_nursery_size;                  /* size of young generation in
+                                                 KB, 0 if not generational */
+    UINTVAL gc_max_pause_us;                  /* time budget of incremental
+                                                 GC step, 0 if not incremental */
+    UINTVAL gc_mark_threads;                  /* threads marking in parallel,
+                                                 0 or 1 if not parallel */
+    UINTVAL gc_alloc_threshold;               /* KB allocated between ms2
+                                                 collections, 0 for default */
 
     PMC *gc_registry;                         /* root set of registered PMCs */
 
@@ -203,6 +223,8 @@ struct parrot_interp_t {
 
     PackFile_ByteCode *code;                  /* The code we are executing */
     struct PackFile          *initial_pf;     /* first created PF  */
+    struct PackFile          *snapshot_pf;    /* PFs restored from a snapshot */
+    struct PackFile_Mapping  *pf_mappings;    /* kept for in-place strings */
 
     struct _imc_info_t *imc_info;             /* imcc data */
     Hash               *op_hash;              /* mapping from op names to op_info_t */
@@ -223,6 +245,7 @@ struct parrot_interp_t {
     INTVAL world_inited;                      /* world_init_once() is done */
 
     UINTVAL hash_seed;                        /* STRING hash seed */
+    INTVAL  hash_siphash;                     /* STRING hash uses SipHash */
 
     PMC *iglobals;                      /* FixedPMCArray of PMCs, containing: */
     /* 0:   PMC *Parrot_base_classname_hash; hash containing name->base_type */
@@ -249,6 +272,7 @@ struct parrot_interp_t {
 
     STRING     **const_cstring_table;         /* CONST_STRING(x) items */
     Hash        *const_cstring_hash;          /* cache of const_string items */
+    Hash        *str_index_table;             /* codepoint indexes of UTF-8 strings */
 
     struct QUEUE* task_queue;                 /* per interpreter queue */
     struct _handler_node_t *exit_handler_list;/* exit.c */
@@ -74,6 +74,7 @@
 #define PIO_LINEBUFSIZE 256     /* Default linebuffer size */
 #define PIO_GRAIN 2048          /* Smallest size for a block buffer */
 #define PIO_BUFSIZE (PIO_GRAIN * 2)
+#define PIO_RECVSIZE (PIO_BUFSIZE * 16) /* Default size of a socket's receive buffer */
 
 #define PIO_NR_OPEN 256         /* Size of an "IO handle table" */
 
@@ -852,6 +853,17 @@ INTVAL Parrot_io_recv(PARROT_INTERP, ARGMOD(PMC *pmc), ARGOUT(STRING **buf))
         FUNC_MODIFIES(*pmc)
         FUNC_MODIFIES(*buf);
 
+PARROT_EXPORT
+INTVAL Parrot_io_recv_into(PARROT_INTERP,
+    ARGMOD(PMC *pmc),
+    ARGMOD(PMC *buffer),
+    INTVAL length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pmc)
+        FUNC_MODIFIES(*buffer);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_io_send(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(STRING *buf))
@@ -861,6 +873,27 @@ INTVAL Parrot_io_send(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(STRING *buf))
         FUNC_MODIFIES(*pmc)
         FUNC_MODIFIES(*buf);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_io_sendfile(PARROT_INTERP,
+    ARGMOD(PMC *pmc),
+    ARGMOD(PMC *file),
+    PIOOFF_T offset,
+    INTVAL length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pmc)
+        FUNC_MODIFIES(*file);
+
+PARROT_EXPORT
+INTVAL Parrot_io_set_blocking(PARROT_INTERP,
+    ARGMOD(PMC *pmc),
+    INTVAL blocking)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
@@ -880,6 +913,22 @@ INTVAL Parrot_io_socket_is_closed(ARGMOD(PMC *socket))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*socket);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_io_writev(PARROT_INTERP,
+    ARGMOD(PMC *pmc),
+    ARGIN(PMC *strings))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pmc);
+
+PARROT_CANNOT_RETURN_NULL
+char * Parrot_io_socket_recv_buffer(PARROT_INTERP, ARGMOD(PMC *socket))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*socket);
+
 #define ASSERT_ARGS_Parrot_io_accept __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
@@ -903,17 +952,121 @@ INTVAL Parrot_io_socket_is_closed(ARGMOD(PMC *socket))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
     , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_Parrot_io_recv_into __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(buffer))
 #define ASSERT_ARGS_Parrot_io_send __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
     , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_Parrot_io_sendfile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_Parrot_io_set_blocking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_io_socket __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_io_socket_is_closed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(socket))
+#define ASSERT_ARGS_Parrot_io_writev __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(strings))
+#define ASSERT_ARGS_Parrot_io_socket_recv_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(socket))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/io/socket_api.c */
 
+/* HEADERIZER BEGIN: src/io/reactor.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_io_accept_async(PARROT_INTERP,
+    ARGMOD(PMC *socket),
+    ARGIN_NULLOK(PMC *callback))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*socket);
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_io_read_async(PARROT_INTERP,
+    ARGMOD(PMC *handle),
+    INTVAL length,
+    ARGIN_NULLOK(PMC *callback))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*handle);
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_io_write_async(PARROT_INTERP,
+    ARGMOD(PMC *handle),
+    ARGIN(STRING *s),
+    ARGIN_NULLOK(PMC *callback))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*handle);
+
+void Parrot_io_reactor_add(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    ARGMOD(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*scheduler)
+        FUNC_MODIFIES(*task);
+
+void Parrot_io_reactor_close(PARROT_INTERP, ARGMOD(PMC *scheduler))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_io_reactor_pending(SHIM_INTERP, ARGIN(PMC *scheduler))
+        __attribute__nonnull__(2);
+
+INTVAL Parrot_io_reactor_poll(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    FLOATVAL timeout)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+#define ASSERT_ARGS_Parrot_io_accept_async __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(socket))
+#define ASSERT_ARGS_Parrot_io_read_async __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle))
+#define ASSERT_ARGS_Parrot_io_write_async __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_Parrot_io_reactor_add __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler) \
+    , PARROT_ASSERT_ARG(task))
+#define ASSERT_ARGS_Parrot_io_reactor_close __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_Parrot_io_reactor_pending __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_Parrot_io_reactor_poll __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/io/reactor.c */
+
 /*
  * pioctl argument constants. These don't have to
  * be unique across io commands.
@@ -208,6 +208,15 @@ INTVAL Parrot_io_poll_unix(SHIM_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*socket);
 
+INTVAL Parrot_io_recv_bytes_unix(SHIM_INTERP,
+    ARGMOD(PMC *socket),
+    ARGOUT(char *buf),
+    INTVAL len)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*socket)
+        FUNC_MODIFIES(*buf);
+
 INTVAL Parrot_io_recv_unix(PARROT_INTERP,
     ARGMOD(PMC *socket),
     ARGOUT(STRING **s))
@@ -225,6 +234,23 @@ INTVAL Parrot_io_send_unix(SHIM_INTERP,
         FUNC_MODIFIES(*socket)
         FUNC_MODIFIES(*s);
 
+INTVAL Parrot_io_sendfile_unix(PARROT_INTERP,
+    ARGMOD(PMC *socket),
+    ARGMOD(PMC *file),
+    PIOOFF_T offset,
+    INTVAL length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*socket)
+        FUNC_MODIFIES(*file);
+
+INTVAL Parrot_io_set_blocking_unix(SHIM_INTERP,
+    ARGMOD(PMC *socket),
+    INTVAL blocking)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*socket);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_io_sockaddr_in(PARROT_INTERP, ARGIN(STRING *addr), INTVAL port)
@@ -241,6 +267,14 @@ INTVAL Parrot_io_socket_unix(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+INTVAL Parrot_io_writev_unix(PARROT_INTERP,
+    ARGMOD(PMC *socket),
+    ARGIN(PMC *strings))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*socket);
+
 #define ASSERT_ARGS_Parrot_io_accept_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(socket))
@@ -256,6 +290,9 @@ INTVAL Parrot_io_socket_unix(PARROT_INTERP,
        PARROT_ASSERT_ARG(socket))
 #define ASSERT_ARGS_Parrot_io_poll_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(socket))
+#define ASSERT_ARGS_Parrot_io_recv_bytes_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(socket) \
+    , PARROT_ASSERT_ARG(buf))
 #define ASSERT_ARGS_Parrot_io_recv_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(socket) \
@@ -263,12 +300,22 @@ INTVAL Parrot_io_socket_unix(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_io_send_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(socket) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_Parrot_io_sendfile_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(socket) \
+    , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_Parrot_io_set_blocking_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(socket))
 #define ASSERT_ARGS_Parrot_io_sockaddr_in __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(addr))
 #define ASSERT_ARGS_Parrot_io_socket_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_Parrot_io_writev_unix __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(socket) \
+    , PARROT_ASSERT_ARG(strings))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/io/socket_unix.c */
 
@@ -303,6 +350,14 @@ INTVAL Parrot_io_socket_unix(PARROT_INTERP,
     Parrot_io_recv_unix((interp), (pmc), (buf))
 #define PIO_SEND(interp, pmc, buf) \
     Parrot_io_send_unix((interp), (pmc), (buf))
+#define PIO_RECV_BYTES(interp, pmc, buf, len) \
+    Parrot_io_recv_bytes_unix((interp), (pmc), (buf), (len))
+#define PIO_WRITEV(interp, pmc, strings) \
+    Parrot_io_writev_unix((interp), (pmc), (strings))
+#define PIO_SET_BLOCKING(interp, pmc, blocking) \
+    Parrot_io_set_blocking_unix((interp), (pmc), (blocking))
+#define PIO_SENDFILE(interp, pmc, file, offset, length) \
+    Parrot_io_sendfile_unix((interp), (pmc), (file), (offset), (length))
 #define PIO_CONNECT(interp, pmc, address) \
     Parrot_io_connect_unix((interp), (pmc), (address))
 #define PIO_BIND(interp, pmc, address) \
@@ -45,6 +45,12 @@ struct longopt_opt_info {
 #define OPT_RUNTIME_PREFIX 132
 #define OPT_HASH_SEED      133
 #define OPT_GC_THRESHOLD   134
+#define OPT_GC_NURSERY     135
+#define OPT_GC_MAX_PAUSE   136
+#define OPT_GC_MARK_THREADS 137
+#define OPT_HASH_SIPHASH   138
+#define OPT_SNAPSHOT       139
+#define OPT_GC_ALLOC_THRESHOLD 140
 
 /* HEADERIZER BEGIN: src/longopt.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
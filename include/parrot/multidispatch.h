@@ -53,7 +53,24 @@ typedef struct _multi_func_list {
     funcptr_t func_ptr;
 } multi_func_list;
 
-#define MMD_Cache Hash
+/* Type tuples with more arguments than this are not cached. */
+#define MMD_CACHE_MAX_ARGS 4
+
+typedef struct _mmd_cache_entry {
+    PMC        *chosen;                     /* the candidate, NULL if unused */
+    char       *name;                       /* multi name, NULL if the cache
+                                               belongs to a single MultiSub */
+    UINTVAL     hashval;
+    INTVAL      num_types;
+    INTVAL      types[MMD_CACHE_MAX_ARGS];  /* argument type ids */
+} MMD_Cache_entry;
+
+/* open addressed by the hash of name and type ids, no allocation on lookup */
+typedef struct _mmd_cache {
+    MMD_Cache_entry *entries;
+    UINTVAL          mask;                  /* number of entries - 1 */
+    UINTVAL          count;                 /* entries in use */
+} MMD_Cache;
 
 /* HEADERIZER BEGIN: src/multidispatch.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -106,16 +123,27 @@ void Parrot_mmd_cache_destroy(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*cache);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_mmd_cache_lookup_by_sig_obj(PARROT_INTERP,
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(PMC *sig_obj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*cache);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC * Parrot_mmd_cache_lookup_by_types(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *types))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*cache);
 
@@ -124,11 +152,10 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC * Parrot_mmd_cache_lookup_by_values(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *values))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*cache);
 
@@ -138,15 +165,26 @@ void Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*cache);
 
+PARROT_EXPORT
+void Parrot_mmd_cache_store_by_sig_obj(PARROT_INTERP,
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(PMC *sig_obj),
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*cache);
+
 PARROT_EXPORT
 void Parrot_mmd_cache_store_by_types(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *types),
     ARGIN(PMC *chosen))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*cache);
@@ -154,12 +192,11 @@ void Parrot_mmd_cache_store_by_types(PARROT_INTERP,
 PARROT_EXPORT
 void Parrot_mmd_cache_store_by_values(PARROT_INTERP,
     ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name),
+    ARGIN_NULLOK(const char *name),
     ARGIN(PMC *values),
     ARGIN(PMC *chosen))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
         __attribute__nonnull__(4)
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*cache);
@@ -230,33 +267,40 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_mmd_cache_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_sig_obj \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(sig_obj))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_Parrot_mmd_cache_lookup_by_values \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values))
 #define ASSERT_ARGS_Parrot_mmd_cache_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache))
+#define ASSERT_ARGS_Parrot_mmd_cache_store_by_sig_obj \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(sig_obj) \
+    , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_cache_store_by_types \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(types) \
     , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_cache_store_by_values \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cache) \
-    , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values) \
     , PARROT_ASSERT_ARG(chosen))
 #define ASSERT_ARGS_Parrot_mmd_find_multi_from_long_sig \
@@ -0,0 +1,41 @@
+
+#ifndef PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+#define PARROT_OPLIB_CORE_OPS_CG_H_GUARD
+
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/parrot.h"
+#include "parrot/oplib.h"
+#include "parrot/runcore_api.h"
+
+PARROT_EXPORT
+op_lib_t *Parrot_DynOp_core_cg_2_10_1(PARROT_INTERP, long init);
+
+
+#include "parrot/oplib/core_ops.h"
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+opcode_t * cg_core(opcode_t *cur_opcode, PARROT_INTERP);
+#endif
+
+
+#endif /* PARROT_OPLIB_CORE_OPS_CG_H_GUARD */
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
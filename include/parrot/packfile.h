@@ -64,6 +64,8 @@
 #  define PFOPT_VALUE 16
 #endif
 #define PFOPT_PMC_FREEZE_ONLY 32
+/* restored from a snapshot, which supplies the PMC constants thawed */
+#define PFOPT_SNAPSHOT 64
 
 #if TRACE_PACKFILE
 /* Here we pass multipe args to a macro so the args may not be bracketed here! */
@@ -227,6 +229,7 @@ typedef struct PackFile_ConstTable {
     struct {
         opcode_t        const_count;
         PMC           **constants;
+        const opcode_t **frozen; /* images of PMCs not thawed yet, or NULL */
     } pmc;
     PackFile_ByteCode  *code;  /* where this segment belongs to */
     Hash               *string_hash; /* Hash for lookup strings and numbers */
@@ -254,6 +257,8 @@ struct PackFile_ByteCode {
     op_func_t                    *op_func_table;   /* opcode dispatch table */
     op_func_t                    *save_func_table; /* for when we hijack op_func_table */
     op_info_t                   **op_info_table;
+    void                        **op_addr_table;   /* op labels for the computed goto core */
+    size_t                        op_addr_count;   /* number of ops in op_addr_table */
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
 };
@@ -341,6 +346,20 @@ typedef struct PackFile {
     packfile_fetch_nv_t  fetch_nv;
 } PackFile;
 
+/* The mapping of a destroyed in-place packfile. Its constant strings may
+ * outlive it, so the main interpreter unmaps it only on its way out. */
+typedef struct PackFile_Mapping {
+    struct PackFile_Mapping *next;
+    void                    *src;
+    size_t                   size;
+} PackFile_Mapping;
+
+/* A native packfile mapped by Parrot_pbc_read matches this Parrot in
+ * wordsize, byte order and float type: its segments, strings and frozen
+ * constants are used in place from the read-only mapping. */
+#define PF_IN_PLACE(pf) ((pf)->is_mmap_ped && !(pf)->need_endianize \
+    && !(pf)->need_wordsize && !(pf)->fetch_nv)
+
 
 typedef enum {
     PBC_MAIN   = 1,
@@ -483,6 +502,14 @@ void PackFile_ConstTable_clear(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*self);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC * PackFile_ConstTable_get_pmc(PARROT_INTERP,
+    ARGIN(const PackFile_ConstTable *self),
+    opcode_t idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -731,7 +758,7 @@ size_t PackFile_Annotations_packed_size(SHIM_INTERP,
     ARGIN(PackFile_Segment *seg))
         __attribute__nonnull__(2);
 
-PARROT_CANNOT_RETURN_NULL
+PARROT_CAN_RETURN_NULL
 const opcode_t * PackFile_Annotations_unpack(PARROT_INTERP,
     ARGMOD(PackFile_Segment *seg),
     ARGIN(const opcode_t *cursor))
@@ -740,6 +767,9 @@ const opcode_t * PackFile_Annotations_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*seg);
 
+void Parrot_destroy_mappings(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 void Parrot_trace_eprintf(ARGIN(const char *s), ...)
         __attribute__nonnull__(1);
 
@@ -763,6 +793,9 @@ void Parrot_trace_eprintf(ARGIN(const char *s), ...)
 #define ASSERT_ARGS_PackFile_ConstTable_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_PackFile_ConstTable_get_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_PackFile_ConstTable_unpack __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg) \
@@ -865,6 +898,8 @@ void Parrot_trace_eprintf(ARGIN(const char *s), ...)
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_Parrot_destroy_mappings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_trace_eprintf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -171,6 +171,9 @@ typedef enum PObj_enum {
     PObj_custom_destroy_FLAG    = POBJ_FLAG(22),
     /* For debugging, report when this buffer gets moved around */
     PObj_report_FLAG            = POBJ_FLAG(23),
+    /* Set by a generational GC on old objects whose next write must be
+     * recorded by PARROT_GC_WRITE_BARRIER */
+    PObj_GC_need_write_barrier_FLAG = POBJ_FLAG(24),
 
 /* PMC specific FLAGs */
     /* call object finalizer */
@@ -248,6 +251,10 @@ typedef enum PObj_enum {
 #define PObj_live_SET(o) gc_flag_SET(live, o)
 #define PObj_live_CLEAR(o) gc_flag_CLEAR(live, o)
 
+#define PObj_GC_need_write_barrier_TEST(o) PObj_flag_TEST(GC_need_write_barrier, o)
+#define PObj_GC_need_write_barrier_SET(o) PObj_flag_SET(GC_need_write_barrier, o)
+#define PObj_GC_need_write_barrier_CLEAR(o) PObj_flag_CLEAR(GC_need_write_barrier, o)
+
 #define PObj_is_string_TEST(o) PObj_flag_TEST(is_string, o)
 #define PObj_is_string_SET(o) PObj_flag_SET(is_string, o)
 #define PObj_is_string_CLEAR(o) PObj_flag_CLEAR(is_string, o)
@@ -59,6 +59,19 @@ do {                                                                \
     }                                                               \
 } while (0);
 
+/* Same for a single chunk of array */
+#define POINTER_ARRAY_CHUNK_ITER(_chunk, _code)                     \
+do {                                                                \
+    size_t _j;                                                      \
+    for (_j = 0; _j < CELL_PER_CHUNK - (_chunk)->num_free; _j++) {  \
+        void *ptr = (_chunk)->data[_j];                             \
+        if ((UINTVAL)(ptr) & 1)                                     \
+            continue;                                               \
+                                                                    \
+        { _code }                                                   \
+    }                                                               \
+} while (0);
+
 /* HEADERIZER BEGIN: src/pointer_array.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
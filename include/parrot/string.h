@@ -74,6 +74,16 @@
 
 typedef struct parrot_string_t STRING;
 
+/* Set on strings with an entry in interp->str_index_table */
+#define PObj_str_indexed_FLAG PObj_private0_FLAG
+
+/* Drops the codepoint index of a STRING that dies or changes */
+#define Parrot_str_forget_index(interp, s) \
+    do { \
+        if (PObj_is_string_TEST(s) && PObj_flag_TEST(str_indexed, (s))) \
+            Parrot_str_drop_index((interp), (STRING *)(s)); \
+    } while (0)
+
 /* String iterator */
 typedef struct string_iterator_t {
     UINTVAL bytepos;
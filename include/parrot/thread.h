@@ -99,6 +99,9 @@ typedef struct _Thread_data {
 
     /* COW'd constant tables */
     Hash             *const_tables;
+
+    /* last quiescent state: holds no shared PMC retired after this epoch */
+    UINTVAL           shared_epoch;
 } Thread_data;
 
 #  define LOCK_INTERPRETER(interp) \
@@ -144,6 +147,36 @@ typedef struct _Shared_gc_info {
 /* TODO use thread pools instead */
 VAR_SCOPE Shared_gc_info *shared_gc_info;
 
+/*
+ * read-copy-update publication of shared PMCs, see Parrot_shared_publish
+ */
+typedef struct _Shared_pin {
+    PMC    *pmc;
+    int     made_ro;        /* switched to the read-only vtable on publish */
+} Shared_pin;
+
+typedef struct _Shared_version {
+    PMC    *pmc;
+    UINTVAL epoch;          /* retired in this epoch */
+} Shared_version;
+
+typedef struct _Shared_rcu_info {
+    UINTVAL         epoch;          /* bumped by every retirement */
+    UINTVAL         reclaimed;      /* versions retired up to here are gone */
+    PMC           **roots;          /* published for good */
+    size_t          root_count;
+    size_t          root_size;
+    Shared_version *retired;        /* waiting for their grace period */
+    size_t          retired_count;
+    size_t          retired_size;
+    Shared_pin     *pins;           /* every published PMC */
+    size_t          pin_count;
+    size_t          pin_size;
+} Shared_rcu_info;
+
+/* lives in the main interpreter, epochs are guarded by interpreter_array_mutex */
+VAR_SCOPE Shared_rcu_info *shared_rcu_info;
+
 /* HEADERIZER BEGIN: src/thread.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -155,6 +188,25 @@ PARROT_EXPORT
 void Parrot_shared_gc_unblock(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+void Parrot_shared_publish(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+void Parrot_shared_publish_version(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+void Parrot_shared_quiescent(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_shared_retire(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -235,6 +287,17 @@ PMC * pt_transfer_sub(
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_shared_gc_unblock __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_shared_publish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_shared_publish_version __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_shared_quiescent __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_shared_retire __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_pt_thread_create __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_pt_add_to_interpreters __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -106,6 +106,7 @@ External Library Options:
 
    --without-gettext    Build parrot without gettext support
    --without-gmp        Build parrot without GMP support
+   --without-io-uring   Build parrot without io_uring for asynchronous file I/O
    --without-libffi     Build parrot without libffi support
    --without-opengl     Build parrot without OpenGL support (GL/GLU/GLUT)
    --without-readline   Build parrot without readline support
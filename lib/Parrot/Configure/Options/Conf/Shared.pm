@@ -78,6 +78,7 @@ our @shared_valid_options = qw{
     without-gettext
     without-gmp
     without-icu
+    without-io-uring
     without-opengl
     without-libffi
     without-readline
@@ -408,10 +408,12 @@ This is to exclude automatically generated C-language files Parrot might have.
             include/parrot/config.h
             include/parrot/has_header.h
             include/parrot/oplib/core_ops.h
+            include/parrot/oplib/core_ops_cg.h
             include/parrot/oplib/ops.h
             include/parrot/opsenum.h
             src/gc/malloc.c
             src/ops/core_ops.c
+            src/ops/core_ops_cg.c
             } unless @exemptions;
 
         my $path = -f $file ? $file : $file->path;
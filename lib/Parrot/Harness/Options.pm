@@ -90,6 +90,7 @@ sub remap_runcore_opts
         'G' => '-runcore=gcdebug',
         'b' => '-runcore=bounds',
         'f' => '-runcore=fast',
+        'g' => '-runcore=cgoto',
         'r' => '-run-pbc',
     );
 
@@ -112,6 +113,7 @@ perl t/harness [options] [testfiles]
     -b         ... run bounds checked
     --run-exec ... run exec core
     -f         ... run fast core
+    -g         ... run computed goto core
     -j         ... run fast core
     -r         ... run the compiled pbc
     -v         ... run parrot with -v : This is NOT the same as prove -v
@@ -243,10 +243,15 @@ EOA
 EOA
     }
 
+    my $barrier = $attrtype =~ $isptrtopmc || $attrtype =~ $isptrtostring
+                ? "\n            PARROT_GC_WRITE_BARRIER(interp, pmc); \\"
+                : '';
+
     $decl .= <<"EOA";
         } \\
-        else \\
+        else { \\$barrier
             ((Parrot_${pmcname}_attributes *)PMC_data(pmc))->$attrname = (value); \\
+        } \\
     } while (0)
 
 EOA
@@ -48,7 +48,18 @@ sub generate_body {
 
     $emit->( $self->decl( $pmc, 'CFILE' ) );
     $emit->("{\n");
-    $emit->($body);
+
+    if ( $self->needs_write_barrier($pmc) ) {
+        # In a block of its own, so that the body can still declare
+        # variables first
+        $emit->("    PARROT_GC_WRITE_BARRIER(interp, _self);\n    {\n");
+        $emit->($body);
+        $emit->("    }\n");
+    }
+    else {
+        $emit->($body);
+    }
+
     $emit->("}\n");
 
     if ( $self->mmds ) {
@@ -60,6 +71,28 @@ sub generate_body {
     return 1;
 }
 
+=item C<needs_write_barrier($pmc)>
+
+Returns true if the method may store pointers into SELF, so that a
+generational GC needs to know about it.  That is every vtable function
+declared as writing, the ones creating properties or changing state on
+invocation, and every MULTI.  METHODs get theirs from C<rewrite_pccmethod>.
+
+=cut
+
+sub needs_write_barrier {
+    my ( $self, $pmc ) = @_;
+
+    return 0 if $self->pmc_unused;
+    # METHODs emit their own after fetching the invocant
+    return 0 if $self->{PCCMETHOD};
+    return 1 unless $self->is_vtable;
+
+    my $name = $self->name;
+    return 1 if $name =~ /^(?:setprop|delprop|getprops|invoke)$/;
+    return $pmc->vtable_method_does_write($name);
+}
+
 sub generate_headers {
     my ( $self, $pmc ) = @_;
 
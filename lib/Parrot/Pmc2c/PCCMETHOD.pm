@@ -427,6 +427,12 @@ END
             $params_varargs);
 END
     }
+
+    # The invocant is known only now, so the write barrier of a METHOD
+    # can't be emitted with the other ones in MethodEmitter.
+    $e->emit( <<'END', __FILE__, __LINE__ + 1 );
+    PARROT_GC_WRITE_BARRIER(interp, _self);
+END
     $e->emit( <<'END', __FILE__, __LINE__ + 1 );
     { /* BEGIN PMETHOD BODY */
 END
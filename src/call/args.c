@@ -20,9 +20,11 @@ passing to and from subroutines following the Parrot Calling Conventions.
 
 #include "parrot/parrot.h"
 #include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
 #include "args.str"
 #include "pmc/pmc_key.h"
 #include "pmc/pmc_fixedintegerarray.h"
+#include "pmc/pmc_sub.h"
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -54,6 +56,15 @@ typedef struct pcc_funcs_ptr {
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL args_use_pmc_register(PARROT_INTERP,
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_args),
+    opcode_t reg)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void assign_default_param_value(PARROT_INTERP,
     INTVAL param_index,
     INTVAL param_flags,
@@ -156,6 +167,14 @@ static FLOATVAL* numval_param_from_op(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL params_match_directly(PARROT_INTERP,
+    ARGIN(const Parrot_Sub_attributes *sub),
+    ARGIN(PMC *raw_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void parse_signature_string(PARROT_INTERP,
     ARGIN(const char *signature),
     ARGMOD(PMC **arg_flags))
@@ -222,6 +241,10 @@ static STRING** string_param_from_op(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_args_use_pmc_register __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args))
 #define ASSERT_ARGS_assign_default_param_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(arg_info) \
@@ -261,6 +284,10 @@ static STRING** string_param_from_op(PARROT_INTERP,
 #define ASSERT_ARGS_numval_param_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_params_match_directly __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub) \
+    , PARROT_ASSERT_ARG(raw_sig))
 #define ASSERT_ARGS_parse_signature_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(signature) \
@@ -403,6 +430,245 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
 
 /*
 
+=item C<PMC* Parrot_pcc_build_direct_call_from_op(PARROT_INTERP, PMC *raw_sig,
+opcode_t *raw_args)>
+
+Check whether a set_args opcode feeds straight into an C<invokecc> (possibly
+preceded by loading the Sub constant it invokes) of a plain Sub whose
+parameters take the arguments one to one, with the same types and no flags.
+If so, return a CallContext that leaves the arguments where they are;
+C<Parrot_pcc_fill_params_direct> later copies them register to register into
+the new frame.  Otherwise return PMCNULL, and the arguments have to be
+marshalled with C<Parrot_pcc_build_sig_object_from_op>.
+
+The arguments are read from their registers only once the Sub is invoked, so
+a Sub constant loaded into one of the argument registers rules the shortcut
+out.
+
+The outcome of the check is cached in the Sub, keyed by the signature of the
+call site.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC*
+Parrot_pcc_build_direct_call_from_op(PARROT_INTERP, ARGIN(PMC *raw_sig),
+        ARGIN(opcode_t *raw_args))
+{
+    ASSERT_ARGS(Parrot_pcc_build_direct_call_from_op)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PMC            *call_object;
+    PMC            *sub_pmc;
+    Parrot_Sub_attributes *sub;
+    opcode_t       *next;
+    INTVAL          arg_count;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    next = raw_args + arg_count + 2;
+
+    /* IMCC loads a Sub of the same compilation unit as a constant
+     * in between: set_p_pc Px, sub; invokecc_p Px */
+    if (OPCODE_IS(interp, interp->code, *next, core_ops, PARROT_OP_set_p_pc)
+    &&  OPCODE_IS(interp, interp->code, next[3], core_ops, PARROT_OP_invokecc_p)
+    &&  next[1] == next[4]) {
+        if (args_use_pmc_register(interp, raw_sig, raw_args, next[1]))
+            return PMCNULL;
+
+        sub_pmc = Parrot_pcc_get_pmc_constant(interp, CURRENT_CONTEXT(interp), next[2]);
+    }
+    else if (OPCODE_IS(interp, interp->code, *next, core_ops, PARROT_OP_invokecc_p))
+        sub_pmc = CTX_REG_PMC(CURRENT_CONTEXT(interp), next[1]);
+    else
+        return PMCNULL;
+
+    if (PMC_IS_NULL(sub_pmc) || sub_pmc->vtable->base_type != enum_class_Sub)
+        return PMCNULL;
+
+    sub = PARROT_SUB(sub_pmc);
+
+    if (sub->direct_args_sig != raw_sig) {
+        PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
+        sub->direct_args_sig = raw_sig;
+        sub->direct_args_ok  = params_match_directly(interp, sub, raw_sig);
+    }
+
+    if (!sub->direct_args_ok)
+        return PMCNULL;
+
+    call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+    SETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+    SETATTR_CallContext_direct_args(interp, call_object, raw_args);
+
+    return call_object;
+}
+
+/*
+
+=item C<static INTVAL args_use_pmc_register(PARROT_INTERP, PMC *raw_sig, const
+opcode_t *raw_args, opcode_t reg)>
+
+Returns true if one of the arguments of a set_args opcode is the PMC register
+C<reg>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+args_use_pmc_register(PARROT_INTERP, ARGIN(PMC *raw_sig),
+        ARGIN(const opcode_t *raw_args), opcode_t reg)
+{
+    ASSERT_ARGS(args_use_pmc_register)
+    INTVAL *arg_flags;
+    INTVAL  arg_count, i;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, arg_flags);
+
+    for (i = 0; i < arg_count; ++i) {
+        if (PARROT_ARG_TYPE_MASK_MASK(arg_flags[i]) == PARROT_ARG_PMC
+        &&  !PARROT_ARG_CONSTANT_ISSET(arg_flags[i])
+        &&  raw_args[i + 2] == reg)
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static INTVAL params_match_directly(PARROT_INTERP, const
+Parrot_Sub_attributes *sub, PMC *raw_sig)>
+
+Returns true if the Sub starts with a get_params opcode whose parameters
+are plain, required positionals matching the arguments of C<raw_sig> one to
+one in number and type.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+params_match_directly(PARROT_INTERP, ARGIN(const Parrot_Sub_attributes *sub),
+        ARGIN(PMC *raw_sig))
+{
+    ASSERT_ARGS(params_match_directly)
+    const opcode_t * const pc = sub->seg->base.data + sub->start_offs;
+    PMC            *param_sig;
+    INTVAL         *arg_flags;
+    INTVAL         *param_flags;
+    INTVAL          arg_count, param_count, i;
+
+    if (!OPCODE_IS(interp, sub->seg, *pc, PARROT_GET_CORE_OPLIB(interp),
+            PARROT_OP_get_params_pc))
+        return 0;
+
+    param_sig = PackFile_ConstTable_get_pmc(interp, sub->seg->const_table, pc[1]);
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    GETATTR_FixedIntegerArray_size(interp, param_sig, param_count);
+
+    if (arg_count != param_count)
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, arg_flags);
+    GETATTR_FixedIntegerArray_int_array(interp, param_sig, param_flags);
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL type = PARROT_ARG_TYPE_MASK_MASK(arg_flags[i]);
+
+        if ((arg_flags[i] & ~(PARROT_ARG_TYPE_MASK | PARROT_ARG_CONSTANT))
+        ||   param_flags[i] != type)
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<opcode_t* Parrot_pcc_fill_params_direct(PARROT_INTERP, PMC *call_object,
+PMC *caller_ctx, opcode_t *pc)>
+
+If C<call_object> came from C<Parrot_pcc_build_direct_call_from_op>, copy the
+arguments from the registers and constants of C<caller_ctx> straight into the
+parameter registers named by the get_params opcode at C<pc>, and return the
+address of the opcode following it.  Otherwise return C<pc> unchanged.  The
+registers of C<call_object> must have been allocated already.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+opcode_t*
+Parrot_pcc_fill_params_direct(PARROT_INTERP, ARGIN(PMC *call_object),
+        ARGIN(PMC *caller_ctx), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_pcc_fill_params_direct)
+    opcode_t *raw_args;
+    PMC      *raw_sig;
+    INTVAL   *int_array;
+    INTVAL    arg_count, arg_index;
+
+    GETATTR_CallContext_direct_args(interp, call_object, raw_args);
+
+    if (!raw_args)
+        return pc;
+
+    SETATTR_CallContext_direct_args(interp, call_object, NULL);
+    GETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+
+    for (arg_index = 0; arg_index < arg_count; ++arg_index) {
+        const INTVAL   arg_flags = int_array[arg_index];
+        const INTVAL   constant  = PARROT_ARG_CONSTANT_ISSET(arg_flags);
+        const opcode_t raw_index = raw_args[arg_index + 2];
+        const opcode_t reg_index = pc[arg_index + 2];
+
+        switch (PARROT_ARG_TYPE_MASK_MASK(arg_flags)) {
+          case PARROT_ARG_INTVAL:
+            CTX_REG_INT(call_object, reg_index) = constant
+                ? raw_index
+                : CTX_REG_INT(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_FLOATVAL:
+            CTX_REG_NUM(call_object, reg_index) = constant
+                ? Parrot_pcc_get_num_constant(interp, caller_ctx, raw_index)
+                : CTX_REG_NUM(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_STRING:
+            CTX_REG_STR(call_object, reg_index) = constant
+                ? Parrot_pcc_get_string_constant(interp, caller_ctx, raw_index)
+                : CTX_REG_STR(caller_ctx, raw_index);
+            break;
+          case PARROT_ARG_PMC:
+          default:
+            {
+                PMC * const pmc_value = constant
+                    ? Parrot_pcc_get_pmc_constant(interp, caller_ctx, raw_index)
+                    : CTX_REG_PMC(caller_ctx, raw_index);
+
+                CTX_REG_PMC(call_object, reg_index) = PMC_IS_NULL(pmc_value)
+                    ? PMCNULL
+                    : clone_key_arg(interp, pmc_value);
+                break;
+            }
+        }
+    }
+
+    return pc + arg_count + 2;
+}
+
+/*
+
 =item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *call_object,
 STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
 
@@ -61,6 +61,54 @@ an available context is stored corresponds to the size of the context.
         / SLOT_CHUNK_SIZE) * SLOT_CHUNK_SIZE)
 #define CALCULATE_SLOT_NUM(size) ((size) / SLOT_CHUNK_SIZE)
 
+/*
+
+=head2 Frame stack
+
+Every context entered by a call pushes a frame onto a contiguous, chunked
+stack owned by the interpreter.  The frame starts with a C<Frame_header>
+naming the context, followed by its registers unless they live on the heap
+(contexts of lexical scopes and coroutines):
+
+    chunk: | hdr | regs | hdr | hdr | regs | ... | free ... |
+                                                 ^
+                                                 chunk->top
+
+A context records the stack height after its frame in C<frame_mark>.  When
+control returns to it while its frame is still pushed, everything above that
+mark is popped.  Contexts of popped frames lose their stack registers;
+those marked as escaped (captured by a continuation, closure or
+introspection) have their registers moved to the heap instead, so they stay
+valid for as long as the context PMC lives.
+
+=cut
+
+*/
+
+typedef struct _frame_chunk {
+    struct _frame_chunk *prev;      /* chunk below this one */
+    UINTVAL              base;      /* stack height at the first frame */
+    char                *top;       /* first free byte */
+    char                *limit;     /* end of the chunk */
+} Frame_chunk;
+
+typedef struct _frame_header {
+    PMC    *ctx;                    /* owning context, NULL once disowned */
+    size_t  size;                   /* size of the frame including header */
+} Frame_header;
+
+#define FRAME_CHUNK_SIZE (64 * 1024)
+
+#define ALIGNED_CHUNK_HEADER_SIZE ROUND_ALLOC_SIZE(sizeof (Frame_chunk))
+#define ALIGNED_FRAME_HEADER_SIZE ROUND_ALLOC_SIZE(sizeof (Frame_header))
+
+#define FRAME_CHUNK_DATA(chunk) ((char *)(chunk) + ALIGNED_CHUNK_HEADER_SIZE)
+#define FRAME_REGISTERS(frame) ((char *)(frame) + ALIGNED_FRAME_HEADER_SIZE)
+
+/* registers of ctx were carved from its frame */
+#define REGISTERS_ON_FRAME(ctx) ((ctx)->frame \
+        && (char *)(ctx)->registers == FRAME_REGISTERS((ctx)->frame))
+
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -83,6 +131,14 @@ static void clear_regs(PARROT_INTERP, ARGMOD(Parrot_Context *ctx))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ctx);
 
+static void disown_frame(SHIM_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(2);
+
+static void evict_frame(PARROT_INTERP, ARGMOD(Frame_header *frame))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*frame);
+
 static void init_context(PARROT_INTERP,
     ARGMOD(PMC *pmcctx),
     ARGIN_NULLOK(PMC *pmcold))
@@ -95,6 +151,13 @@ static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void push_frame(PARROT_INTERP, ARGIN(PMC *pmcctx), size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void release_frames(PARROT_INTERP, UINTVAL height)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_allocate_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx) \
@@ -104,6 +167,11 @@ static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
 #define ASSERT_ARGS_clear_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_disown_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_evict_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(frame))
 #define ASSERT_ARGS_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx))
@@ -111,6 +179,11 @@ static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(number_regs_used))
+#define ASSERT_ARGS_push_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_release_frames __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -281,6 +354,7 @@ init_context(PARROT_INTERP, ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = NULL;
         ctx->str_constants     = NULL;
         ctx->pmc_constants     = NULL;
+        ctx->const_table       = NULL;
         ctx->warns             = 0;
         ctx->errors            = 0;
         ctx->trace_flags       = 0;
@@ -294,6 +368,7 @@ init_context(PARROT_INTERP, ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = old->num_constants;
         ctx->str_constants     = old->str_constants;
         ctx->pmc_constants     = old->pmc_constants;
+        ctx->const_table       = old->const_table;
         ctx->warns             = old->warns;
         ctx->errors            = old->errors;
         ctx->trace_flags       = old->trace_flags;
@@ -424,6 +499,9 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
     const size_t all_regs_size = size_n + size_i + size_p + size_s;
     const size_t reg_alloc     = ROUND_ALLOC_SIZE(all_regs_size);
 
+    /* registers live on the heap, the frame only marks the entry */
+    push_frame(interp, pmcctx, ALIGNED_FRAME_HEADER_SIZE);
+
     /* don't allocate any storage if there are no registers */
     ctx->registers = reg_alloc
         ? (Parrot_Context *)Parrot_gc_allocate_fixed_size_storage(interp, reg_alloc)
@@ -465,6 +543,392 @@ Parrot_pcc_allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
     ||  number_regs_used[2]
     ||  number_regs_used[3])
         allocate_registers(interp, pmcctx, number_regs_used);
+    else
+        Parrot_pcc_push_frame(interp, pmcctx);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_allocate_frame(PARROT_INTERP, PMC *pmcctx, const UINTVAL
+*number_regs_used)>
+
+Allocate registers in Context from the interpreter's frame stack.  The frame
+is popped when control returns to a context entered before this one; call
+C<Parrot_pcc_escape_context> before handing out anything that may resume the
+context later.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_allocate_frame(PARROT_INTERP, ARGIN(PMC *pmcctx),
+        ARGIN(const UINTVAL *number_regs_used))
+{
+    ASSERT_ARGS(Parrot_pcc_allocate_frame)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    const size_t size_i = sizeof (INTVAL)   * number_regs_used[REGNO_INT];
+    const size_t size_n = sizeof (FLOATVAL) * number_regs_used[REGNO_NUM];
+    const size_t size_s = sizeof (STRING *) * number_regs_used[REGNO_STR];
+    const size_t size_p = sizeof (PMC *)    * number_regs_used[REGNO_PMC];
+
+    const size_t size_nip  = size_n + size_i + size_p;
+    const size_t reg_alloc = ROUND_ALLOC_SIZE(size_nip + size_s);
+
+    if (!reg_alloc) {
+        Parrot_pcc_allocate_registers(interp, pmcctx, number_regs_used);
+        return;
+    }
+
+    push_frame(interp, pmcctx, ALIGNED_FRAME_HEADER_SIZE + reg_alloc);
+    ctx->registers = FRAME_REGISTERS(ctx->frame);
+
+    ctx->n_regs_used[REGNO_INT] = number_regs_used[REGNO_INT];
+    ctx->n_regs_used[REGNO_NUM] = number_regs_used[REGNO_NUM];
+    ctx->n_regs_used[REGNO_STR] = number_regs_used[REGNO_STR];
+    ctx->n_regs_used[REGNO_PMC] = number_regs_used[REGNO_PMC];
+
+    ctx->bp.regs_i    = (INTVAL *)((char *)ctx->registers + size_n);
+    ctx->bp_ps.regs_s = (STRING **)((char *)ctx->registers + size_nip);
+
+    clear_regs(interp, ctx);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_push_frame(PARROT_INTERP, PMC *pmcctx)>
+
+Push an empty frame for Context, marking the point to pop back to when
+control returns to it.  Needed when a context is re-entered, as a Coroutine
+is.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_push_frame(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_push_frame)
+    push_frame(interp, pmcctx, ALIGNED_FRAME_HEADER_SIZE);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_escape_context(PARROT_INTERP, PMC *pmcctx)>
+
+Mark Context and the contexts it returns through as escaped: their frames
+may be resumed after they have been popped, so popping moves their
+registers to the heap instead of discarding them.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_escape_context(SHIM_INTERP, ARGIN_NULLOK(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_escape_context)
+
+    while (!PMC_IS_NULL(pmcctx) && !CALLSIGNATURE_escaped_TEST(pmcctx)) {
+        CALLSIGNATURE_escaped_SET(pmcctx);
+        pmcctx = CONTEXT_STRUCT(pmcctx)->caller_ctx;
+    }
+}
+
+
+/*
+
+=item C<void Parrot_pcc_capture_context(PARROT_INTERP, PMC *pmcctx)>
+
+Make sure the registers of Context outlive its frame, as needed when it
+becomes the outer context of a closure.  Contexts with heap registers
+already do.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_capture_context(PARROT_INTERP, ARGIN_NULLOK(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_capture_context)
+
+    if (!PMC_IS_NULL(pmcctx) && REGISTERS_ON_FRAME(CONTEXT_STRUCT(pmcctx)))
+        Parrot_pcc_escape_context(interp, pmcctx);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_release_frames(PARROT_INTERP, PMC *pmcctx)>
+
+Pop every frame pushed after the frame of Context.  Called when a
+continuation makes Context current again.  If the frame of Context was
+popped already, its mark is meaningless and nothing is popped; the frames
+are reclaimed once control returns below them.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_release_frames(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_release_frames)
+    const Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    if (ctx->frame)
+        release_frames(interp, ctx->frame_mark);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_free_frame(PARROT_INTERP, PMC *pmcctx)>
+
+Pop the frame of Context if it is the topmost one and nothing can resume
+it, as is the case for the caller of a tail call.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_free_frame(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(Parrot_pcc_free_frame)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    if (ctx->frame
+    && !CALLSIGNATURE_escaped_TEST(pmcctx)
+    &&  ctx->frame_mark == interp->frames.height) {
+        const Frame_header * const frame = (Frame_header *)ctx->frame;
+        release_frames(interp, ctx->frame_mark - frame->size);
+    }
+}
+
+
+/*
+
+=item C<void Parrot_pcc_destroy_frame_stack(PARROT_INTERP)>
+
+Free the chunks of the interpreter's frame stack.  All contexts must have
+been destroyed already.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_destroy_frame_stack(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_destroy_frame_stack)
+    Frame_chunk *chunk = interp->frames.chunk;
+
+    while (chunk) {
+        Frame_chunk * const prev = chunk->prev;
+        mem_internal_free(chunk);
+        chunk = prev;
+    }
+
+    if (interp->frames.spare)
+        mem_internal_free(interp->frames.spare);
+
+    interp->frames.chunk  = NULL;
+    interp->frames.spare  = NULL;
+    interp->frames.height = 0;
+    interp->frames.floor  = 0;
+}
+
+
+/*
+
+=item C<static void push_frame(PARROT_INTERP, PMC *pmcctx, size_t size)>
+
+Carve a frame of C<size> bytes for Context off the top of the frame stack,
+starting a new chunk if the current one is full.  Any earlier frame of the
+context is disowned.
+
+=cut
+
+*/
+
+static void
+push_frame(PARROT_INTERP, ARGIN(PMC *pmcctx), size_t size)
+{
+    ASSERT_ARGS(push_frame)
+    Parrot_Context * const ctx   = CONTEXT_STRUCT(pmcctx);
+    frame_stack    * const stack = &interp->frames;
+    Frame_chunk           *chunk = stack->chunk;
+    Frame_header          *frame;
+
+    disown_frame(interp, pmcctx);
+
+    if (!chunk || chunk->top + size > chunk->limit) {
+        Frame_chunk * const spare = stack->spare;
+
+        if (spare && FRAME_CHUNK_DATA(spare) + size <= spare->limit) {
+            chunk        = spare;
+            stack->spare = NULL;
+        }
+        else {
+            const size_t alloc = size > FRAME_CHUNK_SIZE - ALIGNED_CHUNK_HEADER_SIZE
+                               ? size + ALIGNED_CHUNK_HEADER_SIZE
+                               : FRAME_CHUNK_SIZE;
+
+            chunk        = (Frame_chunk *)mem_internal_allocate(alloc);
+            chunk->limit = (char *)chunk + alloc;
+        }
+
+        chunk->prev  = stack->chunk;
+        chunk->base  = stack->height;
+        chunk->top   = FRAME_CHUNK_DATA(chunk);
+        stack->chunk = chunk;
+    }
+
+    frame          = (Frame_header *)chunk->top;
+    frame->ctx     = pmcctx;
+    frame->size    = size;
+    chunk->top    += size;
+    stack->height += size;
+
+    ctx->frame      = frame;
+    ctx->frame_mark = stack->height;
+}
+
+
+/*
+
+=item C<static void release_frames(PARROT_INTERP, UINTVAL height)>
+
+Pop frames until the frame stack is C<height> bytes high, but never below
+the floor set by an enclosing runloop.  Owners of popped frames are detached
+from them, or have their registers moved to the heap if they escaped.
+
+=cut
+
+*/
+
+static void
+release_frames(PARROT_INTERP, UINTVAL height)
+{
+    ASSERT_ARGS(release_frames)
+    frame_stack * const stack = &interp->frames;
+
+    if (height < stack->floor)
+        height = stack->floor;
+
+    while (stack->height > height) {
+        Frame_chunk * const chunk = stack->chunk;
+        char        * const data  = FRAME_CHUNK_DATA(chunk);
+        char        * const start = height > chunk->base
+                                  ? data + (height - chunk->base)
+                                  : data;
+        char                *f;
+
+        for (f = start; f < chunk->top; f += ((Frame_header *)f)->size) {
+            Frame_header * const frame = (Frame_header *)f;
+
+            if (frame->ctx)
+                evict_frame(interp, frame);
+        }
+
+        chunk->top    = start;
+        stack->height = chunk->base + (start - data);
+
+        /* keep the bottom chunk, and one emptied chunk for reuse */
+        if (start == data && chunk->prev) {
+            if (stack->spare)
+                mem_internal_free(stack->spare);
+
+            stack->spare = chunk;
+            stack->chunk = chunk->prev;
+        }
+    }
+}
+
+
+/*
+
+=item C<static void evict_frame(PARROT_INTERP, Frame_header *frame)>
+
+Detach the owner of a frame that is being popped.  If its registers were
+part of the frame, an escaped owner gets a heap copy of them; any other
+owner is left without registers.
+
+=cut
+
+*/
+
+static void
+evict_frame(PARROT_INTERP, ARGMOD(Frame_header *frame))
+{
+    ASSERT_ARGS(evict_frame)
+    PMC            * const pmcctx = frame->ctx;
+    Parrot_Context * const ctx    = CONTEXT_STRUCT(pmcctx);
+    char           * const old    = (char *)ctx->registers;
+    const int              on_frame = REGISTERS_ON_FRAME(ctx);
+
+    frame->ctx = NULL;
+    ctx->frame = NULL;
+
+    if (!on_frame)
+        return;
+
+    if (CALLSIGNATURE_escaped_TEST(pmcctx)) {
+        const size_t size = calculate_registers_size(interp, ctx->n_regs_used);
+        char * const regs = (char *)Parrot_gc_allocate_fixed_size_storage(interp, size);
+
+        memcpy(regs, old, size);
+        ctx->registers    = regs;
+        ctx->bp.regs_i    = (INTVAL *)(regs + ((char *)ctx->bp.regs_i - old));
+        ctx->bp_ps.regs_s = (STRING **)(regs + ((char *)ctx->bp_ps.regs_s - old));
+    }
+    else {
+        ctx->registers              = NULL;
+        ctx->bp.regs_i              = NULL;
+        ctx->bp_ps.regs_s           = NULL;
+        ctx->n_regs_used[REGNO_INT] = 0;
+        ctx->n_regs_used[REGNO_NUM] = 0;
+        ctx->n_regs_used[REGNO_STR] = 0;
+        ctx->n_regs_used[REGNO_PMC] = 0;
+    }
+}
+
+
+/*
+
+=item C<static void disown_frame(PARROT_INTERP, PMC *pmcctx)>
+
+Give up the frame of Context, if it has one, without popping it.  The
+frame is reclaimed with the frames around it; registers carved from it are
+forgotten.
+
+=cut
+
+*/
+
+static void
+disown_frame(SHIM_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(disown_frame)
+    Parrot_Context * const ctx   = CONTEXT_STRUCT(pmcctx);
+    Frame_header   * const frame = (Frame_header *)ctx->frame;
+
+    if (frame) {
+        if (REGISTERS_ON_FRAME(ctx))
+            ctx->registers = NULL;
+
+        frame->ctx = NULL;
+        ctx->frame = NULL;
+    }
 }
 
 
@@ -487,8 +951,10 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
     const size_t reg_size =
         Parrot_pcc_calculate_registers_size(interp, ctx->n_regs_used);
 
-    if (reg_size)
+    if (reg_size && !REGISTERS_ON_FRAME(ctx))
         Parrot_gc_free_fixed_size_storage(interp, reg_size, ctx->registers);
+
+    disown_frame(interp, pmcctx);
 }
 
 
@@ -596,6 +1062,43 @@ Parrot_set_new_context(PARROT_INTERP, ARGIN(const UINTVAL *number_regs_used))
 }
 
 
+/*
+
+=item C<INTVAL Parrot_pcc_cell_type(PARROT_INTERP, const Pcc_cell *cell)>
+
+Returns the type id of the positional argument in C<cell> of a CallContext,
+as multiple dispatch sees it: a native type or the type of the PMC.  Throws
+for an unknown cell type.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pcc_cell_type(PARROT_INTERP, ARGIN(const Pcc_cell *cell))
+{
+    ASSERT_ARGS(Parrot_pcc_cell_type)
+    INTVAL type = enum_type_undef;
+
+    switch (cell->type) {
+      case INTCELL:    type = enum_type_INTVAL;   break;
+      case FLOATCELL:  type = enum_type_FLOATVAL; break;
+      case STRINGCELL: type = enum_type_STRING;   break;
+      case PMCCELL:
+        type = PMC_IS_NULL(cell->u.p)
+             ? (INTVAL)enum_type_PMC
+             : VTABLE_type(interp, cell->u.p);
+        break;
+      default:
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Multiple Dispatch: invalid argument type!");
+    }
+
+    return type;
+}
+
+
 /*
 
 =back
@@ -106,6 +106,7 @@ Parrot_pcc_set_constants_func(SHIM_INTERP, ARGIN(PMC *ctx),
     c->num_constants = ct->num.constants;
     c->str_constants = ct->str.constants;
     c->pmc_constants = ct->pmc.constants;
+    c->const_table   = ct;
 }
 
 /*
@@ -723,7 +724,8 @@ INTVAL idx)>
 =item C<PMC* Parrot_pcc_get_pmc_constant_func(PARROT_INTERP, PMC *ctx, INTVAL
 idx)>
 
-Get typed constant from context.
+Get typed constant from context.  PMC constants not thawed yet are thawed on
+first access, see C<PackFile_ConstTable_get_pmc>.
 
 =cut
 
@@ -754,15 +756,18 @@ Parrot_pcc_get_string_constant_func(SHIM_INTERP, ARGIN(PMC *ctx), INTVAL idx)
 }
 
 PARROT_EXPORT
-PARROT_PURE_FUNCTION
 PARROT_CAN_RETURN_NULL
 PMC*
-Parrot_pcc_get_pmc_constant_func(SHIM_INTERP, ARGIN(PMC *ctx), INTVAL idx)
+Parrot_pcc_get_pmc_constant_func(PARROT_INTERP, ARGIN(PMC *ctx), INTVAL idx)
 {
     ASSERT_ARGS(Parrot_pcc_get_pmc_constant_func)
     const Parrot_Context * const c = CONTEXT_STRUCT(ctx);
     PARROT_ASSERT(ctx->vtable->base_type == enum_class_CallContext);
-    return c->pmc_constants[idx];
+
+    if (c->pmc_constants[idx])
+        return c->pmc_constants[idx];
+
+    return PackFile_ConstTable_get_pmc(interp, c->const_table, idx);
 }
 
 /*
@@ -64,6 +64,7 @@ runops(PARROT_INTERP, size_t offs)
 {
     ASSERT_ARGS(runops)
     volatile size_t offset            = offs;
+    const    UINTVAL old_frame_floor  = interp->frames.floor;
     const    int    old_runloop_id    = interp->current_runloop_id;
     int             our_runloop_level = interp->current_runloop_level;
     int             our_runloop_id    = old_runloop_id;
@@ -98,6 +99,7 @@ runops(PARROT_INTERP, size_t offs)
 
             interp->current_runloop_level = our_runloop_level - 1;
             interp->current_runloop_id    = old_runloop_id;
+            interp->frames.floor          = old_frame_floor;
 
 #if RUNLOOP_TRACE
             fprintf(stderr, "[handled exception; back to loop %d, level %d]\n",
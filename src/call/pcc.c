@@ -303,14 +303,19 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
 
     opcode_t    *dest;
     UINTVAL      n_regs_used[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    const UINTVAL old_floor = interp->frames.floor;
     PMC         *ctx  = Parrot_push_context(interp, n_regs_used);
-    PMC * const  ret_cont = pmc_new(interp, enum_class_Continuation);
+    PMC * const  ret_cont = Parrot_sub_new_return_continuation(interp);
 
     Parrot_pcc_set_signature(interp, ctx, call_object);
     Parrot_pcc_set_continuation(interp, ctx, ret_cont);
     interp->current_cont                    = NEED_CONTINUATION;
     PARROT_CONTINUATION(ret_cont)->from_ctx = ctx;
 
+    /* The C caller still runs in the frames below; whatever the callee
+     * does, it must not pop them. */
+    interp->frames.floor = interp->frames.height;
+
     /* Invoke the function */
     dest = VTABLE_invoke(interp, sub_obj, NULL);
 
@@ -323,6 +328,7 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
         runops(interp, offset);
         Interp_core_SET(interp, old_core);
     }
+    interp->frames.floor = old_floor;
     Parrot_pop_context(interp);
     Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp),
             Parrot_pcc_get_signature(interp, ctx));
@@ -353,6 +353,9 @@ Parrot_set_run_core(PARROT_INTERP, Parrot_Run_core_t core)
       case PARROT_FAST_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
         break;
+      case PARROT_CGOTO_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+        break;
       case PARROT_EXEC_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "exec"));
         break;
@@ -517,7 +520,7 @@ again:
 
         fd = open(fullname, O_RDONLY | O_BINARY);
 
-        if (!fd) {
+        if (fd < 0) {
             Parrot_io_eprintf(interp, "Parrot VM: Can't open %s, code %i.\n",
                     fullname, errno);
             return NULL;
@@ -756,7 +759,7 @@ set_current_sub(PARROT_INTERP)
 
     for (i = 0; i < ct->pmc.const_count; i++) {
         PMC *sub_pmc = ct->pmc.constants[i];
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
@@ -909,7 +912,7 @@ print_constant_table(PARROT_INTERP, ARGIN(PMC *output))
         Parrot_io_fprintf(interp, output, "STR_CONST(%d): %S\n", i, ct->str.constants[i]);
 
     for (i = 0; i < ct->pmc.const_count; i++) {
-        PMC *c = ct->pmc.constants[i];
+        PMC *c = PackFile_ConstTable_get_pmc(interp, ct, i);
         Parrot_io_fprintf(interp, output, "PMC_CONST(%d): ", i);
 
         switch (c->vtable->base_type) {
@@ -176,6 +176,72 @@ Parrot_gc_mark_STRING_alive_fun(PARROT_INTERP, ARGMOD_NULLOK(STRING *obj))
 
 /*
 
+=item C<void Parrot_gc_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Records that C<pmc> is about to be modified and may then point to younger
+objects.  Called through C<PARROT_GC_WRITE_BARRIER> only for PMCs a
+generational GC flagged as old, and a no-op for all others.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_write_barrier)
+    if (interp->gc_sys->write_barrier)
+        interp->gc_sys->write_barrier(interp, pmc);
+    else
+        PObj_GC_need_write_barrier_CLEAR(pmc);
+}
+
+/*
+
+=item C<void Parrot_gc_pin_pmc(PARROT_INTERP, PMC *pmc)>
+
+Makes C<pmc> constant.  The collector neither frees nor traces it anymore, so
+everything it refers to must be constant as well.  Collectors keeping lists
+of their objects take it off those.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_pin_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_pin_pmc)
+    if (interp->gc_sys->pin_pmc)
+        interp->gc_sys->pin_pmc(interp, pmc);
+    PObj_constant_SET(pmc);
+}
+
+/*
+
+=item C<void Parrot_gc_unpin_pmc(PARROT_INTERP, PMC *pmc)>
+
+Hands C<pmc>, pinned by C<Parrot_gc_pin_pmc>, back to the collector.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_unpin_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_unpin_pmc)
+    PObj_constant_CLEAR(pmc);
+    PObj_live_CLEAR(pmc);
+    if (interp->gc_sys->unpin_pmc)
+        interp->gc_sys->unpin_pmc(interp, pmc);
+}
+
+/*
+
 =item C<void Parrot_gc_initialize(PARROT_INTERP, void *stacktop)>
 
 Initializes the memory allocator and the garbage collection subsystem.
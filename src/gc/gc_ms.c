@@ -462,6 +462,9 @@ Parrot_gc_ms_init(PARROT_INTERP)
     initialize_fixed_size_pools(interp, interp->mem_pools);
     Parrot_gc_initialize_fixed_size_pools(interp, interp->mem_pools,
                                           GC_NUM_INITIAL_FIXED_SIZE_POOLS);
+
+    interp->mem_pools->parallel_mark = Parrot_gc_parallel_mark_new(interp,
+                                           interp->gc_mark_threads, 1);
 }
 
 /*
@@ -484,6 +487,9 @@ gc_ms_finalize(PARROT_INTERP)
     /* memory pools in resources */
     Parrot_gc_str_finalize(interp, &interp->mem_pools->string_gc);
 
+    if (interp->mem_pools->parallel_mark)
+        Parrot_gc_parallel_mark_destroy(interp, interp->mem_pools->parallel_mark);
+
     /* mem subsystem is dead now */
     mem_internal_free(interp->mem_pools);
     interp->mem_pools = NULL;
@@ -925,6 +931,7 @@ gc_ms_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
     ASSERT_ARGS(gc_ms_free_string_header)
     if (!PObj_constant_TEST(s)) {
         Fixed_Size_Pool * const pool = interp->mem_pools->string_header_pool;
+        Parrot_str_forget_index(interp, s);
         PObj_flags_SETTO((PObj *)s, PObj_on_free_list_FLAG);
         pool->add_free_object(interp, interp->mem_pools, pool, s);
         ++pool->num_free_objects;
@@ -1431,8 +1438,19 @@ static int
 gc_ms_trace_active_PMCs(PARROT_INTERP, Parrot_gc_trace_type trace)
 {
     ASSERT_ARGS(gc_ms_trace_active_PMCs)
+    GC_Parallel_Mark * const pm = interp->mem_pools->parallel_mark;
+
+    if (pm) {
+        /* Children of the roots are marked after tracing them */
+        Interp * const marker = Parrot_gc_parallel_mark_start(interp, pm);
+        const int      done   = Parrot_gc_trace_root(marker, interp->mem_pools, trace);
 
-    if (!Parrot_gc_trace_root(interp, interp->mem_pools, trace))
+        Parrot_gc_parallel_mark_finish(interp, pm);
+
+        if (!done)
+            return 0;
+    }
+    else if (!Parrot_gc_trace_root(interp, interp->mem_pools, trace))
         return 0;
 
     pt_gc_mark_root_finished(interp);
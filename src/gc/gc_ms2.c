@@ -7,6 +7,47 @@ src/gc/gc_ms2.c - Non-recursive M&S
 
 =head1 DESCRIPTION
 
+When started with C<--gc-nursery-size> the GC is generational.  PMCs are
+allocated into a nursery, C<objects>, and PMCs surviving a collection are
+promoted to C<old_objects>.  Most collections are then minor ones, which
+trace and sweep only the nursery and the old PMCs remembered by the write
+barrier since the last collection.  Full collections still happen when the
+total allocated memory crosses C<gc_threshold>, an eighth of the physical
+memory unless set with C<--gc-alloc-threshold>.
+
+A write to an old PMC which may store a pointer to a younger object has to
+go through C<PARROT_GC_WRITE_BARRIER>.  pmc2c emits it into vtable functions,
+METHODs and the SETATTRs of PMC and STRING attributes.  Every collection
+also remembers the PMCs found on the C stack, because code still running on
+them passed its barrier before the collection.  Contexts are always traced,
+as their registers are written by ops directly.
+
+When started with C<--gc-max-pause-us> instead, marking is incremental.  A
+collection starts by graying the roots, and every C<GC_MS2_ALLOCS_PER_STEP>
+allocations the gray objects are blackened for at most the given time.
+Objects already in C<new_objects> are gray or black, the rest is white, and
+that rather than C<PObj_live_FLAG> keeps them from being swept: code like
+C<Parrot_pmc_reuse> resets the flags of a black object.  The write barrier
+moves black objects written to into C<rescan>, so do the contexts when
+blackened and the black objects a step finds on the C stack, since code
+running on them may have passed its barrier before.  They are scanned once
+more together with the roots and the C stack before the sweep.  Scanning
+written objects then rather than at once keeps a large object written all
+the time from being scanned by every step.  Objects allocated while marking
+are white: like in a full collection, only what is reachable gets scanned,
+not headers whose init hasn't even run.
+
+Otherwise C<--gc-mark-threads> spreads marking over several threads, see
+F<src/gc/parallel_mark.c>.  Marking doesn't move live objects then, they are
+moved by the sweep.
+
+Unless generational, collections triggered by allocation sweep lazily.  Live
+PMCs are painted white at once, but C<objects> and C<strings> are kept as
+C<dead_objects> and C<dead_strings> and swept a chunk at a time whenever
+their pool has no free cells left, PMCs before strings.  Surviving objects
+move to fresh lists.  The sweep is finished before the next collection, and
+the string pool is compacted once it's done.
+
 =cut
 
 */
@@ -32,13 +73,63 @@ typedef struct string_alloc_struct {
 #define PMC2PAC(p) ((pmc_alloc_struct *)((char*)(p) - sizeof (void *)))
 #define STR2PAC(p) ((string_alloc_struct *)((char*)(p) - sizeof (void *)))
 
+/* In generational mode, the low bit of the pointer to the cell in the
+pointer array flags objects living in old_objects.  In incremental mode it
+flags objects in new_objects or rescan instead, and the next bit the ones in
+rescan */
+#define PAC_OLD_FLAG ((UINTVAL)1)
+#define PAC_RESCAN_FLAG ((UINTVAL)2)
+#define PAC_IS_OLD(i) (PTR2UINTVAL((i)->ptr) & PAC_OLD_FLAG)
+#define PAC_IS_RESCAN(i) (PTR2UINTVAL((i)->ptr) & PAC_RESCAN_FLAG)
+#define PAC_CELL(i) UINTVAL2PTR(void *, \
+    PTR2UINTVAL((i)->ptr) & ~(PAC_OLD_FLAG | PAC_RESCAN_FLAG))
+#define PAC_SET_OLD_CELL(i, cell) \
+    ((i)->ptr = (cell), \
+     (i)->ptr = UINTVAL2PTR(void *, PTR2UINTVAL((i)->ptr) | PAC_OLD_FLAG))
+#define PAC_SET_RESCAN_CELL(i, cell) \
+    ((i)->ptr = (cell), \
+     (i)->ptr = UINTVAL2PTR(void *, \
+        PTR2UINTVAL((i)->ptr) | PAC_OLD_FLAG | PAC_RESCAN_FLAG))
+
 #define PANIC_OUT_OF_MEM(size) failed_allocation(__LINE__, (size))
 
 /* Maybe M&S. Depends on total allocated memory, memory allocated since last
 alloc, and phase of the Moon. */
 #define MAYBE_MARK_AND_SWEEP(interp, self) { \
-    if ((interp)->gc_sys->stats.mem_used_last_collect > (self)->gc_threshold) \
-        gc_ms2_mark_and_sweep((interp), 0); \
+    if ((self)->marking) { \
+        if (++(self)->allocs_since_step > GC_MS2_ALLOCS_PER_STEP) \
+            gc_ms2_mark_step((interp)); \
+    } \
+    else if ((interp)->gc_sys->stats.mem_used_last_collect > (self)->gc_threshold) { \
+        if ((self)->max_pause_us) \
+            gc_ms2_start_marking((interp)); \
+        else \
+            gc_ms2_mark_and_sweep((interp), GC_MS2_LAZY_SWEEP_FLAG); \
+    } \
+    }
+
+/* Sweep lazily what the last collection left in list before growing pool */
+#define MAYBE_SWEEP(interp, self, pool, list) { \
+    while ((list) && !(pool)->free_list && !(pool)->newfree \
+    &&     gc_ms2_sweep_step((interp), (self))) \
+        ; \
+    }
+
+/* Private flag of collections triggered by allocation. They leave sweeping to
+later allocations */
+#define GC_MS2_LAZY_SWEEP_FLAG (UINTVAL)(1 << 8)
+
+/* Number of allocated headers between incremental marking steps */
+#define GC_MS2_ALLOCS_PER_STEP 1024
+
+/* Incremental marking gives up and finishes a collection at once when the
+program allocated this many times gc_threshold meanwhile */
+#define GC_MS2_MAX_THRESHOLD_DEBT 2
+
+/* Collect nursery when it's full in generational mode. */
+#define MAYBE_COLLECT_NURSERY(interp, self) { \
+    if ((self)->nursery_size && (self)->nursery_used > (self)->nursery_size) \
+        gc_ms2_minor_collection((interp)); \
     }
 
 /* Private information */
@@ -71,6 +162,52 @@ typedef struct MarkSweep_GC {
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
 
+    /* Generational mode. Objects which survived collection */
+    struct Parrot_Pointer_Array    *old_objects;
+    /* Old objects written to since last collection */
+    struct Parrot_Pointer_Array    *remembered;
+    /* Objects found on C stack during current collection */
+    struct Parrot_Pointer_Array    *stack_objects;
+
+    /* Size of nursery in bytes. 0 if GC isn't generational */
+    size_t nursery_size;
+    /* Memory allocated for new objects since last collection */
+    size_t nursery_used;
+
+    /* Currently tracing C stack */
+    int    tracing_stack;
+    /* Currently doing minor collection */
+    int    minor_collection;
+
+    /* Incremental mode. Time budget of marking step in microseconds. 0 if
+     * marking isn't incremental */
+    UINTVAL max_pause_us;
+    /* Incremental marking is in progress */
+    int     marking;
+    /* Headers allocated since last marking step */
+    UINTVAL allocs_since_step;
+
+    /* Stack of gray objects */
+    PMC   **gray;
+    size_t  gray_count;
+    size_t  gray_size;
+
+    /* Black contexts and black objects written to while marking, moved out
+     * of new_objects to be scanned again */
+    struct Parrot_Pointer_Array    *rescan;
+
+    /* Helper threads marking full collections. NULL if single threaded */
+    struct GC_Parallel_Mark        *parallel_mark;
+
+    /* Lazy sweeping. Objects and strings left by the last collection, live
+     * ones included, until swept a chunk at a time. NULL when all swept */
+    struct Parrot_Pointer_Array    *dead_objects;
+    struct Parrot_Pointer_Array    *dead_strings;
+    /* Next chunk of dead_objects, or of dead_strings once they're done */
+    size_t sweep_chunk;
+    /* Currently sweeping a chunk */
+    int    sweeping;
+
 } MarkSweep_GC;
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
@@ -145,9 +282,23 @@ static void gc_ms2_destroy_pmc_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static int gc_ms2_drain_gray(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    UHUGEINTVAL deadline)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_finish_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_finish_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_free_buffer_header(PARROT_INTERP,
     ARGFREE(Buffer *s),
     SHIM(size_t size))
@@ -175,6 +326,10 @@ static void gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 static size_t gc_ms2_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
         __attribute__nonnull__(1);
 
+static void gc_ms2_incremental_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static unsigned int gc_ms2_is_blocked_GC_mark(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -195,6 +350,18 @@ static int gc_ms2_is_ptr_owned(PARROT_INTERP,
 static int gc_ms2_is_string_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
         __attribute__nonnull__(1);
 
+static int gc_ms2_is_unswept(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN_NULLOK(Parrot_Pointer_Array *list),
+    ARGIN(PObj *obj),
+    ARGIN(void *item),
+    ARGIN(void *cell))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6);
+
 static void gc_ms2_iterate_live_strings(PARROT_INTERP,
     string_iterator_callback callback,
     ARGIN_NULLOK(void *data))
@@ -203,6 +370,20 @@ static void gc_ms2_iterate_live_strings(PARROT_INTERP,
 static void gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+static void gc_ms2_mark_generation(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void gc_ms2_mark_gray(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_ms2_mark_live_objects(PARROT_INTERP,
     ARGIN(MarkSweep_GC *self),
     UINTVAL flags)
@@ -216,12 +397,36 @@ static void gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
 static void gc_ms2_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj * obj))
         __attribute__nonnull__(1);
 
+static void gc_ms2_mark_step(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_ms2_minor_collection(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_ms2_move_to_rescan(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGMOD(pmc_alloc_struct *item))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*item);
+
+static void gc_ms2_pin_pmc(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_pmc_needs_early_collection(PARROT_INTERP,
     ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_ms2_push_gray(SHIM_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_ms2_reallocate_buffer_storage(PARROT_INTERP,
     ARGIN(Buffer *str),
     size_t size)
@@ -247,6 +452,24 @@ static void gc_ms2_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms2_start_marking(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void gc_ms2_start_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_swap_remembered(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array_Chunk *chunk))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_ms2_sweep_pmc_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -254,6 +477,17 @@ static void gc_ms2_sweep_pmc_pool(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static int gc_ms2_sweep_step(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_sweep_string_chunk(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array_Chunk *chunk))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void gc_ms2_sweep_string_pool(PARROT_INTERP,
     ARGIN(Pool_Allocator *pool),
     ARGIN(Parrot_Pointer_Array *list))
@@ -267,6 +501,14 @@ static void gc_ms2_unblock_GC_mark(PARROT_INTERP)
 static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void gc_ms2_unpin_pmc(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void gc_ms2_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_failed_allocation __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_gc_ms2_allocate_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -302,8 +544,17 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_drain_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_finish_marking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_finish_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_free_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_free_fixed_size_storage \
@@ -320,6 +571,10 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_get_gc_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_incremental_write_barrier \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_is_blocked_GC_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_is_blocked_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -332,10 +587,24 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
     , PARROT_ASSERT_ARG(list))
 #define ASSERT_ARGS_gc_ms2_is_string_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_is_unswept __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(obj) \
+    , PARROT_ASSERT_ARG(item) \
+    , PARROT_ASSERT_ARG(cell))
 #define ASSERT_ARGS_gc_ms2_iterate_live_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_mark_and_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_mark_generation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_mark_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_mark_live_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
@@ -344,10 +613,24 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
     , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_mark_pobj_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_mark_step __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_minor_collection __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_move_to_rescan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(item))
+#define ASSERT_ARGS_gc_ms2_pin_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_push_gray __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_reallocate_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -360,10 +643,29 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_ms2_start_marking __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_start_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_swap_remembered __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_sweep_pmc_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(chunk))
 #define ASSERT_ARGS_gc_ms2_sweep_pmc_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(list))
+#define ASSERT_ARGS_gc_ms2_sweep_step __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_sweep_string_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(chunk))
 #define ASSERT_ARGS_gc_ms2_sweep_string_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
@@ -372,6 +674,12 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_ms2_unblock_GC_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_ms2_unpin_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_write_barrier __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -401,7 +709,8 @@ Flags can be a combination of these values:
 
 =item C<static void gc_ms2_compact_memory_pool(PARROT_INTERP)>
 
-Stub for compacting memory pools.
+Compact the string pool.  Strings left by the last collection are swept
+first, which compacts when done: their buffers would be copied otherwise.
 
 =cut
 
@@ -412,7 +721,11 @@ gc_ms2_compact_memory_pool(PARROT_INTERP)
 {
     ASSERT_ARGS(gc_ms2_compact_memory_pool)
     MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    Parrot_gc_str_compact_pool(interp, &self->string_gc);
+
+    if (self->dead_strings)
+        gc_ms2_finish_sweep(interp, self);
+    else
+        Parrot_gc_str_compact_pool(interp, &self->string_gc);
 }
 
 
@@ -468,6 +781,7 @@ gc_ms2_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
 
     memset(PMC_data(pmc), 0, attr_size);
     interp->gc_sys->stats.mem_used_last_collect += attr_size;
+    self->nursery_used                          += attr_size;
 
     return PMC_data(pmc);
 }
@@ -640,9 +954,31 @@ Parrot_gc_ms2_init(PARROT_INTERP)
 
         self->fixed_size_allocator = Parrot_gc_fixed_allocator_new(interp);
 
-        self->gc_threshold = Parrot_sysmem_amount(interp) / 8;
+        if (interp->gc_alloc_threshold)
+            self->gc_threshold = interp->gc_alloc_threshold * 1024;
+        else
+            self->gc_threshold = Parrot_sysmem_amount(interp) / 8;
+
+        if (interp->gc_nursery_size) {
+            self->nursery_size = interp->gc_nursery_size * 1024;
+            self->old_objects  = Parrot_pa_new(interp);
+            self->remembered   = Parrot_pa_new(interp);
+        }
+        else if (interp->gc_max_pause_us)
+            self->max_pause_us = interp->gc_max_pause_us;
+        else
+            self->parallel_mark = Parrot_gc_parallel_mark_new(interp,
+                interp->gc_mark_threads, 0);
     }
 
+    if (self->nursery_size)
+        interp->gc_sys->write_barrier = gc_ms2_write_barrier;
+    else if (self->max_pause_us)
+        interp->gc_sys->write_barrier = gc_ms2_incremental_write_barrier;
+
+    interp->gc_sys->pin_pmc   = gc_ms2_pin_pmc;
+    interp->gc_sys->unpin_pmc = gc_ms2_unpin_pmc;
+
     interp->gc_sys->gc_private = self;
     Parrot_gc_str_initialize(interp, &self->string_gc);
 }
@@ -670,6 +1006,18 @@ gc_ms2_finalize(PARROT_INTERP)
 
         Parrot_pa_destroy(interp, self->objects);
         Parrot_pa_destroy(interp, self->strings);
+        if (self->dead_objects)
+            Parrot_pa_destroy(interp, self->dead_objects);
+        if (self->dead_strings)
+            Parrot_pa_destroy(interp, self->dead_strings);
+        if (self->nursery_size) {
+            Parrot_pa_destroy(interp, self->old_objects);
+            Parrot_pa_destroy(interp, self->remembered);
+        }
+        if (self->gray)
+            mem_sys_free(self->gray);
+        if (self->parallel_mark)
+            Parrot_gc_parallel_mark_destroy(interp, self->parallel_mark);
         Parrot_gc_pool_destroy(interp, self->pmc_allocator);
         Parrot_gc_pool_destroy(interp, self->string_allocator);
         Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
@@ -692,12 +1040,15 @@ gc_ms2_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)
     pmc_alloc_struct *ptr;
 
     MAYBE_MARK_AND_SWEEP(interp, self);
+    MAYBE_COLLECT_NURSERY(interp, self);
+    MAYBE_SWEEP(interp, self, pool, self->dead_objects);
 
     /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
     ++interp->gc_sys->stats.header_allocs_since_last_collect;
 
     interp->gc_sys->stats.memory_allocated      += sizeof (PMC);
     interp->gc_sys->stats.mem_used_last_collect += sizeof (PMC);
+    self->nursery_used                          += sizeof (PMC);
 
     ptr = (pmc_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
     ptr->ptr = Parrot_pa_insert(interp, self->objects, ptr);
@@ -713,9 +1064,20 @@ gc_ms2_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
     MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
     if (pmc) {
+        pmc_alloc_struct * const item = PMC2PAC(pmc);
+
         if (PObj_on_free_list_TEST(pmc))
             return;
-        Parrot_pa_remove(interp, self->objects, PMC2PAC(pmc)->ptr);
+        Parrot_pa_remove(interp,
+            PAC_IS_RESCAN(item)
+                ? self->rescan
+            : PAC_IS_OLD(item)
+                ? (self->nursery_size ? self->old_objects : self->new_objects)
+            : gc_ms2_is_unswept(interp, self, self->dead_objects,
+                (PObj *)pmc, item, PAC_CELL(item))
+                ? self->dead_objects
+            : self->objects,
+            PAC_CELL(item));
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
@@ -746,10 +1108,28 @@ gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
     MarkSweep_GC      *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     pmc_alloc_struct  *item = PMC2PAC(pmc);
 
+    /* Code running on a black object found on the C stack by a marking step
+     * may have passed its barrier while it was white */
+    if (self->tracing_stack && self->marking) {
+        if (PObj_GC_need_write_barrier_TEST(pmc))
+            gc_ms2_incremental_write_barrier(interp, pmc);
+        return;
+    }
+
     /* Object was already marked as grey. Or live. Or dead. Skip it */
     if (PObj_is_live_or_free_TESTALL(pmc))
         return;
 
+    if (self->nursery_size && !PObj_constant_TEST(pmc)) {
+        gc_ms2_mark_generation(interp, self, pmc);
+        return;
+    }
+
+    if (self->marking) {
+        gc_ms2_mark_gray(interp, self, pmc);
+        return;
+    }
+
     /* mark it live */
     PObj_live_SET(pmc);
 
@@ -761,6 +1141,185 @@ gc_ms2_mark_pmc_header(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<static void gc_ms2_mark_generation(PARROT_INTERP, MarkSweep_GC *self,
+PMC *pmc)>
+
+Mark as grey in generational mode.  Every object surviving the collection is
+promoted to C<old_objects>.  A minor collection doesn't trace old objects,
+except for contexts and the objects found on the C stack.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_generation(PARROT_INTERP, ARGIN(MarkSweep_GC *self), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_mark_generation)
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    if (self->tracing_stack)
+        Parrot_pa_insert(interp, self->stack_objects, item);
+
+    if (!PAC_IS_OLD(item)) {
+        Parrot_pa_remove(interp, self->objects, PAC_CELL(item));
+    }
+    else if (!self->minor_collection) {
+        Parrot_pa_remove(interp, self->old_objects, PAC_CELL(item));
+    }
+    else {
+        if (!self->tracing_stack
+        &&  pmc->vtable->base_type != enum_class_CallContext)
+            return;
+
+        /* Trace it without moving. Gray list is painted white afterwards */
+        PObj_live_SET(pmc);
+        Parrot_pa_insert(interp, self->new_objects, item);
+        return;
+    }
+
+    PObj_live_SET(pmc);
+    PObj_GC_need_write_barrier_SET(pmc);
+
+    if (self->minor_collection) {
+        PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->old_objects, item));
+        Parrot_pa_insert(interp, self->new_objects, item);
+    }
+    else
+        PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->new_objects, item));
+}
+
+
+/*
+
+=item C<static void gc_ms2_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Remember old C<pmc> for the next minor collection.  Cleared
+C<PObj_GC_need_write_barrier_FLAG> keeps it from being remembered twice.
+
+=cut
+
+*/
+
+static void
+gc_ms2_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_write_barrier)
+    MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    PObj_GC_need_write_barrier_CLEAR(pmc);
+
+    if (PAC_IS_OLD(item) && !PObj_on_free_list_TEST(pmc))
+        Parrot_pa_insert(interp, self->remembered, item);
+}
+
+
+/*
+
+=item C<static void gc_ms2_pin_pmc(PARROT_INTERP, PMC *pmc)>
+
+Take C<pmc> off the object lists.  Unswept objects are swept first, so it is
+in C<objects> or in C<old_objects> (C<new_objects> or C<rescan> while
+marking).
+
+=cut
+
+*/
+
+static void
+gc_ms2_pin_pmc(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_pin_pmc)
+    MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    if (PObj_constant_TEST(pmc) || !item->ptr)
+        return;
+
+    gc_ms2_finish_sweep(interp, self);
+
+    Parrot_pa_remove(interp,
+        PAC_IS_RESCAN(item)
+            ? self->rescan
+        : PAC_IS_OLD(item)
+            ? (self->nursery_size ? self->old_objects : self->new_objects)
+        : self->objects,
+        PAC_CELL(item));
+    item->ptr = NULL;
+}
+
+
+/*
+
+=item C<static void gc_ms2_unpin_pmc(PARROT_INTERP, PMC *pmc)>
+
+Put pinned C<pmc> back: gray while marking, as whatever it refers to wasn't
+traced through it, and old in generational mode, as it may refer to old
+objects only.
+
+=cut
+
+*/
+
+static void
+gc_ms2_unpin_pmc(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_unpin_pmc)
+    MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    if (item->ptr)
+        return;
+
+    if (self->marking) {
+        PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->new_objects, item));
+        gc_ms2_push_gray(interp, self, pmc);
+    }
+    else if (self->nursery_size) {
+        PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->old_objects, item));
+        PObj_GC_need_write_barrier_SET(pmc);
+    }
+    else
+        item->ptr = Parrot_pa_insert(interp, self->objects, item);
+}
+
+
+/*
+
+=item C<static void gc_ms2_swap_remembered(PARROT_INTERP, MarkSweep_GC *self)>
+
+Replace the remembered set after marking.  Objects remembered so far need
+the write barrier again.  Objects found on the C stack are remembered for
+the next collection instead: code running on them may store into them
+without passing the barrier again.
+
+=cut
+
+*/
+
+static void
+gc_ms2_swap_remembered(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_swap_remembered)
+
+    POINTER_ARRAY_ITER(self->remembered,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        if (PAC_IS_OLD(item) && !PObj_on_free_list_TEST(&item->pmc))
+            PObj_GC_need_write_barrier_SET(&item->pmc););
+
+    POINTER_ARRAY_ITER(self->stack_objects,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PObj_GC_need_write_barrier_CLEAR(&item->pmc););
+
+    Parrot_pa_destroy(interp, self->remembered);
+    self->remembered    = self->stack_objects;
+    self->stack_objects = NULL;
+}
+
+
 /*
 
 =item C<static int gc_ms2_is_pmc_ptr(PARROT_INTERP, void *ptr)>
@@ -776,7 +1335,12 @@ gc_ms2_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
 {
     ASSERT_ARGS(gc_ms2_is_pmc_ptr)
     MarkSweep_GC      *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    return gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->objects);
+    return gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->objects)
+        || (self->nursery_size
+        &&  gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->old_objects))
+        || (self->marking
+        &&  (gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->new_objects)
+        ||   gc_ms2_is_ptr_owned(interp, ptr, self->pmc_allocator, self->rescan)));
 }
 
 /*
@@ -807,6 +1371,7 @@ gc_ms2_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
     STRING           *ret;
 
     MAYBE_MARK_AND_SWEEP(interp, self);
+    MAYBE_SWEEP(interp, self, pool, self->dead_strings);
 
     /* Increase used memory. Not precisely accurate due Pool_Allocator paging */
     ++interp->gc_sys->stats.header_allocs_since_last_collect;
@@ -818,6 +1383,11 @@ gc_ms2_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
 
     ret = &ptr->str;
     memset(ret, 0, sizeof (STRING));
+
+    /* Allocate black while marking */
+    if (self->marking)
+        PObj_live_SET(ret);
+
     return ret;
 }
 
@@ -829,9 +1399,17 @@ gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 
     if (s
     && !PObj_on_free_list_TEST(s)) {
-        MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+        MarkSweep_GC        *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+        string_alloc_struct *item = STR2PAC(s);
 
-        Parrot_pa_remove(interp, self->strings, STR2PAC(s)->ptr);
+        Parrot_pa_remove(interp,
+            gc_ms2_is_unswept(interp, self, self->dead_strings,
+                (PObj *)s, item, item->ptr)
+                ? self->dead_strings
+                : self->strings,
+            item->ptr);
+
+        Parrot_str_forget_index(interp, s);
 
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
@@ -960,9 +1538,12 @@ gc_ms2_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj * obj))
 {
     ASSERT_ARGS(gc_ms2_mark_pobj_header)
     if (obj) {
+        MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
         if (PObj_is_PMC_TEST(obj))
             gc_ms2_mark_pmc_header(interp, (PMC *)obj);
-        else
+        /* Minor collections don't sweep strings */
+        else if (!self->minor_collection)
             PObj_live_SET(obj);
     }
 }
@@ -992,6 +1573,12 @@ gc_ms2_iterate_live_strings(PARROT_INTERP,
     POINTER_ARRAY_ITER(self->strings,
         STRING *s = &((string_alloc_struct *)ptr)->str;
         callback(interp, (Buffer *)s, data););
+
+    /* Unswept strings still own their buffers */
+    if (self->dead_strings)
+        POINTER_ARRAY_ITER(self->dead_strings,
+            STRING *s = &((string_alloc_struct *)ptr)->str;
+            callback(interp, (Buffer *)s, data););
 }
 
 
@@ -1024,6 +1611,42 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
         PObj_live_SET(interp->gc_registry);
         PObj_live_SET(interp->scheduler);
     }
+    else if (self->nursery_size) {
+        gc_ms2_mark_pmc_header(interp, PMCNULL);
+
+        self->stack_objects = Parrot_pa_new(interp);
+        self->tracing_stack = 1;
+        Parrot_gc_trace_root(interp, NULL, GC_TRACE_SYSTEM_ONLY);
+        self->tracing_stack = 0;
+
+        /* Old objects written to since last collection are roots too */
+        if (self->minor_collection)
+            POINTER_ARRAY_ITER(self->remembered,
+                pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+                PMC              * const pmc  = &item->pmc;
+
+                if (PAC_IS_OLD(item) && !PObj_is_live_or_free_TESTALL(pmc)) {
+                    PObj_live_SET(pmc);
+                    Parrot_pa_insert(interp, self->new_objects, item);
+                });
+
+        Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+
+        if (interp->pdb && interp->pdb->debugger)
+            Parrot_gc_trace_root(interp->pdb->debugger, NULL,
+                (Parrot_gc_trace_type)0);
+    }
+    else if (self->parallel_mark && !(interp->pdb && interp->pdb->debugger)) {
+        /* Mark without moving, live objects are moved by the sweep */
+        Interp * const marker = Parrot_gc_parallel_mark_start(interp,
+                                    self->parallel_mark);
+
+        marker->gc_sys->mark_pmc_header(marker, PMCNULL);
+        Parrot_gc_trace_root(marker, NULL, GC_TRACE_FULL);
+
+        Parrot_gc_parallel_mark_finish(interp, self->parallel_mark);
+        return;
+    }
     else {
         /* Trace "roots" into new_objects */
         gc_ms2_mark_pmc_header(interp, PMCNULL);
@@ -1061,46 +1684,416 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (self->gc_mark_block_level)
         return;
 
-    /* Ignore calls from String GC. We know better when to trigger GC */
-    if (flags & GC_strings_cb_FLAG)
+    /* Ignore calls from String GC. We know better when to trigger GC. But
+     * it's about to compact, so sweep what the last collection left */
+    if (flags & GC_strings_cb_FLAG) {
+        gc_ms2_finish_sweep(interp, self);
         return;
+    }
 
     /* avoid global destruction for child interps */
     if (flags & GC_finish_FLAG && interp->parent_interpreter)
         return;
 
-    ++self->gc_mark_block_level;
-    gc_ms2_mark_live_objects(interp, self, flags);
+    /* Marking needs everything painted white */
+    gc_ms2_finish_sweep(interp, self);
 
-    /* At this point of time new_objects contains only live PMCs */
-    /* objects contains "dead" or "constant" PMCs */
-    /* sweep of new_objects will repaint them white */
-    /* sweep of objects will destroy dead objects leaving only "constant" */
-    gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->new_objects);
-    gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
-    gc_ms2_sweep_string_pool(interp, self->string_allocator, self->strings);
+    ++self->gc_mark_block_level;
 
-    /* destroy the rest */
-    if (flags & GC_finish_FLAG) {
-        gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->objects);
-        gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->new_objects);
+    /* Complete incremental marking in progress, even on exit */
+    if (self->marking)
+        gc_ms2_finish_marking(interp, self);
+    else
+        gc_ms2_mark_live_objects(interp, self, flags);
+
+    if (self->stack_objects)
+        gc_ms2_swap_remembered(interp, self);
+
+    if (self->nursery_size || flags & GC_finish_FLAG) {
+        /* At this point of time new_objects contains only live PMCs */
+        /* objects contains "dead" or "constant" PMCs */
+        /* sweep of new_objects will repaint them white */
+        /* sweep of objects will destroy dead objects leaving only "constant" */
+        gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->new_objects);
+        gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
+        if (self->nursery_size)
+            gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->old_objects);
+        gc_ms2_sweep_string_pool(interp, self->string_allocator, self->strings);
+
+        /* destroy the rest */
+        if (flags & GC_finish_FLAG) {
+            gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->objects);
+            gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->new_objects);
+            if (self->nursery_size)
+                gc_ms2_destroy_pmc_pool(interp, self->pmc_allocator, self->old_objects);
+        }
+
+        /* Replace objects with new_objects. Ignoring "constant" one */
+        if (self->nursery_size) {
+            /* All survivors are old now */
+            Parrot_pa_destroy(interp, self->old_objects);
+            Parrot_pa_destroy(interp, self->objects);
+            self->old_objects = self->new_objects;
+            self->objects     = Parrot_pa_new(interp);
+        }
+        else do {
+            Parrot_Pointer_Array *tmp = self->objects;
+            self->objects = self->new_objects;
+            Parrot_pa_destroy(interp, tmp);
+        } while (0);
     }
-
-    /* Replace objects with new_objects. Ignoring "constant" one */
-    do {
-        Parrot_Pointer_Array *tmp = self->objects;
-        self->objects = self->new_objects;
-        Parrot_pa_destroy(interp, tmp);
-    } while (0);
+    else
+        gc_ms2_start_sweep(interp, self);
 
     /* We swept all dead objects */
     self->num_early_gc_PMCs                                = 0;
     interp->gc_sys->stats.mem_used_last_collect            = 0;
     interp->gc_sys->stats.header_allocs_since_last_collect = 0;
     interp->gc_sys->stats.gc_mark_runs++;
+    self->nursery_used = 0;
     self->gc_mark_block_level--;
 
-    gc_ms2_compact_memory_pool(interp);
+    /* Compacting waits for the strings to be swept */
+    if (self->dead_strings) {
+        if (!(flags & GC_MS2_LAZY_SWEEP_FLAG))
+            gc_ms2_finish_sweep(interp, self);
+    }
+    else
+        gc_ms2_compact_memory_pool(interp);
+}
+
+
+/*
+
+=item C<static void gc_ms2_minor_collection(PARROT_INTERP)>
+
+Collect nursery.  Surviving objects are promoted to C<old_objects> while
+marking, so only dead and constant objects remain in C<objects>.
+
+=cut
+
+*/
+
+static void
+gc_ms2_minor_collection(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_ms2_minor_collection)
+    MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (self->gc_mark_block_level)
+        return;
+
+    ++self->gc_mark_block_level;
+    self->minor_collection = 1;
+
+    gc_ms2_mark_live_objects(interp, self, 0);
+    gc_ms2_swap_remembered(interp, self);
+
+    /* Gray list contains promoted and traced old objects only */
+    POINTER_ARRAY_ITER(self->new_objects,
+        PObj_live_CLEAR(&((pmc_alloc_struct *)ptr)->pmc););
+    Parrot_pa_destroy(interp, self->new_objects);
+    self->new_objects = NULL;
+
+    gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->objects);
+
+    /* Collected memory is accounted in sweep. The rest was promoted */
+    interp->gc_sys->stats.header_allocs_since_last_collect = 0;
+    interp->gc_sys->stats.gc_mark_runs++;
+    self->nursery_used     = 0;
+    self->minor_collection = 0;
+    self->gc_mark_block_level--;
+}
+
+
+/*
+
+=item C<static void gc_ms2_start_marking(PARROT_INTERP)>
+
+Start incremental collection by graying the roots.  The C stack is left for
+C<gc_ms2_finish_marking>, it will be different by then anyway.
+
+=cut
+
+*/
+
+static void
+gc_ms2_start_marking(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_ms2_start_marking)
+    MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (self->gc_mark_block_level)
+        return;
+
+    gc_ms2_finish_sweep(interp, self);
+
+    self->new_objects       = Parrot_pa_new(interp);
+    self->rescan            = Parrot_pa_new(interp);
+    self->marking           = 1;
+    self->allocs_since_step = 0;
+
+    gc_ms2_mark_pmc_header(interp, PMCNULL);
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+
+    gc_ms2_mark_step(interp);
+}
+
+
+/*
+
+=item C<static void gc_ms2_mark_step(PARROT_INTERP)>
+
+Blacken gray objects for at most C<max_pause_us>.  Finish the collection
+when there are none left, or when marking can't keep up with allocation.
+Otherwise queue the black objects on the C stack for another scan.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_step(PARROT_INTERP)
+{
+    ASSERT_ARGS(gc_ms2_mark_step)
+    MarkSweep_GC *self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    UHUGEINTVAL   deadline;
+    int           done;
+
+    self->allocs_since_step = 0;
+
+    if (self->gc_mark_block_level)
+        return;
+
+    if (interp->gc_sys->stats.mem_used_last_collect
+    >   self->gc_threshold * GC_MS2_MAX_THRESHOLD_DEBT) {
+        gc_ms2_mark_and_sweep(interp, GC_MS2_LAZY_SWEEP_FLAG);
+        return;
+    }
+
+    deadline = Parrot_hires_get_time() * Parrot_hires_get_tick_duration()
+             + self->max_pause_us * 1000;
+
+    ++self->gc_mark_block_level;
+    done = gc_ms2_drain_gray(interp, self, deadline);
+
+    if (!done) {
+        self->tracing_stack = 1;
+        Parrot_gc_trace_root(interp, NULL, GC_TRACE_SYSTEM_ONLY);
+        self->tracing_stack = 0;
+    }
+    --self->gc_mark_block_level;
+
+    if (done)
+        gc_ms2_mark_and_sweep(interp, GC_MS2_LAZY_SWEEP_FLAG);
+}
+
+
+/*
+
+=item C<static int gc_ms2_drain_gray(PARROT_INTERP, MarkSweep_GC *self,
+UHUGEINTVAL deadline)>
+
+Scan gray objects until there are none left or the time in nanoseconds is
+past C<deadline>, if not 0.  Returns true when done.
+
+Contexts go to C<rescan>, as their registers are written without barrier.
+Cells freed, or freed and handed out again, since they were grayed are
+skipped.
+
+=cut
+
+*/
+
+static int
+gc_ms2_drain_gray(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        UHUGEINTVAL deadline)
+{
+    ASSERT_ARGS(gc_ms2_drain_gray)
+    UINTVAL counter = 0;
+
+    while (self->gray_count) {
+        PMC              * const pmc  = self->gray[--self->gray_count];
+        pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+        /* Freed while gray. A new object in the cell is white */
+        if (PObj_on_free_list_TEST(pmc) || !PAC_IS_OLD(item))
+            continue;
+
+        if (PObj_custom_mark_TEST(pmc))
+            VTABLE_mark(interp, pmc);
+
+        if (PMC_metadata(pmc))
+            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+        if (pmc->vtable->base_type == enum_class_CallContext) {
+            if (self->marking == 1 && !PAC_IS_RESCAN(item))
+                gc_ms2_move_to_rescan(interp, self, item);
+        }
+        else
+            PObj_GC_need_write_barrier_SET(pmc);
+
+        /* Checking time is expensive enough to not do it every time */
+        if (deadline && !(++counter & 0x3f)
+        &&  Parrot_hires_get_time() * Parrot_hires_get_tick_duration() > deadline)
+            return !self->gray_count;
+    }
+
+    return 1;
+}
+
+
+/*
+
+=item C<static void gc_ms2_finish_marking(PARROT_INTERP, MarkSweep_GC *self)>
+
+Complete incremental marking at once.  Scans the roots including the C
+stack, everything in C<rescan>, and everything still gray.  C<rescan> only
+holds objects still in use, as freeing one takes it off the list.
+
+=cut
+
+*/
+
+static void
+gc_ms2_finish_marking(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_finish_marking)
+
+    self->marking = 2;
+
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
+
+    if (interp->pdb && interp->pdb->debugger)
+        Parrot_gc_trace_root(interp->pdb->debugger, NULL,
+            (Parrot_gc_trace_type)0);
+
+    POINTER_ARRAY_ITER(self->rescan,
+        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+
+        if (PObj_custom_mark_TEST(pmc))
+            VTABLE_mark(interp, pmc);
+
+        if (PMC_metadata(pmc))
+            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+
+    gc_ms2_drain_gray(interp, self, 0);
+
+    /* Sweep them along with the rest */
+    POINTER_ARRAY_ITER(self->rescan,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->new_objects, item)););
+
+    Parrot_pa_destroy(interp, self->rescan);
+    self->rescan  = NULL;
+    self->marking = 0;
+}
+
+
+/*
+
+=item C<static void gc_ms2_mark_gray(PARROT_INTERP, MarkSweep_GC *self, PMC
+*pmc)>
+
+Mark white C<pmc> as gray in incremental mode.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_gray(PARROT_INTERP, ARGIN(MarkSweep_GC *self), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_mark_gray)
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    /* Gray or black already, even if its flags were reset since */
+    if (PAC_IS_OLD(item))
+        return;
+
+    PObj_live_SET(pmc);
+
+    if (PObj_constant_TEST(pmc))
+        return;
+
+    Parrot_pa_remove(interp, self->objects, item->ptr);
+    PAC_SET_OLD_CELL(item, Parrot_pa_insert(interp, self->new_objects, item));
+    gc_ms2_push_gray(interp, self, pmc);
+}
+
+
+/*
+
+=item C<static void gc_ms2_push_gray(PARROT_INTERP, MarkSweep_GC *self, PMC
+*pmc)>
+
+Push C<pmc> onto the stack of gray objects.
+
+=cut
+
+*/
+
+static void
+gc_ms2_push_gray(SHIM_INTERP, ARGIN(MarkSweep_GC *self), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_push_gray)
+
+    if (self->gray_count == self->gray_size) {
+        self->gray_size = self->gray_size ? self->gray_size * 2 : 1024;
+        mem_realloc_n_typed(self->gray, self->gray_size, PMC *);
+    }
+
+    self->gray[self->gray_count++] = pmc;
+}
+
+
+/*
+
+=item C<static void gc_ms2_incremental_write_barrier(PARROT_INTERP, PMC *pmc)>
+
+Queue black C<pmc> for C<gc_ms2_finish_marking>, to find whatever was stored
+into it.  Only black objects have C<PObj_GC_need_write_barrier_FLAG> set, and
+clearing it queues each of them once.  Nothing is queued by the final scan,
+no code storing into objects runs then.
+
+=cut
+
+*/
+
+static void
+gc_ms2_incremental_write_barrier(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_incremental_write_barrier)
+    MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    pmc_alloc_struct * const item = PMC2PAC(pmc);
+
+    PObj_GC_need_write_barrier_CLEAR(pmc);
+
+    if (self->marking == 1 && !PObj_on_free_list_TEST(pmc)
+    &&  PAC_IS_OLD(item) && !PAC_IS_RESCAN(item))
+        gc_ms2_move_to_rescan(interp, self, item);
+}
+
+
+/*
+
+=item C<static void gc_ms2_move_to_rescan(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item)>
+
+Move black C<item> from C<new_objects> to C<rescan>.
+
+=cut
+
+*/
+
+static void
+gc_ms2_move_to_rescan(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item))
+{
+    ASSERT_ARGS(gc_ms2_move_to_rescan)
+
+    Parrot_pa_remove(interp, self->new_objects, PAC_CELL(item));
+    PAC_SET_RESCAN_CELL(item, Parrot_pa_insert(interp, self->rescan, item));
 }
 
 
@@ -1121,16 +2114,25 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
         ARGIN(Parrot_Pointer_Array *list))
 {
     ASSERT_ARGS(gc_ms2_sweep_pmc_pool)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
     POINTER_ARRAY_ITER(list,
-        PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PMC *pmc = &item->pmc;
 
-        /* Paint live objects white */
-        if (PObj_live_TEST(pmc))
+        /* Paint live objects white. Including the ones left black by
+         * incremental marking, whatever their flags */
+        if (self->max_pause_us && PAC_IS_OLD(item)) {
+            PObj_live_CLEAR(pmc);
+            PObj_GC_need_write_barrier_CLEAR(pmc);
+            item->ptr = PAC_CELL(item);
+        }
+
+        else if (PObj_live_TEST(pmc))
             PObj_live_CLEAR(pmc);
 
         else if (!PObj_constant_TEST(pmc)) {
-            Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
+            Parrot_pa_remove(interp, list, PAC_CELL(PMC2PAC(pmc)));
 
             /* this is manual inlining of Parrot_pmc_destroy() */
             if (PObj_custom_destroy_TEST(pmc))
@@ -1144,6 +2146,7 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
             PObj_gc_CLEAR(pmc);
 
             Parrot_gc_pool_free(interp, pool, ptr);
+            interp->gc_sys->stats.mem_used_last_collect -= sizeof (PMC);
         });
 }
 
@@ -1168,7 +2171,7 @@ gc_ms2_destroy_pmc_pool(PARROT_INTERP,
 
     POINTER_ARRAY_ITER(list,
         PMC *pmc = &(((pmc_alloc_struct*)ptr)->pmc);
-        Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
+        Parrot_pa_remove(interp, list, PAC_CELL(PMC2PAC(pmc)));
 
         Parrot_pmc_destroy(interp, pmc);
         PObj_on_free_list_SET(pmc);
@@ -1207,6 +2210,7 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 
         else if (!PObj_constant_TEST(obj)) {
             Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
+            Parrot_str_forget_index(interp, obj);
             if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
                 Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Buffer*)obj);
 
@@ -1217,6 +2221,238 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 }
 
 
+/*
+
+=item C<static void gc_ms2_start_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Paint live objects in C<new_objects> white and leave the rest of
+C<objects> and C<strings> to be swept lazily.
+
+=cut
+
+*/
+
+static void
+gc_ms2_start_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_start_sweep)
+
+    gc_ms2_sweep_pmc_pool(interp, self->pmc_allocator, self->new_objects);
+
+    self->dead_objects = self->objects;
+    self->objects      = self->new_objects;
+    self->dead_strings = self->strings;
+    self->strings      = Parrot_pa_new(interp);
+    self->sweep_chunk  = 0;
+}
+
+
+/*
+
+=item C<static int gc_ms2_sweep_step(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweep the next chunk of C<dead_objects>, or of C<dead_strings> when all PMCs
+are swept.  Compacts the string pool after the last one.  Returns false when
+there's nothing left to sweep, or while sweeping already.
+
+=cut
+
+*/
+
+static int
+gc_ms2_sweep_step(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_sweep_step)
+
+    if (self->sweeping)
+        return 0;
+
+    if (self->dead_objects) {
+        Parrot_Pointer_Array * const list = self->dead_objects;
+
+        if (self->sweep_chunk < list->total_chunks) {
+            const size_t used = interp->gc_sys->stats.mem_used_last_collect;
+
+            /* Destructors may allocate */
+            ++self->gc_mark_block_level;
+            self->sweeping = 1;
+            gc_ms2_sweep_pmc_chunk(interp, self,
+                list->chunks[self->sweep_chunk++]);
+            self->sweeping = 0;
+            --self->gc_mark_block_level;
+
+            /* The collection accounted for freeing dead objects already */
+            interp->gc_sys->stats.mem_used_last_collect = used;
+            return 1;
+        }
+
+        Parrot_pa_destroy(interp, list);
+        self->dead_objects = NULL;
+        self->sweep_chunk  = 0;
+    }
+
+    if (self->dead_strings) {
+        Parrot_Pointer_Array * const list = self->dead_strings;
+
+        if (self->sweep_chunk < list->total_chunks) {
+            self->sweeping = 1;
+            gc_ms2_sweep_string_chunk(interp, self,
+                list->chunks[self->sweep_chunk++]);
+            self->sweeping = 0;
+            return 1;
+        }
+
+        Parrot_pa_destroy(interp, list);
+        self->dead_strings = NULL;
+        self->sweep_chunk  = 0;
+
+        gc_ms2_compact_memory_pool(interp);
+    }
+
+    return 0;
+}
+
+
+/*
+
+=item C<static void gc_ms2_finish_sweep(PARROT_INTERP, MarkSweep_GC *self)>
+
+Sweep whatever the last collection left.
+
+=cut
+
+*/
+
+static void
+gc_ms2_finish_sweep(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_finish_sweep)
+
+    while (gc_ms2_sweep_step(interp, self))
+        ;
+}
+
+
+/*
+
+=item C<static void gc_ms2_sweep_pmc_chunk(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array_Chunk *chunk)>
+
+Destroy dead PMCs in C<chunk> of C<dead_objects>.  Live and constant ones
+move to C<objects>, painted white.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_pmc_chunk(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array_Chunk *chunk))
+{
+    ASSERT_ARGS(gc_ms2_sweep_pmc_chunk)
+
+    POINTER_ARRAY_CHUNK_ITER(chunk,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PMC              * const pmc  = &item->pmc;
+
+        Parrot_pa_remove(interp, self->dead_objects, PAC_CELL(item));
+
+        if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
+            PObj_live_CLEAR(pmc);
+            item->ptr = Parrot_pa_insert(interp, self->objects, item);
+        }
+        else {
+            /* this is manual inlining of Parrot_pmc_destroy() */
+            if (PObj_custom_destroy_TEST(pmc))
+                VTABLE_destroy(interp, pmc);
+
+            if (pmc->vtable->attr_size && PMC_data(pmc))
+                Parrot_gc_free_pmc_attributes(interp, pmc);
+            PMC_data(pmc) = NULL;
+
+            PObj_on_free_list_SET(pmc);
+            PObj_gc_CLEAR(pmc);
+
+            Parrot_gc_pool_free(interp, self->pmc_allocator, item);
+        });
+}
+
+
+/*
+
+=item C<static void gc_ms2_sweep_string_chunk(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array_Chunk *chunk)>
+
+Free dead STRINGs in C<chunk> of C<dead_strings>.  Live and constant ones
+move to C<strings>, painted white.
+
+=cut
+
+*/
+
+static void
+gc_ms2_sweep_string_chunk(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array_Chunk *chunk))
+{
+    ASSERT_ARGS(gc_ms2_sweep_string_chunk)
+
+    POINTER_ARRAY_CHUNK_ITER(chunk,
+        string_alloc_struct * const item = (string_alloc_struct *)ptr;
+        STRING              * const str  = &item->str;
+
+        Parrot_pa_remove(interp, self->dead_strings, item->ptr);
+
+        if (PObj_live_TEST(str) || PObj_constant_TEST(str)) {
+            PObj_live_CLEAR(str);
+            item->ptr = Parrot_pa_insert(interp, self->strings, item);
+        }
+        else {
+            Parrot_str_forget_index(interp, str);
+
+            if (Buffer_bufstart(str) && !PObj_external_TEST(str))
+                Parrot_gc_str_free_buffer_storage(interp,
+                    &self->string_gc, (Buffer *)str);
+
+            PObj_on_free_list_SET(str);
+
+            Parrot_gc_pool_free(interp, self->string_allocator, item);
+        });
+}
+
+
+/*
+
+=item C<static int gc_ms2_is_unswept(PARROT_INTERP, MarkSweep_GC *self,
+Parrot_Pointer_Array *list, PObj *obj, void *item, void *cell)>
+
+Check that C<obj> is still in C<list>, C<dead_objects> or C<dead_strings>,
+to be freed from there.  Only unswept objects are live.  Constant ones and the
+ones freed by destructors while sweeping can be in either list.
+
+=cut
+
+*/
+
+static int
+gc_ms2_is_unswept(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
+        ARGIN_NULLOK(Parrot_Pointer_Array *list), ARGIN(PObj *obj),
+        ARGIN(void *item), ARGIN(void *cell))
+{
+    ASSERT_ARGS(gc_ms2_is_unswept)
+
+    if (!list)
+        return 0;
+
+    if (PObj_live_TEST(obj))
+        return 1;
+
+    if (PObj_constant_TEST(obj) || self->sweeping)
+        return Parrot_pa_is_owned(interp, list, item, cell);
+
+    return 0;
+}
+
+
 /*
 
 =item C<static int gc_ms2_is_ptr_owned(PARROT_INTERP, void *ptr, Pool_Allocator
@@ -1250,7 +2486,7 @@ gc_ms2_is_ptr_owned(PARROT_INTERP,
         return 0;
 
     /* Pool.is_owned isn't precise enough (yet) */
-    return Parrot_pa_is_owned(interp, list, item, item->ptr);
+    return Parrot_pa_is_owned(interp, list, item, PAC_CELL(item));
 }
 
 
@@ -200,6 +200,14 @@ typedef struct GC_Subsystem {
      *These will be called via the GC API functions Parrot_gc_func_name
      *e.g. read barrier && write barrier hooks can go here later ...*/
 
+    /* Record write to old PMC. Called via PARROT_GC_WRITE_BARRIER */
+    void (*write_barrier)(PARROT_INTERP, PMC *pmc);
+
+    /* Take a PMC out of (or put it back into) the collected heap. Called via
+     * Parrot_gc_pin_pmc and Parrot_gc_unpin_pmc */
+    void (*pin_pmc)(PARROT_INTERP, PMC *pmc);
+    void (*unpin_pmc)(PARROT_INTERP, PMC *pmc);
+
     /* Holds system-specific data structures */
     void * gc_private;
 } GC_Subsystem;
@@ -331,10 +339,49 @@ typedef struct Memory_Pools {
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
     UINTVAL num_early_PMCs_seen;  /* how many such PMCs has GC seen */
 
+    struct GC_Parallel_Mark *parallel_mark; /* helper threads for marking,
+                                               or NULL */
+
     /* private data for the GC subsystem */
     void *gc_private;             /* GC subsystem data */
 } Memory_Pools;
 
+/* One marking thread.  It marks through its own copy of the interpreter,
+ * whose gc_sys pushes gray PMCs onto the stack of this worker. */
+typedef struct GC_Mark_Worker {
+    struct GC_Parallel_Mark *pm;        /* Marking this worker belongs to */
+    Interp                   interp;    /* Interpreter to mark with */
+    GC_Subsystem             gc_sys;    /* gc_sys of interp */
+    PMC                    **stack;     /* Gray objects */
+    size_t                   count;     /* Number of gray objects */
+    size_t                   size;      /* Allocated size of stack */
+    Parrot_thread            thread;    /* Helper thread, unless first */
+    UINTVAL                  cycle;     /* Last marking joined */
+} GC_Mark_Worker;
+
+/* Parallel marking. See src/gc/parallel_mark.c */
+typedef struct GC_Parallel_Mark {
+    GC_Mark_Worker *workers;            /* First one is the collecting thread */
+    UINTVAL         num_workers;
+    int             trace_constants;    /* Scan children of constant PMCs */
+    int             started;            /* Helper threads are running */
+    int             shutdown;           /* Helper threads are to exit */
+
+    Parrot_mutex    lock;               /* Protects everything below */
+    Parrot_cond     start;              /* Signaled when cycle changes */
+    Parrot_cond     work;               /* Signaled when shared gets work or
+                                           all workers are idle */
+    Parrot_cond     done;               /* Signaled when a helper finished */
+    UINTVAL         cycle;              /* Number of markings started */
+    UINTVAL         finished;           /* Helpers finished current marking */
+    PMC           **shared;             /* Gray objects given away */
+    size_t          shared_count;
+    size_t          shared_size;
+
+    Parrot_atomic_integer idle;         /* Workers waiting for work, also
+                                           read without lock */
+} GC_Parallel_Mark;
+
 
 /* HEADERIZER BEGIN: src/gc/system.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -660,6 +707,43 @@ void Parrot_gc_ms2_init(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/gc_ms2.c */
 
+/* HEADERIZER BEGIN: src/gc/parallel_mark.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_parallel_mark_destroy(SHIM_INTERP,
+    ARGFREE_NOTNULL(GC_Parallel_Mark *pm))
+        __attribute__nonnull__(2);
+
+void Parrot_gc_parallel_mark_finish(SHIM_INTERP,
+    ARGMOD(GC_Parallel_Mark *pm))
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pm);
+
+PARROT_CAN_RETURN_NULL
+GC_Parallel_Mark * Parrot_gc_parallel_mark_new(SHIM_INTERP,
+    UINTVAL threads,
+    int trace_constants);
+
+PARROT_CANNOT_RETURN_NULL
+Interp * Parrot_gc_parallel_mark_start(PARROT_INTERP,
+    ARGMOD(GC_Parallel_Mark *pm))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pm);
+
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_destroy \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm))
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_finish \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm))
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pm))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/parallel_mark.c */
+
 /* HEADERIZER BEGIN: src/gc/string_gc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
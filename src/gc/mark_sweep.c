@@ -661,6 +661,8 @@ free_buffer(PARROT_INTERP,
 {
     ASSERT_ARGS(free_buffer)
 
+    Parrot_str_forget_index(interp, b);
+
     /* If there is no allocated buffer - bail out */
     if (!Buffer_buflen(b))
         return;
@@ -0,0 +1,541 @@
+/*
+Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/parallel_mark.c - Mark phase spread over several threads
+
+=head1 DESCRIPTION
+
+Helper threads for the mark phase of stop-the-world collectors.  The
+collecting thread traces the roots, then all workers blacken the gray
+objects found from them.
+
+Each worker has a stack of gray PMCs and marks through a private copy of the
+interpreter whose C<gc_sys> pushes onto this stack, so C<VTABLE_mark> and
+C<Parrot_gc_mark_PMC_alive> work unchanged.  A busy worker gives half of its
+stack away whenever some other worker is idle.  Marking is done when all
+workers are idle and nothing is left to take.
+
+Nothing but the live flag is written to objects while marking, so setting it
+needs no atomic instruction: two workers racing for an object can only both
+scan it, which is harmless.
+
+Workers read the heap while other workers mark it, so C<mark> vtables must not
+modify it.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "gc_private.h"
+
+/* Number of gray objects a worker takes from shared ones at once */
+#define GC_PARALLEL_MARK_CHUNK 256
+
+/* Worker owning an interpreter copy made by Parrot_gc_parallel_mark_start */
+#define MARK_WORKER(interp) \
+    ((GC_Mark_Worker *)((char *)(interp) - offsetof(GC_Mark_Worker, interp)))
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void gc_parallel_mark_drain(ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*worker);
+
+static void gc_parallel_mark_pmc_header(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1);
+
+static void gc_parallel_mark_pobj_header(PARROT_INTERP,
+    ARGIN_NULLOK(PObj *obj))
+        __attribute__nonnull__(1);
+
+static void gc_parallel_mark_reserve(
+    ARGMOD(PMC ***stack),
+    ARGMOD(size_t *size),
+    size_t count)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stack)
+        FUNC_MODIFIES(*size);
+
+static void gc_parallel_mark_share(
+    ARGMOD(GC_Parallel_Mark *pm),
+    ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pm)
+        FUNC_MODIFIES(*worker);
+
+static int gc_parallel_mark_take(
+    ARGMOD(GC_Parallel_Mark *pm),
+    ARGMOD(GC_Mark_Worker *worker))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pm)
+        FUNC_MODIFIES(*worker);
+
+PARROT_CAN_RETURN_NULL
+static void* gc_parallel_mark_thread(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_gc_parallel_mark_drain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_parallel_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_parallel_mark_pobj_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_gc_parallel_mark_reserve __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stack) \
+    , PARROT_ASSERT_ARG(size))
+#define ASSERT_ARGS_gc_parallel_mark_share __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_parallel_mark_take __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm) \
+    , PARROT_ASSERT_ARG(worker))
+#define ASSERT_ARGS_gc_parallel_mark_thread __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+
+/*
+
+=item C<GC_Parallel_Mark * Parrot_gc_parallel_mark_new(PARROT_INTERP, UINTVAL
+threads, int trace_constants)>
+
+Create parallel marking with C<threads> workers, including the collecting
+thread.  With C<trace_constants> children of constant PMCs are marked too.
+Returns NULL if there is nothing to parallelize.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+GC_Parallel_Mark *
+Parrot_gc_parallel_mark_new(SHIM_INTERP, UINTVAL threads, int trace_constants)
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_new)
+#ifdef PARROT_HAS_THREADS
+    GC_Parallel_Mark *pm;
+    UINTVAL           i;
+
+    if (threads < 2)
+        return NULL;
+
+    pm                  = mem_allocate_zeroed_typed(GC_Parallel_Mark);
+    pm->workers         = mem_allocate_n_zeroed_typed(threads, GC_Mark_Worker);
+    pm->num_workers     = threads;
+    pm->trace_constants = trace_constants;
+
+    for (i = 0; i < threads; ++i)
+        pm->workers[i].pm = pm;
+
+    MUTEX_INIT(pm->lock);
+    COND_INIT(pm->start);
+    COND_INIT(pm->work);
+    COND_INIT(pm->done);
+    PARROT_ATOMIC_INT_INIT(pm->idle);
+
+    return pm;
+#else
+    UNUSED(threads);
+    UNUSED(trace_constants);
+    return NULL;
+#endif
+}
+
+
+/*
+
+=item C<void Parrot_gc_parallel_mark_destroy(PARROT_INTERP, GC_Parallel_Mark
+*pm)>
+
+Stop the helper threads and free C<pm>.
+
+=cut
+
+*/
+
+void
+Parrot_gc_parallel_mark_destroy(SHIM_INTERP, ARGFREE_NOTNULL(GC_Parallel_Mark *pm))
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_destroy)
+    UINTVAL i;
+
+    if (pm->started) {
+        LOCK(pm->lock);
+        pm->shutdown = 1;
+        COND_BROADCAST(pm->start);
+        UNLOCK(pm->lock);
+
+        for (i = 1; i < pm->num_workers; ++i) {
+            void *retval;
+            JOIN(pm->workers[i].thread, retval);
+        }
+    }
+
+    for (i = 0; i < pm->num_workers; ++i)
+        if (pm->workers[i].stack)
+            mem_sys_free(pm->workers[i].stack);
+
+    if (pm->shared)
+        mem_sys_free(pm->shared);
+
+    PARROT_ATOMIC_INT_DESTROY(pm->idle);
+    COND_DESTROY(pm->done);
+    COND_DESTROY(pm->work);
+    COND_DESTROY(pm->start);
+    MUTEX_DESTROY(pm->lock);
+
+    mem_sys_free(pm->workers);
+    mem_sys_free(pm);
+}
+
+
+/*
+
+=item C<Interp * Parrot_gc_parallel_mark_start(PARROT_INTERP, GC_Parallel_Mark
+*pm)>
+
+Prepare the workers for marking.  Returns the interpreter to trace the roots
+with, which leaves them gray.  Nothing else may be marked until
+C<Parrot_gc_parallel_mark_finish>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+Interp *
+Parrot_gc_parallel_mark_start(PARROT_INTERP, ARGMOD(GC_Parallel_Mark *pm))
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_start)
+    UINTVAL i;
+
+    for (i = 0; i < pm->num_workers; ++i) {
+        GC_Mark_Worker * const worker = &pm->workers[i];
+
+        worker->gc_sys                  = *interp->gc_sys;
+        worker->gc_sys.mark_pmc_header  = gc_parallel_mark_pmc_header;
+        worker->gc_sys.mark_pobj_header = gc_parallel_mark_pobj_header;
+        worker->interp                  = *interp;
+        worker->interp.gc_sys           = &worker->gc_sys;
+    }
+
+    return &pm->workers[0].interp;
+}
+
+
+/*
+
+=item C<void Parrot_gc_parallel_mark_finish(PARROT_INTERP, GC_Parallel_Mark
+*pm)>
+
+Mark everything reachable from the gray objects, then return when all workers
+are done.
+
+=cut
+
+*/
+
+void
+Parrot_gc_parallel_mark_finish(SHIM_INTERP, ARGMOD(GC_Parallel_Mark *pm))
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_finish)
+
+    LOCK(pm->lock);
+    PARROT_ATOMIC_INT_SET(pm->idle, 0);
+    pm->finished = 0;
+
+    if (!pm->started) {
+        UINTVAL i;
+
+        for (i = 1; i < pm->num_workers; ++i) {
+            GC_Mark_Worker * const worker = &pm->workers[i];
+
+            worker->cycle = pm->cycle;
+            THREAD_CREATE_JOINABLE(worker->thread, gc_parallel_mark_thread,
+                worker);
+        }
+
+        pm->started = 1;
+    }
+
+    ++pm->cycle;
+    COND_BROADCAST(pm->start);
+    UNLOCK(pm->lock);
+
+    gc_parallel_mark_drain(&pm->workers[0]);
+
+    LOCK(pm->lock);
+    while (pm->finished < pm->num_workers - 1)
+        COND_WAIT(pm->done, pm->lock);
+    UNLOCK(pm->lock);
+}
+
+
+/*
+
+=item C<static void* gc_parallel_mark_thread(void *arg)>
+
+Body of a helper thread.  Takes part in every marking until shutdown.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void*
+gc_parallel_mark_thread(ARGIN(void *arg))
+{
+    ASSERT_ARGS(gc_parallel_mark_thread)
+    GC_Mark_Worker   * const worker = (GC_Mark_Worker *)arg;
+    GC_Parallel_Mark * const pm     = worker->pm;
+
+    for (;;) {
+        int shutdown;
+
+        LOCK(pm->lock);
+        while (pm->cycle == worker->cycle && !pm->shutdown)
+            COND_WAIT(pm->start, pm->lock);
+        worker->cycle = pm->cycle;
+        shutdown      = pm->shutdown;
+        UNLOCK(pm->lock);
+
+        if (shutdown)
+            break;
+
+        gc_parallel_mark_drain(worker);
+
+        LOCK(pm->lock);
+        ++pm->finished;
+        COND_SIGNAL(pm->done);
+        UNLOCK(pm->lock);
+    }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static void gc_parallel_mark_drain(GC_Mark_Worker *worker)>
+
+Blacken gray objects of C<worker>, and shared ones when it has none left,
+until marking is done.
+
+=cut
+
+*/
+
+static void
+gc_parallel_mark_drain(ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_parallel_mark_drain)
+    GC_Parallel_Mark * const pm     = worker->pm;
+    Interp           * const interp = &worker->interp;
+    UINTVAL                  counter = 0;
+
+    do {
+        while (worker->count) {
+            PMC * const pmc = worker->stack[--worker->count];
+
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+            /* Reading idle takes a lock on some platforms */
+            if (!(++counter & 0x3f) && worker->count > 1) {
+                INTVAL idle;
+                PARROT_ATOMIC_INT_GET(idle, pm->idle);
+                if (idle)
+                    gc_parallel_mark_share(pm, worker);
+            }
+        }
+    } while (gc_parallel_mark_take(pm, worker));
+}
+
+
+/*
+
+=item C<static void gc_parallel_mark_share(GC_Parallel_Mark *pm, GC_Mark_Worker
+*worker)>
+
+Give the bottom half of the stack of C<worker> to idle workers.  Objects
+deeper in the stack tend to lead to larger parts of the graph.
+
+=cut
+
+*/
+
+static void
+gc_parallel_mark_share(ARGMOD(GC_Parallel_Mark *pm), ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_parallel_mark_share)
+    const size_t n = worker->count / 2;
+
+    LOCK(pm->lock);
+
+    gc_parallel_mark_reserve(&pm->shared, &pm->shared_size, pm->shared_count + n);
+    mem_copy_n_typed(pm->shared + pm->shared_count, worker->stack, n, PMC *);
+    pm->shared_count += n;
+
+    COND_BROADCAST(pm->work);
+    UNLOCK(pm->lock);
+
+    worker->count -= n;
+    memmove(worker->stack, worker->stack + n, worker->count * sizeof (PMC *));
+}
+
+
+/*
+
+=item C<static int gc_parallel_mark_take(GC_Parallel_Mark *pm, GC_Mark_Worker
+*worker)>
+
+Wait until there are shared gray objects and move some to C<worker>, which
+has none.  Returns false when all workers are out of work.
+
+=cut
+
+*/
+
+static int
+gc_parallel_mark_take(ARGMOD(GC_Parallel_Mark *pm), ARGMOD(GC_Mark_Worker *worker))
+{
+    ASSERT_ARGS(gc_parallel_mark_take)
+    INTVAL idle;
+
+    LOCK(pm->lock);
+    PARROT_ATOMIC_INT_INC(idle, pm->idle);
+
+    while (!pm->shared_count && (UINTVAL)idle < pm->num_workers) {
+        COND_WAIT(pm->work, pm->lock);
+        PARROT_ATOMIC_INT_GET(idle, pm->idle);
+    }
+
+    if (pm->shared_count) {
+        const size_t n = pm->shared_count < GC_PARALLEL_MARK_CHUNK
+                       ? pm->shared_count
+                       : GC_PARALLEL_MARK_CHUNK;
+
+        pm->shared_count -= n;
+        gc_parallel_mark_reserve(&worker->stack, &worker->size, n);
+        mem_copy_n_typed(worker->stack, pm->shared + pm->shared_count, n, PMC *);
+        worker->count = n;
+
+        PARROT_ATOMIC_INT_DEC(idle, pm->idle);
+        UNLOCK(pm->lock);
+        return 1;
+    }
+
+    /* Wake up the other idle workers to finish */
+    COND_BROADCAST(pm->work);
+    UNLOCK(pm->lock);
+    return 0;
+}
+
+
+/*
+
+=item C<static void gc_parallel_mark_reserve(PMC ***stack, size_t *size, size_t
+count)>
+
+Grow C<stack> to hold at least C<count> objects.
+
+=cut
+
+*/
+
+static void
+gc_parallel_mark_reserve(ARGMOD(PMC ***stack), ARGMOD(size_t *size), size_t count)
+{
+    ASSERT_ARGS(gc_parallel_mark_reserve)
+
+    if (count > *size) {
+        size_t new_size = *size ? *size : 1024;
+
+        while (new_size < count)
+            new_size *= 2;
+
+        mem_realloc_n_typed(*stack, new_size, PMC *);
+        *size = new_size;
+    }
+}
+
+
+/*
+
+=item C<static void gc_parallel_mark_pmc_header(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void gc_parallel_mark_pobj_header(PARROT_INTERP, PObj *obj)>
+
+Mark functions of the interpreter copies.  A PMC marked live for the first
+time is pushed onto the stack of the worker marking it.
+
+=cut
+
+*/
+
+static void
+gc_parallel_mark_pmc_header(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(gc_parallel_mark_pmc_header)
+    GC_Mark_Worker * const worker = MARK_WORKER(interp);
+
+    if (!pmc || PObj_is_live_or_free_TESTALL(pmc))
+        return;
+
+    PObj_live_SET(pmc);
+
+    if (PObj_constant_TEST(pmc) && !worker->pm->trace_constants)
+        return;
+
+    if (worker->count == worker->size)
+        gc_parallel_mark_reserve(&worker->stack, &worker->size, worker->count + 1);
+
+    worker->stack[worker->count++] = pmc;
+}
+
+static void
+gc_parallel_mark_pobj_header(PARROT_INTERP, ARGIN_NULLOK(PObj *obj))
+{
+    ASSERT_ARGS(gc_parallel_mark_pobj_header)
+
+    if (obj) {
+        if (PObj_is_PMC_TEST(obj))
+            gc_parallel_mark_pmc_header(interp, (PMC *)obj);
+        else
+            PObj_live_SET(obj);
+    }
+}
+
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -23,6 +23,7 @@ I<What are these global variables?>
 #define INSIDE_GLOBAL_SETUP
 #include "parrot/parrot.h"
 #include "parrot/oplib/core_ops.h"
+#include "parrot/imageio.h"
 #include "global_setup.str"
 
 /* These functions are defined in the auto-generated file core_pmcs.c */
@@ -95,20 +96,27 @@ Parrot_gbl_set_config_hash_interpreter(PARROT_INTERP)
     PMC *config_hash = NULL;
 
     if (parrot_config_size_stored > 1) {
-        STRING *config_string;
+        STRING              *config_string;
+        const unsigned char *version;
 
         if (parrot_config_size_stored < 16)
             Parrot_ex_throw_from_c_args(interp, NULL,
                 EXCEPTION_INVALID_STRING_REPRESENTATION,
                 "Invalid config hash");
 
-        if (parrot_config_stored[14] != PARROT_PBC_MAJOR
-        ||  parrot_config_stored[15] != PARROT_PBC_MINOR)
+        /* the bytecode version is in the compact image header, or in the
+         * packfile header of older images */
+        version = memcmp(parrot_config_stored, IMAGE_COMPACT_MAGIC, 4) == 0
+                ? parrot_config_stored + 7
+                : parrot_config_stored + 14;
+
+        if (version[0] != PARROT_PBC_MAJOR
+        ||  version[1] != PARROT_PBC_MINOR)
             Parrot_ex_throw_from_c_args(interp, NULL,
                 EXCEPTION_INVALID_STRING_REPRESENTATION,
                 "Version %d.%d of config hash is invalid, expected %d.%d. "
                 "You're probably linking against an incompatible libparrot.",
-                parrot_config_stored[14], parrot_config_stored[15],
+                version[0], version[1],
                 PARROT_PBC_MAJOR, PARROT_PBC_MINOR);
 
         config_string =
@@ -7,13 +7,20 @@ src/hash.c - Hash table
 
 =head1 DESCRIPTION
 
-A hashtable contains an array of bucket indexes. Buckets are nodes in a
-linked list, each containing a C<void *> key and value. During hash
+A hashtable contains a store of buckets, each containing a C<void *> key
+and value, and an open addressed index of bucket pointers. During hash
 creation, the types of key and value as well as appropriate compare and
 hashing functions can be set.
 
+Every index slot has a control byte, telling whether the slot is empty,
+deleted or full. Full slots keep seven bits of the hash value of their key.
+Lookups scan the control bytes a group at a time (16 slots with SSE2, 8
+otherwise) and compare keys only for the slots whose control byte matches,
+until a group with an empty slot ends the search.
+
 This hash implementation uses just one piece of malloced memory. The
-C<< hash->buckets >> bucket store points to this region.
+C<< hash->buckets >> bucket store points to this region, followed by the
+index and its control bytes.
 
 =head2 Functions
 
@@ -25,6 +32,10 @@ C<< hash->buckets >> bucket store points to this region.
 
 #include "parrot/parrot.h"
 
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
 /* hash first allocation size */
 #define INITIAL_SIZE  2
 
@@ -32,6 +43,14 @@ C<< hash->buckets >> bucket store points to this region.
  * else we use system allocator */
 #define SPLIT_POINT  16
 
+/* first group of the probe sequence for a hash value */
+#define HASH_GROUP_START(hashval, mask) \
+    ((hashval) & (mask) & ~(UINTVAL)(HASH_GROUP_WIDTH - 1))
+
+/* control byte of a full slot, mixing in bits above those of the slot */
+#define HASH_CTRL_HASH(hashval) \
+    ((unsigned char)(((hashval) ^ ((hashval) >> 7)) & 0x7F))
+
 /* HEADERIZER HFILE: include/parrot/hash.h */
 
 /* HEADERIZER BEGIN: static */
@@ -44,6 +63,15 @@ static void allocate_buckets(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*hash);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_INLINE
+static size_t bucket_hashval(PARROT_INTERP,
+    ARGIN(const Hash *hash),
+    ARGIN(const HashBucket *bucket))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -120,6 +148,46 @@ static int hash_compare_string_enc(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL hash_find_slot(PARROT_INTERP,
+    ARGIN(const Hash *hash),
+    ARGIN_NULLOK(void *key),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+PARROT_INLINE
+static UINTVAL hash_first_bit(unsigned int bits);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static unsigned int hash_group_match(
+    ARGIN(const unsigned char *ctrl),
+    unsigned int byte)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static unsigned int hash_group_match_free(ARGIN(const unsigned char *ctrl))
+        __attribute__nonnull__(1);
+
+static void hash_index_insert(
+    ARGMOD(Hash *hash),
+    ARGIN(HashBucket *bucket),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*hash);
+
+static void hash_rehash_in_place(PARROT_INTERP, ARGMOD(Hash *hash))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*hash);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -181,6 +249,10 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_allocate_buckets __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_bucket_hashval __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash) \
+    , PARROT_ASSERT_ARG(bucket))
 #define ASSERT_ARGS_expand_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -210,6 +282,20 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(search_key) \
     , PARROT_ASSERT_ARG(bucket_key))
+#define ASSERT_ARGS_hash_find_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_hash_first_bit __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_hash_group_match __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ctrl))
+#define ASSERT_ARGS_hash_group_match_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ctrl))
+#define ASSERT_ARGS_hash_index_insert __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash) \
+    , PARROT_ASSERT_ARG(bucket))
+#define ASSERT_ARGS_hash_rehash_in_place __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_key_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -858,7 +944,7 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(const UINTVAL s
     HashBucket *new_buckets, *bucket;
     size_t i;
 
-    while (size > new_size)
+    while (size > N_BUCKETS(new_size))
         new_size <<= 1;
 
     if (new_size > SPLIT_POINT)
@@ -873,13 +959,18 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(const UINTVAL s
     hash->mask      = new_size - 1;
     hash->buckets   = new_buckets;
     hash->index     = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    hash->control   = (unsigned char *)(hash->index + new_size);
+    hash->deleted   = 0;
+    hash->free_list = NULL;
+
+    memset(hash->control, HASH_CTRL_EMPTY, HASH_CTRL_SIZE(new_size));
 
     /* add new buckets to free_list
      * lowest bucket is top on free list and will be used first */
 
     bucket = hash->buckets + N_BUCKETS(new_size) - 1;
     for (i = 0; i < N_BUCKETS(new_size); ++i, --bucket) {
-        bucket->next    = hash->free_list;
+        bucket->value   = hash->free_list;
         hash->free_list = bucket;
     }
 }
@@ -890,26 +981,17 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(const UINTVAL s
 
 Expands a hash when necessary.
 
-For a hashtable of size N, we use C<MAXFULL_PERCENT> % of N as the
-number of buckets. This way, as soon as we run out of buckets on the
-free list, we know that it's time to resize the hashtable.
-
-Algorithm for expansion: We exactly double the size of the hashtable.
-Keys are assigned to buckets with the formula
-
-    bucket_index = hash(key) % parrot_hash_size
+For an index of size N, we use 7/8 of N as the number of buckets (all of them
+while the index fits into a single probe group). This way, as soon as we run
+out of buckets on the free list, we know that it's time to resize the
+hashtable. Expansion also happens when the index is crowded with deleted
+slots, see C<hash_rehash_in_place>.
 
-When doubling the size of the hashtable, we know that every key is either
-already in the correct bucket, or belongs in the current bucket plus
-C<parrot_hash_size> (the old C<parrot_hash_size>). In fact, because the
-hashtable is always a power of two in size, it depends only on the next bit
-in the hash value, after the ones previously used.
-
-We scan through all the buckets in order, moving the buckets that need to be
-moved. No bucket will be scanned twice, and the cache should be reasonably
-happy because the hashtable accesses will be two parallel sequential scans.
-(Of course, this also mucks with the C<< ->next >> pointers, and they'll be
-all over memory.)
+Algorithm for expansion: We exactly double the size of the hashtable. The
+bucket store is copied as is, so buckets keep their order for linear
+iteration, and the new buckets go to the front of the free list. The index
+is rebuilt by inserting every full slot of the old index into the new one;
+deleted slots are dropped on the way.
 
 =cut
 
@@ -919,25 +1001,27 @@ static void
 expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
 {
     ASSERT_ARGS(expand_hash)
-    HashBucket  **new_index,  **index;
-    HashBucket   *new_buckets, *bucket;
+    HashBucket           **old_index   = hash->index;
+    const unsigned char   *old_control = hash->control;
+    HashBucket            *old_free    = hash->free_list;
+    HashBucket            *new_buckets, *bucket;
 
     void *        new_mem;
     void * const  old_mem    = hash->buckets;
     const UINTVAL old_size   = hash->mask + 1;
     const UINTVAL new_size   = old_size  << 1; /* Double. Right-shift is 2x */
-    const UINTVAL new_mask   = new_size   - 1;
-    size_t        offset, i;
+    size_t        i;
 
     /*
        allocate some less buckets
-       e.g. 3 buckets, 4 pointers:
-
-         +---+---+---+-+-+-+-+
-         | --> buckets |     |
-         +---+---+---+-+-+-+-+
-         ^             ^
-         | old_mem     | hash->index
+       e.g. 14 buckets, 16 pointers, 16 control bytes:
+
+         +---+---+---+-+-+-+-+-+-+
+         | --> buckets |     |   |
+         +---+---+---+-+-+-+-+-+-+
+         ^             ^     ^
+         | old_mem     |     | hash->control
+                       | hash->index
     */
 
     /* resize mem */
@@ -948,15 +1032,38 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
         new_mem  = Parrot_gc_allocate_fixed_size_storage(
                         interp, HASH_ALLOC_SIZE(new_size));
 
-    offset = (char *)new_mem - (char *)old_mem;
-
-    new_buckets = (HashBucket *)  new_mem;
-    new_index   = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    new_buckets = (HashBucket *)new_mem;
 
-    /* copy buckets and index */
-    mem_sys_memcopy(new_buckets, hash->buckets,
+    /* copy buckets, clear the new ones */
+    mem_sys_memcopy(new_buckets, old_mem,
             N_BUCKETS(old_size) * sizeof (HashBucket));
-    mem_sys_memcopy(new_index, hash->index, old_size * sizeof (HashBucket **));
+    memset(new_buckets + N_BUCKETS(old_size), 0,
+            (N_BUCKETS(new_size) - N_BUCKETS(old_size)) * sizeof (HashBucket));
+
+    /* update hash data */
+    hash->buckets   = new_buckets;
+    hash->index     = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    hash->control   = (unsigned char *)(hash->index + new_size);
+    hash->mask      = new_size - 1;
+    hash->deleted   = 0;
+
+    memset(hash->control, HASH_CTRL_EMPTY, HASH_CTRL_SIZE(new_size));
+
+    /* reloc pointers and rebuild the index */
+    for (i = 0; i < old_size; ++i) {
+        if (HASH_CTRL_IS_FULL(old_control[i])) {
+            bucket = new_buckets + (old_index[i] - (HashBucket *)old_mem);
+            hash_index_insert(hash, bucket, bucket_hashval(interp, hash, bucket));
+        }
+    }
+
+    /* reloc the remaining free list, if the index was crowded */
+    hash->free_list = NULL;
+    if (old_free) {
+        hash->free_list = new_buckets + (old_free - (HashBucket *)old_mem);
+        for (bucket = hash->free_list; bucket->value; bucket = (HashBucket *)bucket->value)
+            bucket->value = new_buckets + ((HashBucket *)bucket->value - (HashBucket *)old_mem);
+    }
 
     /* free */
     if (old_size > SPLIT_POINT)
@@ -964,72 +1071,255 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
     else
         Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_mem);
 
+    /* add new buckets to free_list
+     * lowest bucket is top on free list and will be used first */
+    bucket = new_buckets + N_BUCKETS(new_size) - 1;
+    for (i = N_BUCKETS(old_size); i < N_BUCKETS(new_size); ++i, --bucket) {
+        bucket->value   = hash->free_list;
+        hash->free_list = bucket;
+    }
+}
 
-    /* clear second half of the buckets, freed by old the index */
-    memset(new_buckets + N_BUCKETS(old_size), 0,
-            sizeof (HashBucket *) * old_size);
+/*
 
-    /* clear second half of the index */
-    memset(new_index + (old_size), 0, sizeof (HashBucket **) * old_size);
+=item C<static void hash_rehash_in_place(PARROT_INTERP, Hash *hash)>
 
+Rebuilds the index of a hash at its current size, dropping all deleted slots.
+Lookups for missing keys stop only at empty slots, so an index which
+accumulated many deleted slots gets cleaned up before it runs out of them.
 
+=cut
 
-    /*
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         |  buckets  | old_index |  new_index    |
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         ^                       ^
-         | new_mem               | hash->index
-    */
+*/
 
-    /* update hash data */
-    hash->index     = new_index;
-    hash->buckets   = new_buckets;
-    hash->mask      = new_mask;
+static void
+hash_rehash_in_place(PARROT_INTERP, ARGMOD(Hash *hash))
+{
+    ASSERT_ARGS(hash_rehash_in_place)
+    const UINTVAL       size    = hash->mask + 1;
+    HashBucket  ** const live   = mem_gc_allocate_n_typed(interp, hash->entries, HashBucket *);
+    UINTVAL             i, n    = 0;
 
-    /* reloc pointers and recalc bucket indices */
-    for (i = 0; i < old_size; ++i) {
-        index = new_index + i;
+    for (i = 0; i < size; ++i)
+        if (HASH_CTRL_IS_FULL(hash->control[i]))
+            live[n++] = hash->index[i];
 
-        while (*index != NULL) {
-            size_t new_loc;
-            size_t hashval;
+    memset(hash->control, HASH_CTRL_EMPTY, HASH_CTRL_SIZE(size));
+    hash->deleted = 0;
 
-            bucket = (HashBucket *)((char *)*index + offset);
+    for (i = 0; i < n; ++i)
+        hash_index_insert(hash, live[i], bucket_hashval(interp, hash, live[i]));
 
-            /* rehash the bucket */
-            if (hash->key_type == Hash_key_type_STRING
-            ||  hash->key_type == Hash_key_type_STRING_enc) {
-                STRING *s = (STRING *)bucket->key;
-                hashval   = s->hashval;
-            }
-            else {
-                hashval = key_hash(interp, hash, bucket->key);
-            }
+    mem_gc_free(interp, live);
+}
 
-            new_loc = hashval & new_mask;
+/*
 
-            if (i != new_loc) {
-                *index              = bucket->next;
-                bucket->next        = new_index[new_loc];
-                new_index[new_loc]  = bucket;
-            }
-            else {
-                *index = bucket;
-                index  = &bucket->next;
-            }
-        }
+=item C<static unsigned int hash_group_match(const unsigned char *ctrl, unsigned
+int byte)>
+
+Returns a bit mask of the control bytes in the group starting at C<ctrl> which
+are equal to C<byte>. Bit N stands for the Nth slot of the group. With SSE2 the
+whole group is compared at once.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static unsigned int
+hash_group_match(ARGIN(const unsigned char *ctrl), unsigned int byte)
+{
+    ASSERT_ARGS(hash_group_match)
+#ifdef __SSE2__
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (unsigned int)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else
+    unsigned int bits = 0, i;
+    for (i = 0; i < HASH_GROUP_WIDTH; ++i)
+        bits |= (unsigned int)(ctrl[i] == byte) << i;
+    return bits;
+#endif
+}
+
+/*
+
+=item C<static unsigned int hash_group_match_free(const unsigned char *ctrl)>
+
+Returns a bit mask of the empty or deleted slots in the group starting at
+C<ctrl>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static unsigned int
+hash_group_match_free(ARGIN(const unsigned char *ctrl))
+{
+    ASSERT_ARGS(hash_group_match_free)
+#ifdef __SSE2__
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+#else
+    unsigned int bits = 0, i;
+    for (i = 0; i < HASH_GROUP_WIDTH; ++i)
+        bits |= (unsigned int)(ctrl[i] >> 7) << i;
+    return bits;
+#endif
+}
+
+/*
+
+=item C<static UINTVAL hash_first_bit(unsigned int bits)>
+
+Returns the position of the lowest set bit in the non-zero C<bits>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+PARROT_INLINE
+static UINTVAL
+hash_first_bit(unsigned int bits)
+{
+    ASSERT_ARGS(hash_first_bit)
+#ifdef __GNUC__
+    return (UINTVAL)__builtin_ctz(bits);
+#else
+    UINTVAL pos = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++pos;
     }
+    return pos;
+#endif
+}
 
-    /* add new buckets to free_list
-     * lowest bucket is top on free list and will be used first */
-    bucket = new_buckets + N_BUCKETS(old_size);
-    for (i = N_BUCKETS(old_size)-1 ; i > 0; --i, ++bucket) {
-        bucket->next = bucket + 1;
+/*
+
+=item C<static size_t bucket_hashval(PARROT_INTERP, const Hash *hash, const
+HashBucket *bucket)>
+
+Returns the hash value of the key stored in C<bucket>. STRING keys have it
+cached already.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_INLINE
+static size_t
+bucket_hashval(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN(const HashBucket *bucket))
+{
+    ASSERT_ARGS(bucket_hashval)
+    if (hash->key_type == Hash_key_type_STRING
+    ||  hash->key_type == Hash_key_type_STRING_enc) {
+        const STRING * const s = (const STRING *)bucket->key;
+        return s->hashval;
+    }
+
+    return key_hash(interp, hash, bucket->key);
+}
+
+/*
+
+=item C<static void hash_index_insert(Hash *hash, HashBucket *bucket, size_t
+hashval)>
+
+Puts C<bucket> into the first empty or deleted slot on the probe sequence of
+C<hashval>. The index must have a free slot.
+
+Probing starts at the group holding slot C<hashval & mask> and visits the other
+groups in triangular steps, which reaches every group of a power of two sized
+index.
+
+=cut
+
+*/
+
+static void
+hash_index_insert(ARGMOD(Hash *hash), ARGIN(HashBucket *bucket), size_t hashval)
+{
+    ASSERT_ARGS(hash_index_insert)
+    const UINTVAL mask  = hash->mask;
+    UINTVAL       group = HASH_GROUP_START(hashval, mask);
+    UINTVAL       step  = 0;
+    UINTVAL       slot;
+
+    for (;;) {
+        unsigned int avail = hash_group_match_free(hash->control + group);
+
+        /* slots past the end of a small index only pad the group */
+        if (mask < HASH_GROUP_WIDTH - 1)
+            avail &= (1U << (mask + 1)) - 1;
+
+        if (avail) {
+            slot = group + hash_first_bit(avail);
+            break;
+        }
+
+        step += HASH_GROUP_WIDTH;
+        group = (group + step) & mask;
     }
 
-    bucket->next = NULL;
-    hash->free_list = new_buckets + N_BUCKETS(old_size);
+    if (hash->control[slot] == HASH_CTRL_DELETED)
+        --hash->deleted;
+
+    hash->control[slot] = HASH_CTRL_HASH(hashval);
+    hash->index[slot]   = bucket;
+}
+
+/*
+
+=item C<static INTVAL hash_find_slot(PARROT_INTERP, const Hash *hash, void *key,
+size_t hashval)>
+
+Returns the index slot holding the bucket for C<key>, or -1 if there is none.
+Only slots whose control byte matches the hash value are compared; the search
+ends at the first group with an empty slot.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+hash_find_slot(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *key),
+        size_t hashval)
+{
+    ASSERT_ARGS(hash_find_slot)
+    const UINTVAL       mask  = hash->mask;
+    const unsigned int  h2    = HASH_CTRL_HASH(hashval);
+    UINTVAL             group = HASH_GROUP_START(hashval, mask);
+    UINTVAL             step  = 0;
+
+    for (;;) {
+        const unsigned char * const ctrl  = hash->control + group;
+        unsigned int                match = hash_group_match(ctrl, h2);
+
+        while (match) {
+            const UINTVAL slot = group + hash_first_bit(match);
+            if (hash_compare(interp, hash, key, hash->index[slot]->key) == 0)
+                return slot;
+            match &= match - 1;
+        }
+
+        if (hash_group_match(ctrl, HASH_CTRL_EMPTY))
+            return -1;
+
+        step += HASH_GROUP_WIDTH;
+        if (step > mask)
+            return -1;
+        group = (group + step) & mask;
+    }
 }
 
 
@@ -1149,7 +1439,9 @@ parrot_create_hash(PARROT_INTERP, PARROT_DATA_TYPE val_type, Hash_key_type hkey_
     hash->seed       = interp->hash_seed;
     hash->mask       = 0;
     hash->entries    = 0;
+    hash->deleted    = 0;
     hash->index      = NULL;
+    hash->control    = NULL;
     hash->buckets    = NULL;
     hash->free_list  = NULL;
 
@@ -1315,19 +1607,11 @@ parrot_hash_get_bucket(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(cons
         return parrot_hash_get_bucket_string(interp, hash, s, hashval);
     }
     else {
-        const size_t hashval = key_hash(interp, hash,
-                                    PARROT_const_cast(void *, key));
-        HashBucket  *bucket  = hash->index[hashval & hash->mask];
-
-        while (bucket) {
-            if (hash_compare(interp, hash,
-                    PARROT_const_cast(void *, key),
-                    bucket->key) == 0)
-                break;
-            bucket = bucket->next;
-        }
+        void * const  k       = PARROT_const_cast(void *, key);
+        const INTVAL  slot    = hash_find_slot(interp, hash, k,
+                                    key_hash(interp, hash, k));
 
-        return bucket;
+        return slot < 0 ? NULL : hash->index[slot];
     }
 }
 
@@ -1394,26 +1678,42 @@ parrot_hash_get_bucket_string(PARROT_INTERP, ARGIN(const Hash *hash),
         ARGIN(STRING *s), UINTVAL hashval)
 {
     ASSERT_ARGS(parrot_hash_get_bucket_string)
-    HashBucket *bucket = hash->index[hashval & hash->mask];
+    const UINTVAL       mask  = hash->mask;
+    const unsigned int  h2    = HASH_CTRL_HASH(hashval);
+    UINTVAL             group = HASH_GROUP_START(hashval, mask);
+    UINTVAL             step  = 0;
+
+    for (;;) {
+        const unsigned char * const ctrl  = hash->control + group;
+        unsigned int                match = hash_group_match(ctrl, h2);
+
+        while (match) {
+            HashBucket * const bucket = hash->index[group + hash_first_bit(match)];
+            const STRING      *s2     = (const STRING *)bucket->key;
+
+            if (s == s2)
+                return bucket;
+
+            /* manually inline part of string_equal  */
+            if (hashval == s2->hashval) {
+                if (s->encoding == s2->encoding) {
+                    if ((STRING_byte_length(s) == STRING_byte_length(s2))
+                    && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
+                        return bucket;
+                } else if (STRING_equal(interp, s, s2))
+                        return bucket;
+            }
+            match &= match - 1;
+        }
 
-    while (bucket) {
-        const STRING *s2 = (const STRING *)bucket->key;
-        if (s == s2)
-            break;
+        if (hash_group_match(ctrl, HASH_CTRL_EMPTY))
+            return NULL;
 
-        /* manually inline part of string_equal  */
-        if (hashval == s2->hashval) {
-            if (s->encoding == s2->encoding) {
-                if ((STRING_byte_length(s) == STRING_byte_length(s2))
-                && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
-                    break;
-            } else if (STRING_equal(interp, s, s2))
-                    break;
-        }
-        bucket = bucket->next;
+        step += HASH_GROUP_WIDTH;
+        if (step > mask)
+            return NULL;
+        group = (group + step) & mask;
     }
-
-    return bucket;
 }
 
 
@@ -1449,15 +1749,23 @@ parrot_hash_store_value_in_bucket(PARROT_INTERP, ARGMOD(Hash *hash),
         if (!hash->free_list)
             expand_hash(interp, hash);
 
+        /* Too few empty slots left to end searches quickly. Clean up the
+           deleted ones, or grow if the hash is nearly full anyway */
+        else if (hash->entries + hash->deleted >= N_BUCKETS(hash->mask + 1)) {
+            if (hash->entries * 32 <= (hash->mask + 1) * 25)
+                hash_rehash_in_place(interp, hash);
+            else
+                expand_hash(interp, hash);
+        }
+
         bucket = hash->free_list;
 
         /* Add the value to the new bucket, increasing the count of elements */
         ++hash->entries;
-        hash->free_list                   = bucket->next;
-        bucket->key                       = key;
-        bucket->value                     = value;
-        bucket->next                      = hash->index[hashval & hash->mask];
-        hash->index[hashval & hash->mask] = bucket;
+        hash->free_list = (HashBucket *)bucket->value;
+        bucket->key     = key;
+        bucket->value   = value;
+        hash_index_insert(hash, bucket, (size_t)hashval);
     }
 }
 
@@ -1495,14 +1803,11 @@ parrot_hash_put(PARROT_INTERP, ARGMOD(Hash *hash),
             bucket  = parrot_hash_get_bucket_string(interp, hash, s, hashval);
         }
         else {
+            INTVAL slot;
             hashval = key_hash(interp, hash, key);
-            bucket  = hash->index[hashval & hash->mask];
-
-            while (bucket) {
-                if (hash_compare(interp, hash, key, bucket->key) == 0)
-                    break;
-                bucket = bucket->next;
-            }
+            slot    = hash_find_slot(interp, hash, key, hashval);
+            if (slot >= 0)
+                bucket = hash->index[slot];
         }
     }
 
@@ -1528,21 +1833,26 @@ void
 parrot_hash_delete(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN(void *key))
 {
     ASSERT_ARGS(parrot_hash_delete)
-    const UINTVAL hashval = key_hash(interp, hash, key) & hash->mask;
-    if (hash->buckets){
-        HashBucket   **prev   = &hash->index[hashval];
-        if (*prev) {
-            for (; *prev; prev = &(*prev)->next) {
-                HashBucket *current = *prev;
-                if (hash_compare(interp, hash, key, current->key) == 0) {
-                    *prev = current->next;
-                    --hash->entries;
-                    current->next    = hash->free_list;
-                    current->key     = NULL;
-                    hash->free_list = current;
-                    return;
-                }
+    if (hash->entries) {
+        const INTVAL slot = hash_find_slot(interp, hash, key,
+                                key_hash(interp, hash, key));
+        if (slot >= 0) {
+            HashBucket * const current = hash->index[slot];
+
+            /* A probe that reaches a group with an empty slot stops there
+               anyway, only in full groups the slot must stay occupied */
+            if (hash_group_match(hash->control + HASH_GROUP_START(slot, hash->mask),
+                    HASH_CTRL_EMPTY))
+                hash->control[slot] = HASH_CTRL_EMPTY;
+            else {
+                hash->control[slot] = HASH_CTRL_DELETED;
+                ++hash->deleted;
             }
+
+            --hash->entries;
+            current->key    = NULL;
+            current->value  = hash->free_list;
+            hash->free_list = current;
         }
     }
 }
@@ -1592,7 +1902,7 @@ parrot_hash_clone_prunable(PARROT_INTERP, ARGIN(const Hash *hash),
         else
             Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(dest->mask+1), dest->buckets);
     }
-    allocate_buckets(interp, dest, hash->mask);
+    allocate_buckets(interp, dest, hash->entries);
 
     parrot_hash_iterate(hash,
         void         *valtmp;
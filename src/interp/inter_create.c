@@ -427,6 +427,9 @@ Parrot_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg))
 
     Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
 
+    /* register frames, now that no context refers to them */
+    Parrot_pcc_destroy_frame_stack(interp);
+
     /* MMD cache */
     Parrot_mmd_cache_destroy(interp, interp->op_mmd_cache);
 
@@ -439,6 +442,9 @@ Parrot_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg))
     if (interp->initial_pf)
         PackFile_destroy(interp, interp->initial_pf);
 
+    if (interp->snapshot_pf)
+        PackFile_destroy(interp, interp->snapshot_pf);
+
     /* cache structure */
     destroy_object_cache(interp);
 
@@ -467,6 +473,9 @@ Parrot_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg))
         /* Finalize GC */
         Parrot_gc_finalize(interp);
 
+        /* in-place packfiles, now that no string points into them */
+        Parrot_destroy_mappings(interp);
+
         MUTEX_DESTROY(interpreter_array_mutex);
         mem_internal_free(interp);
 
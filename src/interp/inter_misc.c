@@ -258,6 +258,7 @@ interpinfo_p(PARROT_INTERP, INTVAL what)
         result = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_CONT:
+        Parrot_pcc_escape_context(interp, CURRENT_CONTEXT(interp));
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_OBJECT:
@@ -680,8 +680,8 @@ Parrot_io_puts(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(const char *s))
 
 =item C<INTVAL Parrot_io_putps(PARROT_INTERP, PMC *pmc, STRING *s)>
 
-Writes C<*s> to C<*pmc>. Parrot string version. Calls the C<puts> method
-on the filehandle PMC.
+Writes C<*s> to C<*pmc>. Parrot string version.  Sockets send it, other
+handles than FileHandles get it through their C<puts> method.
 
 =cut
 
@@ -711,6 +711,11 @@ Parrot_io_putps(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD_NULLOK(STRING *s))
         else
             result = Parrot_io_write_buffer(interp, pmc, s);
     }
+    else if (pmc->vtable->base_type == enum_class_Socket) {
+        if (STRING_IS_NULL(s))
+            return 0;
+        result = Parrot_io_send(interp, pmc, s);
+    }
     else
         Parrot_pcc_invoke_method_from_c_args(interp, pmc, CONST_STRING(interp, "puts"), "S->I", s, &result);
 
@@ -444,6 +444,10 @@ Parrot_io_peek_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle),
 This is called from C<Parrot_io_read_buffer()> to do line buffered reading if
 that is what is required.
 
+The newline is searched with C<memchr> over the whole buffered data, and the
+read position is updated once per line.  A line that crosses the end of the
+buffer is copied out per refill, growing the string storage geometrically.
+
 =cut
 
 */
@@ -453,13 +457,8 @@ size_t
 Parrot_io_readline_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle), ARGOUT(STRING **buf))
 {
     ASSERT_ARGS(Parrot_io_readline_buffer)
-    size_t l;
-    unsigned char *out_buf;
-    unsigned char *buf_start;
-    const INTVAL   buffer_flags = Parrot_io_get_buffer_flags(interp, filehandle);
-    unsigned char *buffer_next;
-    unsigned char *buffer_end;
-    size_t len;
+    size_t  l = 0;
+    size_t  limit;
     STRING *s;
 
     if (*buf == NULL) {
@@ -468,78 +467,72 @@ Parrot_io_readline_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle), ARGOUT(STRING
     s = *buf;
     s->strlen = 0;
 
+    /* if there is a buffer, readline is called by the read opcode
+     * - return at most that much
+     */
+    limit = s->bufused;
+
     /* fill empty buffer */
-    if (!(buffer_flags & PIO_BF_READBUF)) {
+    if (!(Parrot_io_get_buffer_flags(interp, filehandle) & PIO_BF_READBUF)) {
         if (Parrot_io_fill_readbuf(interp, filehandle) == 0) {
             s->bufused = 0;
             return 0;
         }
     }
 
-    /* Retrieve filled buffer */
-    buffer_next = Parrot_io_get_buffer_next(interp, filehandle);
-    buffer_end  = Parrot_io_get_buffer_end(interp, filehandle);
+    for (;;) {
+        unsigned char * const buffer_next = Parrot_io_get_buffer_next(interp, filehandle);
+        unsigned char * const buffer_end  = Parrot_io_get_buffer_end(interp, filehandle);
+        size_t                avail       = buffer_end - buffer_next;
+        const unsigned char  *eol;
+        size_t                len;
 
-    buf_start = buffer_next;
+        if (limit && avail > limit - l)
+            avail = limit - l;
 
-    for (l = 0; buffer_next < buffer_end;) {
-        ++l;
-        if (io_is_end_of_line((char *)buffer_next)) {
-            Parrot_io_set_buffer_next(interp, filehandle, ++buffer_next);
-            break;
+        eol = (const unsigned char *)memchr(buffer_next, '\n', avail);
+        len = eol ? (size_t)(eol - buffer_next) + 1 : avail;
+
+        if (l + len > Buffer_buflen(s)) {
+            /* exact size for a line within the buffer, doubling for long
+             * lines spanning refills */
+            size_t size = l + len;
+
+            if (l && size < 2 * l)
+                size = 2 * l;
+
+            s->bufused = l;
+            if (s->strstart)
+                Parrot_gc_reallocate_string_storage(interp, s, size);
+            else
+                Parrot_gc_allocate_string_storage(interp, s, size);
         }
 
-        Parrot_io_set_buffer_next(interp, filehandle, ++buffer_next);
+        memcpy((unsigned char *)s->strstart + l, buffer_next, len);
+        l += len;
 
-        /* if there is a buffer, readline is called by the read opcode
-         * - return just that part
-         */
-        if (s->bufused && l == s->bufused)
+        if (buffer_next + len < buffer_end) {
+            Parrot_io_set_buffer_next(interp, filehandle, buffer_next + len);
             break;
-        /* buffer completed; copy out and refill */
-        if (buffer_next == buffer_end) {
-            len = buffer_end - buf_start;
-            if (s->bufused < l) {
-                if (s->strstart) {
-                    Parrot_gc_reallocate_string_storage(interp, s, l);
-                }
-                else {
-                    Parrot_gc_allocate_string_storage(interp, s, l);
-                }
-            }
-            out_buf = (unsigned char*)s->strstart + s->strlen;
-            memcpy(out_buf, buf_start, len);
-            s->strlen = s->bufused = l;
-            if (Parrot_io_fill_readbuf(interp, filehandle) == 0)
-                return l;
-
-            buffer_next = Parrot_io_get_buffer_next(interp, filehandle);
-            buffer_end  = Parrot_io_get_buffer_end(interp, filehandle);
-            buf_start = Parrot_io_get_buffer_start(interp, filehandle);
-        }
-    }
-    if (s->bufused < l) {
-        if (s->strstart) {
-            Parrot_gc_reallocate_string_storage(interp, s, l);
-        }
-        else {
-            Parrot_gc_allocate_string_storage(interp, s, l);
         }
-    }
-    out_buf = (unsigned char*)s->strstart + s->strlen;
-    len = buffer_next - buf_start;
-    memcpy(out_buf, buf_start, len);
-    s->strlen = s->bufused = l;
 
-    /* check if buffer is finished */
-    if (buffer_next == buffer_end) {
+        /* buffer is finished */
         Parrot_io_set_buffer_flags(interp, filehandle,
                 (Parrot_io_get_buffer_flags(interp, filehandle) & ~PIO_BF_READBUF));
         Parrot_io_set_buffer_next(interp, filehandle,
                 Parrot_io_get_buffer_start(interp, filehandle));
         Parrot_io_set_buffer_end(interp, filehandle, NULL);
+
+        if (eol || l == limit)
+            break;
+
+        /* no newline yet; refill */
+        if (Parrot_io_fill_readbuf(interp, filehandle) == 0)
+            break;
     }
 
+    s->strlen = s->bufused = l;
+
     return l;
 }
 
@@ -63,6 +63,41 @@ Some ideas from AT&T SFIO.
 #define PIO_BF_WRITEBUF 00000004        /* Buffer is write-buffer       */
 #define PIO_BF_MMAP     00000010        /* Buffer mmap()ed              */
 
+/* Operations of an IOTask */
+typedef enum {
+    PIO_ASYNC_READ = 1,
+    PIO_ASYNC_WRITE,
+    PIO_ASYNC_ACCEPT
+} Parrot_io_async_op;
+
+
+/* Returned by socket calls on a non-blocking socket that is not ready */
+#define PIO_NOT_READY   (-2)
+
+/* Whether a non-blocking call failed only because it would block */
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+#  define PIO_WOULD_BLOCK(error) ((error) == EAGAIN || (error) == EWOULDBLOCK)
+#else
+#  define PIO_WOULD_BLOCK(error) ((error) == EAGAIN)
+#endif
+
+/* Asynchronous file I/O through io_uring, see src/io/uring.c */
+#if defined(PARROT_HAS_HEADER_LINUXIO_URING) && defined(PARROT_HAS_HEADER_SYSEPOLL)
+#  include <linux/io_uring.h>
+#  ifdef IORING_FEAT_RW_CUR_POS
+#    define PIO_HAS_RING 1
+#  endif
+#endif
+
+typedef struct Parrot_io_ring Parrot_io_ring;
+
+/* A read or write in flight on an io_uring */
+typedef struct Parrot_io_ring_req {
+    PIOHANDLE fd;       /* The file descriptor                          */
+    INTVAL    result;   /* Bytes transferred, or minus the system error */
+    size_t    length;   /* Bytes to transfer                            */
+    char      data[1];  /* The bytes to write, or those read            */
+} Parrot_io_ring_req;
 
 #define PIO_ACCMODE     0000003
 #define PIO_DEFAULTMODE DEFAULT_OPEN_MODE
@@ -86,6 +121,88 @@ typedef socklen_t Parrot_Socklen_t;
 typedef int Parrot_Socklen_t;
 #endif
 
+/* HEADERIZER BEGIN: src/io/uring.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_io_ring_advise(PARROT_INTERP,
+    ARGMOD(Parrot_io_ring *ring),
+    PIOHANDLE fd,
+    PIOOFF_T offset,
+    size_t length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ring);
+
+void Parrot_io_ring_close(PARROT_INTERP,
+    ARGFREE_NOTNULL(Parrot_io_ring *ring))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+Parrot_io_ring_req * Parrot_io_ring_complete(PARROT_INTERP,
+    ARGMOD(Parrot_io_ring *ring))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ring);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PIOHANDLE Parrot_io_ring_fd(ARGIN(const Parrot_io_ring *ring))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_ring * Parrot_io_ring_open(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+INTVAL Parrot_io_ring_queue(PARROT_INTERP,
+    ARGMOD(Parrot_io_ring *ring),
+    ARGMOD(Parrot_io_ring_req *req),
+    INTVAL write)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ring)
+        FUNC_MODIFIES(*req);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_ring_req * Parrot_io_ring_request(PARROT_INTERP,
+    PIOHANDLE fd,
+    size_t length)
+        __attribute__nonnull__(1);
+
+INTVAL Parrot_io_ring_submit(SHIM_INTERP,
+    ARGMOD(Parrot_io_ring *ring),
+    INTVAL wait)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ring);
+
+#define ASSERT_ARGS_Parrot_io_ring_advise __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ring))
+#define ASSERT_ARGS_Parrot_io_ring_close __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ring))
+#define ASSERT_ARGS_Parrot_io_ring_complete __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ring))
+#define ASSERT_ARGS_Parrot_io_ring_fd __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ring))
+#define ASSERT_ARGS_Parrot_io_ring_open __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_io_ring_queue __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ring) \
+    , PARROT_ASSERT_ARG(req))
+#define ASSERT_ARGS_Parrot_io_ring_request __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_io_ring_submit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ring))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/io/uring.c */
+
 #endif /* PARROT_IO_PRIVATE_H_GUARD */
 
 /*
@@ -95,7 +212,9 @@ typedef int Parrot_Socklen_t;
 F<src/io/api.c>,
 F<src/io/buffer.c>,
 F<src/io/portable.c>,
+F<src/io/reactor.c>,
 F<src/io/unix.c>,
+F<src/io/uring.c>,
 F<src/io/utf8.c>,
 F<src/io/io_win32.c>.
 
@@ -0,0 +1,1262 @@
+/*
+Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+src/io/reactor.c - Asynchronous I/O on the scheduler
+
+=head1 DESCRIPTION
+
+The asynchronous read, write and accept operations of FileHandle and Socket
+return an IOTask, which the scheduler hands to its reactor.  The reactor
+keeps the waiting tasks in a queue per file descriptor and watches the
+descriptors with epoll.  When a descriptor turns ready, the reactor runs the
+operations queued for it without blocking, stores their results in the tasks,
+and moves the finished tasks to the scheduler's list of active tasks.  The
+scheduler then invokes their code like that of any other task.
+
+Linux can't watch regular files with epoll.  Reads and writes of files go to
+an io_uring instead, see F<src/io/uring.c>, one operation per file at a time
+so they keep their order.  Operations on many files are submitted together
+each time the reactor is polled, and a read that fills its buffer also asks
+the kernel to read ahead.  Without io_uring they run right away.
+
+The reactor is polled without waiting whenever the scheduler refreshes its
+task list.  The C<sleep> opcode and C<IOTask.wait> wait for it, see
+C<Parrot_cx_run_io> in F<src/scheduler.c>.
+
+Platforms without epoll don't support asynchronous I/O yet.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/scheduler_private.h"
+#include "io_private.h"
+#include "pmc/pmc_scheduler.h"
+#include "pmc/pmc_iotask.h"
+#include "pmc/pmc_handle.h"
+#include "pmc/pmc_socket.h"
+#include "pmc/pmc_filehandle.h"
+
+#include "reactor.str"
+
+#ifdef PARROT_HAS_HEADER_SYSEPOLL
+#  include <sys/epoll.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/stat.h>
+
+/* The number of ready descriptors handled per epoll_wait call */
+#  define PIO_REACTOR_EVENTS 64
+
+/* How many times the length of a file read the kernel is asked to read ahead */
+#  define PIO_RING_READAHEAD 4
+
+#  ifndef MSG_NOSIGNAL
+#    define MSG_NOSIGNAL 0
+#  endif
+#endif
+
+/* HEADERIZER HFILE: include/parrot/io.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL io_async_is_closed(PARROT_INTERP, ARGIN(PMC *handle))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * io_async_task(PARROT_INTERP,
+    ARGIN(PMC *handle),
+    INTVAL op,
+    ARGIN_NULLOK(PMC *callback))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void io_reactor_activate(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*scheduler);
+
+static INTVAL io_reactor_attempt(PARROT_INTERP, ARGMOD(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*task);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * io_reactor_box_string(PARROT_INTERP, ARGIN(STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void io_reactor_fail_all(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    PIOHANDLE fd,
+    INTVAL error)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+static void io_reactor_file_read(PARROT_INTERP,
+    ARGMOD(PMC *filehandle),
+    ARGMOD(STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*filehandle)
+        FUNC_MODIFIES(*s);
+
+static INTVAL io_reactor_finish(PARROT_INTERP,
+    ARGMOD(PMC *task),
+    ARGIN(PMC *result),
+    INTVAL error)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*task);
+
+static int io_reactor_nonblocking(PIOHANDLE fd);
+static INTVAL io_reactor_poller(ARGMOD(PMC *scheduler))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*scheduler);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * io_reactor_read_buffer(PARROT_INTERP,
+    ARGMOD(PMC *filehandle),
+    INTVAL length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*filehandle);
+
+static void io_reactor_restore(PIOHANDLE fd, int flags);
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_io_ring * io_reactor_ring(PARROT_INTERP,
+    ARGMOD(PMC *scheduler))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+static INTVAL io_reactor_run(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    PIOHANDLE fd,
+    UINTVAL events)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+static void io_reactor_watch(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    PIOHANDLE fd)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+static INTVAL io_ring_reap(PARROT_INTERP, ARGMOD(PMC *scheduler))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+static void io_ring_start(PARROT_INTERP,
+    ARGMOD(PMC *scheduler),
+    PIOHANDLE fd)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*scheduler);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL io_ring_takes(PARROT_INTERP, ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_io_async_is_closed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle))
+#define ASSERT_ARGS_io_async_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle))
+#define ASSERT_ARGS_io_reactor_activate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler) \
+    , PARROT_ASSERT_ARG(task))
+#define ASSERT_ARGS_io_reactor_attempt __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task))
+#define ASSERT_ARGS_io_reactor_box_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_io_reactor_fail_all __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_reactor_file_read __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_io_reactor_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task) \
+    , PARROT_ASSERT_ARG(result))
+#define ASSERT_ARGS_io_reactor_nonblocking __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_io_reactor_poller __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_reactor_read_buffer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(filehandle))
+#define ASSERT_ARGS_io_reactor_restore __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_io_reactor_ring __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_reactor_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_reactor_watch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_ring_reap __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_ring_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(scheduler))
+#define ASSERT_ARGS_io_ring_takes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(task))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<PMC * Parrot_io_read_async(PARROT_INTERP, PMC *handle, INTVAL length,
+PMC *callback)>
+
+Reads up to C<length> bytes from C<handle> once it is readable.  An empty
+string means end of file.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_io_read_async(PARROT_INTERP, ARGMOD(PMC *handle), INTVAL length,
+        ARGIN_NULLOK(PMC *callback))
+{
+    ASSERT_ARGS(Parrot_io_read_async)
+    PMC * const task = io_async_task(interp, handle, PIO_ASYNC_READ, callback);
+
+    PARROT_IOTASK(task)->length = length > 0 ? length : PIO_BUFSIZE;
+    Parrot_cx_schedule_task(interp, task);
+
+    return task;
+}
+
+/*
+
+=item C<PMC * Parrot_io_write_async(PARROT_INTERP, PMC *handle, STRING *s, PMC
+*callback)>
+
+Writes all of C<s> to C<handle>, as fast as it accepts data.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_io_write_async(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(STRING *s),
+        ARGIN_NULLOK(PMC *callback))
+{
+    ASSERT_ARGS(Parrot_io_write_async)
+    PMC * const task = io_async_task(interp, handle, PIO_ASYNC_WRITE, callback);
+
+    /* keep the order of earlier buffered writes */
+    if (handle->vtable->base_type == enum_class_FileHandle)
+        Parrot_io_flush(interp, handle);
+
+    PARROT_IOTASK(task)->buffer = s;
+    Parrot_cx_schedule_task(interp, task);
+
+    return task;
+}
+
+/*
+
+=item C<PMC * Parrot_io_accept_async(PARROT_INTERP, PMC *socket, PMC *callback)>
+
+Accepts the next connection on the listening C<socket>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_io_accept_async(PARROT_INTERP, ARGMOD(PMC *socket), ARGIN_NULLOK(PMC *callback))
+{
+    ASSERT_ARGS(Parrot_io_accept_async)
+    PMC * const task = io_async_task(interp, socket, PIO_ASYNC_ACCEPT, callback);
+
+    if (socket->vtable->base_type != enum_class_Socket)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Can only accept on a Socket");
+
+    Parrot_cx_schedule_task(interp, task);
+
+    return task;
+}
+
+/*
+
+=item C<static PMC * io_async_task(PARROT_INTERP, PMC *handle, INTVAL op, PMC
+*callback)>
+
+Creates the IOTask for the operation C<op> on C<handle>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+io_async_task(PARROT_INTERP, ARGIN(PMC *handle), INTVAL op,
+        ARGIN_NULLOK(PMC *callback))
+{
+    ASSERT_ARGS(io_async_task)
+    PMC                      *task;
+    Parrot_IOTask_attributes *attrs;
+
+    if (handle->vtable->base_type != enum_class_FileHandle
+    &&  handle->vtable->base_type != enum_class_Socket)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Asynchronous I/O needs a FileHandle or a Socket");
+
+    if (io_async_is_closed(interp, handle))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot do asynchronous I/O on a closed handle");
+
+    task  = Parrot_pmc_new(interp, enum_class_IOTask);
+    attrs = PARROT_IOTASK(task);
+
+    attrs->handle    = handle;
+    attrs->op        = op;
+    attrs->codeblock = callback ? callback : PMCNULL;
+    attrs->subtype   = op == PIO_ASYNC_READ  ? CONST_STRING(interp, "read")
+                     : op == PIO_ASYNC_WRITE ? CONST_STRING(interp, "write")
+                     :                         CONST_STRING(interp, "accept");
+
+    return task;
+}
+
+/*
+
+=item C<static INTVAL io_async_is_closed(PARROT_INTERP, PMC *handle)>
+
+Returns whether C<handle> is closed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+io_async_is_closed(PARROT_INTERP, ARGIN(PMC *handle))
+{
+    ASSERT_ARGS(io_async_is_closed)
+
+    if (handle->vtable->base_type == enum_class_Socket)
+        return Parrot_io_socket_is_closed(handle);
+
+    return Parrot_io_is_closed_filehandle(interp, handle);
+}
+
+/*
+
+=item C<void Parrot_io_reactor_add(PARROT_INTERP, PMC *scheduler, PMC *task)>
+
+Runs the IOTask C<task> right away if nothing is queued for its descriptor
+and it does not block, otherwise queues it until the descriptor is ready.
+Called by the scheduler when the task is scheduled.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_add(PARROT_INTERP, ARGMOD(PMC *scheduler), ARGMOD(PMC *task))
+{
+    ASSERT_ARGS(Parrot_io_reactor_add)
+#ifdef PARROT_HAS_HEADER_SYSEPOLL
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PIOHANDLE fd;
+    PMC      *queue;
+
+    GETATTR_Handle_os_handle(interp, PARROT_IOTASK(task)->handle, fd);
+
+    PARROT_IOTASK(task)->status = CONST_STRING(interp, "waiting");
+
+    queue = fd < VTABLE_elements(interp, sched->io_queues)
+          ? VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd)
+          : PMCNULL;
+
+    if (PMC_IS_NULL(queue)) {
+        queue = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        VTABLE_set_pmc_keyed_int(interp, sched->io_queues, fd, queue);
+    }
+
+#  ifdef PIO_HAS_RING
+    if (io_ring_takes(interp, task) && io_reactor_ring(interp, scheduler)) {
+        VTABLE_push_pmc(interp, queue, task);
+        ++sched->io_pending;
+
+        if (VTABLE_elements(interp, queue) == 1)
+            io_ring_start(interp, scheduler, fd);
+        return;
+    }
+#  endif
+
+    if (VTABLE_elements(interp, queue) == 0 && io_reactor_attempt(interp, task)) {
+        io_reactor_activate(interp, scheduler, task);
+        return;
+    }
+
+    VTABLE_push_pmc(interp, queue, task);
+    ++sched->io_pending;
+    io_reactor_watch(interp, scheduler, fd);
+#else
+    UNUSED(scheduler);
+    UNUSED(task);
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+        "Asynchronous I/O is not available on this platform");
+#endif
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_pending(PARROT_INTERP, PMC *scheduler)>
+
+Returns the number of IOTasks waiting in the reactor of C<scheduler>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_io_reactor_pending(SHIM_INTERP, ARGIN(PMC *scheduler))
+{
+    ASSERT_ARGS(Parrot_io_reactor_pending)
+    return PARROT_SCHEDULER(scheduler)->io_pending;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_reactor_poll(PARROT_INTERP, PMC *scheduler, FLOATVAL
+timeout)>
+
+Waits up to C<timeout> seconds for a watched descriptor to turn ready, without
+limit if C<timeout> is negative, and runs the operations waiting for the ready
+descriptors.  Returns the number of tasks finished.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_reactor_poll(PARROT_INTERP, ARGMOD(PMC *scheduler), FLOATVAL timeout)
+{
+    ASSERT_ARGS(Parrot_io_reactor_poll)
+#ifdef PARROT_HAS_HEADER_SYSEPOLL
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    struct epoll_event events[PIO_REACTOR_EVENTS];
+    PIOHANDLE ring_fd  = PIO_INVALID_HANDLE;
+    INTVAL    finished = 0;
+    int       ms, ready, i;
+
+    if (sched->io_poller == PIO_INVALID_HANDLE)
+        return 0;
+
+#  ifdef PIO_HAS_RING
+    if (sched->io_ring) {
+        Parrot_io_ring * const ring = (Parrot_io_ring *)sched->io_ring;
+
+        /* one system call for all the file operations queued meanwhile */
+        Parrot_io_ring_submit(interp, ring, 0);
+        ring_fd   = Parrot_io_ring_fd(ring);
+        finished += io_ring_reap(interp, scheduler);
+    }
+#  endif
+
+    /* nothing could ever wake us */
+    if (timeout < 0.0 && sched->io_pending == 0)
+        return finished;
+
+    /* round up, so a short timeout does not turn into a busy loop */
+    ms = finished  ? 0
+       : timeout < 0.0 ? -1
+       : (int)(timeout * 1000.0 + 0.999);
+
+    ready = epoll_wait(sched->io_poller, events, PIO_REACTOR_EVENTS, ms);
+
+    for (i = 0; i < ready; ++i) {
+#  ifdef PIO_HAS_RING
+        if (events[i].data.fd == ring_fd) {
+            finished += io_ring_reap(interp, scheduler);
+            continue;
+        }
+#  endif
+        finished += io_reactor_run(interp, scheduler,
+                        events[i].data.fd, events[i].events);
+    }
+
+    return finished;
+#else
+    UNUSED(interp);
+    UNUSED(scheduler);
+    UNUSED(timeout);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_reactor_close(PARROT_INTERP, PMC *scheduler)>
+
+Closes the epoll descriptor and the io_uring of the reactor of C<scheduler>.
+
+=cut
+
+*/
+
+void
+Parrot_io_reactor_close(PARROT_INTERP, ARGMOD(PMC *scheduler))
+{
+    ASSERT_ARGS(Parrot_io_reactor_close)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+
+#ifdef PIO_HAS_RING
+    if (sched->io_ring)
+        Parrot_io_ring_close(interp, (Parrot_io_ring *)sched->io_ring);
+#else
+    UNUSED(interp);
+#endif
+
+    sched->io_ring = NULL;
+
+#ifdef PARROT_HAS_HEADER_SYSEPOLL
+    if (sched->io_poller != PIO_INVALID_HANDLE)
+        close(sched->io_poller);
+#endif
+
+    sched->io_poller = PIO_INVALID_HANDLE;
+}
+
+#ifdef PARROT_HAS_HEADER_SYSEPOLL
+
+/*
+
+=item C<static INTVAL io_reactor_run(PARROT_INTERP, PMC *scheduler, PIOHANDLE
+fd, UINTVAL events)>
+
+Runs the operations queued for C<fd> that C<events> allows, in order per
+direction, until one would block.  Returns the number of tasks finished.
+
+=cut
+
+*/
+
+static INTVAL
+io_reactor_run(PARROT_INTERP, ARGMOD(PMC *scheduler), PIOHANDLE fd, UINTVAL events)
+{
+    ASSERT_ARGS(io_reactor_run)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PMC * const queue    = VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd);
+    int         readable = (events & (EPOLLIN  | EPOLLERR | EPOLLHUP)) != 0;
+    int         writable = (events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0;
+    INTVAL      finished = 0;
+    INTVAL      i        = 0;
+
+    if (PMC_IS_NULL(queue))
+        return 0;
+
+    while (i < VTABLE_elements(interp, queue)) {
+        PMC * const task   = VTABLE_get_pmc_keyed_int(interp, queue, i);
+        const int   output = PARROT_IOTASK(task)->op == PIO_ASYNC_WRITE;
+
+        if ((output ? writable : readable) && io_reactor_attempt(interp, task)) {
+            VTABLE_delete_keyed_int(interp, queue, i);
+            --sched->io_pending;
+            io_reactor_activate(interp, scheduler, task);
+            ++finished;
+        }
+        else {
+            /* later operations in this direction wait for this one */
+            if (output)
+                writable = 0;
+            else
+                readable = 0;
+            ++i;
+        }
+    }
+
+    io_reactor_watch(interp, scheduler, fd);
+
+    return finished;
+}
+
+/*
+
+=item C<static void io_reactor_watch(PARROT_INTERP, PMC *scheduler, PIOHANDLE
+fd)>
+
+Registers with epoll the events the operations queued for C<fd> wait for,
+creating the epoll descriptor first if needed.  If that fails, all of them
+fail.
+
+=cut
+
+*/
+
+static void
+io_reactor_watch(PARROT_INTERP, ARGMOD(PMC *scheduler), PIOHANDLE fd)
+{
+    ASSERT_ARGS(io_reactor_watch)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PMC * const  queue   = VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd);
+    const INTVAL n       = VTABLE_elements(interp, queue);
+    const INTVAL watched = fd < VTABLE_elements(interp, sched->io_events)
+                         ? VTABLE_get_integer_keyed_int(interp, sched->io_events, fd)
+                         : 0;
+    INTVAL       wanted  = 0;
+    INTVAL       i;
+    struct epoll_event ev;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const task = VTABLE_get_pmc_keyed_int(interp, queue, i);
+        wanted |= PARROT_IOTASK(task)->op == PIO_ASYNC_WRITE ? EPOLLOUT : EPOLLIN;
+    }
+
+    if (wanted == watched)
+        return;
+
+    if (!io_reactor_poller(scheduler)) {
+        io_reactor_fail_all(interp, scheduler, fd, errno);
+        return;
+    }
+
+    ev.events  = (uint32_t)wanted;
+    ev.data.fd = fd;
+
+    /* a closed descriptor left the epoll set on its own, so DEL may fail */
+    if (epoll_ctl(sched->io_poller,
+            !watched ? EPOLL_CTL_ADD : wanted ? EPOLL_CTL_MOD : EPOLL_CTL_DEL,
+            fd, &ev) < 0 && wanted) {
+        io_reactor_fail_all(interp, scheduler, fd, errno);
+        return;
+    }
+
+    VTABLE_set_integer_keyed_int(interp, sched->io_events, fd, wanted);
+}
+
+/*
+
+=item C<static INTVAL io_reactor_poller(PMC *scheduler)>
+
+Creates the epoll descriptor of the reactor of C<scheduler> if needed.
+Returns 0 if that fails.
+
+=cut
+
+*/
+
+static INTVAL
+io_reactor_poller(ARGMOD(PMC *scheduler))
+{
+    ASSERT_ARGS(io_reactor_poller)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+
+    if (sched->io_poller == PIO_INVALID_HANDLE) {
+        sched->io_poller = epoll_create(PIO_NR_OPEN);
+        if (sched->io_poller < 0) {
+            sched->io_poller = PIO_INVALID_HANDLE;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static void io_reactor_fail_all(PARROT_INTERP, PMC *scheduler, PIOHANDLE
+fd, INTVAL error)>
+
+Fails every operation queued for C<fd> with the system error C<error>.
+
+=cut
+
+*/
+
+static void
+io_reactor_fail_all(PARROT_INTERP, ARGMOD(PMC *scheduler), PIOHANDLE fd, INTVAL error)
+{
+    ASSERT_ARGS(io_reactor_fail_all)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PMC * const queue = VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd);
+
+    while (VTABLE_elements(interp, queue) > 0) {
+        PMC * const task = VTABLE_shift_pmc(interp, queue);
+
+        io_reactor_finish(interp, task, PMCNULL, error);
+        --sched->io_pending;
+        io_reactor_activate(interp, scheduler, task);
+    }
+}
+
+/*
+
+=item C<static INTVAL io_reactor_attempt(PARROT_INTERP, PMC *task)>
+
+Runs the operation of C<task> without blocking.  Returns 1 if it finished,
+successfully or not, and 0 if it has to wait.
+
+=cut
+
+*/
+
+static INTVAL
+io_reactor_attempt(PARROT_INTERP, ARGMOD(PMC *task))
+{
+    ASSERT_ARGS(io_reactor_attempt)
+    Parrot_IOTask_attributes * const attrs  = PARROT_IOTASK(task);
+    PMC                      * const handle = attrs->handle;
+    const int is_socket = handle->vtable->base_type == enum_class_Socket;
+    PIOHANDLE fd;
+    ssize_t   got;
+    int       flags;
+
+    if (io_async_is_closed(interp, handle))
+        return io_reactor_finish(interp, task, PMCNULL, EBADF);
+
+    GETATTR_Handle_os_handle(interp, handle, fd);
+
+    switch (attrs->op) {
+      case PIO_ASYNC_READ:
+        {
+            STRING *s;
+
+            if (!is_socket
+            && (Parrot_io_get_buffer_flags(interp, handle) & PIO_BF_READBUF))
+                return io_reactor_finish(interp, task,
+                        io_reactor_read_buffer(interp, handle, attrs->length), 0);
+
+            s = Parrot_str_new_noinit(interp, attrs->length);
+
+            do {
+                if (is_socket)
+                    got = recv(fd, s->strstart, attrs->length, MSG_DONTWAIT);
+                else {
+                    flags = io_reactor_nonblocking(fd);
+                    got   = read(fd, s->strstart, attrs->length);
+                    io_reactor_restore(fd, flags);
+                }
+            } while (got < 0 && errno == EINTR);
+
+            if (got < 0)
+                return PIO_WOULD_BLOCK(errno)
+                     ? 0
+                     : io_reactor_finish(interp, task, PMCNULL, errno);
+
+            s->bufused = got;
+
+            if (is_socket) {
+                /* like Parrot_io_recv_unix */
+                s->encoding = Parrot_ascii_encoding_ptr;
+                s->strlen   = got;
+            }
+            else
+                io_reactor_file_read(interp, handle, s);
+
+            return io_reactor_finish(interp, task, io_reactor_box_string(interp, s), 0);
+        }
+
+      case PIO_ASYNC_WRITE:
+        {
+            STRING * const s = attrs->buffer;
+
+            while (attrs->length < (INTVAL)s->bufused) {
+                const char * const start = s->strstart + attrs->length;
+                const size_t       left  = s->bufused - attrs->length;
+
+                if (is_socket)
+                    got = send(fd, start, left, MSG_DONTWAIT | MSG_NOSIGNAL);
+                else {
+                    flags = io_reactor_nonblocking(fd);
+                    got   = write(fd, start, left);
+                    io_reactor_restore(fd, flags);
+                }
+
+                if (got < 0) {
+                    if (errno == EINTR)
+                        continue;
+
+                    return PIO_WOULD_BLOCK(errno)
+                         ? 0
+                         : io_reactor_finish(interp, task, PMCNULL, errno);
+                }
+
+                attrs->length += got;
+
+                if (!is_socket)
+                    Parrot_io_set_file_position(interp, handle,
+                        Parrot_io_get_file_position(interp, handle) + got);
+            }
+
+            return io_reactor_finish(interp, task,
+                Parrot_pmc_new_init_int(interp, enum_class_Integer, attrs->length), 0);
+        }
+
+      case PIO_ASYNC_ACCEPT:
+        {
+            PMC *conn;
+            int  error;
+
+            flags = io_reactor_nonblocking(fd);
+            conn  = PIO_ACCEPT(interp, handle);
+            error = errno;
+            io_reactor_restore(fd, flags);
+
+            if (!PMC_IS_NULL(conn))
+                return io_reactor_finish(interp, task, conn, 0);
+
+            /* the connection may be gone again */
+            if (PIO_WOULD_BLOCK(error) || error == EINTR || error == ECONNABORTED)
+                return 0;
+
+            return io_reactor_finish(interp, task, PMCNULL, error);
+        }
+
+      default:
+        return io_reactor_finish(interp, task, PMCNULL, EINVAL);
+    }
+}
+
+/*
+
+=item C<static void io_reactor_file_read(PARROT_INTERP, PMC *filehandle, STRING
+*s)>
+
+Gives C<s>, just read from C<filehandle>, the encoding of the handle, and
+moves the handle's position past it, or marks the end of the file if C<s> is
+empty.
+
+=cut
+
+*/
+
+static void
+io_reactor_file_read(PARROT_INTERP, ARGMOD(PMC *filehandle), ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(io_reactor_file_read)
+    STRING *encoding;
+
+    GETATTR_FileHandle_encoding(interp, filehandle, encoding);
+
+    if (!STRING_IS_NULL(encoding))
+        s->encoding = Parrot_get_encoding(interp,
+            Parrot_encoding_number(interp, encoding));
+
+    s->strlen = STRING_scan(interp, s);
+
+    if (s->bufused == 0)
+        Parrot_io_set_flags(interp, filehandle,
+            Parrot_io_get_flags(interp, filehandle) | PIO_F_EOF);
+    else
+        Parrot_io_set_file_position(interp, filehandle,
+            Parrot_io_get_file_position(interp, filehandle) + s->bufused);
+}
+
+/*
+
+=item C<static PMC * io_reactor_read_buffer(PARROT_INTERP, PMC *filehandle,
+INTVAL length)>
+
+Takes up to C<length> bytes from the read buffer of C<filehandle>, which holds
+data, and returns them in a String.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+io_reactor_read_buffer(PARROT_INTERP, ARGMOD(PMC *filehandle), INTVAL length)
+{
+    ASSERT_ARGS(io_reactor_read_buffer)
+    STRING *s = Parrot_str_new_noinit(interp, length);
+
+    s->bufused = length;
+    s->bufused = Parrot_io_read_buffer(interp, filehandle, &s);
+
+    return io_reactor_box_string(interp, s);
+}
+
+/*
+
+=item C<static PMC * io_reactor_box_string(PARROT_INTERP, STRING *s)>
+
+Returns a String PMC holding C<s>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+io_reactor_box_string(PARROT_INTERP, ARGIN(STRING *s))
+{
+    ASSERT_ARGS(io_reactor_box_string)
+    PMC * const result = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, result, s);
+
+    return result;
+}
+
+/*
+
+=item C<static INTVAL io_reactor_finish(PARROT_INTERP, PMC *task, PMC *result,
+INTVAL error)>
+
+Records that the operation of C<task> completed with C<result>, or failed with
+the system error C<error>.  Returns 1.
+
+=cut
+
+*/
+
+static INTVAL
+io_reactor_finish(PARROT_INTERP, ARGMOD(PMC *task), ARGIN(PMC *result), INTVAL error)
+{
+    ASSERT_ARGS(io_reactor_finish)
+    Parrot_IOTask_attributes * const attrs = PARROT_IOTASK(task);
+
+    attrs->result = result;
+    attrs->error  = error;
+    attrs->status = error ? CONST_STRING(interp, "failed")
+                          : CONST_STRING(interp, "completed");
+
+    return 1;
+}
+
+/*
+
+=item C<static void io_reactor_activate(PARROT_INTERP, PMC *scheduler, PMC
+*task)>
+
+Moves the finished C<task> to the active tasks of C<scheduler>, which invokes
+its code at the next opportunity.
+
+=cut
+
+*/
+
+static void
+io_reactor_activate(PARROT_INTERP, ARGMOD(PMC *scheduler), ARGIN(PMC *task))
+{
+    ASSERT_ARGS(io_reactor_activate)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+
+    VTABLE_push_integer(interp, sched->task_index, VTABLE_get_integer(interp, task));
+    SCHEDULER_cache_valid_CLEAR(scheduler);
+    Parrot_cx_runloop_wake(interp, scheduler);
+}
+
+#  ifdef PIO_HAS_RING
+
+/*
+
+=item C<static INTVAL io_ring_takes(PARROT_INTERP, PMC *task)>
+
+Returns whether the operation of C<task> goes to the io_uring: a read or write
+of a regular file, which epoll can't wait for.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+io_ring_takes(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(io_ring_takes)
+    Parrot_IOTask_attributes * const attrs = PARROT_IOTASK(task);
+    struct stat buf;
+
+    if (attrs->handle->vtable->base_type != enum_class_FileHandle
+    ||  attrs->op == PIO_ASYNC_ACCEPT)
+        return 0;
+
+    /* the open flags don't tell a file from a FIFO or a device */
+    if (fstat(Parrot_io_get_os_handle(interp, attrs->handle), &buf) < 0)
+        return 0;
+
+    return S_ISREG(buf.st_mode);
+}
+
+/*
+
+=item C<static Parrot_io_ring * io_reactor_ring(PARROT_INTERP, PMC *scheduler)>
+
+Returns the io_uring of the reactor of C<scheduler>, setting it up and
+watching its descriptor the first time, or NULL if the kernel does not
+support io_uring.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_io_ring *
+io_reactor_ring(PARROT_INTERP, ARGMOD(PMC *scheduler))
+{
+    ASSERT_ARGS(io_reactor_ring)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    Parrot_io_ring *ring = (Parrot_io_ring *)sched->io_ring;
+
+    if (!ring) {
+        struct epoll_event ev;
+
+        if (!io_reactor_poller(scheduler))
+            return NULL;
+
+        ring = Parrot_io_ring_open(interp);
+
+        if (Parrot_io_ring_fd(ring) != PIO_INVALID_HANDLE) {
+            ev.events  = EPOLLIN;
+            ev.data.fd = Parrot_io_ring_fd(ring);
+
+            /* try again with the next file operation */
+            if (epoll_ctl(sched->io_poller, EPOLL_CTL_ADD, ev.data.fd, &ev) < 0) {
+                Parrot_io_ring_close(interp, ring);
+                return NULL;
+            }
+        }
+
+        sched->io_ring = ring;
+    }
+
+    return Parrot_io_ring_fd(ring) != PIO_INVALID_HANDLE ? ring : NULL;
+}
+
+/*
+
+=item C<static void io_ring_start(PARROT_INTERP, PMC *scheduler, PIOHANDLE fd)>
+
+Queues the first operation waiting for the file C<fd> on the io_uring.
+Operations that need no system call, or don't fit on the ring, run right
+away, and so on until one is queued or none is left.
+
+=cut
+
+*/
+
+static void
+io_ring_start(PARROT_INTERP, ARGMOD(PMC *scheduler), PIOHANDLE fd)
+{
+    ASSERT_ARGS(io_ring_start)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    Parrot_io_ring * const ring  = (Parrot_io_ring *)sched->io_ring;
+    PMC            * const queue = VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd);
+
+    while (VTABLE_elements(interp, queue) > 0) {
+        PMC * const task = VTABLE_get_pmc_keyed_int(interp, queue, 0);
+        Parrot_IOTask_attributes * const attrs = PARROT_IOTASK(task);
+        const INTVAL write = attrs->op == PIO_ASYNC_WRITE;
+
+        /* a closed handle fails, and the read buffer serves a read */
+        if (!io_async_is_closed(interp, attrs->handle)
+        &&  (write || !(Parrot_io_get_buffer_flags(interp, attrs->handle) & PIO_BF_READBUF))) {
+            STRING * const s = attrs->buffer;
+            Parrot_io_ring_req * const req = Parrot_io_ring_request(interp, fd,
+                write ? s->bufused - attrs->length : (size_t)attrs->length);
+
+            if (write)
+                memcpy(req->data, s->strstart + attrs->length, req->length);
+
+            if (Parrot_io_ring_queue(interp, ring, req, write) == 0)
+                return;
+
+            mem_gc_free(interp, req);
+        }
+
+        /* only a device or a FIFO can block, then epoll waits for it */
+        if (!io_reactor_attempt(interp, task)) {
+            io_reactor_watch(interp, scheduler, fd);
+            return;
+        }
+
+        VTABLE_shift_pmc(interp, queue);
+        --sched->io_pending;
+        io_reactor_activate(interp, scheduler, task);
+    }
+}
+
+/*
+
+=item C<static INTVAL io_ring_reap(PARROT_INTERP, PMC *scheduler)>
+
+Finishes the operations the io_uring completed, and starts the next ones
+waiting for their files.  Returns the number of tasks finished.
+
+=cut
+
+*/
+
+static INTVAL
+io_ring_reap(PARROT_INTERP, ARGMOD(PMC *scheduler))
+{
+    ASSERT_ARGS(io_ring_reap)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    Parrot_io_ring * const ring     = (Parrot_io_ring *)sched->io_ring;
+    INTVAL                 finished = 0;
+    Parrot_io_ring_req    *req;
+
+    while ((req = Parrot_io_ring_complete(interp, ring)) != NULL) {
+        const PIOHANDLE fd = req->fd;
+        PMC * const queue  = VTABLE_get_pmc_keyed_int(interp, sched->io_queues, fd);
+        PMC * const task   = VTABLE_get_pmc_keyed_int(interp, queue, 0);
+        Parrot_IOTask_attributes * const attrs  = PARROT_IOTASK(task);
+        PMC                      * const handle = attrs->handle;
+
+        if (req->result < 0)
+            io_reactor_finish(interp, task, PMCNULL, -req->result);
+
+        else if (attrs->op == PIO_ASYNC_WRITE) {
+            attrs->length += req->result;
+            Parrot_io_set_file_position(interp, handle,
+                Parrot_io_get_file_position(interp, handle) + req->result);
+
+            /* a short write goes on with the rest */
+            if (req->result > 0 && attrs->length < (INTVAL)attrs->buffer->bufused) {
+                mem_gc_free(interp, req);
+                io_ring_start(interp, scheduler, fd);
+                continue;
+            }
+
+            io_reactor_finish(interp, task,
+                Parrot_pmc_new_init_int(interp, enum_class_Integer, attrs->length), 0);
+        }
+
+        else {
+            STRING * const s = Parrot_str_new_noinit(interp, req->result);
+
+            memcpy(s->strstart, req->data, req->result);
+            s->bufused = req->result;
+            io_reactor_file_read(interp, handle, s);
+
+            /* a full read looks like a sequential scan */
+            if (req->result == attrs->length)
+                Parrot_io_ring_advise(interp, ring, fd,
+                    Parrot_io_get_file_position(interp, handle),
+                    attrs->length * PIO_RING_READAHEAD);
+
+            io_reactor_finish(interp, task, io_reactor_box_string(interp, s), 0);
+        }
+
+        mem_gc_free(interp, req);
+        VTABLE_shift_pmc(interp, queue);
+        --sched->io_pending;
+        io_reactor_activate(interp, scheduler, task);
+        ++finished;
+
+        io_ring_start(interp, scheduler, fd);
+    }
+
+    return finished;
+}
+
+#  endif /* PIO_HAS_RING */
+
+/*
+
+=item C<static int io_reactor_nonblocking(PIOHANDLE fd)>
+
+Switches C<fd> to non-blocking mode for one operation.  Returns the flags to
+restore.
+
+=item C<static void io_reactor_restore(PIOHANDLE fd, int flags)>
+
+Restores the flags of C<fd> after the operation.
+
+=cut
+
+*/
+
+static int
+io_reactor_nonblocking(PIOHANDLE fd)
+{
+    ASSERT_ARGS(io_reactor_nonblocking)
+    const int flags = fcntl(fd, F_GETFL, 0);
+
+    if (flags >= 0 && !(flags & O_NONBLOCK))
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    return flags;
+}
+
+static void
+io_reactor_restore(PIOHANDLE fd, int flags)
+{
+    ASSERT_ARGS(io_reactor_restore)
+
+    if (flags >= 0 && !(flags & O_NONBLOCK)) {
+        /* keep the errno of the operation */
+        const int error = errno;
+        fcntl(fd, F_SETFL, flags);
+        errno = error;
+    }
+}
+
+#endif /* PARROT_HAS_HEADER_SYSEPOLL */
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/scheduler.c>, F<src/pmc/iotask.pmc>, F<src/io/socket_unix.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -21,6 +21,7 @@ These are the primary interface functions for working with socket objects.
 #include "io_private.h"
 #include "api.str"
 #include "pmc/pmc_socket.h"
+#include "pmc/pmc_bytebuffer.h"
 
 #include <stdarg.h>
 
@@ -200,7 +201,8 @@ Parrot_io_socket(PARROT_INTERP, ARGMOD_NULLOK(PMC *socket), INTVAL fam,
 =item C<INTVAL Parrot_io_recv(PARROT_INTERP, PMC *pmc, STRING **buf)>
 
 Receives a message from the connected socket C<*pmc> in C<*buf>.  Returns C<-1>
-if it fails.
+if it fails, or C<PIO_NOT_READY> with a null C<*buf> if the socket is
+non-blocking and has no data.
 
 =cut
 
@@ -222,7 +224,8 @@ Parrot_io_recv(PARROT_INTERP, ARGMOD(PMC *pmc), ARGOUT(STRING **buf))
 =item C<INTVAL Parrot_io_send(PARROT_INTERP, PMC *pmc, STRING *buf)>
 
 Sends the message C<*buf> to the connected socket C<*pmc>.  Returns
-C<-1> if it cannot send the message.
+C<-1> if it cannot send the message, or C<PIO_NOT_READY> if the socket is
+non-blocking and cannot take any data.
 
 =cut
 
@@ -242,6 +245,165 @@ Parrot_io_send(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(STRING *buf))
 
 /*
 
+=item C<INTVAL Parrot_io_writev(PARROT_INTERP, PMC *pmc, PMC *strings)>
+
+Sends the strings in the array C<*strings> to the connected socket C<*pmc>
+with scatter-gather writes.  Returns the number of bytes sent, C<-1> if it
+cannot send them, or C<PIO_NOT_READY> if the socket is non-blocking and
+cannot take any data.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_io_writev(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(PMC *strings))
+{
+    ASSERT_ARGS(Parrot_io_writev)
+    if (Parrot_io_socket_is_closed(pmc))
+        return -1;
+
+    return PIO_WRITEV(interp, pmc, strings);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_sendfile(PARROT_INTERP, PMC *pmc, PMC *file, PIOOFF_T
+offset, INTVAL length)>
+
+Sends C<length> bytes of the open FileHandle C<*file>, or all up to its end if
+C<length> is not positive, to the connected socket C<*pmc> without reading
+them into a STRING.  A file is sent from C<offset> and keeps its position, a
+pipe from where it was read so far.  Returns the number of bytes sent, C<-1>
+if it cannot send them, or C<PIO_NOT_READY> if the socket is non-blocking and
+cannot take any data.  Throws if C<offset> is negative.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_io_sendfile(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *file),
+        PIOOFF_T offset, INTVAL length)
+{
+    ASSERT_ARGS(Parrot_io_sendfile)
+
+    if (file->vtable->base_type != enum_class_FileHandle
+    ||  Parrot_io_is_closed_filehandle(interp, file))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Can only send an open FileHandle");
+
+    if (offset < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_OUT_OF_BOUNDS,
+            "Cannot send a file from a negative offset");
+
+    if (Parrot_io_socket_is_closed(pmc))
+        return -1;
+
+    /* what was written to the file must be there before it is sent */
+    if (Parrot_io_get_buffer_flags(interp, file) & PIO_BF_WRITEBUF)
+        Parrot_io_flush_buffer(interp, file);
+
+    return PIO_SENDFILE(interp, pmc, file, offset, length);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_recv_into(PARROT_INTERP, PMC *pmc, PMC *buffer, INTVAL
+length)>
+
+Receives up to C<length> bytes from the connected socket C<*pmc>, or up to
+the size of its receive buffer if C<length> is not positive, and appends
+them to the ByteBuffer C<*buffer>.  Returns the number of bytes received,
+C<-1> if it fails, or C<PIO_NOT_READY> if the socket is non-blocking and has
+no data.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_io_recv_into(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *buffer), INTVAL length)
+{
+    ASSERT_ARGS(Parrot_io_recv_into)
+    unsigned char *content;
+    INTVAL         size, received;
+
+    if (buffer->vtable->base_type != enum_class_ByteBuffer)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can only receive into a ByteBuffer");
+
+    if (Parrot_io_socket_is_closed(pmc))
+        return -1;
+
+    if (length <= 0)
+        length = PARROT_SOCKET(pmc)->recv_size;
+
+    /* make room at the end, then give back what was not filled */
+    size = VTABLE_elements(interp, buffer);
+    VTABLE_set_integer_native(interp, buffer, size + length);
+    GETATTR_ByteBuffer_content(interp, buffer, content);
+
+    received = PIO_RECV_BYTES(interp, pmc, (char *)content + size, length);
+
+    VTABLE_set_integer_native(interp, buffer, size + (received > 0 ? received : 0));
+
+    return received;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_set_blocking(PARROT_INTERP, PMC *pmc, INTVAL blocking)>
+
+Switches the socket C<*pmc> to blocking mode if C<blocking> is true, and to
+non-blocking mode otherwise.  Returns C<-1> if it fails.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_io_set_blocking(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL blocking)
+{
+    ASSERT_ARGS(Parrot_io_set_blocking)
+    if (Parrot_io_socket_is_closed(pmc))
+        return -1;
+
+    return PIO_SET_BLOCKING(interp, pmc, blocking);
+}
+
+/*
+
+=item C<char * Parrot_io_socket_recv_buffer(PARROT_INTERP, PMC *socket)>
+
+Returns the receive buffer of C<*socket>, allocating it on first use.  Its
+size is the C<recv_size> attribute.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+char *
+Parrot_io_socket_recv_buffer(PARROT_INTERP, ARGMOD(PMC *socket))
+{
+    ASSERT_ARGS(Parrot_io_socket_recv_buffer)
+    Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+
+    if (!io->recv_buf)
+        io->recv_buf = mem_gc_allocate_n_typed(interp, io->recv_size, char);
+
+    return io->recv_buf;
+}
+
+/*
+
 =item C<INTVAL Parrot_io_connect(PARROT_INTERP, PMC *pmc, PMC *address)>
 
 Connects C<*pmc> to C<*address>.  Returns C<-1> on failure.
@@ -34,12 +34,38 @@ APitUE - W. Richard Stevens, AT&T SFIO, Perl 5 (Nick Ing-Simmons)
 #ifdef PIO_OS_UNIX
 
 #  include <sys/socket.h>
+#  include <sys/uio.h>
+#  include <fcntl.h>
+#  include <limits.h>
+#  ifdef PARROT_HAS_HEADER_SYSSENDFILE
+#    include <sys/sendfile.h>
+#  endif
+
+/* The most strings passed to one writev call */
+#  if defined(IOV_MAX) && IOV_MAX < 64
+#    define PIO_IOV_MAX IOV_MAX
+#  else
+#    define PIO_IOV_MAX 64
+#  endif
+
+/* The most bytes moved by one sendfile or splice call when sending to the end */
+#  define PIO_SENDFILE_CHUNK 0x40000000
 
 /* HEADERIZER HFILE: include/parrot/io_unix.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static INTVAL copy_to_socket(PARROT_INTERP,
+    ARGMOD(PMC *socket),
+    PIOHANDLE in,
+    PIOOFF_T offset,
+    INTVAL length,
+    INTVAL sent)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*socket);
+
 static void get_sockaddr_in(PARROT_INTERP,
     ARGIN(PMC * sockaddr),
     ARGIN(const char* host),
@@ -48,10 +74,24 @@ static void get_sockaddr_in(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static INTVAL send_bytes(
+    PIOHANDLE fd,
+    ARGIN(const char *buf),
+    size_t len,
+    int wait)
+        __attribute__nonnull__(2);
+
+static INTVAL sent_or_error(INTVAL sent);
+#define ASSERT_ARGS_copy_to_socket __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(socket))
 #define ASSERT_ARGS_get_sockaddr_in __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sockaddr) \
     , PARROT_ASSERT_ARG(host))
+#define ASSERT_ARGS_send_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_sent_or_error __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -256,6 +296,8 @@ Parrot_io_accept_unix(PARROT_INTERP, ARGMOD(PMC *socket))
     PARROT_SOCKET(newio)->remote = Parrot_pmc_new(interp, enum_class_Sockaddr);
     saddr                        = SOCKADDR_REMOTE(newio);
 
+    PARROT_SOCKET(newio)->recv_size = PARROT_SOCKET(socket)->recv_size;
+
     newsock = accept(io->os_handle, (struct sockaddr *)saddr, &addrlen);
 
     if (newsock == -1) {
@@ -277,7 +319,8 @@ Parrot_io_accept_unix(PARROT_INTERP, ARGMOD(PMC *socket))
 
 =item C<INTVAL Parrot_io_send_unix(PARROT_INTERP, PMC *socket, STRING *s)>
 
-Send the message C<*s> to C<*io>'s connected socket.
+Send the message C<*s> to C<*io>'s connected socket.  On a non-blocking
+socket, returns what was sent before it would block, or C<PIO_NOT_READY>.
 
 =cut
 
@@ -311,11 +354,10 @@ AGAIN:
             goto AGAIN;
 #  ifdef EWOULDBLOCK
           case EWOULDBLOCK:
-            goto AGAIN;
 #  else
           case EAGAIN:
-            goto AGAIN;
 #  endif
+            return byteswrote ? byteswrote : PIO_NOT_READY;
           case EPIPE:
             /* XXX why close it here and not below */
             close(io->os_handle);
@@ -328,9 +370,91 @@ AGAIN:
 
 /*
 
+=item C<INTVAL Parrot_io_writev_unix(PARROT_INTERP, PMC *socket, PMC *strings)>
+
+Sends the strings in the array C<*strings> to C<*io>'s connected socket,
+passing up to C<PIO_IOV_MAX> of them to each C<writev> call.  On a
+non-blocking socket, returns what was sent before it would block, or
+C<PIO_NOT_READY>.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_writev_unix(PARROT_INTERP, ARGMOD(PMC *socket), ARGIN(PMC *strings))
+{
+    ASSERT_ARGS(Parrot_io_writev_unix)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    const INTVAL  n          = VTABLE_elements(interp, strings);
+    INTVAL        first      = 0;
+    size_t        offset     = 0;
+    INTVAL        byteswrote = 0;
+    STRING       *parts[PIO_IOV_MAX];
+    struct iovec  iov[PIO_IOV_MAX];
+
+    while (first < n) {
+        int     count = 0;
+        int     i;
+        ssize_t sent;
+
+        /* fetch the strings first, so that no allocation moves their
+         * contents while the iovecs point into them */
+        while (count < PIO_IOV_MAX && first + count < n) {
+            parts[count] = VTABLE_get_string_keyed_int(interp, strings, first + count);
+            ++count;
+        }
+
+        for (i = 0; i < count; ++i) {
+            const size_t skip = i ? 0 : offset;
+
+            if (STRING_IS_NULL(parts[i])) {
+                iov[i].iov_base = NULL;
+                iov[i].iov_len  = 0;
+            }
+            else {
+                iov[i].iov_base = parts[i]->strstart + skip;
+                iov[i].iov_len  = parts[i]->bufused  - skip;
+            }
+        }
+
+        sent = writev(io->os_handle, iov, count);
+
+        if (sent < 0) {
+            switch (errno) {
+              case EINTR:
+                continue;
+#  ifdef EWOULDBLOCK
+              case EWOULDBLOCK:
+#  else
+              case EAGAIN:
+#  endif
+                return byteswrote ? byteswrote : PIO_NOT_READY;
+              default:
+                return -1;
+            }
+        }
+
+        byteswrote += sent;
+
+        /* skip the strings sent completely */
+        for (i = 0; i < count && (size_t)sent >= iov[i].iov_len; ++i)
+            sent -= iov[i].iov_len;
+
+        offset = (i ? 0 : offset) + sent;
+        first += i;
+    }
+
+    return byteswrote;
+}
+
+/*
+
 =item C<INTVAL Parrot_io_recv_unix(PARROT_INTERP, PMC *socket, STRING **s)>
 
-Receives a message in C<**s> from C<*io>'s connected socket.
+Receives a message in C<**s> from C<*io>'s connected socket, at most the size
+of its receive buffer.  On a non-blocking socket without data, returns
+C<PIO_NOT_READY> and a null C<**s>.
 
 =cut
 
@@ -340,39 +464,61 @@ INTVAL
 Parrot_io_recv_unix(PARROT_INTERP, ARGMOD(PMC *socket), ARGOUT(STRING **s))
 {
     ASSERT_ARGS(Parrot_io_recv_unix)
-    int error;
-    unsigned int bytesread = 0;
-    char buf[2048];
-    Parrot_Socket_attributes * io = PARROT_SOCKET(socket);
+    Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    char * const buf = Parrot_io_socket_recv_buffer(interp, socket);
+    const INTVAL bytesread = Parrot_io_recv_bytes_unix(interp, socket, buf, io->recv_size);
 
-AGAIN:
-    if ((error = recv(io->os_handle, buf, 2048, 0)) >= 0) {
-        bytesread += error;
+    if (bytesread >= 0) {
         *s = Parrot_str_new_init(interp, buf, bytesread,
                 Parrot_binary_encoding_ptr, 0);
         /* Hack to make Rakudo and UTF-8 work */
         (*s)->encoding = Parrot_ascii_encoding_ptr;
-        return bytesread;
     }
+    else if (bytesread == PIO_NOT_READY)
+        *s = STRINGNULL;
+    else {
+        /* XXX why close it on err return result is -1 anyway */
+        close(io->os_handle);
+        *s = Parrot_str_new_noinit(interp, 0);
+    }
+
+    return bytesread;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_recv_bytes_unix(PARROT_INTERP, PMC *socket, char *buf,
+INTVAL len)>
+
+Receives up to C<len> bytes from C<*io>'s connected socket into C<*buf>.
+Returns the number of bytes received, C<-1> on failure, or C<PIO_NOT_READY>
+on a non-blocking socket without data.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_recv_bytes_unix(SHIM_INTERP, ARGMOD(PMC *socket), ARGOUT(char *buf), INTVAL len)
+{
+    ASSERT_ARGS(Parrot_io_recv_bytes_unix)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    ssize_t bytesread;
+
+AGAIN:
+    if ((bytesread = recv(io->os_handle, buf, len, 0)) >= 0)
+        return bytesread;
     else {
         switch (errno) {
           case EINTR:
             goto AGAIN;
 #  ifdef EWOULDBLOCK
           case EWOULDBLOCK:
-            goto AGAIN;
 #  else
           case EAGAIN:
-            goto AGAIN;
 #  endif
-          case ECONNRESET:
-            /* XXX why close it on err return result is -1 anyway */
-            close(io->os_handle);
-            *s = Parrot_str_new_noinit(interp, 0);
-            return -1;
+            return PIO_NOT_READY;
           default:
-            close(io->os_handle);
-            *s = Parrot_str_new_noinit(interp, 0);
             return -1;
         }
     }
@@ -380,6 +526,248 @@ AGAIN:
 
 /*
 
+=item C<INTVAL Parrot_io_set_blocking_unix(PARROT_INTERP, PMC *socket, INTVAL
+blocking)>
+
+Sets or clears C<O_NONBLOCK> on C<*io>'s descriptor.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_set_blocking_unix(SHIM_INTERP, ARGMOD(PMC *socket), INTVAL blocking)
+{
+    ASSERT_ARGS(Parrot_io_set_blocking_unix)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    const int flags = fcntl(io->os_handle, F_GETFL, 0);
+
+    if (flags < 0)
+        return -1;
+
+    return fcntl(io->os_handle, F_SETFL,
+            blocking ? flags & ~O_NONBLOCK : flags | O_NONBLOCK) < 0 ? -1 : 0;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_sendfile_unix(PARROT_INTERP, PMC *socket, PMC *file,
+PIOOFF_T offset, INTVAL length)>
+
+Sends C<length> bytes of the FileHandle C<*file>, or all up to its end if
+C<length> is not positive, to C<*io>'s connected socket.  The kernel moves
+them without copying through Parrot: a file with C<sendfile>, starting at
+C<offset> and leaving its position alone, and a pipe with C<splice>, starting
+with the bytes already in its read buffer.  Where it can't, the bytes are
+copied through the socket's receive buffer.
+
+Returns the number of bytes sent, C<-1> on failure, or C<PIO_NOT_READY> on a
+non-blocking socket that can't take any data.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_sendfile_unix(PARROT_INTERP, ARGMOD(PMC *socket), ARGMOD(PMC *file),
+        PIOOFF_T offset, INTVAL length)
+{
+    ASSERT_ARGS(Parrot_io_sendfile_unix)
+    const PIOHANDLE out = PARROT_SOCKET(socket)->os_handle;
+    const PIOHANDLE in  = Parrot_io_get_os_handle(interp, file);
+    INTVAL          sent = 0;
+
+    if (Parrot_io_get_flags(interp, file) & PIO_F_PIPE) {
+        unsigned char * const next = Parrot_io_get_buffer_next(interp, file);
+        unsigned char * const end  = Parrot_io_get_buffer_end(interp, file);
+
+        if ((Parrot_io_get_buffer_flags(interp, file) & PIO_BF_READBUF) && next < end) {
+            const size_t buffered = length > 0 && end - next > length
+                                  ? (size_t)length : (size_t)(end - next);
+
+            sent = send_bytes(out, (const char *)next, buffered, 0);
+            if (sent < 0)
+                return sent;
+
+            Parrot_io_set_buffer_next(interp, file, next + sent);
+            if ((size_t)sent < buffered)
+                return sent;
+        }
+
+        /* a pipe is read where it stands */
+        offset = -1;
+
+#  ifdef SPLICE_F_MOVE
+        for (;;) {
+            size_t  chunk;
+            ssize_t moved;
+
+            if (length > 0 && sent >= length)
+                return sent;
+
+            chunk = length > 0 ? (size_t)(length - sent) : PIO_SENDFILE_CHUNK;
+            moved = splice(in, NULL, out, NULL, chunk, SPLICE_F_MOVE | SPLICE_F_MORE);
+
+            if (moved > 0)
+                sent += moved;
+            else if (moved == 0)
+                return sent;
+            else if (errno == EINVAL || errno == ENOSYS)
+                break;
+            else if (errno != EINTR)
+                return sent_or_error(sent);
+        }
+#  endif
+    }
+#  ifdef PARROT_HAS_HEADER_SYSSENDFILE
+    else {
+        off_t pos = offset;
+
+        for (;;) {
+            size_t  chunk;
+            ssize_t moved;
+
+            if (length > 0 && sent >= length)
+                return sent;
+
+            chunk = length > 0 ? (size_t)(length - sent) : PIO_SENDFILE_CHUNK;
+            moved = sendfile(out, in, &pos, chunk);
+
+            if (moved > 0)
+                sent += moved;
+            else if (moved == 0)
+                return sent;
+            else if (errno == EINVAL || errno == ENOSYS)
+                break;
+            else if (errno != EINTR)
+                return sent_or_error(sent);
+        }
+
+        offset = pos;
+    }
+#  endif
+
+    return copy_to_socket(interp, socket, in, offset, length, sent);
+}
+
+/*
+
+=item C<static INTVAL copy_to_socket(PARROT_INTERP, PMC *socket, PIOHANDLE in,
+PIOOFF_T offset, INTVAL length, INTVAL sent)>
+
+The fallback of C<Parrot_io_sendfile_unix>.  Copies up to C<length> bytes,
+less the C<sent> ones, from C<in> to C<*socket> through its receive buffer,
+reading from C<offset>, or where C<in> stands if C<offset> is negative.
+Bytes read that way can't be read again, so it waits until they are sent.
+
+=cut
+
+*/
+
+static INTVAL
+copy_to_socket(PARROT_INTERP, ARGMOD(PMC *socket), PIOHANDLE in,
+        PIOOFF_T offset, INTVAL length, INTVAL sent)
+{
+    ASSERT_ARGS(copy_to_socket)
+    const PIOHANDLE out  = PARROT_SOCKET(socket)->os_handle;
+    const size_t    size = PARROT_SOCKET(socket)->recv_size;
+    char * const    buf  = Parrot_io_socket_recv_buffer(interp, socket);
+
+    while (length <= 0 || sent < length) {
+        const size_t  chunk = length > 0 && (size_t)(length - sent) < size
+                            ? (size_t)(length - sent) : size;
+        const ssize_t got   = offset < 0
+                            ? read(in, buf, chunk)
+                            : pread(in, buf, chunk, offset);
+        INTVAL        put;
+
+        if (got < 0) {
+            if (errno == EINTR)
+                continue;
+            return sent ? sent : -1;
+        }
+        if (got == 0)
+            break;
+
+        put = send_bytes(out, buf, got, offset < 0);
+        if (put < 0)
+            return sent ? sent : put;
+
+        sent += put;
+        if (put < got)
+            break;
+        if (offset >= 0)
+            offset += put;
+    }
+
+    return sent;
+}
+
+/*
+
+=item C<static INTVAL send_bytes(PIOHANDLE fd, const char *buf, size_t len, int
+wait)>
+
+Sends C<len> bytes from C<*buf> to the socket C<fd>.  Returns the number of
+bytes sent, C<-1> on failure, or C<PIO_NOT_READY> on a non-blocking socket
+that can't take any data.  If C<wait> is true, it waits for such a socket
+instead, until all the bytes are sent.
+
+=cut
+
+*/
+
+static INTVAL
+send_bytes(PIOHANDLE fd, ARGIN(const char *buf), size_t len, int wait)
+{
+    ASSERT_ARGS(send_bytes)
+    size_t sent = 0;
+
+    while (sent < len) {
+        const ssize_t put = send(fd, buf + sent, len - sent, 0);
+
+        if (put >= 0)
+            sent += put;
+        else if (errno == EINTR)
+            continue;
+        else if (wait && PIO_WOULD_BLOCK(errno)) {
+            fd_set w;
+            FD_ZERO(&w);
+            FD_SET(fd, &w);
+            select(fd + 1, NULL, &w, NULL, NULL);
+        }
+        else
+            return sent_or_error(sent);
+    }
+
+    return sent;
+}
+
+/*
+
+=item C<static INTVAL sent_or_error(INTVAL sent)>
+
+Returns C<sent> if some bytes were sent before a call failed, otherwise
+C<PIO_NOT_READY> if it failed only because the socket is non-blocking, or
+C<-1>.
+
+=cut
+
+*/
+
+static INTVAL
+sent_or_error(INTVAL sent)
+{
+    ASSERT_ARGS(sent_or_error)
+
+    if (sent)
+        return sent;
+
+    return PIO_WOULD_BLOCK(errno) ? PIO_NOT_READY : -1;
+}
+
+/*
+
 =item C<INTVAL Parrot_io_poll_unix(PARROT_INTERP, PMC *socket, int which, int
 sec, int usec)>
 
@@ -31,6 +31,9 @@ Win32 System Programming, 2nd Edition.
 
 #ifdef PIO_OS_WIN32
 
+/* The most strings passed to one WSASend call */
+#  define PIO_IOV_MAX 64
+
 /* HEADERIZER HFILE: include/parrot/io_win32.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -43,10 +46,19 @@ static void get_sockaddr_in(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static INTVAL send_bytes(
+    SOCKET fd,
+    ARGIN(const char *buf),
+    size_t len,
+    int wait)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_get_sockaddr_in __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sockaddr) \
     , PARROT_ASSERT_ARG(host))
+#define ASSERT_ARGS_send_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -206,6 +218,8 @@ Parrot_io_accept_win32(PARROT_INTERP, ARGMOD(PMC *socket))
     PARROT_SOCKET(newio)->remote = Parrot_pmc_new(interp, enum_class_Sockaddr);
     saddr                        = SOCKADDR_REMOTE(newio);
 
+    PARROT_SOCKET(newio)->recv_size = PARROT_SOCKET(socket)->recv_size;
+
     newsock = accept((int)io->os_handle, (struct sockaddr *)saddr, &addrlen);
 
     if (newsock == -1) {
@@ -227,7 +241,8 @@ Parrot_io_accept_win32(PARROT_INTERP, ARGMOD(PMC *socket))
 
 =item C<INTVAL Parrot_io_send_win32(PARROT_INTERP, PMC *socket, STRING *s)>
 
-Send the message C<*s> to C<*io>'s connected socket.
+Send the message C<*s> to C<*io>'s connected socket.  On a non-blocking
+socket, returns what was sent before it would block, or C<PIO_NOT_READY>.
 
 =cut
 
@@ -256,19 +271,14 @@ AGAIN:
         goto AGAIN;
     }
     else {
-        switch (errno) {
+        switch (WSAGetLastError()) {
           case WSAEINTR:
             goto AGAIN;
-#  ifdef WSAEWOULDBLOCK
           case WSAEWOULDBLOCK:
-            goto AGAIN;
-#  else
-          case WSAEAGAIN:
-            goto AGAIN;
-#  endif
-          case EPIPE:
+            return byteswrote ? byteswrote : PIO_NOT_READY;
+          case WSAECONNRESET:
             /* XXX why close it here and not below */
-            close((int)io->os_handle);
+            closesocket((SOCKET)io->os_handle);
             return -1;
           default:
             return -1;
@@ -278,9 +288,85 @@ AGAIN:
 
 /*
 
+=item C<INTVAL Parrot_io_writev_win32(PARROT_INTERP, PMC *socket, PMC *strings)>
+
+Sends the strings in the array C<*strings> to C<*io>'s connected socket,
+passing up to C<PIO_IOV_MAX> of them to each C<WSASend> call.  On a
+non-blocking socket, returns what was sent before it would block, or
+C<PIO_NOT_READY>.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_writev_win32(PARROT_INTERP, ARGMOD(PMC *socket), ARGIN(PMC *strings))
+{
+    ASSERT_ARGS(Parrot_io_writev_win32)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    const INTVAL n          = VTABLE_elements(interp, strings);
+    INTVAL       first      = 0;
+    ULONG        offset     = 0;
+    INTVAL       byteswrote = 0;
+    STRING      *parts[PIO_IOV_MAX];
+    WSABUF       bufs[PIO_IOV_MAX];
+
+    while (first < n) {
+        DWORD count = 0;
+        DWORD sent;
+        DWORD i;
+
+        /* fetch the strings first, so that no allocation moves their
+         * contents while the buffers point into them */
+        while (count < PIO_IOV_MAX && first + (INTVAL)count < n) {
+            parts[count] = VTABLE_get_string_keyed_int(interp, strings, first + count);
+            ++count;
+        }
+
+        for (i = 0; i < count; ++i) {
+            const ULONG skip = i ? 0 : offset;
+
+            if (STRING_IS_NULL(parts[i])) {
+                bufs[i].buf = NULL;
+                bufs[i].len = 0;
+            }
+            else {
+                bufs[i].buf = parts[i]->strstart + skip;
+                bufs[i].len = (ULONG)parts[i]->bufused - skip;
+            }
+        }
+
+        if (WSASend((SOCKET)io->os_handle, bufs, count, &sent, 0, NULL, NULL) != 0) {
+            switch (WSAGetLastError()) {
+              case WSAEINTR:
+                continue;
+              case WSAEWOULDBLOCK:
+                return byteswrote ? byteswrote : PIO_NOT_READY;
+              default:
+                return -1;
+            }
+        }
+
+        byteswrote += sent;
+
+        /* skip the strings sent completely */
+        for (i = 0; i < count && sent >= bufs[i].len; ++i)
+            sent -= bufs[i].len;
+
+        offset = (i ? 0 : offset) + sent;
+        first += i;
+    }
+
+    return byteswrote;
+}
+
+/*
+
 =item C<INTVAL Parrot_io_recv_win32(PARROT_INTERP, PMC *socket, STRING **s)>
 
-Receives a message in C<**s> from C<*io>'s connected socket.
+Receives a message in C<**s> from C<*io>'s connected socket, at most the size
+of its receive buffer.  On a non-blocking socket without data, returns
+C<PIO_NOT_READY> and a null C<**s>.
 
 =cut
 
@@ -290,39 +376,57 @@ INTVAL
 Parrot_io_recv_win32(PARROT_INTERP, ARGMOD(PMC *socket), ARGOUT(STRING **s))
 {
     ASSERT_ARGS(Parrot_io_recv_win32)
-    int error;
-    unsigned int bytesread = 0;
-    char buf[2048];
     const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    char * const buf = Parrot_io_socket_recv_buffer(interp, socket);
+    const INTVAL bytesread = Parrot_io_recv_bytes_win32(interp, socket, buf, io->recv_size);
 
-AGAIN:
-    if ((error = recv((int)io->os_handle, buf, 2048, 0)) >= 0) {
-        bytesread += error;
+    if (bytesread >= 0) {
         *s = Parrot_str_new_init(interp, buf, bytesread,
                 Parrot_binary_encoding_ptr, 0);
         /* Hack to make Rakudo and UTF-8 work */
         (*s)->encoding = Parrot_ascii_encoding_ptr;
-        return bytesread;
     }
+    else if (bytesread == PIO_NOT_READY)
+        *s = STRINGNULL;
     else {
-        switch (errno) {
-          case EINTR:
+        /* XXX why close it on err return result is -1 anyway */
+        closesocket((SOCKET)io->os_handle);
+        *s = Parrot_str_new_noinit(interp, 0);
+    }
+
+    return bytesread;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_recv_bytes_win32(PARROT_INTERP, PMC *socket, char *buf,
+INTVAL len)>
+
+Receives up to C<len> bytes from C<*io>'s connected socket into C<*buf>.
+Returns the number of bytes received, C<-1> on failure, or C<PIO_NOT_READY>
+on a non-blocking socket without data.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_recv_bytes_win32(SHIM_INTERP, ARGMOD(PMC *socket), ARGOUT(char *buf), INTVAL len)
+{
+    ASSERT_ARGS(Parrot_io_recv_bytes_win32)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    int bytesread;
+
+AGAIN:
+    if ((bytesread = recv((SOCKET)io->os_handle, buf, (int)len, 0)) >= 0)
+        return bytesread;
+    else {
+        switch (WSAGetLastError()) {
+          case WSAEINTR:
             goto AGAIN;
-#  ifdef WSAEWOULDBLOCK
           case WSAEWOULDBLOCK:
-            goto AGAIN;
-#  else
-          case WSAEAGAIN:
-            goto AGAIN;
-#  endif
-          case WSAECONNRESET:
-            /* XXX why close it on err return result is -1 anyway */
-            close((int)io->os_handle);
-            *s = Parrot_str_new_noinit(interp, 0);
-            return -1;
+            return PIO_NOT_READY;
           default:
-            close((int)io->os_handle);
-            *s = Parrot_str_new_noinit(interp, 0);
             return -1;
         }
     }
@@ -330,6 +434,155 @@ AGAIN:
 
 /*
 
+=item C<INTVAL Parrot_io_set_blocking_win32(PARROT_INTERP, PMC *socket, INTVAL
+blocking)>
+
+Switches C<*io>'s socket between blocking and non-blocking mode.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_set_blocking_win32(SHIM_INTERP, ARGMOD(PMC *socket), INTVAL blocking)
+{
+    ASSERT_ARGS(Parrot_io_set_blocking_win32)
+    const Parrot_Socket_attributes * const io = PARROT_SOCKET(socket);
+    u_long nonblocking = !blocking;
+
+    return ioctlsocket((SOCKET)io->os_handle, FIONBIO, &nonblocking) == 0 ? 0 : -1;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_sendfile_win32(PARROT_INTERP, PMC *socket, PMC *file,
+PIOOFF_T offset, INTVAL length)>
+
+Sends C<length> bytes of the FileHandle C<*file>, or all up to its end if
+C<length> is not positive, to C<*io>'s connected socket.  A file is read from
+C<offset> and keeps its position, a pipe is read where it stands, starting
+with the bytes already in its read buffer.  The bytes are copied through the
+socket's receive buffer.
+
+Returns the number of bytes sent, C<-1> on failure, or C<PIO_NOT_READY> on a
+non-blocking socket that can't take any data.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_sendfile_win32(PARROT_INTERP, ARGMOD(PMC *socket), ARGMOD(PMC *file),
+        PIOOFF_T offset, INTVAL length)
+{
+    ASSERT_ARGS(Parrot_io_sendfile_win32)
+    const SOCKET    out     = (SOCKET)PARROT_SOCKET(socket)->os_handle;
+    const PIOHANDLE in      = Parrot_io_get_os_handle(interp, file);
+    const size_t    size    = PARROT_SOCKET(socket)->recv_size;
+    const int       is_pipe = (Parrot_io_get_flags(interp, file) & PIO_F_PIPE) != 0;
+    char * const    buf     = Parrot_io_socket_recv_buffer(interp, socket);
+    INTVAL          sent    = 0;
+
+    if (is_pipe) {
+        unsigned char * const next = Parrot_io_get_buffer_next(interp, file);
+        unsigned char * const end  = Parrot_io_get_buffer_end(interp, file);
+
+        if ((Parrot_io_get_buffer_flags(interp, file) & PIO_BF_READBUF) && next < end) {
+            const size_t buffered = length > 0 && end - next > length
+                                  ? (size_t)length : (size_t)(end - next);
+
+            sent = send_bytes(out, (const char *)next, buffered, 0);
+            if (sent < 0)
+                return sent;
+
+            Parrot_io_set_buffer_next(interp, file, next + sent);
+            if ((size_t)sent < buffered)
+                return sent;
+        }
+    }
+
+    while (length <= 0 || sent < length) {
+        const DWORD chunk = length > 0 && (size_t)(length - sent) < size
+                          ? (DWORD)(length - sent) : (DWORD)size;
+        DWORD       got;
+        OVERLAPPED  at;
+        INTVAL      put;
+
+        memset(&at, 0, sizeof (at));
+        at.Offset     = (DWORD)offset;
+        at.OffsetHigh = (DWORD)(offset >> 32);
+
+        if (!ReadFile(in, buf, chunk, &got, is_pipe ? NULL : &at)) {
+            const DWORD error = GetLastError();
+            if (error == ERROR_HANDLE_EOF || error == ERROR_BROKEN_PIPE)
+                break;
+            return sent ? sent : -1;
+        }
+        if (got == 0)
+            break;
+
+        /* bytes read from a pipe can't be read again, so wait until they are sent */
+        put = send_bytes(out, buf, got, is_pipe);
+        if (put < 0)
+            return sent ? sent : put;
+
+        sent += put;
+        if ((DWORD)put < got)
+            break;
+        offset += put;
+    }
+
+    return sent;
+}
+
+/*
+
+=item C<static INTVAL send_bytes(SOCKET fd, const char *buf, size_t len, int
+wait)>
+
+Sends C<len> bytes from C<*buf> to the socket C<fd>.  Returns the number of
+bytes sent, C<-1> on failure, or C<PIO_NOT_READY> on a non-blocking socket
+that can't take any data.  If C<wait> is true, it waits for such a socket
+instead, until all the bytes are sent.
+
+=cut
+
+*/
+
+static INTVAL
+send_bytes(SOCKET fd, ARGIN(const char *buf), size_t len, int wait)
+{
+    ASSERT_ARGS(send_bytes)
+    size_t sent = 0;
+
+    while (sent < len) {
+        const int put = send(fd, buf + sent, (int)(len - sent), 0);
+
+        if (put >= 0)
+            sent += put;
+        else {
+            const int error = WSAGetLastError();
+
+            if (error == WSAEINTR)
+                continue;
+            else if (wait && error == WSAEWOULDBLOCK) {
+                fd_set w;
+                FD_ZERO(&w);
+                FD_SET(fd, &w);
+                select(0, NULL, &w, NULL, NULL);
+            }
+            else if (sent)
+                break;
+            else
+                return error == WSAEWOULDBLOCK ? PIO_NOT_READY : -1;
+        }
+    }
+
+    return sent;
+}
+
+/*
+
 =item C<INTVAL Parrot_io_poll_win32(PARROT_INTERP, PMC *socket, int which, int
 sec, int usec)>
 
@@ -0,0 +1,489 @@
+/*
+Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+src/io/uring.c - Batched file I/O through io_uring
+
+=head1 DESCRIPTION
+
+Linux can't wait for a regular file with epoll, so the reactor hands the
+asynchronous reads and writes of files to an io_uring instead, see
+F<src/io/reactor.c>.  Operations are queued in the submission ring as they
+are scheduled and submitted together, with a single system call, the next
+time the reactor polls.  The ring's descriptor turns readable when operations
+completed, so the reactor waits for it with epoll like for any other
+descriptor.
+
+Each operation transfers the bytes of a C<Parrot_io_ring_req> at the current
+position of its file, which the kernel advances.  The request memory is not
+managed by the GC, so it does not move while the kernel uses it.
+
+The ring is talked to with raw system calls, so no library is needed.  It is
+built if F<linux/io_uring.h> is found, unless C<Configure.pl> was run with
+C<--without-io-uring>, and used if the running kernel supports it.  Otherwise
+files are read and written synchronously when the reactor gets them.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "io_private.h"
+
+#ifdef PIO_HAS_RING
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <stddef.h>
+
+/* The size of the submission ring; the completion ring is twice as large */
+#  define PIO_RING_ENTRIES 256
+
+struct Parrot_io_ring {
+    PIOHANDLE            fd;        /* The ring, or PIO_INVALID_HANDLE     */
+    unsigned int         queued;    /* Entries not submitted yet           */
+    unsigned int         inflight;  /* Submitted requests not reaped yet   */
+    unsigned int         capacity;  /* The size of the completion ring     */
+    unsigned int        *sq_head;
+    unsigned int        *sq_tail;
+    unsigned int        *sq_mask;
+    unsigned int        *sq_array;
+    unsigned int         sq_entries;
+    struct io_uring_sqe *sqes;
+    unsigned int        *cq_head;
+    unsigned int        *cq_tail;
+    unsigned int        *cq_mask;
+    struct io_uring_cqe *cqes;
+    void                *sq_ring;   /* The mapped rings                    */
+    void                *cq_ring;
+    size_t               sq_size;
+    size_t               cq_size;
+};
+
+/* HEADERIZER HFILE: src/io/io_private.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static struct io_uring_sqe * ring_next_sqe(PARROT_INTERP,
+    ARGMOD(Parrot_io_ring *ring))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ring);
+
+static void ring_publish(ARGMOD(Parrot_io_ring *ring))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ring);
+
+#define ASSERT_ARGS_ring_next_sqe __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ring))
+#define ASSERT_ARGS_ring_publish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ring))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<Parrot_io_ring * Parrot_io_ring_open(PARROT_INTERP)>
+
+Sets up an io_uring.  If the kernel can't, the descriptor of the returned
+ring is C<PIO_INVALID_HANDLE>, see C<Parrot_io_ring_fd>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_ring *
+Parrot_io_ring_open(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_io_ring_open)
+    Parrot_io_ring * const ring = mem_gc_allocate_zeroed_typed(interp, Parrot_io_ring);
+    struct io_uring_params p;
+    long   fd;
+    size_t sqes_size;
+
+    ring->fd = PIO_INVALID_HANDLE;
+
+    memset(&p, 0, sizeof (p));
+    fd = syscall(__NR_io_uring_setup, PIO_RING_ENTRIES, &p);
+
+    if (fd < 0)
+        return ring;
+
+    /* reads and writes have to move the file position like read() does */
+    if (!(p.features & IORING_FEAT_RW_CUR_POS)) {
+        close((int)fd);
+        return ring;
+    }
+
+    ring->sq_size = p.sq_off.array + p.sq_entries * sizeof (unsigned int);
+    ring->cq_size = p.cq_off.cqes  + p.cq_entries * sizeof (struct io_uring_cqe);
+
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_size > ring->sq_size)
+            ring->sq_size = ring->cq_size;
+        ring->cq_size = 0;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, (int)fd, IORING_OFF_SQ_RING);
+    ring->cq_ring = ring->cq_size
+                  ? mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, (int)fd, IORING_OFF_CQ_RING)
+                  : ring->sq_ring;
+
+    sqes_size  = p.sq_entries * sizeof (struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe *)mmap(NULL, sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, (int)fd, IORING_OFF_SQES);
+
+    if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED
+    ||  (void *)ring->sqes == MAP_FAILED) {
+        if (ring->sq_ring != MAP_FAILED)
+            munmap(ring->sq_ring, ring->sq_size);
+        if (ring->cq_size && ring->cq_ring != MAP_FAILED)
+            munmap(ring->cq_ring, ring->cq_size);
+        if ((void *)ring->sqes != MAP_FAILED)
+            munmap(ring->sqes, sqes_size);
+        close((int)fd);
+        return ring;
+    }
+
+    ring->sq_head    = (unsigned int *)((char *)ring->sq_ring + p.sq_off.head);
+    ring->sq_tail    = (unsigned int *)((char *)ring->sq_ring + p.sq_off.tail);
+    ring->sq_mask    = (unsigned int *)((char *)ring->sq_ring + p.sq_off.ring_mask);
+    ring->sq_array   = (unsigned int *)((char *)ring->sq_ring + p.sq_off.array);
+    ring->sq_entries = p.sq_entries;
+    ring->cq_head    = (unsigned int *)((char *)ring->cq_ring + p.cq_off.head);
+    ring->cq_tail    = (unsigned int *)((char *)ring->cq_ring + p.cq_off.tail);
+    ring->cq_mask    = (unsigned int *)((char *)ring->cq_ring + p.cq_off.ring_mask);
+    ring->cqes       = (struct io_uring_cqe *)((char *)ring->cq_ring + p.cq_off.cqes);
+    ring->capacity   = p.cq_entries;
+    ring->fd         = (PIOHANDLE)fd;
+
+    return ring;
+}
+
+/*
+
+=item C<PIOHANDLE Parrot_io_ring_fd(const Parrot_io_ring *ring)>
+
+Returns the descriptor of C<ring>, which turns readable when operations
+completed, or C<PIO_INVALID_HANDLE> if the kernel does not support io_uring.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PIOHANDLE
+Parrot_io_ring_fd(ARGIN(const Parrot_io_ring *ring))
+{
+    ASSERT_ARGS(Parrot_io_ring_fd)
+    return ring->fd;
+}
+
+/*
+
+=item C<Parrot_io_ring_req * Parrot_io_ring_request(PARROT_INTERP, PIOHANDLE fd,
+size_t length)>
+
+Allocates a request to transfer C<length> bytes on C<fd>.  Fill in its
+C<data> before queueing a write.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Parrot_io_ring_req *
+Parrot_io_ring_request(PARROT_INTERP, PIOHANDLE fd, size_t length)
+{
+    ASSERT_ARGS(Parrot_io_ring_request)
+    Parrot_io_ring_req * const req = (Parrot_io_ring_req *)
+        Parrot_gc_allocate_memory_chunk(interp,
+            offsetof(Parrot_io_ring_req, data) + (length ? length : 1));
+
+    req->fd     = fd;
+    req->result = 0;
+    req->length = length;
+
+    return req;
+}
+
+/*
+
+=item C<INTVAL Parrot_io_ring_queue(PARROT_INTERP, Parrot_io_ring *ring,
+Parrot_io_ring_req *req, INTVAL write)>
+
+Queues the read, or the write if C<write> is true, of C<req> at the current
+position of its file.  Returns 0, or -1 if the ring is full.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_ring_queue(PARROT_INTERP, ARGMOD(Parrot_io_ring *ring),
+        ARGMOD(Parrot_io_ring_req *req), INTVAL write)
+{
+    ASSERT_ARGS(Parrot_io_ring_queue)
+    struct io_uring_sqe * const sqe = ring_next_sqe(interp, ring);
+
+    if (!sqe)
+        return -1;
+
+    sqe->opcode    = write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd        = req->fd;
+    sqe->off       = (__u64)-1;
+    sqe->addr      = (__u64)(UINTVAL)req->data;
+    sqe->len       = (__u32)req->length;
+    sqe->user_data = (__u64)(UINTVAL)req;
+
+    ring_publish(ring);
+    return 0;
+}
+
+/*
+
+=item C<void Parrot_io_ring_advise(PARROT_INTERP, Parrot_io_ring *ring,
+PIOHANDLE fd, PIOOFF_T offset, size_t length)>
+
+Queues a hint that the C<length> bytes at C<offset> of C<fd> will be read
+soon, so the kernel starts reading them into the page cache.  The hint is
+dropped if the ring is full.
+
+=cut
+
+*/
+
+void
+Parrot_io_ring_advise(PARROT_INTERP, ARGMOD(Parrot_io_ring *ring), PIOHANDLE fd,
+        PIOOFF_T offset, size_t length)
+{
+    ASSERT_ARGS(Parrot_io_ring_advise)
+    struct io_uring_sqe * const sqe = ring_next_sqe(interp, ring);
+    Parrot_io_ring_req  *hint;
+
+    if (!sqe)
+        return;
+
+    /* a request without file marks the completion to skip */
+    hint = Parrot_io_ring_request(interp, PIO_INVALID_HANDLE, 0);
+
+    sqe->opcode         = IORING_OP_FADVISE;
+    sqe->fd             = fd;
+    sqe->off            = (__u64)offset;
+    sqe->len            = (__u32)length;
+    sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+    sqe->user_data      = (__u64)(UINTVAL)hint;
+
+    ring_publish(ring);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_ring_submit(PARROT_INTERP, Parrot_io_ring *ring, INTVAL
+wait)>
+
+Submits the queued operations and, if C<wait> is true, waits until one
+completed.  Returns the number of operations submitted, or -1 on failure.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_ring_submit(SHIM_INTERP, ARGMOD(Parrot_io_ring *ring), INTVAL wait)
+{
+    ASSERT_ARGS(Parrot_io_ring_submit)
+    long submitted;
+
+    if (!ring->queued && !wait)
+        return 0;
+
+    do {
+        submitted = syscall(__NR_io_uring_enter, ring->fd, ring->queued,
+                        wait ? 1 : 0, wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    } while (submitted < 0 && errno == EINTR);
+
+    if (submitted < 0)
+        return -1;
+
+    ring->queued   -= (unsigned int)submitted;
+    ring->inflight += (unsigned int)submitted;
+
+    return submitted;
+}
+
+/*
+
+=item C<Parrot_io_ring_req * Parrot_io_ring_complete(PARROT_INTERP,
+Parrot_io_ring *ring)>
+
+Returns the next completed request, its C<result> set, or NULL if none
+completed yet.  The caller frees the request with C<mem_gc_free>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+Parrot_io_ring_req *
+Parrot_io_ring_complete(PARROT_INTERP, ARGMOD(Parrot_io_ring *ring))
+{
+    ASSERT_ARGS(Parrot_io_ring_complete)
+
+    for (;;) {
+        const unsigned int head = *ring->cq_head;
+        const unsigned int tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        struct io_uring_cqe *cqe;
+        Parrot_io_ring_req  *req;
+
+        if (head == tail)
+            return NULL;
+
+        cqe         = &ring->cqes[head & *ring->cq_mask];
+        req         = (Parrot_io_ring_req *)(UINTVAL)cqe->user_data;
+        req->result = cqe->res;
+
+        __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+        --ring->inflight;
+
+        if (req->fd != PIO_INVALID_HANDLE)
+            return req;
+
+        mem_gc_free(interp, req);
+    }
+}
+
+/*
+
+=item C<void Parrot_io_ring_close(PARROT_INTERP, Parrot_io_ring *ring)>
+
+Waits for the operations in flight, since the kernel may still write into
+their requests, frees the requests and the ring.
+
+=cut
+
+*/
+
+void
+Parrot_io_ring_close(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_io_ring *ring))
+{
+    ASSERT_ARGS(Parrot_io_ring_close)
+
+    if (ring->fd != PIO_INVALID_HANDLE) {
+        Parrot_io_ring_req *req;
+
+        while (ring->inflight + ring->queued > 0) {
+            if (Parrot_io_ring_submit(interp, ring, 1) < 0)
+                break;
+            while ((req = Parrot_io_ring_complete(interp, ring)) != NULL)
+                mem_gc_free(interp, req);
+        }
+
+        munmap(ring->sqes, ring->sq_entries * sizeof (struct io_uring_sqe));
+        munmap(ring->sq_ring, ring->sq_size);
+        if (ring->cq_size)
+            munmap(ring->cq_ring, ring->cq_size);
+        close(ring->fd);
+    }
+
+    mem_gc_free(interp, ring);
+}
+
+/*
+
+=item C<static struct io_uring_sqe * ring_next_sqe(PARROT_INTERP, Parrot_io_ring
+*ring)>
+
+Returns a cleared submission entry, submitting the queued ones first if the
+ring is full, or NULL if there is no room for another operation.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static struct io_uring_sqe *
+ring_next_sqe(PARROT_INTERP, ARGMOD(Parrot_io_ring *ring))
+{
+    ASSERT_ARGS(ring_next_sqe)
+    const unsigned int tail = *ring->sq_tail;
+    struct io_uring_sqe *sqe;
+
+    /* every operation needs room in the completion ring */
+    if (ring->inflight + ring->queued >= ring->capacity)
+        return NULL;
+
+    /* the kernel takes the submitted entries off the ring right away */
+    if (tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) >= ring->sq_entries) {
+        Parrot_io_ring_submit(interp, ring, 0);
+        if (tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) >= ring->sq_entries)
+            return NULL;
+    }
+
+    sqe = &ring->sqes[tail & *ring->sq_mask];
+    memset(sqe, 0, sizeof (*sqe));
+
+    return sqe;
+}
+
+/*
+
+=item C<static void ring_publish(Parrot_io_ring *ring)>
+
+Makes the entry returned by C<ring_next_sqe> visible to the kernel, to be
+submitted with the next C<Parrot_io_ring_submit>.
+
+=cut
+
+*/
+
+static void
+ring_publish(ARGMOD(Parrot_io_ring *ring))
+{
+    ASSERT_ARGS(ring_publish)
+    const unsigned int tail  = *ring->sq_tail;
+    const unsigned int index = tail & *ring->sq_mask;
+
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++ring->queued;
+}
+
+#endif /* PIO_HAS_RING */
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/io/reactor.c>, L<io_uring(7)>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -86,12 +86,18 @@ Parrot_cmd_options(void)
         { 'E', 'E', (OPTION_flags)0, { "--pre-process-only" } },
         { 'G', 'G', (OPTION_flags)0, { "--no-gc" } },
         { '\0', OPT_HASH_SEED, OPTION_required_FLAG, { "--hash-seed" } },
+        { '\0', OPT_HASH_SIPHASH, (OPTION_flags)0, { "--hash-siphash" } },
         { 'I', 'I', OPTION_required_FLAG, { "--include" } },
         { 'L', 'L', OPTION_required_FLAG, { "--library" } },
         { 'O', 'O', OPTION_optional_FLAG, { "--optimize" } },
         { 'R', 'R', OPTION_required_FLAG, { "--runcore" } },
         { 'g', 'g', OPTION_required_FLAG, { "--gc" } },
         { '\0', OPT_GC_THRESHOLD, OPTION_required_FLAG, { "--gc-threshold" } },
+        { '\0', OPT_GC_NURSERY, OPTION_required_FLAG, { "--gc-nursery-size" } },
+        { '\0', OPT_GC_MAX_PAUSE, OPTION_required_FLAG, { "--gc-max-pause-us" } },
+        { '\0', OPT_GC_MARK_THREADS, OPTION_required_FLAG, { "--gc-mark-threads" } },
+        { '\0', OPT_SNAPSHOT, OPTION_required_FLAG, { "--snapshot" } },
+        { '\0', OPT_GC_ALLOC_THRESHOLD, OPTION_required_FLAG, { "--gc-alloc-threshold" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
         { '\0', OPT_DESTROY_FLAG, (OPTION_flags)0,
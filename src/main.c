@@ -296,9 +296,10 @@ help(void)
     "    -I --include add path to include search\n"
     "    -L --library add path to library search\n"
     "       --hash-seed F00F  specify hex value to use as hash seed\n"
+    "       --hash-siphash    hash strings with SipHash\n"
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
-    "    -R --runcore slow|bounds|fast\n"
+    "    -R --runcore slow|bounds|fast|cgoto\n"
     "    -R --runcore trace|profiling|gcdebug\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
@@ -308,8 +309,13 @@ help(void)
     "    -w --warnings\n"
     "    -G --no-gc\n"
     "       --gc-threshold=percentage    maximum memory wasted by GC\n"
+    "       --gc-nursery-size=KB         young generation size of ms2 GC\n"
+    "       --gc-max-pause-us=usec       incremental marking step of ms2 GC\n"
+    "       --gc-mark-threads=count      threads marking in parallel\n"
+    "       --gc-alloc-threshold=KB      allocation between ms2 collections\n"
     "       --gc-debug\n"
     "       --leak-test|--destroy-at-end\n"
+    "       --snapshot=FILE              start from a saved interpreter\n"
     "    -g --gc ms|inf set GC type\n"
     "    -. --wait    Read a keystroke before starting\n"
     "       --runtime-prefix\n"
@@ -376,7 +382,7 @@ parseflags_minimal(PARROT_INTERP, int argc, ARGIN(const char *argv[]))
     while (pos < argc) {
         const char *arg = argv[pos];
 
-        if (STREQ(arg, "--gc")) {
+        if (STREQ(arg, "--gc") || STREQ(arg, "-g")) {
             ++pos;
             if (pos == argc) {
                 fprintf(stderr,
@@ -435,8 +441,70 @@ parseflags_minimal(PARROT_INTERP, int argc, ARGIN(const char *argv[]))
                         "'%s'\n", arg);
                 exit(EXIT_FAILURE);
             }
-            ++pos;
-            arg = argv[pos];
+        }
+        else if (!strncmp(arg, "--gc-nursery-size", 17)) {
+
+            if ((arg = strrchr(arg, '=')))
+                ++arg;
+            else
+                arg = argv[++pos];
+
+            if (arg && is_all_digits(arg)) {
+                interp->gc_nursery_size = strtoul(arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC nursery size specified:"
+                        "'%s'\n", arg ? arg : "");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (!strncmp(arg, "--gc-max-pause-us", 17)) {
+
+            if ((arg = strrchr(arg, '=')))
+                ++arg;
+            else
+                arg = argv[++pos];
+
+            if (arg && is_all_digits(arg)) {
+                interp->gc_max_pause_us = strtoul(arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC pause specified:"
+                        "'%s'\n", arg ? arg : "");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (!strncmp(arg, "--gc-mark-threads", 17)) {
+
+            if ((arg = strrchr(arg, '=')))
+                ++arg;
+            else
+                arg = argv[++pos];
+
+            if (arg && is_all_digits(arg)) {
+                interp->gc_mark_threads = strtoul(arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC mark threads specified:"
+                        "'%s'\n", arg ? arg : "");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (!strncmp(arg, "--gc-alloc-threshold", 20)) {
+
+            if ((arg = strrchr(arg, '=')))
+                ++arg;
+            else
+                arg = argv[++pos];
+
+            if (arg && is_all_digits(arg)) {
+                interp->gc_alloc_threshold = strtoul(arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC allocation threshold specified:"
+                        "'%s'\n", arg ? arg : "");
+                exit(EXIT_FAILURE);
+            }
         }
         else if (!strncmp(arg, "--hash-seed", 11)) {
 
@@ -453,8 +521,9 @@ parseflags_minimal(PARROT_INTERP, int argc, ARGIN(const char *argv[]))
                         "'%s'\n", arg);
                 exit(EXIT_FAILURE);
             }
-            ++pos;
-            arg = argv[pos];
+        }
+        else if (STREQ(arg, "--hash-siphash")) {
+            interp->hash_siphash = 1;
         }
         ++pos;
     }
@@ -480,7 +549,8 @@ parseflags(PARROT_INTERP,
         ARGMOD(Parrot_Run_core_t *core), ARGMOD(Parrot_trace_flags *trace))
 {
     ASSERT_ARGS(parseflags)
-    struct longopt_opt_info opt  = LONGOPT_OPT_INFO_INIT;
+    struct longopt_opt_info opt      = LONGOPT_OPT_INFO_INIT;
+    const char             *snapshot = NULL;
     int                     status;
 
     if (argc == 1) {
@@ -495,6 +565,8 @@ parseflags(PARROT_INTERP,
                 *core = PARROT_SLOW_CORE;
             else if (STREQ(opt.opt_arg, "fast") || STREQ(opt.opt_arg, "function"))
                 *core = PARROT_FAST_CORE;
+            else if (STREQ(opt.opt_arg, "cgoto"))
+                *core = PARROT_CGOTO_CORE;
             else if (STREQ(opt.opt_arg, "jit"))
                 *core = PARROT_FAST_CORE;
             else if (STREQ(opt.opt_arg, "exec"))
@@ -518,6 +590,18 @@ parseflags(PARROT_INTERP,
           case OPT_GC_THRESHOLD:
             /* handled in parseflags_minimal */
             break;
+          case OPT_GC_NURSERY:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_MAX_PAUSE:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_MARK_THREADS:
+            /* handled in parseflags_minimal */
+            break;
+          case OPT_GC_ALLOC_THRESHOLD:
+            /* handled in parseflags_minimal */
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
@@ -546,6 +630,9 @@ parseflags(PARROT_INTERP,
           case OPT_HASH_SEED:
             /* handled in parseflags_minimal */
             break;
+          case OPT_HASH_SIPHASH:
+            /* handled in parseflags_minimal */
+            break;
           case OPT_HELP_DEBUG:
             help_debug();
             exit(EXIT_FAILURE);
@@ -591,6 +678,11 @@ parseflags(PARROT_INTERP,
           case OPT_PBC_OUTPUT:
             if (!interp->output_file)
                 interp->output_file = "-";
+            break;
+          case OPT_SNAPSHOT:
+            /* loaded below, once the search paths are known */
+            snapshot = opt.opt_arg;
+            break;
           default:
             /* languages handle their arguments later (after being initialized) */
             break;
@@ -603,6 +695,9 @@ parseflags(PARROT_INTERP,
         exit(EXIT_FAILURE);
     }
 
+    if (snapshot)
+        Parrot_snapshot_load(interp, Parrot_str_new(interp, snapshot, 0));
+
     /* reached the end of the option list and consumed all of argv */
     if (argc == opt.opt_index) {
         if (interp->output_file) {
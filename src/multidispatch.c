@@ -82,23 +82,73 @@ static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP,
         __attribute__nonnull__(2);
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_types(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *types))
+PARROT_CANNOT_RETURN_NULL
+static MMD_Cache_entry * mmd_cache_find(
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL num_types,
+    UINTVAL hashval)
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_PURE_FUNCTION
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING * mmd_cache_key_from_values(PARROT_INTERP,
-    ARGIN(const char *name),
-    ARGIN(PMC *values))
+static UINTVAL mmd_cache_hash(
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL num_types)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * mmd_cache_lookup(
+    ARGIN(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL num_types)
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void mmd_cache_store(PARROT_INTERP,
+    ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL num_types,
+    ARGIN(PMC *chosen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*cache);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_sig_obj(PARROT_INTERP,
+    ARGIN(PMC *sig_obj),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_types(PARROT_INTERP,
+    ARGIN(PMC *type_tuple),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_cache_types_from_values(PARROT_INTERP,
+    ARGIN(PMC *values),
+    ARGOUT(INTVAL *types))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*types);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* mmd_cvt_to_types(PARROT_INTERP, ARGIN(PMC *multi_sig))
@@ -167,14 +217,31 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(type_list))
-#define ASSERT_ARGS_mmd_cache_key_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_lookup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(cache) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(chosen))
+#define ASSERT_ARGS_mmd_cache_types_from_sig_obj __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig_obj) \
     , PARROT_ASSERT_ARG(types))
-#define ASSERT_ARGS_mmd_cache_key_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_mmd_cache_types_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(values))
+    , PARROT_ASSERT_ARG(type_tuple) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_cache_types_from_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(values) \
+    , PARROT_ASSERT_ARG(types))
 #define ASSERT_ARGS_mmd_cvt_to_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(multi_sig))
@@ -274,16 +341,16 @@ Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
     call_obj = Parrot_pcc_build_call_from_varargs(interp, PMCNULL, arg_sig, &args);
 
     /* Check the cache. */
-    sub = Parrot_mmd_cache_lookup_by_types(interp, interp->op_mmd_cache, name,
-            VTABLE_get_pmc(interp, call_obj));
+    sub = Parrot_mmd_cache_lookup_by_sig_obj(interp, interp->op_mmd_cache, name,
+            call_obj);
 
     if (PMC_IS_NULL(sub)) {
         sub = Parrot_mmd_find_multi_from_sig_obj(interp,
             Parrot_str_new_constant(interp, name), call_obj);
 
         if (!PMC_IS_NULL(sub))
-            Parrot_mmd_cache_store_by_types(interp, interp->op_mmd_cache, name,
-                    VTABLE_get_pmc(interp, call_obj), sub);
+            Parrot_mmd_cache_store_by_sig_obj(interp, interp->op_mmd_cache, name,
+                    call_obj, sub);
     }
 
     if (PMC_IS_NULL(sub))
@@ -559,6 +626,7 @@ Parrot_mmd_get_cached_multi_sig(PARROT_INTERP, ARGIN(PMC *sub_pmc))
             if (PMC_IS_NULL(converted_sig))
                 return PMCNULL;
 
+            PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
             multi_sig = sub->multi_signature = converted_sig;
         }
 
@@ -986,6 +1054,7 @@ Parrot_mmd_add_multi_from_long_sig(PARROT_INTERP,
     }
     else if (VTABLE_isa(interp, sub_obj, sub_str)) {
         PMC_get_sub(interp, sub_obj, sub);
+        PARROT_GC_WRITE_BARRIER(interp, sub_obj);
         sub->multi_signature = multi_sig;
     }
 
@@ -1099,57 +1168,286 @@ MMD_Cache *
 Parrot_mmd_cache_create(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_mmd_cache_create)
-    /* String hash. */
-    Hash *cache = parrot_new_hash(interp);
+    MMD_Cache * const cache = mem_gc_allocate_zeroed_typed(interp, MMD_Cache);
+
+    cache->entries = mem_gc_allocate_n_zeroed_typed(interp, 32, MMD_Cache_entry);
+    cache->mask    = 31;
     return cache;
 }
 
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_values(PARROT_INTERP, const char
-*name, PMC *values)>
+=item C<static INTVAL mmd_cache_types_from_values(PARROT_INTERP, PMC *values,
+INTVAL *types)>
 
-Generates an MMD cache key from an array of values.
+Fills C<types> with the type ids of an array of values.  Returns the number
+of values, or -1 if they cannot be cached.
 
 =cut
 
 */
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_values(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *values))
+static INTVAL
+mmd_cache_types_from_values(PARROT_INTERP, ARGIN(PMC *values),
+    ARGOUT(INTVAL *types))
 {
-    ASSERT_ARGS(mmd_cache_key_from_values)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
+    ASSERT_ARGS(mmd_cache_types_from_values)
     const INTVAL num_values = VTABLE_elements(interp, values);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_values * sizeof (INTVAL) + name_len;
-    INTVAL *type_ids        = mem_gc_allocate_n_typed(interp, num_values + name_len, INTVAL);
-    STRING *key;
-    INTVAL  i;
+    INTVAL       i;
+
+    if (num_values > MMD_CACHE_MAX_ARGS)
+        return -1;
 
     for (i = 0; i < num_values; ++i) {
         const INTVAL id = VTABLE_type(interp, VTABLE_get_pmc_keyed_int(interp, values, i));
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
 
-        type_ids[i] = id;
+        if (id == 0)
+            return -1;
+
+        types[i] = id;
+    }
+
+    return num_values;
+}
+
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_types(PARROT_INTERP, PMC *type_tuple,
+INTVAL *types)>
+
+Fills C<types> from an array of type ids.  Returns the number of types, or -1
+if they cannot be cached.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_types(PARROT_INTERP, ARGIN(PMC *type_tuple),
+    ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_types_from_types)
+    const INTVAL num_types = VTABLE_elements(interp, type_tuple);
+    INTVAL       i;
+
+    if (num_types > MMD_CACHE_MAX_ARGS)
+        return -1;
+
+    for (i = 0; i < num_types; ++i) {
+        const INTVAL id = VTABLE_get_integer_keyed_int(interp, type_tuple, i);
+
+        if (id == 0)
+            return -1;
+
+        types[i] = id;
+    }
+
+    return num_types;
+}
+
+
+/*
+
+=item C<static INTVAL mmd_cache_types_from_sig_obj(PARROT_INTERP, PMC *sig_obj,
+INTVAL *types)>
+
+Fills C<types> with the type ids of the positional arguments of a CallContext,
+reading its cells rather than building its type tuple.  Returns the number of
+arguments, or -1 if they cannot be cached.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_cache_types_from_sig_obj(PARROT_INTERP, ARGIN(PMC *sig_obj),
+    ARGOUT(INTVAL *types))
+{
+    ASSERT_ARGS(mmd_cache_types_from_sig_obj)
+    Pcc_cell *cells;
+    PMC      *type_tuple;
+    INTVAL    num_positionals;
+    INTVAL    i;
+
+    if (sig_obj->vtable->base_type != enum_class_CallContext)
+        return mmd_cache_types_from_types(interp,
+                VTABLE_get_pmc(interp, sig_obj), types);
+
+    /* An explicitly set type tuple overrides the arguments */
+    GETATTR_CallContext_type_tuple(interp, sig_obj, type_tuple);
+
+    if (!PMC_IS_NULL(type_tuple))
+        return mmd_cache_types_from_types(interp, type_tuple, types);
+
+    GETATTR_CallContext_positionals(interp, sig_obj, cells);
+    GETATTR_CallContext_num_positionals(interp, sig_obj, num_positionals);
+
+    if (num_positionals > MMD_CACHE_MAX_ARGS)
+        return -1;
+
+    for (i = 0; i < num_positionals; ++i) {
+        types[i] = Parrot_pcc_cell_type(interp, &cells[i]);
+
+        if (types[i] == 0)
+            return -1;
     }
 
+    return num_positionals;
+}
+
+
+/*
+
+=item C<static UINTVAL mmd_cache_hash(const char *name, const INTVAL *types,
+INTVAL num_types)>
+
+Hashes a multi name and a tuple of type ids.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+mmd_cache_hash(ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *types),
+    INTVAL num_types)
+{
+    ASSERT_ARGS(mmd_cache_hash)
+    UINTVAL hashval = 2166136261u;
+    INTVAL  i;
+
     if (name)
-        strcpy((char *)(type_ids + num_values), name);
+        while (*name)
+            hashval = (hashval ^ (unsigned char)*name++) * 16777619u;
+
+    for (i = 0; i < num_types; ++i)
+        hashval = (hashval ^ (UINTVAL)types[i]) * 16777619u;
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
-    mem_gc_free(interp, type_ids);
+    return hashval ^ (hashval >> 15);
+}
+
+
+/*
+
+=item C<static MMD_Cache_entry * mmd_cache_find(MMD_Cache *cache, const char
+*name, const INTVAL *types, INTVAL num_types, UINTVAL hashval)>
+
+Returns the entry of C<cache> for the name and type tuple, or the unused entry
+where it belongs.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static MMD_Cache_entry *
+mmd_cache_find(ARGIN(MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types), INTVAL num_types, UINTVAL hashval)
+{
+    ASSERT_ARGS(mmd_cache_find)
+    UINTVAL slot = hashval & cache->mask;
+
+    for (;;) {
+        MMD_Cache_entry * const e = &cache->entries[slot];
+
+        if (!e->chosen)
+            return e;
+
+        if (e->hashval == hashval
+        &&  e->num_types == num_types
+        &&  memcmp(e->types, types, num_types * sizeof (INTVAL)) == 0
+        && (e->name == name || (e->name && name && STREQ(e->name, name))))
+            return e;
+
+        slot = (slot + 1) & cache->mask;
+    }
+}
+
+
+/*
+
+=item C<static PMC * mmd_cache_lookup(MMD_Cache *cache, const char *name, const
+INTVAL *types, INTVAL num_types)>
+
+Returns the candidate cached for the name and type tuple, or PMCNULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+mmd_cache_lookup(ARGIN(MMD_Cache *cache), ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types), INTVAL num_types)
+{
+    ASSERT_ARGS(mmd_cache_lookup)
+    const MMD_Cache_entry * const e = mmd_cache_find(cache, name, types,
+            num_types, mmd_cache_hash(name, types, num_types));
+
+    return e->chosen ? e->chosen : PMCNULL;
+}
+
+
+/*
+
+=item C<static void mmd_cache_store(PARROT_INTERP, MMD_Cache *cache, const char
+*name, const INTVAL *types, INTVAL num_types, PMC *chosen)>
+
+Caches C<chosen> for the name and type tuple.  The table doubles when it is
+three quarters full.
+
+=cut
+
+*/
+
+static void
+mmd_cache_store(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *types),
+    INTVAL num_types, ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(mmd_cache_store)
+    const UINTVAL    hashval = mmd_cache_hash(name, types, num_types);
+    MMD_Cache_entry *e;
+
+    if ((cache->count + 1) * 4 > (cache->mask + 1) * 3) {
+        MMD_Cache_entry * const old_entries = cache->entries;
+        const UINTVAL           old_size    = cache->mask + 1;
+        UINTVAL                 i;
+
+        cache->entries = mem_gc_allocate_n_zeroed_typed(interp, old_size * 2,
+                            MMD_Cache_entry);
+        cache->mask    = old_size * 2 - 1;
+
+        for (i = 0; i < old_size; ++i) {
+            const MMD_Cache_entry * const old = &old_entries[i];
+
+            if (old->chosen)
+                *mmd_cache_find(cache, old->name, old->types, old->num_types,
+                        old->hashval) = *old;
+        }
+
+        mem_gc_free(interp, old_entries);
+    }
+
+    e = mmd_cache_find(cache, name, types, num_types, hashval);
 
-    return key;
+    if (!e->chosen) {
+        e->name      = name ? mem_sys_strdup(name) : NULL;
+        e->hashval   = hashval;
+        e->num_types = num_types;
+        memcpy(e->types, types, num_types * sizeof (INTVAL));
+        ++cache->count;
+    }
+
+    e->chosen = chosen;
 }
 
 
@@ -1169,13 +1467,14 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC *
 Parrot_mmd_cache_lookup_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *values))
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *values))
 {
     ASSERT_ARGS(Parrot_mmd_cache_lookup_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_values(interp, values, types);
 
-    if (key)
-        return (PMC *)parrot_hash_get(interp, cache, key);
+    if (num_types >= 0)
+        return mmd_cache_lookup(cache, name, types, num_types);
 
     return PMCNULL;
 }
@@ -1196,72 +1495,81 @@ it into the cache.
 PARROT_EXPORT
 void
 Parrot_mmd_cache_store_by_values(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *values), ARGIN(PMC *chosen))
 {
     ASSERT_ARGS(Parrot_mmd_cache_store_by_values)
-    STRING * const key = mmd_cache_key_from_values(interp, name, values);
+    INTVAL       types[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_values(interp, values, types);
 
-    if (key)
-        parrot_hash_put(interp, cache, key, chosen);
+    if (num_types >= 0)
+        mmd_cache_store(interp, cache, name, types, num_types, chosen);
 }
 
 
 /*
 
-=item C<static STRING * mmd_cache_key_from_types(PARROT_INTERP, const char
-*name, PMC *types)>
+=item C<PMC * Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, MMD_Cache *cache,
+const char *name, PMC *types)>
 
-Generates an MMD cache key from an array of types.
+Takes an array of types for the call and does a lookup in the MMD cache.
 
 =cut
 
 */
 
+PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING *
-mmd_cache_key_from_types(PARROT_INTERP, ARGIN(const char *name),
-    ARGIN(PMC *types))
+PMC *
+Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *types))
 {
-    ASSERT_ARGS(mmd_cache_key_from_types)
-    /* Build array of type IDs, which we'll then use as a string to key into
-     * the hash. */
-    const INTVAL num_types  = VTABLE_elements(interp, types);
-    const INTVAL name_len   = name ? strlen(name) + 1: 0;
-    const size_t id_size    = num_types * sizeof (INTVAL) + name_len;
-    INTVAL * const type_ids = mem_gc_allocate_n_typed(interp, num_types + name_len, INTVAL);
-
-    STRING *key;
-    INTVAL  i;
+    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_types)
+    INTVAL       type_ids[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_types(interp, types, type_ids);
 
-    for (i = 0; i < num_types; ++i) {
-        const INTVAL id = VTABLE_get_integer_keyed_int(interp, types, i);
+    if (num_types >= 0)
+        return mmd_cache_lookup(cache, name, type_ids, num_types);
 
-        if (id == 0) {
-            mem_gc_free(interp, type_ids);
-            return NULL;
-        }
+    return PMCNULL;
+}
 
-        type_ids[i] = id;
-    }
 
-    if (name)
-        strcpy((char *)(type_ids + num_types), name);
+/*
+
+=item C<void Parrot_mmd_cache_store_by_types(PARROT_INTERP, MMD_Cache *cache,
+const char *name, PMC *types, PMC *chosen)>
+
+Takes an array of types for the call along with a chosen candidate and puts
+it into the cache. The name parameter is optional, and if the cache is already
+tied to an individual multi can be null.
 
-    key = Parrot_str_new_init(interp, (char *)type_ids, id_size,
-            Parrot_binary_encoding_ptr, 0);
+=cut
 
-    mem_gc_free(interp, type_ids);
-    return key;
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_cache_store_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
+{
+    ASSERT_ARGS(Parrot_mmd_cache_store_by_types)
+    INTVAL       type_ids[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_types(interp, types, type_ids);
+
+    if (num_types >= 0)
+        mmd_cache_store(interp, cache, name, type_ids, num_types, chosen);
 }
 
 
 /*
 
-=item C<PMC * Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, MMD_Cache *cache,
-const char *name, PMC *types)>
+=item C<PMC * Parrot_mmd_cache_lookup_by_sig_obj(PARROT_INTERP, MMD_Cache
+*cache, const char *name, PMC *sig_obj)>
 
-Takes an array of types for the call and does a lookup in the MMD cache.
+Looks up the candidate cached for the arguments of a CallContext.  Unlike
+C<Parrot_mmd_cache_lookup_by_types> with its type tuple, this allocates
+nothing.
 
 =cut
 
@@ -1271,14 +1579,15 @@ PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 PMC *
-Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *types))
+Parrot_mmd_cache_lookup_by_sig_obj(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *sig_obj))
 {
-    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_types)
-    const STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    ASSERT_ARGS(Parrot_mmd_cache_lookup_by_sig_obj)
+    INTVAL       type_ids[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_sig_obj(interp, sig_obj, type_ids);
 
-    if (key)
-        return (PMC *)parrot_hash_get(interp, cache, key);
+    if (num_types >= 0)
+        return mmd_cache_lookup(cache, name, type_ids, num_types);
 
     return PMCNULL;
 }
@@ -1286,12 +1595,10 @@ Parrot_mmd_cache_lookup_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
 
 /*
 
-=item C<void Parrot_mmd_cache_store_by_types(PARROT_INTERP, MMD_Cache *cache,
-const char *name, PMC *types, PMC *chosen)>
+=item C<void Parrot_mmd_cache_store_by_sig_obj(PARROT_INTERP, MMD_Cache *cache,
+const char *name, PMC *sig_obj, PMC *chosen)>
 
-Takes an array of types for the call along with a chosen candidate and puts
-it into the cache. The name parameter is optional, and if the cache is already
-tied to an individual multi can be null.
+Caches C<chosen> for the arguments of a CallContext.
 
 =cut
 
@@ -1299,14 +1606,15 @@ tied to an individual multi can be null.
 
 PARROT_EXPORT
 void
-Parrot_mmd_cache_store_by_types(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
-    ARGIN(const char *name), ARGIN(PMC *types), ARGIN(PMC *chosen))
+Parrot_mmd_cache_store_by_sig_obj(PARROT_INTERP, ARGMOD(MMD_Cache *cache),
+    ARGIN_NULLOK(const char *name), ARGIN(PMC *sig_obj), ARGIN(PMC *chosen))
 {
-    ASSERT_ARGS(Parrot_mmd_cache_store_by_types)
-    STRING * const key = mmd_cache_key_from_types(interp, name, types);
+    ASSERT_ARGS(Parrot_mmd_cache_store_by_sig_obj)
+    INTVAL       type_ids[MMD_CACHE_MAX_ARGS];
+    const INTVAL num_types = mmd_cache_types_from_sig_obj(interp, sig_obj, type_ids);
 
-    if (key)
-        parrot_hash_put(interp, cache, key, chosen);
+    if (num_types >= 0)
+        mmd_cache_store(interp, cache, name, type_ids, num_types, chosen);
 }
 
 
@@ -1325,10 +1633,12 @@ void
 Parrot_mmd_cache_mark(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_mark)
-    /* As a small future optimization, note that we only *really* need to mark
-    * keys - the candidates will be referenced outside the cache, provided it's
-    * invalidated properly. */
-    parrot_mark_hash(interp, cache);
+    UINTVAL i;
+
+    /* The keys are plain type ids; only the candidates need marking. */
+    for (i = 0; i <= cache->mask; ++i)
+        if (cache->entries[i].chosen)
+            Parrot_gc_mark_PMC_alive(interp, cache->entries[i].chosen);
 }
 
 
@@ -1347,7 +1657,14 @@ void
 Parrot_mmd_cache_destroy(PARROT_INTERP, ARGMOD(MMD_Cache *cache))
 {
     ASSERT_ARGS(Parrot_mmd_cache_destroy)
-    parrot_hash_destroy(interp, cache);
+    UINTVAL i;
+
+    for (i = 0; i <= cache->mask; ++i)
+        if (cache->entries[i].name)
+            mem_sys_free(cache->entries[i].name);
+
+    mem_gc_free(interp, cache->entries);
+    mem_gc_free(interp, cache);
 }
 
 
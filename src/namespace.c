@@ -737,6 +737,7 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
     ns = get_namespace_pmc(interp, sub_pmc);
 
     /* attach a namespace to the sub for lookups */
+    PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
     sub->namespace_stash = ns;
 
     /* store a :multi sub */
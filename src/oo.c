@@ -47,6 +47,25 @@ static INTVAL fail_if_type_exists(PARROT_INTERP, ARGIN(PMC *name))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL find_attribute_slot(PARROT_INTERP,
+    ARGIN(PMC *object),
+    ARGIN(STRING *name),
+    ARGIN(STRING *override),
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Method_site * find_call_site(PARROT_INTERP,
+    ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_INLINE
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -56,9 +75,18 @@ static PMC * get_pmc_proxy(PARROT_INTERP, INTVAL type)
 static void invalidate_all_caches(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void invalidate_call_sites(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
         __attribute__nonnull__(1);
 
+static void rehash_call_sites(PARROT_INTERP,
+    UINTVAL size,
+    ARGIN_NULLOK(const opcode_t *from),
+    ARGIN_NULLOK(const opcode_t *to))
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_C3_merge __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(merge_list))
@@ -69,12 +97,25 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
 #define ASSERT_ARGS_fail_if_type_exists __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_find_attribute_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(object) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(override) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_find_call_site __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_get_pmc_proxy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_all_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_invalidate_call_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_type_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_rehash_call_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -311,14 +352,12 @@ Parrot_oo_clone_object(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD_NULLOK(PMC *dest))
     /* Now clone attributes list.class. */
     cloned_guts               = (Parrot_Object_attributes *) PMC_data(cloned);
     cloned_guts->_class       = obj->_class;
-    cloned_guts->attrib_store = VTABLE_clone(interp, obj->attrib_store);
-    num_attrs                 = VTABLE_elements(interp, cloned_guts->attrib_store);
+    num_attrs                 = obj->num_attribs;
+    Parrot_oo_new_attrib_store(interp, cloned, num_attrs);
     for (i = 0; i < num_attrs; ++i) {
-        PMC * const to_clone = VTABLE_get_pmc_keyed_int(interp, cloned_guts->attrib_store, i);
-        if (!PMC_IS_NULL(to_clone)) {
-            VTABLE_set_pmc_keyed_int(interp, cloned_guts->attrib_store, i,
-                    VTABLE_clone(interp, to_clone));
-        }
+        PMC * const to_clone = obj->attrib_store[i];
+        if (!PMC_IS_NULL(to_clone))
+            cloned_guts->attrib_store[i] = VTABLE_clone(interp, to_clone);
     }
 
     /* Some of the attributes may have been the PMCs providing storage for any
@@ -344,6 +383,108 @@ Parrot_oo_clone_object(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD_NULLOK(PMC *dest))
 
 /*
 
+=item C<void Parrot_oo_new_attrib_store(PARROT_INTERP, PMC *object, INTVAL
+num_attribs)>
+
+Give the Object C<object> C<num_attribs> attribute slots, all set to
+C<PMCNULL>.  Any slots it had before are freed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_oo_new_attrib_store(PARROT_INTERP, ARGMOD(PMC *object), INTVAL num_attribs)
+{
+    ASSERT_ARGS(Parrot_oo_new_attrib_store)
+    Parrot_Object_attributes * const obj = PARROT_OBJECT(object);
+    INTVAL i;
+
+    if (obj->attrib_store)
+        Parrot_gc_free_fixed_size_storage(interp,
+            obj->num_attribs * sizeof (PMC *), obj->attrib_store);
+
+    obj->attrib_store = num_attribs
+        ? (PMC **)Parrot_gc_allocate_fixed_size_storage(interp,
+                num_attribs * sizeof (PMC *))
+        : NULL;
+    obj->num_attribs  = num_attribs;
+
+    for (i = 0; i < num_attribs; ++i)
+        obj->attrib_store[i] = PMCNULL;
+}
+
+/*
+
+=item C<INTVAL Parrot_oo_get_attrib_index(PARROT_INTERP, PMC *_class, STRING
+*name)>
+
+Find the slot of the attribute C<name> in instances of C<_class>, taking the
+first attribute of that name walking up the inheritance tree.  Returns -1 if
+there is no such attribute.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_oo_get_attrib_index(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *name))
+{
+    ASSERT_ARGS(Parrot_oo_get_attrib_index)
+    Parrot_Class_attributes * const class_info = PARROT_CLASS(_class);
+    const INTVAL                    cur_hll    =
+        Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+    int                             num_classes, i;
+    INTVAL                          retval;
+
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), 0);
+
+    /* First see if we can find it in the cache. */
+    retval                       = VTABLE_get_integer_keyed_str(interp,
+                                         class_info->attrib_cache, name);
+
+    /* there's a semi-predicate problem with a retval of 0 */
+    if (retval
+    ||  VTABLE_exists_keyed_str(interp, class_info->attrib_cache, name)) {
+        Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_hll);
+        return retval;
+    }
+
+    /* No hit. We need to walk up the list of parents to try and find the
+     * attribute. */
+    num_classes = VTABLE_elements(interp, class_info->all_parents);
+
+    for (i = 0; i < num_classes; i++) {
+        /* Get the class and its attribute metadata hash. */
+        PMC * const cur_class = VTABLE_get_pmc_keyed_int(interp,
+            class_info->all_parents, i);
+
+        /* Build a string representing the fully qualified attribute name. */
+        STRING *fq_name = VTABLE_get_string(interp, cur_class);
+        fq_name         = Parrot_str_concat(interp, fq_name, name);
+
+        /* Look up. */
+        if (VTABLE_exists_keyed_str(interp, class_info->attrib_index, fq_name)) {
+            /* Found it. Get value, cache it and we're done. */
+            const INTVAL index = VTABLE_get_integer_keyed_str(interp,
+                class_info->attrib_index, fq_name);
+            VTABLE_set_integer_keyed_str(interp, class_info->attrib_cache, name,
+                index);
+
+            Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_hll);
+            return index;
+        }
+    }
+
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_hll);
+    return -1;
+}
+
+/*
+
 =item C<static PMC * get_pmc_proxy(PARROT_INTERP, INTVAL type)>
 
 Get the PMC proxy for a PMC with the given type, creating it if does not exist.
@@ -709,6 +850,39 @@ Parrot_oo_register_type(PARROT_INTERP, ARGIN(PMC *name), ARGIN(PMC *_namespace))
 
 /*
 
+=item C<void Parrot_oo_set_class_vtable(PARROT_INTERP, PMC *classobj, INTVAL
+type_num)>
+
+Links the type number C<type_num> with a new vtable for the instances of the
+class C<classobj>, and stores it in the global vtable table.
+
+=cut
+
+*/
+
+void
+Parrot_oo_set_class_vtable(PARROT_INTERP, ARGIN(PMC *classobj), INTVAL type_num)
+{
+    ASSERT_ARGS(Parrot_oo_set_class_vtable)
+    Parrot_Class_attributes * const _class     = PARROT_CLASS(classobj);
+    VTABLE                  * const new_vtable =
+        Parrot_vtbl_clone_vtable(interp, classobj->vtable);
+
+    new_vtable->base_type         = type_num;
+    new_vtable->pmc_class         = classobj;
+    new_vtable->whoami            = VTABLE_get_string(interp, classobj);
+    new_vtable->mro               = _class->all_parents;
+    new_vtable->ro_variant_vtable =
+            Parrot_vtbl_clone_vtable(interp, classobj->vtable->ro_variant_vtable);
+
+    /* Store the class's vtable in the global table */
+    interp->vtables[type_num]     = new_vtable;
+
+    _class->id                    = type_num;
+}
+
+/*
+
 =item C<void mark_object_cache(PARROT_INTERP)>
 
 Marks all PMCs in the object method cache as live.  This shouldn't strictly be
@@ -744,6 +918,22 @@ mark_object_cache(PARROT_INTERP)
             }
         }
     }
+
+    if (mc->sites) {
+        for (entry = 0; entry <= mc->site_mask; ++entry) {
+            Method_site * const site = &mc->sites[entry];
+            int i;
+
+            if (!site->pc || site->epoch != mc->site_epoch)
+                continue;
+
+            for (i = 0; i < METHOD_SITE_WAYS && site->entries[i].vtable; ++i) {
+                Parrot_gc_mark_PMC_alive(interp, site->entries[i]._class);
+                Parrot_gc_mark_STRING_alive(interp, site->entries[i].name);
+                Parrot_gc_mark_PMC_alive(interp, site->entries[i].pmc);
+            }
+        }
+    }
 }
 
 
@@ -790,8 +980,12 @@ destroy_object_cache(PARROT_INTERP)
             invalidate_type_caches(interp, i);
     }
 
+    if (mc->sites)
+        mem_gc_free(interp, mc->sites);
+
     mem_gc_free(interp, mc->idx);
     mem_gc_free(interp, mc);
+    interp->caches = NULL;
 }
 
 
@@ -855,12 +1049,36 @@ invalidate_all_caches(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<static void invalidate_call_sites(PARROT_INTERP)>
+
+Forget the methods remembered at all call sites.  A change to one class can
+affect the lookups for all classes inheriting from it, so there is no
+finer-grained invalidation.  The sites are emptied lazily when next used.
+
+=cut
+
+*/
+
+static void
+invalidate_call_sites(PARROT_INTERP)
+{
+    ASSERT_ARGS(invalidate_call_sites)
+    Caches * const mc = interp->caches;
+
+    if (mc)
+        ++mc->site_epoch;
+}
+
+
 /*
 
 =item C<void Parrot_invalidate_method_cache(PARROT_INTERP, STRING *_class)>
 
 Clear method cache for the given class. If class is NULL, caches for
-all classes are invalidated.
+all classes are invalidated.  The caches of all call sites are cleared in
+either case.
 
 =cut
 
@@ -881,6 +1099,8 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
     if (interp->resume_flag & RESUME_INITIAL)
         return;
 
+    invalidate_call_sites(interp);
+
     if (!_class) {
         invalidate_all_caches(interp);
         return;
@@ -1027,6 +1247,331 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 }
 
 
+/*
+
+=item C<PMC * Parrot_find_method_at_site(PARROT_INTERP, PMC *object, STRING
+*method_name, const opcode_t *pc)>
+
+Find the method named C<method_name> of C<object> for the method call or
+lookup opcode at C<pc>.  Each call site remembers the methods it found for
+up to C<METHOD_SITE_WAYS> receiver types, guarded by the vtable and, for
+Objects, the class of the receiver.  Only lookups whose results the
+C<find_method> vtable function caches itself are remembered: those of
+Objects, and of other PMCs with a constant method name.  Any other receiver
+falls back to C<VTABLE_find_method>.
+
+The caches are cleared by C<Parrot_invalidate_method_cache>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_find_method_at_site(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *method_name), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_find_method_at_site)
+    VTABLE      * const vtable = object->vtable;
+    PMC         *_class;
+    PMC         *method;
+    Method_site *site;
+    int          i;
+
+    if (vtable->find_method == interp->vtables[enum_class_Object]->find_method)
+        _class = PARROT_OBJECT(object)->_class;
+    else if (vtable->find_method == interp->vtables[enum_class_default]->find_method
+         &&  PObj_constant_TEST(method_name))
+        _class = NULL;
+    else
+        return VTABLE_find_method(interp, object, method_name);
+
+    site = find_call_site(interp, pc);
+
+    for (i = 0; i < METHOD_SITE_WAYS; ++i) {
+        const Method_site_entry * const e = &site->entries[i];
+
+        if (!e->vtable)
+            break;
+
+        if (e->vtable == vtable && e->_class == _class
+        && (e->name == method_name || STRING_equal(interp, e->name, method_name)))
+            return e->pmc;
+    }
+
+    method = VTABLE_find_method(interp, object, method_name);
+
+    if (PMC_IS_NULL(method))
+        return method;
+
+    /* the lookup may have run code that changed or cleared the caches */
+    site = find_call_site(interp, pc);
+
+    for (i = 0; i < METHOD_SITE_WAYS - 1 && site->entries[i].vtable; ++i)
+        /* find a free entry, or replace the last one */ ;
+
+    site->entries[i].vtable = vtable;
+    site->entries[i]._class = _class;
+    site->entries[i].name   = method_name;
+    site->entries[i].pmc    = method;
+
+    return method;
+}
+
+
+/*
+
+=item C<PMC * Parrot_oo_get_attribute_at_site(PARROT_INTERP, PMC *object, STRING
+*name, const opcode_t *pc)>
+
+Get the attribute C<name> of C<object> for the C<getattribute> opcode at
+C<pc>.  The call site remembers the attribute slots it found for up to
+C<METHOD_SITE_WAYS> classes, so that Objects skip the name lookup.  Anything
+else goes through C<VTABLE_get_attr_str>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_oo_get_attribute_at_site(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *name), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_oo_get_attribute_at_site)
+
+    if (object->vtable->get_attr_str
+    ==  interp->vtables[enum_class_Object]->get_attr_str) {
+        STRING * const override = CONST_STRING(interp, "get_attr_str");
+        const INTVAL   slot     = find_attribute_slot(interp, object, name,
+                                      override, pc);
+
+        if (slot >= 0)
+            return PARROT_OBJECT(object)->attrib_store[slot];
+    }
+
+    return VTABLE_get_attr_str(interp, object, name);
+}
+
+
+/*
+
+=item C<void Parrot_oo_set_attribute_at_site(PARROT_INTERP, PMC *object, STRING
+*name, PMC *value, const opcode_t *pc)>
+
+Set the attribute C<name> of C<object> to C<value> for the C<setattribute>
+opcode at C<pc>, like C<Parrot_oo_get_attribute_at_site>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_oo_set_attribute_at_site(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *name), ARGIN(PMC *value), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_oo_set_attribute_at_site)
+
+    if (object->vtable->set_attr_str
+    ==  interp->vtables[enum_class_Object]->set_attr_str) {
+        STRING * const override = CONST_STRING(interp, "set_attr_str");
+        const INTVAL   slot     = find_attribute_slot(interp, object, name,
+                                      override, pc);
+
+        if (slot >= 0) {
+            PARROT_GC_WRITE_BARRIER(interp, object);
+            PARROT_OBJECT(object)->attrib_store[slot] = value;
+            return;
+        }
+    }
+
+    VTABLE_set_attr_str(interp, object, name, value);
+}
+
+
+/*
+
+=item C<static INTVAL find_attribute_slot(PARROT_INTERP, PMC *object, STRING
+*name, STRING *override, const opcode_t *pc)>
+
+Return the slot of the attribute C<name> of the Object C<object>, as
+remembered by the call site at C<pc> or found and remembered now.  Returns
+-1 if the class of C<object> has no such attribute, or overrides the vtable
+function C<override>, so that the caller has to use the vtable.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+find_attribute_slot(PARROT_INTERP, ARGIN(PMC *object), ARGIN(STRING *name),
+        ARGIN(STRING *override), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(find_attribute_slot)
+    PMC         * const _class = PARROT_OBJECT(object)->_class;
+    Method_site * const site   = find_call_site(interp, pc);
+    INTVAL              slot;
+    int                 i;
+
+    for (i = 0; i < METHOD_SITE_WAYS; ++i) {
+        const Method_site_entry * const e = &site->entries[i];
+
+        if (!e->vtable)
+            break;
+
+        if (e->_class == _class
+        && (e->name == name || STRING_equal(interp, e->name, name)))
+            return e->slot;
+    }
+
+    /* neither of these runs any code that could move the site */
+    if (!PMC_IS_NULL(Parrot_oo_find_vtable_override(interp, _class, override)))
+        return -1;
+
+    slot = Parrot_oo_get_attrib_index(interp, _class, name);
+
+    if (slot < 0)
+        return -1;
+
+    PARROT_ASSERT(slot < PARROT_OBJECT(object)->num_attribs);
+
+    if (i == METHOD_SITE_WAYS)
+        --i;
+
+    site->entries[i].vtable = object->vtable;
+    site->entries[i]._class = _class;
+    site->entries[i].name   = name;
+    site->entries[i].pmc    = PMCNULL;
+    site->entries[i].slot   = slot;
+
+    return slot;
+}
+
+
+/*
+
+=item C<static Method_site * find_call_site(PARROT_INTERP, const opcode_t *pc)>
+
+Return the cache of the call site at C<pc>, creating an empty one if there
+is none yet, and emptying it if it was invalidated.  The table of call sites
+doubles when it is three quarters full.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Method_site *
+find_call_site(PARROT_INTERP, ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(find_call_site)
+    Caches * const mc = interp->caches;
+    UINTVAL        slot;
+
+    if (!mc->sites)
+        rehash_call_sites(interp, 64, NULL, NULL);
+    else if ((mc->site_count + 1) * 4 > (mc->site_mask + 1) * 3)
+        rehash_call_sites(interp, (mc->site_mask + 1) * 2, NULL, NULL);
+
+    slot = PTR2UINTVAL(pc) / sizeof (opcode_t) & mc->site_mask;
+
+    while (mc->sites[slot].pc != pc) {
+        if (!mc->sites[slot].pc) {
+            mc->sites[slot].pc = pc;
+            ++mc->site_count;
+            break;
+        }
+
+        slot = (slot + 1) & mc->site_mask;
+    }
+
+    if (mc->sites[slot].epoch != mc->site_epoch) {
+        memset(mc->sites[slot].entries, 0, sizeof (mc->sites[slot].entries));
+        mc->sites[slot].epoch = mc->site_epoch;
+    }
+
+    return &mc->sites[slot];
+}
+
+
+/*
+
+=item C<static void rehash_call_sites(PARROT_INTERP, UINTVAL size, const
+opcode_t *from, const opcode_t *to)>
+
+Move the call sites into a new table of C<size> sites, a power of two,
+dropping those with a C<pc> from C<from> up to C<to>.
+
+=cut
+
+*/
+
+static void
+rehash_call_sites(PARROT_INTERP, UINTVAL size,
+        ARGIN_NULLOK(const opcode_t *from), ARGIN_NULLOK(const opcode_t *to))
+{
+    ASSERT_ARGS(rehash_call_sites)
+    Caches      * const mc        = interp->caches;
+    Method_site * const old_sites = mc->sites;
+    const UINTVAL       old_size  = old_sites ? mc->site_mask + 1 : 0;
+    UINTVAL             i;
+
+    mc->sites      = mem_gc_allocate_n_zeroed_typed(interp, size, Method_site);
+    mc->site_mask  = size - 1;
+    mc->site_count = 0;
+
+    for (i = 0; i < old_size; ++i) {
+        const opcode_t * const pc = old_sites[i].pc;
+        UINTVAL                slot;
+
+        if (!pc || (from && pc >= from && pc < to))
+            continue;
+
+        slot = PTR2UINTVAL(pc) / sizeof (opcode_t) & mc->site_mask;
+
+        while (mc->sites[slot].pc)
+            slot = (slot + 1) & mc->site_mask;
+
+        mc->sites[slot] = old_sites[i];
+        ++mc->site_count;
+    }
+
+    if (old_sites)
+        mem_gc_free(interp, old_sites);
+}
+
+
+/*
+
+=item C<void Parrot_oo_forget_call_sites(PARROT_INTERP, const opcode_t *code,
+size_t size)>
+
+Drop the call sites in the C<size> opcodes at C<code>, a bytecode segment
+being destroyed, so that code loaded there later doesn't find them.
+
+=cut
+
+*/
+
+void
+Parrot_oo_forget_call_sites(PARROT_INTERP, ARGIN(const opcode_t *code),
+        size_t size)
+{
+    ASSERT_ARGS(Parrot_oo_forget_call_sites)
+    Caches * const mc = interp->caches;
+
+    if (mc && mc->site_count)
+        rehash_call_sites(interp, mc->site_mask + 1, code, code + size);
+}
+
+
 /*
 
 =item C<static PMC* C3_merge(PARROT_INTERP, PMC *merge_list)>
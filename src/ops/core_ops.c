@@ -13,6 +13,7 @@
 #include "parrot/oplib/core_ops.h"
 #include "pmc/pmc_parrotlibrary.h"
 #include "pmc/pmc_callcontext.h"
+#include <math.h>
 
 
 /* defines - Ops::Trans::C */
@@ -26,7 +27,7 @@
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
-#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
 
 static int get_op(PARROT_INTERP, const char * name, int full);
 
@@ -15406,9 +15407,14 @@ Parrot_set_args_pc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
     opcode_t * const raw_args = CUR_OPCODE;
     PMC * const signature = PCONST(1);
-    PMC * const call_sig = Parrot_pcc_build_sig_object_from_op(interp,
-            PMCNULL, signature, raw_args);
+    PMC *       call_sig  = Parrot_pcc_build_direct_call_from_op(interp,
+            signature, raw_args);
     const INTVAL argc = VTABLE_elements(interp, signature);
+
+    if (PMC_IS_NULL(call_sig))
+        call_sig = Parrot_pcc_build_sig_object_from_op(interp,
+                PMCNULL, signature, raw_args);
+
     Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);return (opcode_t *)cur_opcode + argc + 2;
 }
 
@@ -19618,7 +19624,8 @@ Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     STRING   * const meth       = SREG(2);
     opcode_t * const next       = cur_opcode + 3;
 
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
     opcode_t *dest              = NULL;
 
     Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
@@ -19655,7 +19662,8 @@ Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     STRING   * const meth       = SCONST(2);
     opcode_t * const next       = cur_opcode + 3;
 
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
     opcode_t *dest              = NULL;
 
     Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
@@ -19708,7 +19716,8 @@ Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     STRING   * const meth       = SREG(2);
     opcode_t * const next       = cur_opcode + 4;
 
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
     opcode_t *dest              = NULL;
     PMC      *       signature  = Parrot_pcc_get_signature(interp,
                                     CURRENT_CONTEXT(interp));
@@ -19735,7 +19744,8 @@ Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     STRING   * const meth       = SCONST(2);
     opcode_t * const next       = cur_opcode + 4;
 
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
     opcode_t *dest              = NULL;
     PMC      *       signature  = Parrot_pcc_get_signature(interp,
                                     CURRENT_CONTEXT(interp));
@@ -19780,7 +19790,8 @@ Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     opcode_t * const next       = cur_opcode + 3;
     PMC      * const object     = PREG(1);
     STRING   * const meth       = SREG(2);
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
 
     opcode_t *dest;
     PMC      *       signature  = Parrot_pcc_get_signature(interp,
@@ -19806,7 +19817,8 @@ Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     opcode_t * const next       = cur_opcode + 3;
     PMC      * const object     = PREG(1);
     STRING   * const meth       = SCONST(2);
-    PMC      * const method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
 
     opcode_t *dest;
     PMC      *       signature  = Parrot_pcc_get_signature(interp,
@@ -20358,14 +20370,14 @@ return (opcode_t *)cur_opcode + 3;}
 opcode_t *
 Parrot_getattribute_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SREG(3));
+    PREG(1) = Parrot_oo_get_attribute_at_site(interp, PREG(2), SREG(3), CUR_OPCODE);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
 Parrot_getattribute_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
+    PREG(1) = Parrot_oo_get_attribute_at_site(interp, PREG(2), SCONST(3), CUR_OPCODE);
 
 return (opcode_t *)cur_opcode + 4;}
 
@@ -20400,14 +20412,14 @@ return (opcode_t *)cur_opcode + 5;}
 opcode_t *
 Parrot_setattribute_p_s_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_str(interp, PREG(1), SREG(2), PREG(3));
+    Parrot_oo_set_attribute_at_site(interp, PREG(1), SREG(2), PREG(3), CUR_OPCODE);
 
 return (opcode_t *)cur_opcode + 4;}
 
 opcode_t *
 Parrot_setattribute_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
-    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
+    Parrot_oo_set_attribute_at_site(interp, PREG(1), SCONST(2), PREG(3), CUR_OPCODE);
 
 return (opcode_t *)cur_opcode + 4;}
 
@@ -20878,7 +20890,7 @@ opcode_t *
 Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
     opcode_t * const resume = cur_opcode + 4;
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SREG(3), CUR_OPCODE);
     if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
         opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
             EXCEPTION_METHOD_NOT_FOUND,
@@ -20891,7 +20903,7 @@ opcode_t *
 Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP)  {
     const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
     opcode_t * const resume = cur_opcode + 4;
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SCONST(3), CUR_OPCODE);
     if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
         opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
             EXCEPTION_METHOD_NOT_FOUND,
@@ -22031,6 +22043,10 @@ Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
         /* Preserve the metadata on the destination. */
         PMC   * const meta  = VTABLE_getprops(interp, PREG(1));
 
+        /* the destination gets the clone's flags, so pass its barrier while
+         * it still has its own */
+        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
+
         /* avoid leaks and unreachable memory by destroying the destination PMC */
         Parrot_pmc_destroy(interp, PREG(1));
 
@@ -22038,8 +22054,9 @@ Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP)  {
          * destination header */
         memmove(PREG(1), clone, sizeof (PMC));
 
-        /* don't let the clone's destruction destroy the destination's data */
-        PObj_custom_destroy_CLEAR(clone);
+        /* don't let the clone's destruction destroy the destination's data,
+         * nor its marking follow the emptied header */
+        PObj_gc_CLEAR(clone);
         PMC_data(clone)        = NULL;
         PMC_metadata(clone)    = NULL;
 
@@ -0,0 +1,10980 @@
+
+/* ex: set ro:
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'src/ops/core.ops' (and possibly other
+ * .ops files). by ops2c.nqp.
+ *
+ * Any changes made here will be lost!  To regenerate this file after making
+ * changes to any ops, use the bootstrap-ops makefile target.
+ *
+ */
+
+#include "parrot/oplib/core_ops_cg.h"
+#include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_callcontext.h"
+#include <math.h>
+
+
+/* defines - Ops::Trans::CGoto */
+#define REL_PC     ((size_t)(cur_opcode - (opcode_t *)interp->code->base.data))
+#define CUR_OPCODE cur_opcode
+#define IREG(i) (CUR_CTX->bp.regs_i[cur_opcode[i]])
+#define NREG(i) (CUR_CTX->bp.regs_n[-1L - cur_opcode[i]])
+#define PREG(i) (CUR_CTX->bp_ps.regs_p[-1L - cur_opcode[i]])
+#define SREG(i) (CUR_CTX->bp_ps.regs_s[cur_opcode[i]])
+#define ICONST(i) cur_opcode[i]
+#define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
+#define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
+#undef  PCONST
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
+
+/* label of the op at pc in the current segment, rebuilding the table as needed */
+#define CG_LABEL(pc) \
+    ((size_t)*(pc) < cg_seg->op_addr_count ? cg_seg->op_addr_table[*(pc)] : &&cg_branch)
+
+/* fall through to the op following the current one */
+#define CG_NEXT(n) \
+    do { \
+        cur_opcode += (n); \
+        goto *CG_LABEL(cur_opcode); \
+    } while (0)
+
+/* jump anywhere, leaving the runloop on a NULL address */
+#define CG_BRANCH(addr) \
+    do { \
+        cur_opcode = (opcode_t *)(addr); \
+        goto cg_branch; \
+    } while (0)
+
+
+/* XXX should be static, but C++ doesn't want to play ball */
+extern op_lib_t core_cg_op_lib;
+
+
+
+#include "parrot/dynext.h"
+#include "parrot/embed.h"
+#include "parrot/runcore_api.h"
+#include "pmc/pmc_continuation.h"
+#include "pmc/pmc_parrotlibrary.h"
+
+
+ /* Signed shift operator that is compatible with PMC shifts.  This is
+  * guaranteed to produce the same result as bitwise_left_shift_internal modulo
+  * word size, ignoring the fact that Parrot integers are always signed.  This
+  * usually gives the same answer regardless whether you shift PMC operands and
+  * then assign to an I-reg, or move the operands to I-regs and do the shift
+  * there -- except when the true result is between 2^{w-1} and 2^w (where w is
+  * the word size), in which case the high order bit is taken as the sign,
+  * giving a truncated result that is 2^w lower.
+  */
+#define bit_shift_left(number, bits) \
+    ((bits) >= 8*INTVAL_SIZE     ? 0                    \
+     : (bits) >= 0               ? (number) << (bits)   \
+     : (bits) > -8*INTVAL_SIZE   ? (number) >> -(bits)   \
+     : 0)
+
+
+#include "../io/io_private.h"
+
+
+#if PARROT_HAS_ICU
+#  include <unicode/uchar.h>
+#endif
+
+
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+#define CG_OP_COUNT 1073
+
+/*
+** Computed goto runloop:
+*/
+
+opcode_t *
+cg_core(opcode_t *cur_opcode, PARROT_INTERP)
+{
+    static void * const cg_ops_addr[] = {
+        &&PC_0,                                            /*      0 */
+        &&PC_1,                                            /*      1 */
+        &&PC_2,                                            /*      2 */
+        &&PC_3,                                            /*      3 */
+        &&PC_4,                                            /*      4 */
+        &&PC_5,                                            /*      5 */
+        &&PC_6,                                            /*      6 */
+        &&PC_7,                                            /*      7 */
+        &&PC_8,                                            /*      8 */
+        &&PC_9,                                            /*      9 */
+        &&PC_10,                                           /*     10 */
+        &&PC_11,                                           /*     11 */
+        &&PC_12,                                           /*     12 */
+        &&PC_13,                                           /*     13 */
+        &&PC_14,                                           /*     14 */
+        &&PC_15,                                           /*     15 */
+        &&PC_16,                                           /*     16 */
+        &&PC_17,                                           /*     17 */
+        &&PC_18,                                           /*     18 */
+        &&PC_19,                                           /*     19 */
+        &&PC_20,                                           /*     20 */
+        &&PC_21,                                           /*     21 */
+        &&PC_22,                                           /*     22 */
+        &&PC_23,                                           /*     23 */
+        &&PC_24,                                           /*     24 */
+        &&PC_25,                                           /*     25 */
+        &&PC_26,                                           /*     26 */
+        &&PC_27,                                           /*     27 */
+        &&PC_28,                                           /*     28 */
+        &&PC_29,                                           /*     29 */
+        &&PC_30,                                           /*     30 */
+        &&PC_31,                                           /*     31 */
+        &&PC_32,                                           /*     32 */
+        &&PC_33,                                           /*     33 */
+        &&PC_34,                                           /*     34 */
+        &&PC_35,                                           /*     35 */
+        &&PC_36,                                           /*     36 */
+        &&PC_37,                                           /*     37 */
+        &&PC_38,                                           /*     38 */
+        &&PC_39,                                           /*     39 */
+        &&PC_40,                                           /*     40 */
+        &&PC_41,                                           /*     41 */
+        &&PC_42,                                           /*     42 */
+        &&PC_43,                                           /*     43 */
+        &&PC_44,                                           /*     44 */
+        &&PC_45,                                           /*     45 */
+        &&PC_46,                                           /*     46 */
+        &&PC_47,                                           /*     47 */
+        &&PC_48,                                           /*     48 */
+        &&PC_49,                                           /*     49 */
+        &&PC_50,                                           /*     50 */
+        &&PC_51,                                           /*     51 */
+        &&PC_52,                                           /*     52 */
+        &&PC_53,                                           /*     53 */
+        &&PC_54,                                           /*     54 */
+        &&PC_55,                                           /*     55 */
+        &&PC_56,                                           /*     56 */
+        &&PC_57,                                           /*     57 */
+        &&PC_58,                                           /*     58 */
+        &&PC_59,                                           /*     59 */
+        &&PC_60,                                           /*     60 */
+        &&PC_61,                                           /*     61 */
+        &&PC_62,                                           /*     62 */
+        &&PC_63,                                           /*     63 */
+        &&PC_64,                                           /*     64 */
+        &&PC_65,                                           /*     65 */
+        &&PC_66,                                           /*     66 */
+        &&PC_67,                                           /*     67 */
+        &&PC_68,                                           /*     68 */
+        &&PC_69,                                           /*     69 */
+        &&PC_70,                                           /*     70 */
+        &&PC_71,                                           /*     71 */
+        &&PC_72,                                           /*     72 */
+        &&PC_73,                                           /*     73 */
+        &&PC_74,                                           /*     74 */
+        &&PC_75,                                           /*     75 */
+        &&PC_76,                                           /*     76 */
+        &&PC_77,                                           /*     77 */
+        &&PC_78,                                           /*     78 */
+        &&PC_79,                                           /*     79 */
+        &&PC_80,                                           /*     80 */
+        &&PC_81,                                           /*     81 */
+        &&PC_82,                                           /*     82 */
+        &&PC_83,                                           /*     83 */
+        &&PC_84,                                           /*     84 */
+        &&PC_85,                                           /*     85 */
+        &&PC_86,                                           /*     86 */
+        &&PC_87,                                           /*     87 */
+        &&PC_88,                                           /*     88 */
+        &&PC_89,                                           /*     89 */
+        &&PC_90,                                           /*     90 */
+        &&PC_91,                                           /*     91 */
+        &&PC_92,                                           /*     92 */
+        &&PC_93,                                           /*     93 */
+        &&PC_94,                                           /*     94 */
+        &&PC_95,                                           /*     95 */
+        &&PC_96,                                           /*     96 */
+        &&PC_97,                                           /*     97 */
+        &&PC_98,                                           /*     98 */
+        &&PC_99,                                           /*     99 */
+        &&PC_100,                                          /*    100 */
+        &&PC_101,                                          /*    101 */
+        &&PC_102,                                          /*    102 */
+        &&PC_103,                                          /*    103 */
+        &&PC_104,                                          /*    104 */
+        &&PC_105,                                          /*    105 */
+        &&PC_106,                                          /*    106 */
+        &&PC_107,                                          /*    107 */
+        &&PC_108,                                          /*    108 */
+        &&PC_109,                                          /*    109 */
+        &&PC_110,                                          /*    110 */
+        &&PC_111,                                          /*    111 */
+        &&PC_112,                                          /*    112 */
+        &&PC_113,                                          /*    113 */
+        &&PC_114,                                          /*    114 */
+        &&PC_115,                                          /*    115 */
+        &&PC_116,                                          /*    116 */
+        &&PC_117,                                          /*    117 */
+        &&PC_118,                                          /*    118 */
+        &&PC_119,                                          /*    119 */
+        &&PC_120,                                          /*    120 */
+        &&PC_121,                                          /*    121 */
+        &&PC_122,                                          /*    122 */
+        &&PC_123,                                          /*    123 */
+        &&PC_124,                                          /*    124 */
+        &&PC_125,                                          /*    125 */
+        &&PC_126,                                          /*    126 */
+        &&PC_127,                                          /*    127 */
+        &&PC_128,                                          /*    128 */
+        &&PC_129,                                          /*    129 */
+        &&PC_130,                                          /*    130 */
+        &&PC_131,                                          /*    131 */
+        &&PC_132,                                          /*    132 */
+        &&PC_133,                                          /*    133 */
+        &&PC_134,                                          /*    134 */
+        &&PC_135,                                          /*    135 */
+        &&PC_136,                                          /*    136 */
+        &&PC_137,                                          /*    137 */
+        &&PC_138,                                          /*    138 */
+        &&PC_139,                                          /*    139 */
+        &&PC_140,                                          /*    140 */
+        &&PC_141,                                          /*    141 */
+        &&PC_142,                                          /*    142 */
+        &&PC_143,                                          /*    143 */
+        &&PC_144,                                          /*    144 */
+        &&PC_145,                                          /*    145 */
+        &&PC_146,                                          /*    146 */
+        &&PC_147,                                          /*    147 */
+        &&PC_148,                                          /*    148 */
+        &&PC_149,                                          /*    149 */
+        &&PC_150,                                          /*    150 */
+        &&PC_151,                                          /*    151 */
+        &&PC_152,                                          /*    152 */
+        &&PC_153,                                          /*    153 */
+        &&PC_154,                                          /*    154 */
+        &&PC_155,                                          /*    155 */
+        &&PC_156,                                          /*    156 */
+        &&PC_157,                                          /*    157 */
+        &&PC_158,                                          /*    158 */
+        &&PC_159,                                          /*    159 */
+        &&PC_160,                                          /*    160 */
+        &&PC_161,                                          /*    161 */
+        &&PC_162,                                          /*    162 */
+        &&PC_163,                                          /*    163 */
+        &&PC_164,                                          /*    164 */
+        &&PC_165,                                          /*    165 */
+        &&PC_166,                                          /*    166 */
+        &&PC_167,                                          /*    167 */
+        &&PC_168,                                          /*    168 */
+        &&PC_169,                                          /*    169 */
+        &&PC_170,                                          /*    170 */
+        &&PC_171,                                          /*    171 */
+        &&PC_172,                                          /*    172 */
+        &&PC_173,                                          /*    173 */
+        &&PC_174,                                          /*    174 */
+        &&PC_175,                                          /*    175 */
+        &&PC_176,                                          /*    176 */
+        &&PC_177,                                          /*    177 */
+        &&PC_178,                                          /*    178 */
+        &&PC_179,                                          /*    179 */
+        &&PC_180,                                          /*    180 */
+        &&PC_181,                                          /*    181 */
+        &&PC_182,                                          /*    182 */
+        &&PC_183,                                          /*    183 */
+        &&PC_184,                                          /*    184 */
+        &&PC_185,                                          /*    185 */
+        &&PC_186,                                          /*    186 */
+        &&PC_187,                                          /*    187 */
+        &&PC_188,                                          /*    188 */
+        &&PC_189,                                          /*    189 */
+        &&PC_190,                                          /*    190 */
+        &&PC_191,                                          /*    191 */
+        &&PC_192,                                          /*    192 */
+        &&PC_193,                                          /*    193 */
+        &&PC_194,                                          /*    194 */
+        &&PC_195,                                          /*    195 */
+        &&PC_196,                                          /*    196 */
+        &&PC_197,                                          /*    197 */
+        &&PC_198,                                          /*    198 */
+        &&PC_199,                                          /*    199 */
+        &&PC_200,                                          /*    200 */
+        &&PC_201,                                          /*    201 */
+        &&PC_202,                                          /*    202 */
+        &&PC_203,                                          /*    203 */
+        &&PC_204,                                          /*    204 */
+        &&PC_205,                                          /*    205 */
+        &&PC_206,                                          /*    206 */
+        &&PC_207,                                          /*    207 */
+        &&PC_208,                                          /*    208 */
+        &&PC_209,                                          /*    209 */
+        &&PC_210,                                          /*    210 */
+        &&PC_211,                                          /*    211 */
+        &&PC_212,                                          /*    212 */
+        &&PC_213,                                          /*    213 */
+        &&PC_214,                                          /*    214 */
+        &&PC_215,                                          /*    215 */
+        &&PC_216,                                          /*    216 */
+        &&PC_217,                                          /*    217 */
+        &&PC_218,                                          /*    218 */
+        &&PC_219,                                          /*    219 */
+        &&PC_220,                                          /*    220 */
+        &&PC_221,                                          /*    221 */
+        &&PC_222,                                          /*    222 */
+        &&PC_223,                                          /*    223 */
+        &&PC_224,                                          /*    224 */
+        &&PC_225,                                          /*    225 */
+        &&PC_226,                                          /*    226 */
+        &&PC_227,                                          /*    227 */
+        &&PC_228,                                          /*    228 */
+        &&PC_229,                                          /*    229 */
+        &&PC_230,                                          /*    230 */
+        &&PC_231,                                          /*    231 */
+        &&PC_232,                                          /*    232 */
+        &&PC_233,                                          /*    233 */
+        &&PC_234,                                          /*    234 */
+        &&PC_235,                                          /*    235 */
+        &&PC_236,                                          /*    236 */
+        &&PC_237,                                          /*    237 */
+        &&PC_238,                                          /*    238 */
+        &&PC_239,                                          /*    239 */
+        &&PC_240,                                          /*    240 */
+        &&PC_241,                                          /*    241 */
+        &&PC_242,                                          /*    242 */
+        &&PC_243,                                          /*    243 */
+        &&PC_244,                                          /*    244 */
+        &&PC_245,                                          /*    245 */
+        &&PC_246,                                          /*    246 */
+        &&PC_247,                                          /*    247 */
+        &&PC_248,                                          /*    248 */
+        &&PC_249,                                          /*    249 */
+        &&PC_250,                                          /*    250 */
+        &&PC_251,                                          /*    251 */
+        &&PC_252,                                          /*    252 */
+        &&PC_253,                                          /*    253 */
+        &&PC_254,                                          /*    254 */
+        &&PC_255,                                          /*    255 */
+        &&PC_256,                                          /*    256 */
+        &&PC_257,                                          /*    257 */
+        &&PC_258,                                          /*    258 */
+        &&PC_259,                                          /*    259 */
+        &&PC_260,                                          /*    260 */
+        &&PC_261,                                          /*    261 */
+        &&PC_262,                                          /*    262 */
+        &&PC_263,                                          /*    263 */
+        &&PC_264,                                          /*    264 */
+        &&PC_265,                                          /*    265 */
+        &&PC_266,                                          /*    266 */
+        &&PC_267,                                          /*    267 */
+        &&PC_268,                                          /*    268 */
+        &&PC_269,                                          /*    269 */
+        &&PC_270,                                          /*    270 */
+        &&PC_271,                                          /*    271 */
+        &&PC_272,                                          /*    272 */
+        &&PC_273,                                          /*    273 */
+        &&PC_274,                                          /*    274 */
+        &&PC_275,                                          /*    275 */
+        &&PC_276,                                          /*    276 */
+        &&PC_277,                                          /*    277 */
+        &&PC_278,                                          /*    278 */
+        &&PC_279,                                          /*    279 */
+        &&PC_280,                                          /*    280 */
+        &&PC_281,                                          /*    281 */
+        &&PC_282,                                          /*    282 */
+        &&PC_283,                                          /*    283 */
+        &&PC_284,                                          /*    284 */
+        &&PC_285,                                          /*    285 */
+        &&PC_286,                                          /*    286 */
+        &&PC_287,                                          /*    287 */
+        &&PC_288,                                          /*    288 */
+        &&PC_289,                                          /*    289 */
+        &&PC_290,                                          /*    290 */
+        &&PC_291,                                          /*    291 */
+        &&PC_292,                                          /*    292 */
+        &&PC_293,                                          /*    293 */
+        &&PC_294,                                          /*    294 */
+        &&PC_295,                                          /*    295 */
+        &&PC_296,                                          /*    296 */
+        &&PC_297,                                          /*    297 */
+        &&PC_298,                                          /*    298 */
+        &&PC_299,                                          /*    299 */
+        &&PC_300,                                          /*    300 */
+        &&PC_301,                                          /*    301 */
+        &&PC_302,                                          /*    302 */
+        &&PC_303,                                          /*    303 */
+        &&PC_304,                                          /*    304 */
+        &&PC_305,                                          /*    305 */
+        &&PC_306,                                          /*    306 */
+        &&PC_307,                                          /*    307 */
+        &&PC_308,                                          /*    308 */
+        &&PC_309,                                          /*    309 */
+        &&PC_310,                                          /*    310 */
+        &&PC_311,                                          /*    311 */
+        &&PC_312,                                          /*    312 */
+        &&PC_313,                                          /*    313 */
+        &&PC_314,                                          /*    314 */
+        &&PC_315,                                          /*    315 */
+        &&PC_316,                                          /*    316 */
+        &&PC_317,                                          /*    317 */
+        &&PC_318,                                          /*    318 */
+        &&PC_319,                                          /*    319 */
+        &&PC_320,                                          /*    320 */
+        &&PC_321,                                          /*    321 */
+        &&PC_322,                                          /*    322 */
+        &&PC_323,                                          /*    323 */
+        &&PC_324,                                          /*    324 */
+        &&PC_325,                                          /*    325 */
+        &&PC_326,                                          /*    326 */
+        &&PC_327,                                          /*    327 */
+        &&PC_328,                                          /*    328 */
+        &&PC_329,                                          /*    329 */
+        &&PC_330,                                          /*    330 */
+        &&PC_331,                                          /*    331 */
+        &&PC_332,                                          /*    332 */
+        &&PC_333,                                          /*    333 */
+        &&PC_334,                                          /*    334 */
+        &&PC_335,                                          /*    335 */
+        &&PC_336,                                          /*    336 */
+        &&PC_337,                                          /*    337 */
+        &&PC_338,                                          /*    338 */
+        &&PC_339,                                          /*    339 */
+        &&PC_340,                                          /*    340 */
+        &&PC_341,                                          /*    341 */
+        &&PC_342,                                          /*    342 */
+        &&PC_343,                                          /*    343 */
+        &&PC_344,                                          /*    344 */
+        &&PC_345,                                          /*    345 */
+        &&PC_346,                                          /*    346 */
+        &&PC_347,                                          /*    347 */
+        &&PC_348,                                          /*    348 */
+        &&PC_349,                                          /*    349 */
+        &&PC_350,                                          /*    350 */
+        &&PC_351,                                          /*    351 */
+        &&PC_352,                                          /*    352 */
+        &&PC_353,                                          /*    353 */
+        &&PC_354,                                          /*    354 */
+        &&PC_355,                                          /*    355 */
+        &&PC_356,                                          /*    356 */
+        &&PC_357,                                          /*    357 */
+        &&PC_358,                                          /*    358 */
+        &&PC_359,                                          /*    359 */
+        &&PC_360,                                          /*    360 */
+        &&PC_361,                                          /*    361 */
+        &&PC_362,                                          /*    362 */
+        &&PC_363,                                          /*    363 */
+        &&PC_364,                                          /*    364 */
+        &&PC_365,                                          /*    365 */
+        &&PC_366,                                          /*    366 */
+        &&PC_367,                                          /*    367 */
+        &&PC_368,                                          /*    368 */
+        &&PC_369,                                          /*    369 */
+        &&PC_370,                                          /*    370 */
+        &&PC_371,                                          /*    371 */
+        &&PC_372,                                          /*    372 */
+        &&PC_373,                                          /*    373 */
+        &&PC_374,                                          /*    374 */
+        &&PC_375,                                          /*    375 */
+        &&PC_376,                                          /*    376 */
+        &&PC_377,                                          /*    377 */
+        &&PC_378,                                          /*    378 */
+        &&PC_379,                                          /*    379 */
+        &&PC_380,                                          /*    380 */
+        &&PC_381,                                          /*    381 */
+        &&PC_382,                                          /*    382 */
+        &&PC_383,                                          /*    383 */
+        &&PC_384,                                          /*    384 */
+        &&PC_385,                                          /*    385 */
+        &&PC_386,                                          /*    386 */
+        &&PC_387,                                          /*    387 */
+        &&PC_388,                                          /*    388 */
+        &&PC_389,                                          /*    389 */
+        &&PC_390,                                          /*    390 */
+        &&PC_391,                                          /*    391 */
+        &&PC_392,                                          /*    392 */
+        &&PC_393,                                          /*    393 */
+        &&PC_394,                                          /*    394 */
+        &&PC_395,                                          /*    395 */
+        &&PC_396,                                          /*    396 */
+        &&PC_397,                                          /*    397 */
+        &&PC_398,                                          /*    398 */
+        &&PC_399,                                          /*    399 */
+        &&PC_400,                                          /*    400 */
+        &&PC_401,                                          /*    401 */
+        &&PC_402,                                          /*    402 */
+        &&PC_403,                                          /*    403 */
+        &&PC_404,                                          /*    404 */
+        &&PC_405,                                          /*    405 */
+        &&PC_406,                                          /*    406 */
+        &&PC_407,                                          /*    407 */
+        &&PC_408,                                          /*    408 */
+        &&PC_409,                                          /*    409 */
+        &&PC_410,                                          /*    410 */
+        &&PC_411,                                          /*    411 */
+        &&PC_412,                                          /*    412 */
+        &&PC_413,                                          /*    413 */
+        &&PC_414,                                          /*    414 */
+        &&PC_415,                                          /*    415 */
+        &&PC_416,                                          /*    416 */
+        &&PC_417,                                          /*    417 */
+        &&PC_418,                                          /*    418 */
+        &&PC_419,                                          /*    419 */
+        &&PC_420,                                          /*    420 */
+        &&PC_421,                                          /*    421 */
+        &&PC_422,                                          /*    422 */
+        &&PC_423,                                          /*    423 */
+        &&PC_424,                                          /*    424 */
+        &&PC_425,                                          /*    425 */
+        &&PC_426,                                          /*    426 */
+        &&PC_427,                                          /*    427 */
+        &&PC_428,                                          /*    428 */
+        &&PC_429,                                          /*    429 */
+        &&PC_430,                                          /*    430 */
+        &&PC_431,                                          /*    431 */
+        &&PC_432,                                          /*    432 */
+        &&PC_433,                                          /*    433 */
+        &&PC_434,                                          /*    434 */
+        &&PC_435,                                          /*    435 */
+        &&PC_436,                                          /*    436 */
+        &&PC_437,                                          /*    437 */
+        &&PC_438,                                          /*    438 */
+        &&PC_439,                                          /*    439 */
+        &&PC_440,                                          /*    440 */
+        &&PC_441,                                          /*    441 */
+        &&PC_442,                                          /*    442 */
+        &&PC_443,                                          /*    443 */
+        &&PC_444,                                          /*    444 */
+        &&PC_445,                                          /*    445 */
+        &&PC_446,                                          /*    446 */
+        &&PC_447,                                          /*    447 */
+        &&PC_448,                                          /*    448 */
+        &&PC_449,                                          /*    449 */
+        &&PC_450,                                          /*    450 */
+        &&PC_451,                                          /*    451 */
+        &&PC_452,                                          /*    452 */
+        &&PC_453,                                          /*    453 */
+        &&PC_454,                                          /*    454 */
+        &&PC_455,                                          /*    455 */
+        &&PC_456,                                          /*    456 */
+        &&PC_457,                                          /*    457 */
+        &&PC_458,                                          /*    458 */
+        &&PC_459,                                          /*    459 */
+        &&PC_460,                                          /*    460 */
+        &&PC_461,                                          /*    461 */
+        &&PC_462,                                          /*    462 */
+        &&PC_463,                                          /*    463 */
+        &&PC_464,                                          /*    464 */
+        &&PC_465,                                          /*    465 */
+        &&PC_466,                                          /*    466 */
+        &&PC_467,                                          /*    467 */
+        &&PC_468,                                          /*    468 */
+        &&PC_469,                                          /*    469 */
+        &&PC_470,                                          /*    470 */
+        &&PC_471,                                          /*    471 */
+        &&PC_472,                                          /*    472 */
+        &&PC_473,                                          /*    473 */
+        &&PC_474,                                          /*    474 */
+        &&PC_475,                                          /*    475 */
+        &&PC_476,                                          /*    476 */
+        &&PC_477,                                          /*    477 */
+        &&PC_478,                                          /*    478 */
+        &&PC_479,                                          /*    479 */
+        &&PC_480,                                          /*    480 */
+        &&PC_481,                                          /*    481 */
+        &&PC_482,                                          /*    482 */
+        &&PC_483,                                          /*    483 */
+        &&PC_484,                                          /*    484 */
+        &&PC_485,                                          /*    485 */
+        &&PC_486,                                          /*    486 */
+        &&PC_487,                                          /*    487 */
+        &&PC_488,                                          /*    488 */
+        &&PC_489,                                          /*    489 */
+        &&PC_490,                                          /*    490 */
+        &&PC_491,                                          /*    491 */
+        &&PC_492,                                          /*    492 */
+        &&PC_493,                                          /*    493 */
+        &&PC_494,                                          /*    494 */
+        &&PC_495,                                          /*    495 */
+        &&PC_496,                                          /*    496 */
+        &&PC_497,                                          /*    497 */
+        &&PC_498,                                          /*    498 */
+        &&PC_499,                                          /*    499 */
+        &&PC_500,                                          /*    500 */
+        &&PC_501,                                          /*    501 */
+        &&PC_502,                                          /*    502 */
+        &&PC_503,                                          /*    503 */
+        &&PC_504,                                          /*    504 */
+        &&PC_505,                                          /*    505 */
+        &&PC_506,                                          /*    506 */
+        &&PC_507,                                          /*    507 */
+        &&PC_508,                                          /*    508 */
+        &&PC_509,                                          /*    509 */
+        &&PC_510,                                          /*    510 */
+        &&PC_511,                                          /*    511 */
+        &&PC_512,                                          /*    512 */
+        &&PC_513,                                          /*    513 */
+        &&PC_514,                                          /*    514 */
+        &&PC_515,                                          /*    515 */
+        &&PC_516,                                          /*    516 */
+        &&PC_517,                                          /*    517 */
+        &&PC_518,                                          /*    518 */
+        &&PC_519,                                          /*    519 */
+        &&PC_520,                                          /*    520 */
+        &&PC_521,                                          /*    521 */
+        &&PC_522,                                          /*    522 */
+        &&PC_523,                                          /*    523 */
+        &&PC_524,                                          /*    524 */
+        &&PC_525,                                          /*    525 */
+        &&PC_526,                                          /*    526 */
+        &&PC_527,                                          /*    527 */
+        &&PC_528,                                          /*    528 */
+        &&PC_529,                                          /*    529 */
+        &&PC_530,                                          /*    530 */
+        &&PC_531,                                          /*    531 */
+        &&PC_532,                                          /*    532 */
+        &&PC_533,                                          /*    533 */
+        &&PC_534,                                          /*    534 */
+        &&PC_535,                                          /*    535 */
+        &&PC_536,                                          /*    536 */
+        &&PC_537,                                          /*    537 */
+        &&PC_538,                                          /*    538 */
+        &&PC_539,                                          /*    539 */
+        &&PC_540,                                          /*    540 */
+        &&PC_541,                                          /*    541 */
+        &&PC_542,                                          /*    542 */
+        &&PC_543,                                          /*    543 */
+        &&PC_544,                                          /*    544 */
+        &&PC_545,                                          /*    545 */
+        &&PC_546,                                          /*    546 */
+        &&PC_547,                                          /*    547 */
+        &&PC_548,                                          /*    548 */
+        &&PC_549,                                          /*    549 */
+        &&PC_550,                                          /*    550 */
+        &&PC_551,                                          /*    551 */
+        &&PC_552,                                          /*    552 */
+        &&PC_553,                                          /*    553 */
+        &&PC_554,                                          /*    554 */
+        &&PC_555,                                          /*    555 */
+        &&PC_556,                                          /*    556 */
+        &&PC_557,                                          /*    557 */
+        &&PC_558,                                          /*    558 */
+        &&PC_559,                                          /*    559 */
+        &&PC_560,                                          /*    560 */
+        &&PC_561,                                          /*    561 */
+        &&PC_562,                                          /*    562 */
+        &&PC_563,                                          /*    563 */
+        &&PC_564,                                          /*    564 */
+        &&PC_565,                                          /*    565 */
+        &&PC_566,                                          /*    566 */
+        &&PC_567,                                          /*    567 */
+        &&PC_568,                                          /*    568 */
+        &&PC_569,                                          /*    569 */
+        &&PC_570,                                          /*    570 */
+        &&PC_571,                                          /*    571 */
+        &&PC_572,                                          /*    572 */
+        &&PC_573,                                          /*    573 */
+        &&PC_574,                                          /*    574 */
+        &&PC_575,                                          /*    575 */
+        &&PC_576,                                          /*    576 */
+        &&PC_577,                                          /*    577 */
+        &&PC_578,                                          /*    578 */
+        &&PC_579,                                          /*    579 */
+        &&PC_580,                                          /*    580 */
+        &&PC_581,                                          /*    581 */
+        &&PC_582,                                          /*    582 */
+        &&PC_583,                                          /*    583 */
+        &&PC_584,                                          /*    584 */
+        &&PC_585,                                          /*    585 */
+        &&PC_586,                                          /*    586 */
+        &&PC_587,                                          /*    587 */
+        &&PC_588,                                          /*    588 */
+        &&PC_589,                                          /*    589 */
+        &&PC_590,                                          /*    590 */
+        &&PC_591,                                          /*    591 */
+        &&PC_592,                                          /*    592 */
+        &&PC_593,                                          /*    593 */
+        &&PC_594,                                          /*    594 */
+        &&PC_595,                                          /*    595 */
+        &&PC_596,                                          /*    596 */
+        &&PC_597,                                          /*    597 */
+        &&PC_598,                                          /*    598 */
+        &&PC_599,                                          /*    599 */
+        &&PC_600,                                          /*    600 */
+        &&PC_601,                                          /*    601 */
+        &&PC_602,                                          /*    602 */
+        &&PC_603,                                          /*    603 */
+        &&PC_604,                                          /*    604 */
+        &&PC_605,                                          /*    605 */
+        &&PC_606,                                          /*    606 */
+        &&PC_607,                                          /*    607 */
+        &&PC_608,                                          /*    608 */
+        &&PC_609,                                          /*    609 */
+        &&PC_610,                                          /*    610 */
+        &&PC_611,                                          /*    611 */
+        &&PC_612,                                          /*    612 */
+        &&PC_613,                                          /*    613 */
+        &&PC_614,                                          /*    614 */
+        &&PC_615,                                          /*    615 */
+        &&PC_616,                                          /*    616 */
+        &&PC_617,                                          /*    617 */
+        &&PC_618,                                          /*    618 */
+        &&PC_619,                                          /*    619 */
+        &&PC_620,                                          /*    620 */
+        &&PC_621,                                          /*    621 */
+        &&PC_622,                                          /*    622 */
+        &&PC_623,                                          /*    623 */
+        &&PC_624,                                          /*    624 */
+        &&PC_625,                                          /*    625 */
+        &&PC_626,                                          /*    626 */
+        &&PC_627,                                          /*    627 */
+        &&PC_628,                                          /*    628 */
+        &&PC_629,                                          /*    629 */
+        &&PC_630,                                          /*    630 */
+        &&PC_631,                                          /*    631 */
+        &&PC_632,                                          /*    632 */
+        &&PC_633,                                          /*    633 */
+        &&PC_634,                                          /*    634 */
+        &&PC_635,                                          /*    635 */
+        &&PC_636,                                          /*    636 */
+        &&PC_637,                                          /*    637 */
+        &&PC_638,                                          /*    638 */
+        &&PC_639,                                          /*    639 */
+        &&PC_640,                                          /*    640 */
+        &&PC_641,                                          /*    641 */
+        &&PC_642,                                          /*    642 */
+        &&PC_643,                                          /*    643 */
+        &&PC_644,                                          /*    644 */
+        &&PC_645,                                          /*    645 */
+        &&PC_646,                                          /*    646 */
+        &&PC_647,                                          /*    647 */
+        &&PC_648,                                          /*    648 */
+        &&PC_649,                                          /*    649 */
+        &&PC_650,                                          /*    650 */
+        &&PC_651,                                          /*    651 */
+        &&PC_652,                                          /*    652 */
+        &&PC_653,                                          /*    653 */
+        &&PC_654,                                          /*    654 */
+        &&PC_655,                                          /*    655 */
+        &&PC_656,                                          /*    656 */
+        &&PC_657,                                          /*    657 */
+        &&PC_658,                                          /*    658 */
+        &&PC_659,                                          /*    659 */
+        &&PC_660,                                          /*    660 */
+        &&PC_661,                                          /*    661 */
+        &&PC_662,                                          /*    662 */
+        &&PC_663,                                          /*    663 */
+        &&PC_664,                                          /*    664 */
+        &&PC_665,                                          /*    665 */
+        &&PC_666,                                          /*    666 */
+        &&PC_667,                                          /*    667 */
+        &&PC_668,                                          /*    668 */
+        &&PC_669,                                          /*    669 */
+        &&PC_670,                                          /*    670 */
+        &&PC_671,                                          /*    671 */
+        &&PC_672,                                          /*    672 */
+        &&PC_673,                                          /*    673 */
+        &&PC_674,                                          /*    674 */
+        &&PC_675,                                          /*    675 */
+        &&PC_676,                                          /*    676 */
+        &&PC_677,                                          /*    677 */
+        &&PC_678,                                          /*    678 */
+        &&PC_679,                                          /*    679 */
+        &&PC_680,                                          /*    680 */
+        &&PC_681,                                          /*    681 */
+        &&PC_682,                                          /*    682 */
+        &&PC_683,                                          /*    683 */
+        &&PC_684,                                          /*    684 */
+        &&PC_685,                                          /*    685 */
+        &&PC_686,                                          /*    686 */
+        &&PC_687,                                          /*    687 */
+        &&PC_688,                                          /*    688 */
+        &&PC_689,                                          /*    689 */
+        &&PC_690,                                          /*    690 */
+        &&PC_691,                                          /*    691 */
+        &&PC_692,                                          /*    692 */
+        &&PC_693,                                          /*    693 */
+        &&PC_694,                                          /*    694 */
+        &&PC_695,                                          /*    695 */
+        &&PC_696,                                          /*    696 */
+        &&PC_697,                                          /*    697 */
+        &&PC_698,                                          /*    698 */
+        &&PC_699,                                          /*    699 */
+        &&PC_700,                                          /*    700 */
+        &&PC_701,                                          /*    701 */
+        &&PC_702,                                          /*    702 */
+        &&PC_703,                                          /*    703 */
+        &&PC_704,                                          /*    704 */
+        &&PC_705,                                          /*    705 */
+        &&PC_706,                                          /*    706 */
+        &&PC_707,                                          /*    707 */
+        &&PC_708,                                          /*    708 */
+        &&PC_709,                                          /*    709 */
+        &&PC_710,                                          /*    710 */
+        &&PC_711,                                          /*    711 */
+        &&PC_712,                                          /*    712 */
+        &&PC_713,                                          /*    713 */
+        &&PC_714,                                          /*    714 */
+        &&PC_715,                                          /*    715 */
+        &&PC_716,                                          /*    716 */
+        &&PC_717,                                          /*    717 */
+        &&PC_718,                                          /*    718 */
+        &&PC_719,                                          /*    719 */
+        &&PC_720,                                          /*    720 */
+        &&PC_721,                                          /*    721 */
+        &&PC_722,                                          /*    722 */
+        &&PC_723,                                          /*    723 */
+        &&PC_724,                                          /*    724 */
+        &&PC_725,                                          /*    725 */
+        &&PC_726,                                          /*    726 */
+        &&PC_727,                                          /*    727 */
+        &&PC_728,                                          /*    728 */
+        &&PC_729,                                          /*    729 */
+        &&PC_730,                                          /*    730 */
+        &&PC_731,                                          /*    731 */
+        &&PC_732,                                          /*    732 */
+        &&PC_733,                                          /*    733 */
+        &&PC_734,                                          /*    734 */
+        &&PC_735,                                          /*    735 */
+        &&PC_736,                                          /*    736 */
+        &&PC_737,                                          /*    737 */
+        &&PC_738,                                          /*    738 */
+        &&PC_739,                                          /*    739 */
+        &&PC_740,                                          /*    740 */
+        &&PC_741,                                          /*    741 */
+        &&PC_742,                                          /*    742 */
+        &&PC_743,                                          /*    743 */
+        &&PC_744,                                          /*    744 */
+        &&PC_745,                                          /*    745 */
+        &&PC_746,                                          /*    746 */
+        &&PC_747,                                          /*    747 */
+        &&PC_748,                                          /*    748 */
+        &&PC_749,                                          /*    749 */
+        &&PC_750,                                          /*    750 */
+        &&PC_751,                                          /*    751 */
+        &&PC_752,                                          /*    752 */
+        &&PC_753,                                          /*    753 */
+        &&PC_754,                                          /*    754 */
+        &&PC_755,                                          /*    755 */
+        &&PC_756,                                          /*    756 */
+        &&PC_757,                                          /*    757 */
+        &&PC_758,                                          /*    758 */
+        &&PC_759,                                          /*    759 */
+        &&PC_760,                                          /*    760 */
+        &&PC_761,                                          /*    761 */
+        &&PC_762,                                          /*    762 */
+        &&PC_763,                                          /*    763 */
+        &&PC_764,                                          /*    764 */
+        &&PC_765,                                          /*    765 */
+        &&PC_766,                                          /*    766 */
+        &&PC_767,                                          /*    767 */
+        &&PC_768,                                          /*    768 */
+        &&PC_769,                                          /*    769 */
+        &&PC_770,                                          /*    770 */
+        &&PC_771,                                          /*    771 */
+        &&PC_772,                                          /*    772 */
+        &&PC_773,                                          /*    773 */
+        &&PC_774,                                          /*    774 */
+        &&PC_775,                                          /*    775 */
+        &&PC_776,                                          /*    776 */
+        &&PC_777,                                          /*    777 */
+        &&PC_778,                                          /*    778 */
+        &&PC_779,                                          /*    779 */
+        &&PC_780,                                          /*    780 */
+        &&PC_781,                                          /*    781 */
+        &&PC_782,                                          /*    782 */
+        &&PC_783,                                          /*    783 */
+        &&PC_784,                                          /*    784 */
+        &&PC_785,                                          /*    785 */
+        &&PC_786,                                          /*    786 */
+        &&PC_787,                                          /*    787 */
+        &&PC_788,                                          /*    788 */
+        &&PC_789,                                          /*    789 */
+        &&PC_790,                                          /*    790 */
+        &&PC_791,                                          /*    791 */
+        &&PC_792,                                          /*    792 */
+        &&PC_793,                                          /*    793 */
+        &&PC_794,                                          /*    794 */
+        &&PC_795,                                          /*    795 */
+        &&PC_796,                                          /*    796 */
+        &&PC_797,                                          /*    797 */
+        &&PC_798,                                          /*    798 */
+        &&PC_799,                                          /*    799 */
+        &&PC_800,                                          /*    800 */
+        &&PC_801,                                          /*    801 */
+        &&PC_802,                                          /*    802 */
+        &&PC_803,                                          /*    803 */
+        &&PC_804,                                          /*    804 */
+        &&PC_805,                                          /*    805 */
+        &&PC_806,                                          /*    806 */
+        &&PC_807,                                          /*    807 */
+        &&PC_808,                                          /*    808 */
+        &&PC_809,                                          /*    809 */
+        &&PC_810,                                          /*    810 */
+        &&PC_811,                                          /*    811 */
+        &&PC_812,                                          /*    812 */
+        &&PC_813,                                          /*    813 */
+        &&PC_814,                                          /*    814 */
+        &&PC_815,                                          /*    815 */
+        &&PC_816,                                          /*    816 */
+        &&PC_817,                                          /*    817 */
+        &&PC_818,                                          /*    818 */
+        &&PC_819,                                          /*    819 */
+        &&PC_820,                                          /*    820 */
+        &&PC_821,                                          /*    821 */
+        &&PC_822,                                          /*    822 */
+        &&PC_823,                                          /*    823 */
+        &&PC_824,                                          /*    824 */
+        &&PC_825,                                          /*    825 */
+        &&PC_826,                                          /*    826 */
+        &&PC_827,                                          /*    827 */
+        &&PC_828,                                          /*    828 */
+        &&PC_829,                                          /*    829 */
+        &&PC_830,                                          /*    830 */
+        &&PC_831,                                          /*    831 */
+        &&PC_832,                                          /*    832 */
+        &&PC_833,                                          /*    833 */
+        &&PC_834,                                          /*    834 */
+        &&PC_835,                                          /*    835 */
+        &&PC_836,                                          /*    836 */
+        &&PC_837,                                          /*    837 */
+        &&PC_838,                                          /*    838 */
+        &&PC_839,                                          /*    839 */
+        &&PC_840,                                          /*    840 */
+        &&PC_841,                                          /*    841 */
+        &&PC_842,                                          /*    842 */
+        &&PC_843,                                          /*    843 */
+        &&PC_844,                                          /*    844 */
+        &&PC_845,                                          /*    845 */
+        &&PC_846,                                          /*    846 */
+        &&PC_847,                                          /*    847 */
+        &&PC_848,                                          /*    848 */
+        &&PC_849,                                          /*    849 */
+        &&PC_850,                                          /*    850 */
+        &&PC_851,                                          /*    851 */
+        &&PC_852,                                          /*    852 */
+        &&PC_853,                                          /*    853 */
+        &&PC_854,                                          /*    854 */
+        &&PC_855,                                          /*    855 */
+        &&PC_856,                                          /*    856 */
+        &&PC_857,                                          /*    857 */
+        &&PC_858,                                          /*    858 */
+        &&PC_859,                                          /*    859 */
+        &&PC_860,                                          /*    860 */
+        &&PC_861,                                          /*    861 */
+        &&PC_862,                                          /*    862 */
+        &&PC_863,                                          /*    863 */
+        &&PC_864,                                          /*    864 */
+        &&PC_865,                                          /*    865 */
+        &&PC_866,                                          /*    866 */
+        &&PC_867,                                          /*    867 */
+        &&PC_868,                                          /*    868 */
+        &&PC_869,                                          /*    869 */
+        &&PC_870,                                          /*    870 */
+        &&PC_871,                                          /*    871 */
+        &&PC_872,                                          /*    872 */
+        &&PC_873,                                          /*    873 */
+        &&PC_874,                                          /*    874 */
+        &&PC_875,                                          /*    875 */
+        &&PC_876,                                          /*    876 */
+        &&PC_877,                                          /*    877 */
+        &&PC_878,                                          /*    878 */
+        &&PC_879,                                          /*    879 */
+        &&PC_880,                                          /*    880 */
+        &&PC_881,                                          /*    881 */
+        &&PC_882,                                          /*    882 */
+        &&PC_883,                                          /*    883 */
+        &&PC_884,                                          /*    884 */
+        &&PC_885,                                          /*    885 */
+        &&PC_886,                                          /*    886 */
+        &&PC_887,                                          /*    887 */
+        &&PC_888,                                          /*    888 */
+        &&PC_889,                                          /*    889 */
+        &&PC_890,                                          /*    890 */
+        &&PC_891,                                          /*    891 */
+        &&PC_892,                                          /*    892 */
+        &&PC_893,                                          /*    893 */
+        &&PC_894,                                          /*    894 */
+        &&PC_895,                                          /*    895 */
+        &&PC_896,                                          /*    896 */
+        &&PC_897,                                          /*    897 */
+        &&PC_898,                                          /*    898 */
+        &&PC_899,                                          /*    899 */
+        &&PC_900,                                          /*    900 */
+        &&PC_901,                                          /*    901 */
+        &&PC_902,                                          /*    902 */
+        &&PC_903,                                          /*    903 */
+        &&PC_904,                                          /*    904 */
+        &&PC_905,                                          /*    905 */
+        &&PC_906,                                          /*    906 */
+        &&PC_907,                                          /*    907 */
+        &&PC_908,                                          /*    908 */
+        &&PC_909,                                          /*    909 */
+        &&PC_910,                                          /*    910 */
+        &&PC_911,                                          /*    911 */
+        &&PC_912,                                          /*    912 */
+        &&PC_913,                                          /*    913 */
+        &&PC_914,                                          /*    914 */
+        &&PC_915,                                          /*    915 */
+        &&PC_916,                                          /*    916 */
+        &&PC_917,                                          /*    917 */
+        &&PC_918,                                          /*    918 */
+        &&PC_919,                                          /*    919 */
+        &&PC_920,                                          /*    920 */
+        &&PC_921,                                          /*    921 */
+        &&PC_922,                                          /*    922 */
+        &&PC_923,                                          /*    923 */
+        &&PC_924,                                          /*    924 */
+        &&PC_925,                                          /*    925 */
+        &&PC_926,                                          /*    926 */
+        &&PC_927,                                          /*    927 */
+        &&PC_928,                                          /*    928 */
+        &&PC_929,                                          /*    929 */
+        &&PC_930,                                          /*    930 */
+        &&PC_931,                                          /*    931 */
+        &&PC_932,                                          /*    932 */
+        &&PC_933,                                          /*    933 */
+        &&PC_934,                                          /*    934 */
+        &&PC_935,                                          /*    935 */
+        &&PC_936,                                          /*    936 */
+        &&PC_937,                                          /*    937 */
+        &&PC_938,                                          /*    938 */
+        &&PC_939,                                          /*    939 */
+        &&PC_940,                                          /*    940 */
+        &&PC_941,                                          /*    941 */
+        &&PC_942,                                          /*    942 */
+        &&PC_943,                                          /*    943 */
+        &&PC_944,                                          /*    944 */
+        &&PC_945,                                          /*    945 */
+        &&PC_946,                                          /*    946 */
+        &&PC_947,                                          /*    947 */
+        &&PC_948,                                          /*    948 */
+        &&PC_949,                                          /*    949 */
+        &&PC_950,                                          /*    950 */
+        &&PC_951,                                          /*    951 */
+        &&PC_952,                                          /*    952 */
+        &&PC_953,                                          /*    953 */
+        &&PC_954,                                          /*    954 */
+        &&PC_955,                                          /*    955 */
+        &&PC_956,                                          /*    956 */
+        &&PC_957,                                          /*    957 */
+        &&PC_958,                                          /*    958 */
+        &&PC_959,                                          /*    959 */
+        &&PC_960,                                          /*    960 */
+        &&PC_961,                                          /*    961 */
+        &&PC_962,                                          /*    962 */
+        &&PC_963,                                          /*    963 */
+        &&PC_964,                                          /*    964 */
+        &&PC_965,                                          /*    965 */
+        &&PC_966,                                          /*    966 */
+        &&PC_967,                                          /*    967 */
+        &&PC_968,                                          /*    968 */
+        &&PC_969,                                          /*    969 */
+        &&PC_970,                                          /*    970 */
+        &&PC_971,                                          /*    971 */
+        &&PC_972,                                          /*    972 */
+        &&PC_973,                                          /*    973 */
+        &&PC_974,                                          /*    974 */
+        &&PC_975,                                          /*    975 */
+        &&PC_976,                                          /*    976 */
+        &&PC_977,                                          /*    977 */
+        &&PC_978,                                          /*    978 */
+        &&PC_979,                                          /*    979 */
+        &&PC_980,                                          /*    980 */
+        &&PC_981,                                          /*    981 */
+        &&PC_982,                                          /*    982 */
+        &&PC_983,                                          /*    983 */
+        &&PC_984,                                          /*    984 */
+        &&PC_985,                                          /*    985 */
+        &&PC_986,                                          /*    986 */
+        &&PC_987,                                          /*    987 */
+        &&PC_988,                                          /*    988 */
+        &&PC_989,                                          /*    989 */
+        &&PC_990,                                          /*    990 */
+        &&PC_991,                                          /*    991 */
+        &&PC_992,                                          /*    992 */
+        &&PC_993,                                          /*    993 */
+        &&PC_994,                                          /*    994 */
+        &&PC_995,                                          /*    995 */
+        &&PC_996,                                          /*    996 */
+        &&PC_997,                                          /*    997 */
+        &&PC_998,                                          /*    998 */
+        &&PC_999,                                          /*    999 */
+        &&PC_1000,                                         /*   1000 */
+        &&PC_1001,                                         /*   1001 */
+        &&PC_1002,                                         /*   1002 */
+        &&PC_1003,                                         /*   1003 */
+        &&PC_1004,                                         /*   1004 */
+        &&PC_1005,                                         /*   1005 */
+        &&PC_1006,                                         /*   1006 */
+        &&PC_1007,                                         /*   1007 */
+        &&PC_1008,                                         /*   1008 */
+        &&PC_1009,                                         /*   1009 */
+        &&PC_1010,                                         /*   1010 */
+        &&PC_1011,                                         /*   1011 */
+        &&PC_1012,                                         /*   1012 */
+        &&PC_1013,                                         /*   1013 */
+        &&PC_1014,                                         /*   1014 */
+        &&PC_1015,                                         /*   1015 */
+        &&PC_1016,                                         /*   1016 */
+        &&PC_1017,                                         /*   1017 */
+        &&PC_1018,                                         /*   1018 */
+        &&PC_1019,                                         /*   1019 */
+        &&PC_1020,                                         /*   1020 */
+        &&PC_1021,                                         /*   1021 */
+        &&PC_1022,                                         /*   1022 */
+        &&PC_1023,                                         /*   1023 */
+        &&PC_1024,                                         /*   1024 */
+        &&PC_1025,                                         /*   1025 */
+        &&PC_1026,                                         /*   1026 */
+        &&PC_1027,                                         /*   1027 */
+        &&PC_1028,                                         /*   1028 */
+        &&PC_1029,                                         /*   1029 */
+        &&PC_1030,                                         /*   1030 */
+        &&PC_1031,                                         /*   1031 */
+        &&PC_1032,                                         /*   1032 */
+        &&PC_1033,                                         /*   1033 */
+        &&PC_1034,                                         /*   1034 */
+        &&PC_1035,                                         /*   1035 */
+        &&PC_1036,                                         /*   1036 */
+        &&PC_1037,                                         /*   1037 */
+        &&PC_1038,                                         /*   1038 */
+        &&PC_1039,                                         /*   1039 */
+        &&PC_1040,                                         /*   1040 */
+        &&PC_1041,                                         /*   1041 */
+        &&PC_1042,                                         /*   1042 */
+        &&PC_1043,                                         /*   1043 */
+        &&PC_1044,                                         /*   1044 */
+        &&PC_1045,                                         /*   1045 */
+        &&PC_1046,                                         /*   1046 */
+        &&PC_1047,                                         /*   1047 */
+        &&PC_1048,                                         /*   1048 */
+        &&PC_1049,                                         /*   1049 */
+        &&PC_1050,                                         /*   1050 */
+        &&PC_1051,                                         /*   1051 */
+        &&PC_1052,                                         /*   1052 */
+        &&PC_1053,                                         /*   1053 */
+        &&PC_1054,                                         /*   1054 */
+        &&PC_1055,                                         /*   1055 */
+        &&PC_1056,                                         /*   1056 */
+        &&PC_1057,                                         /*   1057 */
+        &&PC_1058,                                         /*   1058 */
+        &&PC_1059,                                         /*   1059 */
+        &&PC_1060,                                         /*   1060 */
+        &&PC_1061,                                         /*   1061 */
+        &&PC_1062,                                         /*   1062 */
+        &&PC_1063,                                         /*   1063 */
+        &&PC_1064,                                         /*   1064 */
+        &&PC_1065,                                         /*   1065 */
+        &&PC_1066,                                         /*   1066 */
+        &&PC_1067,                                         /*   1067 */
+        &&PC_1068,                                         /*   1068 */
+        &&PC_1069,                                         /*   1069 */
+        &&PC_1070,                                         /*   1070 */
+        &&PC_1071,                                         /*   1071 */
+        &&PC_1072,                                         /*   1072 */
+    };
+
+    PackFile_ByteCode *cg_seg = interp->code;
+
+    goto cg_branch;
+
+    /* Ops outside the core oplib, and every op while event checking is
+     * enabled, run through the op function table of the code segment. */
+  cg_function_op:
+    cur_opcode = (interp->code->op_func_table)[*cur_opcode](cur_opcode, interp);
+
+  cg_branch:
+    if (!cur_opcode)
+        return NULL;
+    if (interp->code->save_func_table)
+        goto cg_function_op;
+
+    cg_seg = interp->code;
+
+    /* map the op numbers of new ops in this segment to their labels */
+    if (cg_seg->op_addr_count < cg_seg->op_count) {
+        const op_lib_t * const core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+        size_t i;
+
+        cg_seg->op_addr_table = cg_seg->op_addr_table
+            ? mem_gc_realloc_n_typed_zeroed(interp, cg_seg->op_addr_table,
+                    cg_seg->op_count, cg_seg->op_addr_count, void *)
+            : mem_gc_allocate_n_zeroed_typed(interp, cg_seg->op_count, void *);
+
+        for (i = cg_seg->op_addr_count; i < cg_seg->op_count; i++) {
+            const op_info_t * const info = cg_seg->op_info_table[i];
+            const size_t            op   = info ? (size_t)(info - core_lib->op_info_table) : 0;
+
+            cg_seg->op_addr_table[i] = info && info->lib == core_lib && op < CG_OP_COUNT
+                ? cg_ops_addr[op]
+                : &&cg_function_op;
+        }
+
+        cg_seg->op_addr_count = cg_seg->op_count;
+    }
+
+    goto *cg_seg->op_addr_table[*cur_opcode];
+
+PC_0: { /* end */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);CG_BRANCH(0);
+}
+
+PC_1: { /* noop */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+
+CG_NEXT(1);}
+
+PC_2: { /* check_events */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const next = cur_opcode + 1;
+    Parrot_cx_check_tasks(interp, interp->scheduler);CG_BRANCH(next);   /* force this being a branch op */
+}
+
+PC_3: { /* check_events__ */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const _this = CUR_OPCODE;
+    /* Restore op_func_table. */
+    disable_event_checking(interp);
+    Parrot_cx_handle_tasks(interp, interp->scheduler);CG_BRANCH(_this);   /* force this being a branch op */
+}
+
+PC_4: { /* wrapper__ */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *pc = CUR_OPCODE;
+    DO_OP(pc, interp);CG_BRANCH(pc);
+}
+
+PC_5: { /* load_bytecode_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_bytecode(interp, SREG(1));
+
+CG_NEXT(2);}
+
+PC_6: { /* load_bytecode_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_bytecode(interp, SCONST(1));
+
+CG_NEXT(2);}
+
+PC_7: { /* load_language_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_language(interp, SREG(1));
+
+CG_NEXT(2);}
+
+PC_8: { /* load_language_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_load_language(interp, SCONST(1));
+
+CG_NEXT(2);}
+
+PC_9: { /* branch_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);CG_BRANCH(cur_opcode + IREG(1));
+}
+
+PC_10: { /* branch_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);CG_BRANCH(cur_opcode + ICONST(1));
+}
+
+PC_11: { /* local_branch_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t * const dest = cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_branch'");CG_BRANCH(handler);
+    }
+
+    return_addr = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), return_addr);CG_BRANCH(cur_opcode + IREG(2));
+}
+
+PC_12: { /* local_branch_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t * const dest = cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_branch'");CG_BRANCH(handler);
+    }
+
+    return_addr = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), return_addr);CG_BRANCH(cur_opcode + ICONST(2));
+}
+
+PC_13: { /* local_return_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL return_addr;
+    opcode_t *next;
+    opcode_t * const dest = cur_opcode + 2;
+
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Must pass a valid integer array to 'local_return'");CG_BRANCH(handler);
+    }
+
+    return_addr = VTABLE_pop_integer(interp, PREG(1));
+    next = INTVAL2PTR(opcode_t *, return_addr);
+
+    /* The return address must be within the current code segment. */
+    if (! (next >= interp->code->base.data
+           && next < (interp->code->base.data + interp->code->base.size))) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+            EXCEPTION_INVALID_OPERATION,
+            "Address for 'local_return' must be within the current code segment");CG_BRANCH(handler);
+    }CG_BRANCH(next);
+}
+
+PC_14: { /* jump_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const loc = INTVAL2PTR(opcode_t *, IREG(1));CG_BRANCH(loc);
+}
+
+PC_15: { /* jump_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const loc = INTVAL2PTR(opcode_t *, ICONST(1));CG_BRANCH(loc);
+}
+
+PC_16: { /* enternative */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const addr = run_native(interp, CUR_OPCODE,
+            interp->code->base.data);CG_BRANCH(addr);
+}
+
+PC_17: { /* if_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0)CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_18: { /* if_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!FLOAT_IS_ZERO(NREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_19: { /* if_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (Parrot_str_boolean(interp, SREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_20: { /* if_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_bool(interp, PREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_21: { /* unless_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == 0)CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_22: { /* unless_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (FLOAT_IS_ZERO(NREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_23: { /* unless_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!Parrot_str_boolean(interp, SREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_24: { /* unless_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!VTABLE_get_bool(interp, PREG(1)))CG_BRANCH(cur_opcode + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_25: { /* invokecc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const p     = PREG(1);
+    opcode_t *dest         = cur_opcode + 2;
+    PMC      * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, NULL);
+    interp->current_cont   = NEED_CONTINUATION;
+    dest                   = VTABLE_invoke(interp, p, dest);CG_BRANCH(dest);
+}
+
+PC_26: { /* invoke_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t   *dest       = cur_opcode + 3;
+    PMC * const p          = PREG(1);
+    PMC * const signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, NULL);
+    interp->current_cont   = PREG(2);
+
+    dest = VTABLE_invoke(interp, p, dest);CG_BRANCH(dest);
+}
+
+PC_27: { /* yield */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t   *dest = cur_opcode + 1;
+    PMC * const p    = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+
+    VTABLE_increment(interp, p);
+    dest = VTABLE_invoke(interp, p, dest);CG_BRANCH(dest);
+}
+
+PC_28: { /* tailcall_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const p               = PREG(1);
+    opcode_t   *dest            = cur_opcode + 2;
+    PMC * const ctx             = CURRENT_CONTEXT(interp);
+    PMC * const parent_ctx      = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC * const this_call_sig   = Parrot_pcc_get_signature(interp, ctx);
+    PMC * const parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
+    interp->current_cont        = Parrot_pcc_get_continuation(interp, ctx);
+
+    Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
+
+    SUB_FLAG_TAILCALL_SET(interp->current_cont);
+    dest = VTABLE_invoke(interp, p, dest);CG_BRANCH(dest);
+}
+
+PC_29: { /* returncc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const p = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    opcode_t * const dest = VTABLE_invoke(interp, p, cur_opcode + 1);CG_BRANCH(dest);
+}
+
+PC_30: { /* capture_lex_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_sub_capture_lex(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_31: { /* newclosure_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_sub_new_closure(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_32: { /* set_args_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_args = CUR_OPCODE;
+    PMC * const signature = PCONST(1);
+    PMC *       call_sig  = Parrot_pcc_build_direct_call_from_op(interp,
+            signature, raw_args);
+    const INTVAL argc = VTABLE_elements(interp, signature);
+
+    if (PMC_IS_NULL(call_sig))
+        call_sig = Parrot_pcc_build_sig_object_from_op(interp,
+                PMCNULL, signature, raw_args);
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);CG_BRANCH(cur_opcode + argc + 2);
+}
+
+PC_33: { /* get_params_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_params  = CUR_OPCODE;
+    PMC      * const signature   = PCONST(1);
+    PMC      * const ctx         = CURRENT_CONTEXT(interp);
+    PMC      * const ccont       = Parrot_pcc_get_continuation(interp, ctx);
+    PMC      * const caller_ctx  = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC      * const call_object = Parrot_pcc_get_signature(interp, caller_ctx);
+    INTVAL argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
+            PARROT_ERRORS_PARAM_COUNT_FLAG);
+
+    /* TODO Factor out with Sub.invoke */
+    if (PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
+        PObj_get_FLAGS(ccont) &= ~SUB_FLAG_TAILCALL;
+        Parrot_pcc_dec_recursion_depth(interp, ctx);
+        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    }
+    argc = VTABLE_elements(interp, signature);CG_BRANCH(cur_opcode + argc + 2);
+}
+
+PC_34: { /* set_returns_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_args  = CUR_OPCODE;
+    PMC      * const signature = PCONST(1);
+    PMC      * const call_sig  = Parrot_pcc_build_sig_object_from_op(interp,
+                Parrot_pcc_get_signature(interp,
+                Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp))),
+                    signature, raw_args);
+    INTVAL argc;
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+
+    argc = VTABLE_elements(interp, signature);CG_BRANCH(cur_opcode + argc + 2);
+}
+
+PC_35: { /* get_results_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const raw_params  = CUR_OPCODE;
+    PMC      * const signature   = PCONST(1);
+    PMC             *ctx         = CURRENT_CONTEXT(interp);
+    PMC             *ccont       = Parrot_pcc_get_continuation(interp, ctx);
+    PMC             *call_object = Parrot_pcc_get_signature(interp, ctx);
+
+    INTVAL argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params,
+            PARROT_ERRORS_RESULT_COUNT_FLAG);
+
+    argc = VTABLE_elements(interp, signature);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);CG_BRANCH(cur_opcode + argc + 2);
+}
+
+PC_36: { /* set_result_info_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx,
+            Parrot_str_new_constant(interp, "return_flags"),
+            PREG(1));
+
+CG_NEXT(2);}
+
+PC_37: { /* set_result_info_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx,
+            Parrot_str_new_constant(interp, "return_flags"),
+            PCONST(1));
+
+CG_NEXT(2);}
+
+PC_38: { /* result_info_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const caller_ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC * const sig        = VTABLE_get_attr_str(interp, caller_ctx,
+            Parrot_str_new_constant(interp, "return_flags"));
+
+    /* If no elements, hand back empty array; otherwise PMC. */
+    if (!sig)
+        PREG(1) = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    else
+        PREG(1) = sig;
+
+CG_NEXT(2);}
+
+PC_39: { /* set_addr_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PTR2INTVAL(CUR_OPCODE + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_40: { /* set_addr_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
+
+CG_NEXT(3);}
+
+PC_41: { /* set_addr_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pointer(interp, PREG(1), (void*)IREG(2));
+
+CG_NEXT(3);}
+
+PC_42: { /* get_addr_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *ptr = VTABLE_get_pointer(interp, PREG(2));
+    IREG(1)        = (INTVAL)ptr;
+
+CG_NEXT(3);}
+
+PC_43: { /* schedule_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_schedule_task(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_44: { /* addhandler_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_add_handler(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_45: { /* push_eh_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+    VTABLE_set_pointer(interp, eh, CUR_OPCODE + ICONST(1));
+    Parrot_cx_add_handler_local(interp, eh);
+
+CG_NEXT(2);}
+
+PC_46: { /* push_eh_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_add_handler_local(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_47: { /* pop_eh */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_cx_delete_handler_local(interp,
+            Parrot_str_new_constant(interp, "exception"));
+
+CG_NEXT(1);}
+
+PC_48: { /* throw_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * except = PREG(1);
+    opcode_t *dest;
+    opcode_t * const ret    = cur_opcode + 2;
+    PMC      * const resume = pmc_new(interp, enum_class_Continuation);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+
+    VTABLE_set_attr_str(interp, except, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, except, ret);CG_BRANCH(dest);
+}
+
+PC_49: { /* throw_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * dest;
+    PMC * except = PREG(1);
+    if (PMC_IS_NULL(except) || except->vtable->base_type != enum_class_Exception)
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+    dest = Parrot_ex_throw_from_op(interp, PREG(1),
+                                VTABLE_get_pointer(interp, PREG(2)));CG_BRANCH(dest);
+}
+
+PC_50: { /* rethrow_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * dest;
+    if (PMC_IS_NULL(PREG(1)) || PREG(1)->vtable->base_type != enum_class_Exception) {
+        opcode_t * const ret    = cur_opcode + 2;
+        PMC      * const except = Parrot_ex_build_exception(interp, EXCEPT_fatal,
+                EXCEPTION_UNIMPLEMENTED,
+                Parrot_str_new_constant(interp, "Not a throwable object"));
+        dest = Parrot_ex_throw_from_op(interp, except, ret);CG_BRANCH(dest);
+    }
+    dest = Parrot_ex_rethrow_from_op(interp, PREG(1));CG_BRANCH(dest);
+}
+
+PC_51: { /* count_eh_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_cx_count_handlers_local(interp,
+            Parrot_str_new_constant(interp, "exception"));
+
+CG_NEXT(2);}
+
+PC_52: { /* die_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
+                                    CONTROL_ERROR, SREG(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_53: { /* die_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_error,
+                                    CONTROL_ERROR, SCONST(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_54: { /* die_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    STRING   * const msg       = PMC_IS_NULL(PREG(1)) ? NULL : VTABLE_get_string(interp, PREG(1));
+    PMC      * const exception =
+        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_55: { /* die_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    STRING   * const msg       = PMC_IS_NULL(PCONST(1)) ? NULL : VTABLE_get_string(interp, PCONST(1));
+    PMC      * const exception =
+        Parrot_ex_build_exception(interp, EXCEPT_error, CONTROL_ERROR, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_56: { /* die_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == EXCEPT_doomed)
+        _exit(IREG(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), IREG(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+    }
+}
+
+PC_57: { /* die_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == EXCEPT_doomed)
+        _exit(IREG(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), IREG(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+    }
+}
+
+PC_58: { /* die_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == EXCEPT_doomed)
+        _exit(ICONST(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, IREG(1), ICONST(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+    }
+}
+
+PC_59: { /* die_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == EXCEPT_doomed)
+        _exit(ICONST(2));
+    else {
+        opcode_t * const ret       = cur_opcode + 3;
+        PMC      * const exception = Parrot_ex_build_exception(interp, ICONST(1), ICONST(2), NULL);
+        opcode_t * const dest      = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+    }
+}
+
+PC_60: { /* exit_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
+                                                           CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception,
+        Parrot_str_new_constant(interp, "exit_code"), IREG(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_61: { /* exit_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const ret       = cur_opcode + 2;
+    PMC      * const resume    = pmc_new(interp, enum_class_Continuation);
+    PMC      * const exception = Parrot_ex_build_exception(interp, EXCEPT_exit,
+                                                           CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+
+    VTABLE_set_attr_str(interp, exception,
+                        Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception,
+        Parrot_str_new_constant(interp, "exit_code"), ICONST(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);CG_BRANCH(dest);
+}
+
+PC_62: { /* debug_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Interp_debug_SET(interp,   IREG(1)); }
+    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_63: { /* debug_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Interp_debug_SET(interp,   ICONST(1)); }
+    else         { Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_64: { /* bounds_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_65: { /* bounds_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_BOUNDS_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_66: { /* profile_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_67: { /* profile_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_flag(interp,   PARROT_PROFILE_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_68: { /* trace_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Parrot_set_trace(interp,   IREG(1)); }
+    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_69: { /* trace_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Parrot_set_trace(interp,   ICONST(1)); }
+    else         { Parrot_clear_trace(interp, PARROT_ALL_TRACE_FLAGS); }interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;CG_BRANCH(0);
+}
+
+PC_70: { /* gc_debug_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+
+CG_NEXT(2);}
+
+PC_71: { /* gc_debug_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != 0) { Interp_flags_SET(interp,   PARROT_GC_DEBUG_FLAG); }
+    else         { Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG); }
+
+CG_NEXT(2);}
+
+PC_72: { /* interpinfo_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = interpinfo(interp, IREG(2));
+
+CG_NEXT(3);}
+
+PC_73: { /* interpinfo_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = interpinfo(interp, ICONST(2));
+
+CG_NEXT(3);}
+
+PC_74: { /* interpinfo_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = interpinfo_p(interp, IREG(2));
+
+CG_NEXT(3);}
+
+PC_75: { /* interpinfo_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = interpinfo_p(interp, ICONST(2));
+
+CG_NEXT(3);}
+
+PC_76: { /* interpinfo_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = interpinfo_s(interp, IREG(2));
+    SREG(1) = s;
+
+CG_NEXT(3);}
+
+PC_77: { /* interpinfo_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = interpinfo_s(interp, ICONST(2));
+    SREG(1) = s;
+
+CG_NEXT(3);}
+
+PC_78: { /* warningson_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_on(interp, IREG(1));
+
+CG_NEXT(2);}
+
+PC_79: { /* warningson_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_on(interp, ICONST(1));
+
+CG_NEXT(2);}
+
+PC_80: { /* warningsoff_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_off(interp, IREG(1));
+
+CG_NEXT(2);}
+
+PC_81: { /* warningsoff_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_WARNINGS_off(interp, ICONST(1));
+
+CG_NEXT(2);}
+
+PC_82: { /* errorson_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_on(interp, IREG(1));
+
+CG_NEXT(2);}
+
+PC_83: { /* errorson_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_on(interp, ICONST(1));
+
+CG_NEXT(2);}
+
+PC_84: { /* errorsoff_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_off(interp, IREG(1));
+
+CG_NEXT(2);}
+
+PC_85: { /* errorsoff_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PARROT_ERRORS_off(interp, ICONST(1));
+
+CG_NEXT(2);}
+
+PC_86: { /* runinterp_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, REL_PC + IREG(2));
+
+CG_NEXT(3);}
+
+PC_87: { /* runinterp_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Interp * const new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, REL_PC + ICONST(2));
+
+CG_NEXT(3);}
+
+PC_88: { /* getinterp_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+           IGLOBALS_INTERPRETER);
+
+CG_NEXT(2);}
+
+PC_89: { /* sweep_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1))
+        Parrot_gc_mark_and_sweep(interp, GC_trace_normal_FLAG);
+    else
+        if (Parrot_gc_impatient_pmcs(interp))
+            Parrot_gc_mark_and_sweep(interp, GC_lazy_FLAG);
+
+CG_NEXT(2);}
+
+PC_90: { /* collect */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_gc_compact_memory_pool(interp);
+
+CG_NEXT(1);}
+
+PC_91: { /* sweepoff */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_block_GC_mark(interp);
+
+CG_NEXT(1);}
+
+PC_92: { /* sweepon */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_unblock_GC_mark(interp);
+
+CG_NEXT(1);}
+
+PC_93: { /* collectoff */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_block_GC_sweep(interp);
+
+CG_NEXT(1);}
+
+PC_94: { /* collecton */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_unblock_GC_sweep(interp);
+
+CG_NEXT(1);}
+
+PC_95: { /* needs_destroy_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_gc_pmc_needs_early_collection(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_96: { /* loadlib_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), NULL);
+
+CG_NEXT(3);}
+
+PC_97: { /* loadlib_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), NULL);
+
+CG_NEXT(3);}
+
+PC_98: { /* loadlib_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_99: { /* loadlib_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_100: { /* loadlib_p_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_101: { /* loadlib_p_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_102: { /* dlfunc_p_p_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+CG_NEXT(5);}
+
+PC_103: { /* dlfunc_p_p_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+CG_NEXT(5);}
+
+PC_104: { /* dlfunc_p_p_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+CG_NEXT(5);}
+
+PC_105: { /* dlfunc_p_p_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void         *dl_handle = NULL;
+    void         *ptr       = NULL;
+    funcptr_t     p;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+
+    if (p == NULLfunc) {
+        const char * err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+CG_NEXT(5);}
+
+PC_106: { /* dlvar_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *        dl_handle = NULL;
+    void *        p         = NULL;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+
+    if (p == NULL) {
+        const char * const err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        /* At this point we have the symbol's address. We just need to build
+           a PMC with it so we can get and set the value */
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+CG_NEXT(4);}
+
+PC_107: { /* dlvar_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void *        dl_handle = NULL;
+    void *        p         = NULL;
+
+    if (!PMC_IS_NULL(PREG(2))
+    && PREG(2)->vtable->base_type == enum_class_ParrotLibrary
+    && VTABLE_defined(interp, PREG(2))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+
+    if (p == NULL) {
+        const char * const err = Parrot_dlerror();
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG,
+                "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        /* At this point we have the symbol's address. We just need to build
+           a PMC with it so we can get and set the value */
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+CG_NEXT(4);}
+
+PC_108: { /* compreg_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_109: { /* compreg_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    VTABLE_set_pmc_keyed_str(interp, compreg_hash, SCONST(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_110: { /* compreg_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SREG(2));
+
+CG_NEXT(3);}
+
+PC_111: { /* compreg_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const compreg_hash = VTABLE_get_pmc_keyed_int(interp,
+            interp->iglobals, IGLOBALS_COMPREG_HASH);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, compreg_hash, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_112: { /* new_callback_p_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SREG(4));
+
+CG_NEXT(5);}
+
+PC_113: { /* new_callback_p_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SCONST(4));
+
+CG_NEXT(5);}
+
+PC_114: { /* annotations_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 2) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, NULL);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Hash);
+    }
+
+CG_NEXT(2);}
+
+PC_115: { /* annotations_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, SREG(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+CG_NEXT(3);}
+
+PC_116: { /* annotations_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (interp->code->annotations) {
+        const opcode_t cur_pos = ( cur_opcode + 3) - interp->code->base.data;
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations,
+                cur_pos, SCONST(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+CG_NEXT(3);}
+
+PC_117: { /* band_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) &= IREG(2);
+
+CG_NEXT(3);}
+
+PC_118: { /* band_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) &= ICONST(2);
+
+CG_NEXT(3);}
+
+PC_119: { /* band_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) & IREG(3);
+
+CG_NEXT(4);}
+
+PC_120: { /* band_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) & IREG(3);
+
+CG_NEXT(4);}
+
+PC_121: { /* band_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) & ICONST(3);
+
+CG_NEXT(4);}
+
+PC_122: { /* bor_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) |= IREG(2);
+
+CG_NEXT(3);}
+
+PC_123: { /* bor_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) |= ICONST(2);
+
+CG_NEXT(3);}
+
+PC_124: { /* bor_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) | IREG(3);
+
+CG_NEXT(4);}
+
+PC_125: { /* bor_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) | IREG(3);
+
+CG_NEXT(4);}
+
+PC_126: { /* bor_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) | ICONST(3);
+
+CG_NEXT(4);}
+
+PC_127: { /* shl_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_128: { /* shl_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_129: { /* shl_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_130: { /* shl_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(ICONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_131: { /* shl_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = bit_shift_left(IREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_132: { /* shr_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(2);
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+
+CG_NEXT(3);}
+
+PC_133: { /* shr_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -ICONST(2);
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+
+CG_NEXT(3);}
+
+PC_134: { /* shr_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(3);
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+
+CG_NEXT(4);}
+
+PC_135: { /* shr_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -IREG(3);
+    IREG(1) = bit_shift_left(ICONST(2), signed_shift);
+
+CG_NEXT(4);}
+
+PC_136: { /* shr_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL signed_shift = -ICONST(3);
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+
+CG_NEXT(4);}
+
+PC_137: { /* lsr_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const UINTVAL a = (UINTVAL)IREG(1);
+    const UINTVAL b = a >> IREG(2);
+    IREG(1) = (INTVAL)b;
+
+CG_NEXT(3);}
+
+PC_138: { /* lsr_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const UINTVAL a = (UINTVAL)IREG(1);
+    const UINTVAL b = a >> ICONST(2);
+    IREG(1) = (INTVAL)b;
+
+CG_NEXT(3);}
+
+PC_139: { /* lsr_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> IREG(3));
+
+CG_NEXT(4);}
+
+PC_140: { /* lsr_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)ICONST(2) >> IREG(3));
+
+CG_NEXT(4);}
+
+PC_141: { /* lsr_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)((UINTVAL)IREG(2) >> ICONST(3));
+
+CG_NEXT(4);}
+
+PC_142: { /* bxor_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) ^= IREG(2);
+
+CG_NEXT(3);}
+
+PC_143: { /* bxor_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) ^= ICONST(2);
+
+CG_NEXT(3);}
+
+PC_144: { /* bxor_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ^ IREG(3);
+
+CG_NEXT(4);}
+
+PC_145: { /* bxor_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) ^ IREG(3);
+
+CG_NEXT(4);}
+
+PC_146: { /* bxor_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ^ ICONST(3);
+
+CG_NEXT(4);}
+
+PC_147: { /* eq_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_148: { /* eq_ic_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) == IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_149: { /* eq_i_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) == ICONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_150: { /* eq_n_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) == NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_151: { /* eq_nc_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) == NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_152: { /* eq_n_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) == NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_153: { /* eq_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SREG(1), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_154: { /* eq_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SCONST(1), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_155: { /* eq_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, SREG(1), SCONST(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_156: { /* eq_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_157: { /* eq_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_158: { /* eq_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_159: { /* eq_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /*
+     * the get_number and get_string should probably
+     * be also replaced with code like above, as
+     * overriding the compare multi subs wouldn't
+     * have any effect with the current code
+     */
+    if (VTABLE_get_number(interp, PREG(1)) == NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_160: { /* eq_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /*
+     * the get_number and get_string should probably
+     * be also replaced with code like above, as
+     * overriding the compare multi subs wouldn't
+     * have any effect with the current code
+     */
+    if (VTABLE_get_number(interp, PREG(1)) == NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_161: { /* eq_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_162: { /* eq_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_163: { /* eq_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_164: { /* eq_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_165: { /* eq_addr_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) == SREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_166: { /* eq_addr_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) == SREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_167: { /* eq_addr_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) == SCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_168: { /* eq_addr_sc_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) == SCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_169: { /* eq_addr_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1) == PREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_170: { /* ne_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_171: { /* ne_ic_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) != IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_172: { /* ne_i_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) != ICONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_173: { /* ne_n_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) != NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_174: { /* ne_nc_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) != NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_175: { /* ne_n_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) != NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_176: { /* ne_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SREG(1), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_177: { /* ne_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SCONST(1), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_178: { /* ne_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, SREG(1), SCONST(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_179: { /* ne_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!VTABLE_is_equal(interp, PREG(1), PREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_180: { /* ne_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_181: { /* ne_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (!VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_182: { /* ne_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) != NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_183: { /* ne_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) != NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_184: { /* ne_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_185: { /* ne_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_186: { /* ne_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_187: { /* ne_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_188: { /* ne_addr_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) != SREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_189: { /* ne_addr_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) != SREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_190: { /* ne_addr_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(1) != SCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_191: { /* ne_addr_sc_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(1) != SCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_192: { /* ne_addr_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1) != PREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_193: { /* lt_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) < IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_194: { /* lt_ic_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) < IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_195: { /* lt_i_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) < ICONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_196: { /* lt_n_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) < NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_197: { /* lt_nc_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) < NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_198: { /* lt_n_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) < NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_199: { /* lt_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_200: { /* lt_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SCONST(1), SREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_201: { /* lt_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SCONST(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_202: { /* lt_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_203: { /* lt_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_204: { /* lt_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_205: { /* lt_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) < NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_206: { /* lt_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) < NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_207: { /* lt_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_208: { /* lt_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_209: { /* lt_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_210: { /* lt_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_211: { /* le_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) <= IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_212: { /* le_ic_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(1) <= IREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_213: { /* le_i_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(1) <= ICONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_214: { /* le_n_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) <= NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_215: { /* le_nc_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NCONST(1) <= NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_216: { /* le_n_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (NREG(1) <= NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_217: { /* le_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_218: { /* le_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SCONST(1), SREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_219: { /* le_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, SREG(1), SCONST(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_220: { /* le_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_221: { /* le_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_222: { /* le_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_223: { /* le_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) <= NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_224: { /* le_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) <= NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_225: { /* le_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_226: { /* le_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_227: { /* le_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_228: { /* le_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_229: { /* gt_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) > 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_230: { /* gt_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_231: { /* gt_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_232: { /* gt_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) > NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_233: { /* gt_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) > NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_234: { /* gt_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_235: { /* gt_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_236: { /* gt_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_237: { /* gt_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_238: { /* ge_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_239: { /* ge_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_240: { /* ge_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+
+    if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
+        Parrot_pmc_free_temporary(interp, temp);CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+
+CG_NEXT(4);}
+
+PC_241: { /* ge_p_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) >= NREG(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_242: { /* ge_p_nc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_number(interp, PREG(1)) >= NCONST(2)) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_243: { /* ge_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_244: { /* ge_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_245: { /* ge_str_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_246: { /* ge_num_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0) {CG_BRANCH(cur_opcode + ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_247: { /* if_null_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PMC_IS_NULL(PREG(1))) {CG_BRANCH(cur_opcode + ICONST(2));
+    }
+
+CG_NEXT(3);}
+
+PC_248: { /* if_null_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (STRING_IS_NULL(SREG(1))) {CG_BRANCH(cur_opcode + ICONST(2));
+    }
+
+CG_NEXT(3);}
+
+PC_249: { /* unless_null_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!PMC_IS_NULL(PREG(1))) {CG_BRANCH(cur_opcode + ICONST(2));
+    }
+
+CG_NEXT(3);}
+
+PC_250: { /* unless_null_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!STRING_IS_NULL(SREG(1))) {CG_BRANCH(cur_opcode + ICONST(2));
+    }
+
+CG_NEXT(3);}
+
+PC_251: { /* cmp_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) < IREG(3) ? -1 :
+         IREG(2) > IREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_252: { /* cmp_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) < IREG(3) ? -1 :
+         ICONST(2) > IREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_253: { /* cmp_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) < ICONST(3) ? -1 :
+         IREG(2) > ICONST(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_254: { /* cmp_i_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) < NREG(3) ? -1 :
+         NREG(2) > NREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_255: { /* cmp_i_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NCONST(2) < NREG(3) ? -1 :
+         NCONST(2) > NREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_256: { /* cmp_i_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) < NCONST(3) ? -1 :
+         NREG(2) > NCONST(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_257: { /* cmp_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_258: { /* cmp_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_259: { /* cmp_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_260: { /* cmp_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_cmp(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_261: { /* cmp_i_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
+    IREG(1) = l < IREG(3) ? -1 :
+         l > IREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_262: { /* cmp_i_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL l = VTABLE_get_integer(interp, PREG(2));
+    IREG(1) = l < ICONST(3) ? -1 :
+         l > ICONST(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_263: { /* cmp_i_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
+    IREG(1) = l < NREG(3) ? -1 :
+         l > NREG(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_264: { /* cmp_i_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const FLOATVAL l = VTABLE_get_number(interp, PREG(2));
+    IREG(1) = l < NCONST(3) ? -1 :
+         l > NCONST(3) ? +1 :
+         0;
+
+CG_NEXT(4);}
+
+PC_265: { /* cmp_i_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING* const l = VTABLE_get_string(interp, PREG(2));
+    IREG(1) = STRING_compare(interp, l, SREG(3));
+
+CG_NEXT(4);}
+
+PC_266: { /* cmp_i_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING* const l = VTABLE_get_string(interp, PREG(2));
+    IREG(1) = STRING_compare(interp, l, SCONST(3));
+
+CG_NEXT(4);}
+
+PC_267: { /* cmp_str_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_cmp_string(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_268: { /* cmp_num_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_cmp_num(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_269: { /* cmp_pmc_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_cmp_pmc(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_270: { /* issame_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(2) == PREG(3))
+        IREG(1) = 1;
+    else
+        IREG(1) = VTABLE_is_same(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_271: { /* issame_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(2) == SREG(3);
+
+CG_NEXT(4);}
+
+PC_272: { /* issame_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(2) == SREG(3);
+
+CG_NEXT(4);}
+
+PC_273: { /* issame_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(2) == SCONST(3);
+
+CG_NEXT(4);}
+
+PC_274: { /* issame_i_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(2) == SCONST(3);
+
+CG_NEXT(4);}
+
+PC_275: { /* isntsame_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(2) == PREG(3))
+        IREG(1) = 0;
+    else
+        IREG(1) = !VTABLE_is_same(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_276: { /* isntsame_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(2) != SREG(3);
+
+CG_NEXT(4);}
+
+PC_277: { /* isntsame_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(2) != SREG(3);
+
+CG_NEXT(4);}
+
+PC_278: { /* isntsame_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(2) != SCONST(3);
+
+CG_NEXT(4);}
+
+PC_279: { /* isntsame_i_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(2) != SCONST(3);
+
+CG_NEXT(4);}
+
+PC_280: { /* istrue_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_bool(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_281: { /* isfalse_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = !VTABLE_get_bool(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_282: { /* isnull_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2));
+
+CG_NEXT(3);}
+
+PC_283: { /* isnull_i_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PCONST(2));
+
+CG_NEXT(3);}
+
+PC_284: { /* isnull_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_IS_NULL(SREG(2));
+
+CG_NEXT(3);}
+
+PC_285: { /* isnull_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_IS_NULL(SCONST(2));
+
+CG_NEXT(3);}
+
+PC_286: { /* isgt_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) > 0);
+
+CG_NEXT(4);}
+
+PC_287: { /* isge_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) >= 0);
+
+CG_NEXT(4);}
+
+PC_288: { /* isle_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) <= IREG(3);
+
+CG_NEXT(4);}
+
+PC_289: { /* isle_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) <= IREG(3);
+
+CG_NEXT(4);}
+
+PC_290: { /* isle_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) <= ICONST(3);
+
+CG_NEXT(4);}
+
+PC_291: { /* isle_i_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) <= NREG(3);
+
+CG_NEXT(4);}
+
+PC_292: { /* isle_i_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NCONST(2) <= NREG(3);
+
+CG_NEXT(4);}
+
+PC_293: { /* isle_i_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) <= NCONST(3);
+
+CG_NEXT(4);}
+
+PC_294: { /* isle_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) <= 0;
+
+CG_NEXT(4);}
+
+PC_295: { /* isle_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) <= 0;
+
+CG_NEXT(4);}
+
+PC_296: { /* isle_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) <= 0;
+
+CG_NEXT(4);}
+
+PC_297: { /* isle_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) <= 0);
+
+CG_NEXT(4);}
+
+PC_298: { /* islt_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) < IREG(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_299: { /* islt_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (ICONST(2) < IREG(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_300: { /* islt_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) < ICONST(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_301: { /* islt_i_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) < NREG(3);
+
+CG_NEXT(4);}
+
+PC_302: { /* islt_i_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NCONST(2) < NREG(3);
+
+CG_NEXT(4);}
+
+PC_303: { /* islt_i_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) < NCONST(3);
+
+CG_NEXT(4);}
+
+PC_304: { /* islt_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3)) < 0;
+
+CG_NEXT(4);}
+
+PC_305: { /* islt_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3)) < 0;
+
+CG_NEXT(4);}
+
+PC_306: { /* islt_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3)) < 0;
+
+CG_NEXT(4);}
+
+PC_307: { /* islt_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (VTABLE_cmp(interp, PREG(2), PREG(3)) < 0);
+
+CG_NEXT(4);}
+
+PC_308: { /* iseq_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) == IREG(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_309: { /* iseq_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (ICONST(2) == IREG(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_310: { /* iseq_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) == ICONST(3)) ? 1 : 0;
+
+CG_NEXT(4);}
+
+PC_311: { /* iseq_i_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) == NREG(3);
+
+CG_NEXT(4);}
+
+PC_312: { /* iseq_i_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NCONST(2) == NREG(3);
+
+CG_NEXT(4);}
+
+PC_313: { /* iseq_i_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) == NCONST(3);
+
+CG_NEXT(4);}
+
+PC_314: { /* iseq_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_equal(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_315: { /* iseq_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_equal(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_316: { /* iseq_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_equal(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_317: { /* iseq_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (&PREG(2) == &PREG(3))
+        IREG(1) = 1;
+    else
+        IREG(1) = VTABLE_is_equal(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_318: { /* isne_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) == IREG(3)) ? 0 : 1;
+
+CG_NEXT(4);}
+
+PC_319: { /* isne_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (ICONST(2) == IREG(3)) ? 0 : 1;
+
+CG_NEXT(4);}
+
+PC_320: { /* isne_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) == ICONST(3)) ? 0 : 1;
+
+CG_NEXT(4);}
+
+PC_321: { /* isne_i_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) != NREG(3);
+
+CG_NEXT(4);}
+
+PC_322: { /* isne_i_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NCONST(2) != NREG(3);
+
+CG_NEXT(4);}
+
+PC_323: { /* isne_i_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = NREG(2) != NCONST(3);
+
+CG_NEXT(4);}
+
+PC_324: { /* isne_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = !STRING_equal(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_325: { /* isne_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = !STRING_equal(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_326: { /* isne_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = !STRING_equal(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_327: { /* isne_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (&PREG(2) == &PREG(3))
+        IREG(1) = 0;
+    else
+        IREG(1) = !VTABLE_is_equal(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_328: { /* and_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
+
+CG_NEXT(4);}
+
+PC_329: { /* and_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
+
+CG_NEXT(4);}
+
+PC_330: { /* and_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
+
+CG_NEXT(4);}
+
+PC_331: { /* and_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(3) : PREG(2);
+
+CG_NEXT(4);}
+
+PC_332: { /* not_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ! IREG(1);
+
+CG_NEXT(2);}
+
+PC_333: { /* not_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ! IREG(2);
+
+CG_NEXT(3);}
+
+PC_334: { /* not_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_bool(interp, PREG(1), !VTABLE_get_bool(interp, PREG(1)));
+
+CG_NEXT(2);}
+
+PC_335: { /* not_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL a = ! VTABLE_get_bool(interp, PREG(2));
+    if (PMC_IS_NULL(PREG(1)))
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean));
+    VTABLE_set_bool(interp, PREG(1), a);
+
+CG_NEXT(3);}
+
+PC_336: { /* or_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
+
+CG_NEXT(4);}
+
+PC_337: { /* or_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
+
+CG_NEXT(4);}
+
+PC_338: { /* or_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
+
+CG_NEXT(4);}
+
+PC_339: { /* or_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(2) : PREG(3);
+
+CG_NEXT(4);}
+
+PC_340: { /* xor_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) && ! IREG(3)) ? IREG(2) : (IREG(3) && ! IREG(2)) ? IREG(3) : 0;
+
+CG_NEXT(4);}
+
+PC_341: { /* xor_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (ICONST(2) && ! IREG(3)) ? ICONST(2) : (IREG(3) && ! ICONST(2)) ? IREG(3) : 0;
+
+CG_NEXT(4);}
+
+PC_342: { /* xor_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (IREG(2) && ! ICONST(3)) ? IREG(2) : (ICONST(3) && ! IREG(2)) ? ICONST(3) : 0;
+
+CG_NEXT(4);}
+
+PC_343: { /* xor_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL a = VTABLE_get_bool(interp, PREG(2));
+    const INTVAL b = VTABLE_get_bool(interp, PREG(3));
+    if (a && ! b)
+        PREG(1) = PREG(2);
+    else
+        if (b && ! a)
+            PREG(1) = PREG(3) ;
+        else{
+            PREG(1) = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
+            VTABLE_set_bool(interp, PREG(1), 0);
+        }
+
+CG_NEXT(4);}
+
+PC_344: { /* print_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)IREG(1));
+
+CG_NEXT(2);}
+
+PC_345: { /* print_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)ICONST(1));
+
+CG_NEXT(2);}
+
+PC_346: { /* print_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NREG(1))) {
+        Parrot_io_printf(interp, "-0");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+    }
+#endif
+
+CG_NEXT(2);}
+
+PC_347: { /* print_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NCONST(1))) {
+        Parrot_io_printf(interp, "-0");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+    }
+#endif
+
+CG_NEXT(2);}
+
+PC_348: { /* print_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = SREG(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+
+CG_NEXT(2);}
+
+PC_349: { /* print_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = SCONST(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+
+CG_NEXT(2);}
+
+PC_350: { /* print_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const p = PREG(1);
+    STRING * const s = (VTABLE_get_string(interp, p));
+    if (s)
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+
+CG_NEXT(2);}
+
+PC_351: { /* say_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)IREG(1));
+
+CG_NEXT(2);}
+
+PC_352: { /* say_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)ICONST(1));
+
+CG_NEXT(2);}
+
+PC_353: { /* say_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NREG(1))) {
+        Parrot_io_printf(interp, "-0\n");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+    }
+#endif
+
+CG_NEXT(2);}
+
+PC_354: { /* say_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#ifdef PARROT_HAS_NEGATIVE_ZERO
+    Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+#else
+    /* Workaround for older msvcrt and openbsd. TT #313 */
+    if (Parrot_is_nzero(NCONST(1))) {
+        Parrot_io_printf(interp, "-0\n");
+    }
+    else {
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+    }
+#endif
+
+CG_NEXT(2);}
+
+PC_355: { /* say_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = SREG(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+
+CG_NEXT(2);}
+
+PC_356: { /* say_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = SCONST(1);
+    if (s && Parrot_str_byte_length(interp, s))
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+
+CG_NEXT(2);}
+
+PC_357: { /* say_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const p = PREG(1);
+
+    if (PMC_IS_NULL(p)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 2,
+             EXCEPTION_UNEXPECTED_NULL,
+            "Null PMC in say");CG_BRANCH(handler);
+    }
+    else {
+        STRING * const s = VTABLE_get_string(interp, p);
+        if (s)
+            Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    }
+
+CG_NEXT(2);}
+
+PC_358: { /* print_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1)) {
+        STRING * const s = Parrot_str_from_int(interp, IREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+CG_NEXT(3);}
+
+PC_359: { /* print_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1)) {
+        STRING * const s = Parrot_str_from_int(interp, ICONST(2));
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+CG_NEXT(3);}
+
+PC_360: { /* print_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1)) {
+        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+CG_NEXT(3);}
+
+PC_361: { /* print_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(1)) {
+        STRING * const s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NCONST(2));
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+CG_NEXT(3);}
+
+PC_362: { /* print_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(2) && PREG(1)) {
+        Parrot_io_putps(interp, PREG(1), SREG(2));
+    }
+
+CG_NEXT(3);}
+
+PC_363: { /* print_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(2) && PREG(1)) {
+        Parrot_io_putps(interp, PREG(1), SCONST(2));
+    }
+
+CG_NEXT(3);}
+
+PC_364: { /* print_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PREG(2) && PREG(1)) {
+        STRING * const s = VTABLE_get_string(interp, PREG(2));
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+CG_NEXT(3);}
+
+PC_365: { /* getstdin_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = _PIO_STDIN(interp);
+
+CG_NEXT(2);}
+
+PC_366: { /* getstdout_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = _PIO_STDOUT(interp);
+
+CG_NEXT(2);}
+
+PC_367: { /* getstderr_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = _PIO_STDERR(interp);
+
+CG_NEXT(2);}
+
+PC_368: { /* abs_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = abs(IREG(1));
+
+CG_NEXT(2);}
+
+PC_369: { /* abs_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = fabs(NREG(1));
+
+CG_NEXT(2);}
+
+PC_370: { /* abs_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = abs(IREG(2));
+
+CG_NEXT(3);}
+
+PC_371: { /* abs_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = fabs(NREG(2));
+
+CG_NEXT(3);}
+
+PC_372: { /* abs_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_absolute(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_373: { /* abs_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_absolute(interp, PREG(2), PREG(1));
+
+CG_NEXT(3);}
+
+PC_374: { /* add_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) += IREG(2);
+
+CG_NEXT(3);}
+
+PC_375: { /* add_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) += ICONST(2);
+
+CG_NEXT(3);}
+
+PC_376: { /* add_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) += NREG(2);
+
+CG_NEXT(3);}
+
+PC_377: { /* add_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) += NCONST(2);
+
+CG_NEXT(3);}
+
+PC_378: { /* add_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_379: { /* add_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_add_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_380: { /* add_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_add_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_381: { /* add_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_add_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_382: { /* add_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_add_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_383: { /* add_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) + IREG(3);
+
+CG_NEXT(4);}
+
+PC_384: { /* add_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) + IREG(3);
+
+CG_NEXT(4);}
+
+PC_385: { /* add_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) + ICONST(3);
+
+CG_NEXT(4);}
+
+PC_386: { /* add_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) + NREG(3);
+
+CG_NEXT(4);}
+
+PC_387: { /* add_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NCONST(2) + NREG(3);
+
+CG_NEXT(4);}
+
+PC_388: { /* add_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) + NCONST(3);
+
+CG_NEXT(4);}
+
+PC_389: { /* add_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_390: { /* add_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_391: { /* add_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_392: { /* add_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_393: { /* add_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_394: { /* dec_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1)--;
+
+CG_NEXT(2);}
+
+PC_395: { /* dec_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1)--;
+
+CG_NEXT(2);}
+
+PC_396: { /* dec_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_decrement(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_397: { /* div_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = IREG(2);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) /= den;
+
+CG_NEXT(3);}
+
+PC_398: { /* div_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = ICONST(2);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) /= den;
+
+CG_NEXT(3);}
+
+PC_399: { /* div_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) /= den;
+
+CG_NEXT(3);}
+
+PC_400: { /* div_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NCONST(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) /= den;
+
+CG_NEXT(3);}
+
+PC_401: { /* div_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_divide(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_402: { /* div_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_divide_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_403: { /* div_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_divide_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_404: { /* div_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_divide_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_405: { /* div_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_divide_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_406: { /* div_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = IREG(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) = IREG(2) / den;
+
+CG_NEXT(4);}
+
+PC_407: { /* div_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = IREG(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) = ICONST(2) / den;
+
+CG_NEXT(4);}
+
+PC_408: { /* div_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = ICONST(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) = IREG(2) / den;
+
+CG_NEXT(4);}
+
+PC_409: { /* div_i_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL den = ICONST(3);
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    IREG(1) = ICONST(2) / den;
+
+CG_NEXT(4);}
+
+PC_410: { /* div_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = NREG(2) / den;
+
+CG_NEXT(4);}
+
+PC_411: { /* div_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = NCONST(2) / den;
+
+CG_NEXT(4);}
+
+PC_412: { /* div_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = NREG(2) / den;
+
+CG_NEXT(4);}
+
+PC_413: { /* div_n_nc_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = NCONST(2) / den;
+
+CG_NEXT(4);}
+
+PC_414: { /* div_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_divide(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_415: { /* div_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_416: { /* div_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_417: { /* div_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_418: { /* div_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_419: { /* fdiv_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL   den = IREG(2);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+
+    f  = floor(((FLOATVAL)IREG(1)) / den);
+    IREG(1) = (INTVAL)f;
+
+CG_NEXT(3);}
+
+PC_420: { /* fdiv_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL   den = ICONST(2);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+
+    f  = floor(((FLOATVAL)IREG(1)) / den);
+    IREG(1) = (INTVAL)f;
+
+CG_NEXT(3);}
+
+PC_421: { /* fdiv_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = floor(NREG(1) / den);
+
+CG_NEXT(3);}
+
+PC_422: { /* fdiv_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NCONST(2);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = floor(NREG(1) / den);
+
+CG_NEXT(3);}
+
+PC_423: { /* fdiv_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_floor_divide(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_424: { /* fdiv_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_floor_divide_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_425: { /* fdiv_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_floor_divide_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_426: { /* fdiv_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_floor_divide_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_427: { /* fdiv_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_floor_divide_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_428: { /* fdiv_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL   den = IREG(3);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+
+    f  = floor((FLOATVAL)IREG(2) / den);
+    IREG(1) = (INTVAL)f;
+
+CG_NEXT(4);}
+
+PC_429: { /* fdiv_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL   den = IREG(3);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+
+    f  = floor((FLOATVAL)ICONST(2) / den);
+    IREG(1) = (INTVAL)f;
+
+CG_NEXT(4);}
+
+PC_430: { /* fdiv_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    INTVAL   den = ICONST(3);
+    FLOATVAL f;
+
+    if (den == 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+
+    f  = floor((FLOATVAL)IREG(2) / den);
+    IREG(1) = (INTVAL)f;
+
+CG_NEXT(4);}
+
+PC_431: { /* fdiv_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = floor(NREG(2) / den);
+
+CG_NEXT(4);}
+
+PC_432: { /* fdiv_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NREG(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = floor(NCONST(2) / den);
+
+CG_NEXT(4);}
+
+PC_433: { /* fdiv_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL den = NCONST(3);
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_DIV_BY_ZERO,
+            "Divide by zero");CG_BRANCH(handler);
+    }
+    NREG(1) = floor(NREG(2) / den);
+
+CG_NEXT(4);}
+
+PC_434: { /* fdiv_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_floor_divide(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_435: { /* fdiv_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_436: { /* fdiv_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_437: { /* fdiv_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_438: { /* fdiv_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_439: { /* ceil_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = ceil(NREG(1));
+
+CG_NEXT(2);}
+
+PC_440: { /* ceil_i_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL f = ceil(NREG(2));
+    IREG(1)         = (INTVAL)f;
+
+CG_NEXT(3);}
+
+PC_441: { /* ceil_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = ceil(NREG(2));
+
+CG_NEXT(3);}
+
+PC_442: { /* floor_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = floor(NREG(1));
+
+CG_NEXT(2);}
+
+PC_443: { /* floor_i_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    FLOATVAL f = floor(NREG(2));
+    IREG(1)         = (INTVAL)f;
+
+CG_NEXT(3);}
+
+PC_444: { /* floor_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = floor(NREG(2));
+
+CG_NEXT(3);}
+
+PC_445: { /* inc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1)++;
+
+CG_NEXT(2);}
+
+PC_446: { /* inc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1)++;
+
+CG_NEXT(2);}
+
+PC_447: { /* inc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_increment(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_448: { /* mod_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(IREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_449: { /* mod_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(IREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_450: { /* mod_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_451: { /* mod_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_452: { /* mod_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_453: { /* mod_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_454: { /* mod_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_455: { /* mod_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_456: { /* mod_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_modulus_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_457: { /* mod_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_458: { /* mod_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(ICONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_459: { /* mod_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_util_intval_mod(IREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_460: { /* mod_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_461: { /* mod_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_util_floatval_mod(NCONST(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_462: { /* mod_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NCONST(3));
+
+CG_NEXT(4);}
+
+PC_463: { /* mod_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_464: { /* mod_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_465: { /* mod_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_466: { /* mod_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_467: { /* mod_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_468: { /* mul_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) *= IREG(2);
+
+CG_NEXT(3);}
+
+PC_469: { /* mul_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) *= ICONST(2);
+
+CG_NEXT(3);}
+
+PC_470: { /* mul_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) *= NREG(2);
+
+CG_NEXT(3);}
+
+PC_471: { /* mul_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) *= NCONST(2);
+
+CG_NEXT(3);}
+
+PC_472: { /* mul_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_multiply(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_473: { /* mul_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_multiply_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_474: { /* mul_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_multiply_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_475: { /* mul_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_multiply_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_476: { /* mul_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_multiply_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_477: { /* mul_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) * IREG(3);
+
+CG_NEXT(4);}
+
+PC_478: { /* mul_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) * IREG(3);
+
+CG_NEXT(4);}
+
+PC_479: { /* mul_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) * ICONST(3);
+
+CG_NEXT(4);}
+
+PC_480: { /* mul_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) * NREG(3);
+
+CG_NEXT(4);}
+
+PC_481: { /* mul_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NCONST(2) * NREG(3);
+
+CG_NEXT(4);}
+
+PC_482: { /* mul_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) * NCONST(3);
+
+CG_NEXT(4);}
+
+PC_483: { /* mul_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_484: { /* mul_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_485: { /* mul_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_486: { /* mul_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_487: { /* mul_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_488: { /* neg_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = - IREG(1);
+
+CG_NEXT(2);}
+
+PC_489: { /* neg_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = - NREG(1);
+
+CG_NEXT(2);}
+
+PC_490: { /* neg_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_neg(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_491: { /* neg_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = - IREG(2);
+
+CG_NEXT(3);}
+
+PC_492: { /* neg_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = - NREG(2);
+
+CG_NEXT(3);}
+
+PC_493: { /* neg_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_neg(interp, PREG(2), PREG(1));
+
+CG_NEXT(3);}
+
+PC_494: { /* sub_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) -= IREG(2);
+
+CG_NEXT(3);}
+
+PC_495: { /* sub_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) -= ICONST(2);
+
+CG_NEXT(3);}
+
+PC_496: { /* sub_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) -= NREG(2);
+
+CG_NEXT(3);}
+
+PC_497: { /* sub_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) -= NCONST(2);
+
+CG_NEXT(3);}
+
+PC_498: { /* sub_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_subtract(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_499: { /* sub_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_subtract_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_500: { /* sub_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_subtract_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_501: { /* sub_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_subtract_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_502: { /* sub_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_subtract_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_503: { /* sub_i_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) - IREG(3);
+
+CG_NEXT(4);}
+
+PC_504: { /* sub_i_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2) - IREG(3);
+
+CG_NEXT(4);}
+
+PC_505: { /* sub_i_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2) - ICONST(3);
+
+CG_NEXT(4);}
+
+PC_506: { /* sub_n_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) - NREG(3);
+
+CG_NEXT(4);}
+
+PC_507: { /* sub_n_nc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NCONST(2) - NREG(3);
+
+CG_NEXT(4);}
+
+PC_508: { /* sub_n_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2) - NCONST(3);
+
+CG_NEXT(4);}
+
+PC_509: { /* sub_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_510: { /* sub_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_511: { /* sub_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_512: { /* sub_p_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_513: { /* sub_p_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_514: { /* sqrt_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = sqrt((FLOATVAL)NREG(2));
+
+CG_NEXT(3);}
+
+PC_515: { /* callmethodcc_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    opcode_t * const next       = cur_opcode + 3;
+
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(method_pmc)) {
+        PMC * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+
+        interp->current_cont = NEED_CONTINUATION;
+        dest                 = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC * const _class = VTABLE_get_class(interp, object);
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for invocant of class '%Ss'", meth,
+                VTABLE_get_string(interp, _class));
+        }
+    }CG_BRANCH(dest);
+}
+
+PC_516: { /* callmethodcc_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    opcode_t * const next       = cur_opcode + 3;
+
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(method_pmc)) {
+        PMC * const signature = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+
+        interp->current_cont = NEED_CONTINUATION;
+        dest                 = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC * const _class = VTABLE_get_class(interp, object);
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next,
+                EXCEPTION_METHOD_NOT_FOUND,
+                "Method '%Ss' not found for invocant of class '%Ss'", meth,
+                VTABLE_get_string(interp, _class));
+        }
+    }CG_BRANCH(dest);
+}
+
+PC_517: { /* callmethodcc_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t        *dest;
+    opcode_t * const next  = cur_opcode + 3;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, PREG(1));
+    interp->current_cont   = NEED_CONTINUATION;
+    dest                   = VTABLE_invoke(interp, PREG(2), next);CG_BRANCH(dest);
+}
+
+PC_518: { /* callmethod_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    opcode_t * const next       = cur_opcode + 4;
+
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }CG_BRANCH(dest);
+}
+
+PC_519: { /* callmethod_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    opcode_t * const next       = cur_opcode + 4;
+
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+    opcode_t *dest              = NULL;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }CG_BRANCH(dest);
+}
+
+PC_520: { /* callmethod_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const object     = PREG(1);
+    PMC      * const method_pmc = PREG(2);
+    opcode_t * const next       = cur_opcode + 4;
+
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), next);
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, object);
+    interp->current_cont = PREG(3);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);CG_BRANCH(dest);
+}
+
+PC_521: { /* tailcallmethod_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SREG(2);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }CG_BRANCH(dest);
+}
+
+PC_522: { /* tailcallmethod_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    STRING   * const meth       = SCONST(2);
+    PMC      * const method_pmc = Parrot_find_method_at_site(interp,
+                                    object, meth, CUR_OPCODE);
+
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", meth,
+            VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+        if (!PMC_IS_NULL(signature))
+            Parrot_pcc_set_object(interp, signature, object);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }CG_BRANCH(dest);
+}
+
+PC_523: { /* tailcallmethod_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const next       = cur_opcode + 3;
+    PMC      * const object     = PREG(1);
+    PMC      * const method_pmc = PREG(2);
+
+    opcode_t *dest;
+    PMC      *       signature  = Parrot_pcc_get_signature(interp,
+                                    CURRENT_CONTEXT(interp));
+
+    interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL;
+
+    if (!PMC_IS_NULL(signature))
+        Parrot_pcc_set_object(interp, signature, object);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);CG_BRANCH(dest);
+}
+
+PC_524: { /* addmethod_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_method(interp, PREG(1), SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_525: { /* addmethod_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_method(interp, PREG(1), SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_526: { /* can_i_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_can(interp, PREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_527: { /* can_i_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_can(interp, PREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_528: { /* does_i_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(3) ? VTABLE_does(interp, PREG(2), SREG(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_529: { /* does_i_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(3) ? VTABLE_does(interp, PREG(2), SCONST(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_530: { /* does_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PREG(3) ? VTABLE_does_pmc(interp, PREG(2), PREG(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_531: { /* does_i_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PCONST(3) ? VTABLE_does_pmc(interp, PREG(2), PCONST(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_532: { /* isa_i_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SREG(3) ? VTABLE_isa(interp, PREG(2), SREG(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_533: { /* isa_i_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = SCONST(3) ? VTABLE_isa(interp, PREG(2), SCONST(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_534: { /* isa_i_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PREG(3) ? VTABLE_isa_pmc(interp, PREG(2), PREG(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_535: { /* isa_i_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PCONST(3) ? VTABLE_isa_pmc(interp, PREG(2), PCONST(3)) : 0;
+
+CG_NEXT(4);}
+
+PC_536: { /* newclass_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, name, SREG(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+
+CG_NEXT(3);}
+
+PC_537: { /* newclass_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name = Parrot_pmc_new(interp, enum_class_String);
+    VTABLE_set_string_native(interp, name, SCONST(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+
+CG_NEXT(3);}
+
+PC_538: { /* newclass_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(2));
+
+CG_NEXT(3);}
+
+PC_539: { /* newclass_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(2));
+
+CG_NEXT(3);}
+
+PC_540: { /* subclass_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_541: { /* subclass_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_542: { /* subclass_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_543: { /* subclass_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_544: { /* subclass_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_545: { /* subclass_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t * handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_546: { /* subclass_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_547: { /* subclass_p_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_548: { /* subclass_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_549: { /* subclass_p_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));CG_BRANCH(handler);
+    }
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_550: { /* subclass_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_551: { /* subclass_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_552: { /* subclass_p_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_553: { /* subclass_p_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_554: { /* subclass_p_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_555: { /* subclass_p_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1)  = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_556: { /* subclass_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_557: { /* subclass_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_558: { /* subclass_p_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_559: { /* subclass_p_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC      * const parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t * const next         = cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' doesn't exist", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);CG_BRANCH(next);
+}
+
+PC_560: { /* get_class_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_class_str(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_561: { /* get_class_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_class_str(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_562: { /* get_class_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_class(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_563: { /* get_class_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_class(interp, PCONST(2));
+
+CG_NEXT(3);}
+
+PC_564: { /* class_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_565: { /* addparent_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_parent(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_566: { /* removeparent_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_remove_parent(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_567: { /* addrole_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_role(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_568: { /* addattribute_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_attribute(interp, PREG(1), SREG(2), PMCNULL);
+
+CG_NEXT(3);}
+
+PC_569: { /* addattribute_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_add_attribute(interp, PREG(1), SCONST(2), PMCNULL);
+
+CG_NEXT(3);}
+
+PC_570: { /* removeattribute_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_remove_attribute(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_571: { /* removeattribute_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_remove_attribute(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_572: { /* getattribute_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_attribute_at_site(interp, PREG(2), SREG(3), CUR_OPCODE);
+
+CG_NEXT(4);}
+
+PC_573: { /* getattribute_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_oo_get_attribute_at_site(interp, PREG(2), SCONST(3), CUR_OPCODE);
+
+CG_NEXT(4);}
+
+PC_574: { /* getattribute_p_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SREG(4));
+
+CG_NEXT(5);}
+
+PC_575: { /* getattribute_p_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SREG(4));
+
+CG_NEXT(5);}
+
+PC_576: { /* getattribute_p_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SCONST(4));
+
+CG_NEXT(5);}
+
+PC_577: { /* getattribute_p_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SCONST(4));
+
+CG_NEXT(5);}
+
+PC_578: { /* setattribute_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_oo_set_attribute_at_site(interp, PREG(1), SREG(2), PREG(3), CUR_OPCODE);
+
+CG_NEXT(4);}
+
+PC_579: { /* setattribute_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_oo_set_attribute_at_site(interp, PREG(1), SCONST(2), PREG(3), CUR_OPCODE);
+
+CG_NEXT(4);}
+
+PC_580: { /* setattribute_p_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SREG(3), PREG(4));
+
+CG_NEXT(5);}
+
+PC_581: { /* setattribute_p_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SREG(3), PREG(4));
+
+CG_NEXT(5);}
+
+PC_582: { /* setattribute_p_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SCONST(3), PREG(4));
+
+CG_NEXT(5);}
+
+PC_583: { /* setattribute_p_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SCONST(3), PREG(4));
+
+CG_NEXT(5);}
+
+PC_584: { /* inspect_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_585: { /* inspect_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect(interp, PCONST(2));
+
+CG_NEXT(3);}
+
+PC_586: { /* inspect_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_587: { /* inspect_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_588: { /* inspect_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_589: { /* inspect_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_590: { /* new_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+CG_NEXT(3);}
+
+PC_591: { /* new_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+CG_NEXT(3);}
+
+PC_592: { /* new_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_593: { /* new_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_594: { /* new_p_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_595: { /* new_p_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_596: { /* new_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+CG_NEXT(3);}
+
+PC_597: { /* new_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+CG_NEXT(3);}
+
+PC_598: { /* new_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_599: { /* new_p_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_600: { /* new_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PREG(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_601: { /* new_p_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const name_key = PCONST(2);
+    PMC * const _class   = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class))
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    else {
+        const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+        if (type <= 0) {
+            opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_602: { /* root_new_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(3);}
+
+PC_603: { /* root_new_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(3);}
+
+PC_604: { /* root_new_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_605: { /* root_new_p_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_606: { /* root_new_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PREG(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_607: { /* root_new_p_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const key      = PCONST(2);
+    PMC * const root_ns  = interp->root_namespace;
+    PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC * classobj       = PMCNULL;
+
+    if (!PMC_IS_NULL(ns))
+        classobj = Parrot_oo_get_class(interp, ns);
+    if (!PMC_IS_NULL(classobj))
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    else {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_608: { /* typeof_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_name(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_609: { /* typeof_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_610: { /* get_repr_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_611: { /* find_method_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const resume = cur_opcode + 4;
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SREG(3), CUR_OPCODE);
+    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
+            EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", SREG(3),
+            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));CG_BRANCH(dest);
+    }CG_BRANCH(resume);
+}
+
+PC_612: { /* find_method_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t * const resume = cur_opcode + 4;
+    PREG(1) = Parrot_find_method_at_site(interp, PREG(2), SCONST(3), CUR_OPCODE);
+    if (PMC_IS_NULL(PREG(1)) || !VTABLE_defined(interp, PREG(1))) {
+        opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, resume,
+            EXCEPTION_METHOD_NOT_FOUND,
+            "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3),
+            VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));CG_BRANCH(dest);
+    }CG_BRANCH(resume);
+}
+
+PC_613: { /* defined_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_614: { /* defined_i_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_615: { /* defined_i_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_616: { /* defined_i_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_617: { /* defined_i_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_618: { /* exists_i_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_619: { /* exists_i_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_620: { /* exists_i_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_621: { /* exists_i_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0: VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_622: { /* delete_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_623: { /* delete_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+
+CG_NEXT(3);}
+
+PC_624: { /* delete_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_625: { /* delete_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_626: { /* elements_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_elements(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_627: { /* push_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_integer(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_628: { /* push_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_629: { /* push_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_630: { /* push_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_631: { /* push_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_string(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_632: { /* push_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_string(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_633: { /* push_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_634: { /* pop_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_635: { /* pop_n_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_636: { /* pop_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_pop_string(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_637: { /* pop_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_638: { /* unshift_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_639: { /* unshift_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_640: { /* unshift_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_641: { /* unshift_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_642: { /* unshift_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_string(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_643: { /* unshift_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_644: { /* unshift_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_645: { /* shift_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_646: { /* shift_n_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_647: { /* shift_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_shift_string(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_648: { /* shift_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_649: { /* splice_p_p_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_650: { /* splice_p_p_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_651: { /* splice_p_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_652: { /* splice_p_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_653: { /* setprop_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_setprop(interp, PREG(1), SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_654: { /* setprop_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_setprop(interp, PREG(1), SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_655: { /* getprop_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SREG(2));
+
+CG_NEXT(4);}
+
+PC_656: { /* getprop_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_getprop(interp, PREG(3), SCONST(2));
+
+CG_NEXT(4);}
+
+PC_657: { /* delprop_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delprop(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_658: { /* delprop_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_delprop(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_659: { /* prophash_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_getprops(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_660: { /* freeze_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_freeze(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_661: { /* thaw_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_thaw(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_662: { /* thaw_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_663: { /* add_multi_s_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_664: { /* add_multi_sc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_665: { /* add_multi_s_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_666: { /* add_multi_sc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_667: { /* find_multi_p_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_668: { /* find_multi_p_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_669: { /* find_multi_p_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_670: { /* find_multi_p_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_671: { /* register_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_pmc_gc_register(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_672: { /* unregister_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_pmc_gc_unregister(interp, PREG(1));
+
+CG_NEXT(2);}
+
+PC_673: { /* box_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_674: { /* box_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_675: { /* box_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_676: { /* box_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Float));
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_677: { /* box_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_String));
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_678: { /* box_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_String));
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_679: { /* iter_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_iter(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_680: { /* morph_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_morph(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_681: { /* morph_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_morph(interp, PREG(1), PCONST(2));
+
+CG_NEXT(3);}
+
+PC_682: { /* clone_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /* cloning a NULL STRING produces an empty STRING; TT #964 */
+    SREG(1) = STRING_IS_NULL(SREG(2))
+       ? Parrot_str_new(interp, NULL, 0)
+       : SREG(2);
+
+CG_NEXT(3);}
+
+PC_683: { /* clone_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /* cloning a NULL STRING produces an empty STRING; TT #964 */
+    SREG(1) = STRING_IS_NULL(SCONST(2))
+       ? Parrot_str_new(interp, NULL, 0)
+       : SCONST(2);
+
+CG_NEXT(3);}
+
+PC_684: { /* set_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = IREG(2);
+
+CG_NEXT(3);}
+
+PC_685: { /* set_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = ICONST(2);
+
+CG_NEXT(3);}
+
+PC_686: { /* set_i_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)(NREG(2));
+
+CG_NEXT(3);}
+
+PC_687: { /* set_i_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (INTVAL)(NCONST(2));
+
+CG_NEXT(3);}
+
+PC_688: { /* set_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_to_int(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_689: { /* set_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_690: { /* set_n_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NREG(2);
+
+CG_NEXT(3);}
+
+PC_691: { /* set_n_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = NCONST(2);
+
+CG_NEXT(3);}
+
+PC_692: { /* set_n_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = (FLOATVAL)IREG(2);
+
+CG_NEXT(3);}
+
+PC_693: { /* set_n_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = (FLOATVAL)ICONST(2);
+
+CG_NEXT(3);}
+
+PC_694: { /* set_n_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_str_to_num(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_695: { /* set_n_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_696: { /* set_n_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_697: { /* set_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_string(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_698: { /* set_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = SREG(2);
+
+CG_NEXT(3);}
+
+PC_699: { /* set_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = SCONST(2);
+
+CG_NEXT(3);}
+
+PC_700: { /* set_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_from_int(interp, IREG(2));
+
+CG_NEXT(3);}
+
+PC_701: { /* set_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
+
+CG_NEXT(3);}
+
+PC_702: { /* set_s_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_from_num(interp, NREG(2));
+
+CG_NEXT(3);}
+
+PC_703: { /* set_s_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
+
+CG_NEXT(3);}
+
+PC_704: { /* set_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = PCONST(2);
+
+CG_NEXT(3);}
+
+PC_705: { /* set_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = PREG(2);
+
+CG_NEXT(3);}
+
+PC_706: { /* set_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_707: { /* set_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_708: { /* set_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_709: { /* set_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_710: { /* set_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_711: { /* set_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_712: { /* set_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_713: { /* assign_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_714: { /* assign_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_715: { /* assign_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_716: { /* assign_p_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+
+CG_NEXT(3);}
+
+PC_717: { /* assign_p_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+
+CG_NEXT(3);}
+
+PC_718: { /* assign_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_719: { /* assign_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_720: { /* assign_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = SREG(2);
+
+CG_NEXT(3);}
+
+PC_721: { /* assign_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = SCONST(2);
+
+CG_NEXT(3);}
+
+PC_722: { /* setref_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_723: { /* deref_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_724: { /* set_p_ki_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_725: { /* set_p_kic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_726: { /* set_p_ki_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_727: { /* set_p_kic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_728: { /* set_p_ki_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_729: { /* set_p_kic_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_730: { /* set_p_ki_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
+
+CG_NEXT(4);}
+
+PC_731: { /* set_p_kic_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+
+CG_NEXT(4);}
+
+PC_732: { /* set_p_ki_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_733: { /* set_p_kic_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_734: { /* set_p_ki_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_735: { /* set_p_kic_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_736: { /* set_p_ki_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_737: { /* set_p_kic_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_738: { /* set_i_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_739: { /* set_i_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_740: { /* set_n_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_741: { /* set_n_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_742: { /* set_s_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_743: { /* set_s_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_744: { /* set_p_p_ki */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_745: { /* set_p_p_kic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_746: { /* set_p_k_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_747: { /* set_p_kc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_748: { /* set_p_k_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_749: { /* set_p_kc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_750: { /* set_p_k_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_751: { /* set_p_kc_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+
+CG_NEXT(4);}
+
+PC_752: { /* set_p_k_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+
+CG_NEXT(4);}
+
+PC_753: { /* set_p_kc_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
+
+CG_NEXT(4);}
+
+PC_754: { /* set_p_k_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_755: { /* set_p_kc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_756: { /* set_p_k_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_757: { /* set_p_kc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_758: { /* set_p_k_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_759: { /* set_p_kc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_760: { /* set_i_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_761: { /* set_i_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_762: { /* set_n_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_763: { /* set_n_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_764: { /* set_s_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_765: { /* set_s_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_766: { /* set_p_p_k */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_767: { /* set_p_p_kc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_768: { /* clone_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_clone(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_769: { /* clone_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_770: { /* clone_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+
+CG_NEXT(4);}
+
+PC_771: { /* copy_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (PMC_IS_NULL(PREG(1))) {
+        opcode_t * const dest = cur_opcode + 3;
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, dest,
+                EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");CG_BRANCH(handler);
+    }
+    else {
+        PMC   * const clone = VTABLE_clone(interp, PREG(2));
+        /* Preserve the metadata on the destination. */
+        PMC   * const meta  = VTABLE_getprops(interp, PREG(1));
+
+        /* the destination gets the clone's flags, so pass its barrier while
+         * it still has its own */
+        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
+
+        /* avoid leaks and unreachable memory by destroying the destination PMC */
+        Parrot_pmc_destroy(interp, PREG(1));
+
+        /* the source PMC knows how to clone itself, but we must reuse the
+         * destination header */
+        memmove(PREG(1), clone, sizeof (PMC));
+
+        /* don't let the clone's destruction destroy the destination's data,
+         * nor its marking follow the emptied header */
+        PObj_gc_CLEAR(clone);
+        PMC_data(clone)        = NULL;
+        PMC_metadata(clone)    = NULL;
+
+        /* Restore metadata. */
+        if (!PMC_IS_NULL(meta)) {
+            PMC * const iter = VTABLE_get_iter(interp, meta);
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING * const key = VTABLE_shift_string(interp, iter);
+                PMC * const value  = VTABLE_get_pmc_keyed_str(interp, meta, key);
+                VTABLE_setprop(interp, PREG(1), key, value);
+            }
+        }
+    }
+
+CG_NEXT(3);}
+
+PC_772: { /* null_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRINGNULL;
+
+CG_NEXT(2);}
+
+PC_773: { /* null_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = 0;
+
+CG_NEXT(2);}
+
+PC_774: { /* null_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = PMCNULL;
+
+CG_NEXT(2);}
+
+PC_775: { /* null_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = 0;
+
+CG_NEXT(2);}
+
+PC_776: { /* ord_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SREG(2), 0);
+
+CG_NEXT(3);}
+
+PC_777: { /* ord_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), 0);
+
+CG_NEXT(3);}
+
+PC_778: { /* ord_i_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_779: { /* ord_i_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_780: { /* ord_i_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_781: { /* ord_i_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_782: { /* chr_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
+    SREG(1) = s;
+
+CG_NEXT(3);}
+
+PC_783: { /* chr_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
+    SREG(1) = s;
+
+CG_NEXT(3);}
+
+PC_784: { /* chopn_s_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_785: { /* chopn_s_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_786: { /* chopn_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_787: { /* chopn_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_788: { /* concat_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_concat(interp, SREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_789: { /* concat_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_concat(interp, SREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_790: { /* concat_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_791: { /* concat_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
+
+CG_NEXT(3);}
+
+PC_792: { /* concat_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
+
+CG_NEXT(3);}
+
+PC_793: { /* concat_s_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_794: { /* concat_s_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_795: { /* concat_s_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_796: { /* concat_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_797: { /* concat_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_798: { /* concat_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_799: { /* repeat_s_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
+
+CG_NEXT(4);}
+
+PC_800: { /* repeat_s_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
+
+CG_NEXT(4);}
+
+PC_801: { /* repeat_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
+
+CG_NEXT(4);}
+
+PC_802: { /* repeat_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
+
+CG_NEXT(4);}
+
+PC_803: { /* repeat_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (IREG(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_804: { /* repeat_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (ICONST(3) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_805: { /* repeat_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (VTABLE_get_integer(interp, PREG(3)) < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_NEG_REPEAT,
+                "Cannot repeat with negative arg");CG_BRANCH(handler);
+    }
+    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
+
+CG_NEXT(4);}
+
+PC_806: { /* repeat_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
+
+CG_NEXT(3);}
+
+PC_807: { /* repeat_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
+
+CG_NEXT(3);}
+
+PC_808: { /* repeat_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_i_repeat(interp, PREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_809: { /* length_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_length(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_810: { /* length_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_length(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_811: { /* bytelength_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_812: { /* bytelength_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_813: { /* pin_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_str_pin(interp, SREG(1));
+
+CG_NEXT(2);}
+
+PC_814: { /* unpin_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    Parrot_str_unpin(interp, SREG(1));
+
+CG_NEXT(2);}
+
+PC_815: { /* substr_s_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+
+CG_NEXT(4);}
+
+PC_816: { /* substr_s_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
+
+CG_NEXT(4);}
+
+PC_817: { /* substr_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SREG(2));
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
+
+CG_NEXT(4);}
+
+PC_818: { /* substr_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL len = Parrot_str_byte_length(interp, SCONST(2));
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
+
+CG_NEXT(4);}
+
+PC_819: { /* substr_s_s_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_820: { /* substr_s_sc_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_821: { /* substr_s_s_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_822: { /* substr_s_sc_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_823: { /* substr_s_s_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_824: { /* substr_s_sc_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_825: { /* substr_s_s_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_826: { /* substr_s_sc_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_827: { /* substr_s_p_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_828: { /* substr_s_p_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_829: { /* substr_s_p_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), IREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_830: { /* substr_s_p_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = VTABLE_substr_str(interp, PREG(2), ICONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_831: { /* replace_s_s_i_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_832: { /* replace_s_sc_i_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_833: { /* replace_s_s_ic_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_834: { /* replace_s_sc_ic_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_835: { /* replace_s_s_i_ic_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_836: { /* replace_s_sc_i_ic_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_837: { /* replace_s_s_ic_ic_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_838: { /* replace_s_sc_ic_ic_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
+
+CG_NEXT(6);}
+
+PC_839: { /* replace_s_s_i_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_840: { /* replace_s_sc_i_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_841: { /* replace_s_s_ic_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_842: { /* replace_s_sc_ic_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_843: { /* replace_s_s_i_ic_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_844: { /* replace_s_sc_i_ic_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_845: { /* replace_s_s_ic_ic_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_846: { /* replace_s_sc_ic_ic_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
+
+CG_NEXT(6);}
+
+PC_847: { /* index_i_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), 0) : -1;
+
+CG_NEXT(4);}
+
+PC_848: { /* index_i_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), 0) : -1;
+
+CG_NEXT(4);}
+
+PC_849: { /* index_i_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), 0) : -1;
+
+CG_NEXT(4);}
+
+PC_850: { /* index_i_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : -1;
+
+CG_NEXT(4);}
+
+PC_851: { /* index_i_s_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_852: { /* index_i_sc_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_853: { /* index_i_s_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_854: { /* index_i_sc_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_855: { /* index_i_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SREG(3)) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_856: { /* index_i_sc_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SREG(3)) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_857: { /* index_i_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SREG(2) && SCONST(3)) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_858: { /* index_i_sc_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = (SCONST(2) && SCONST(3)) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : -1;
+
+CG_NEXT(5);}
+
+PC_859: { /* sprintf_s_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1)=Parrot_psprintf(interp, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_860: { /* sprintf_s_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1)=Parrot_psprintf(interp, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_861: { /* sprintf_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_string_native(interp, PREG(1),
+        Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
+
+CG_NEXT(4);}
+
+PC_862: { /* new_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_new_noinit(interp, 0);
+
+CG_NEXT(2);}
+
+PC_863: { /* new_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_new_noinit(interp, IREG(2));
+
+CG_NEXT(3);}
+
+PC_864: { /* new_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_new_noinit(interp, ICONST(2));
+
+CG_NEXT(3);}
+
+PC_865: { /* stringinfo_i_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", IREG(3));CG_BRANCH(handler);
+            }
+        }
+    }
+
+CG_NEXT(4);}
+
+PC_866: { /* stringinfo_i_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", IREG(3));CG_BRANCH(handler);
+            }
+        }
+    }
+
+CG_NEXT(4);}
+
+PC_867: { /* stringinfo_i_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SREG(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", ICONST(3));CG_BRANCH(handler);
+            }
+        }
+    }
+
+CG_NEXT(4);}
+
+PC_868: { /* stringinfo_i_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (SCONST(2) == NULL)
+        IREG(1) = 0;
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "stringinfo: unknown info type: %d", ICONST(3));CG_BRANCH(handler);
+            }
+        }
+    }
+
+CG_NEXT(4);}
+
+PC_869: { /* upcase_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_upcase(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_870: { /* upcase_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_871: { /* downcase_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_downcase(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_872: { /* downcase_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_873: { /* titlecase_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_874: { /* titlecase_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_875: { /* join_s_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_876: { /* join_s_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_877: { /* split_p_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_878: { /* split_p_sc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
+
+CG_NEXT(4);}
+
+PC_879: { /* split_p_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_880: { /* split_p_sc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
+
+CG_NEXT(4);}
+
+PC_881: { /* encoding_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_882: { /* encoding_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_883: { /* encodingname_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_encoding_name(interp, IREG(2));
+
+CG_NEXT(3);}
+
+PC_884: { /* encodingname_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
+
+CG_NEXT(3);}
+
+PC_885: { /* find_encoding_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL n = Parrot_encoding_number(interp, SREG(2));
+    if (n < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_ENCODING,
+                "encoding '%Ss' not found", SREG(2));CG_BRANCH(handler);
+    }
+    IREG(1) = n;
+
+CG_NEXT(3);}
+
+PC_886: { /* find_encoding_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const INTVAL n = Parrot_encoding_number(interp, SCONST(2));
+    if (n < 0) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_ENCODING,
+                "encoding '%Ss' not found", SCONST(2));CG_BRANCH(handler);
+    }
+    IREG(1) = n;
+
+CG_NEXT(3);}
+
+PC_887: { /* trans_encoding_s_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_888: { /* trans_encoding_s_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
+
+CG_NEXT(4);}
+
+PC_889: { /* trans_encoding_s_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_890: { /* trans_encoding_s_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
+
+CG_NEXT(4);}
+
+PC_891: { /* is_cclass_i_i_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_892: { /* is_cclass_i_ic_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_893: { /* is_cclass_i_i_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_894: { /* is_cclass_i_ic_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
+
+CG_NEXT(5);}
+
+PC_895: { /* is_cclass_i_i_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_896: { /* is_cclass_i_ic_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_897: { /* is_cclass_i_i_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_898: { /* is_cclass_i_ic_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
+
+CG_NEXT(5);}
+
+PC_899: { /* find_cclass_i_i_s_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_900: { /* find_cclass_i_ic_s_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_901: { /* find_cclass_i_i_sc_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_902: { /* find_cclass_i_ic_sc_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_903: { /* find_cclass_i_i_s_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_904: { /* find_cclass_i_ic_s_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_905: { /* find_cclass_i_i_sc_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_906: { /* find_cclass_i_ic_sc_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_907: { /* find_cclass_i_i_s_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_908: { /* find_cclass_i_ic_s_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_909: { /* find_cclass_i_i_sc_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_910: { /* find_cclass_i_ic_sc_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_911: { /* find_cclass_i_i_s_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_912: { /* find_cclass_i_ic_s_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_913: { /* find_cclass_i_i_sc_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_914: { /* find_cclass_i_ic_sc_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_915: { /* find_not_cclass_i_i_s_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_916: { /* find_not_cclass_i_ic_s_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_917: { /* find_not_cclass_i_i_sc_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_918: { /* find_not_cclass_i_ic_sc_i_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_919: { /* find_not_cclass_i_i_s_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_920: { /* find_not_cclass_i_ic_s_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_921: { /* find_not_cclass_i_i_sc_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_922: { /* find_not_cclass_i_ic_sc_ic_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+
+CG_NEXT(6);}
+
+PC_923: { /* find_not_cclass_i_i_s_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_924: { /* find_not_cclass_i_ic_s_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_925: { /* find_not_cclass_i_i_sc_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_926: { /* find_not_cclass_i_ic_sc_i_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_927: { /* find_not_cclass_i_i_s_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_928: { /* find_not_cclass_i_ic_s_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_929: { /* find_not_cclass_i_i_sc_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_930: { /* find_not_cclass_i_ic_sc_ic_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+
+CG_NEXT(6);}
+
+PC_931: { /* escape_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_escape(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_932: { /* compose_s_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_compose(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_933: { /* compose_s_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    SREG(1) = Parrot_str_compose(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_934: { /* find_codepoint_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#if PARROT_HAS_ICU
+    UErrorCode   err       = U_ZERO_ERROR;
+    char * const cstr      = Parrot_str_to_cstring(interp, SREG(2));
+    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
+    Parrot_str_free_cstring(cstr);
+    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
+#else
+    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");CG_BRANCH(dest);
+#endif
+
+CG_NEXT(3);}
+
+PC_935: { /* find_codepoint_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#if PARROT_HAS_ICU
+    UErrorCode   err       = U_ZERO_ERROR;
+    char * const cstr      = Parrot_str_to_cstring(interp, SCONST(2));
+    UChar32      codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, &err);
+    Parrot_str_free_cstring(cstr);
+    IREG(1) = U_SUCCESS(err) ? (INTVAL) codepoint : -1;
+#else
+    opcode_t * const dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 3,
+        EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");CG_BRANCH(dest);
+#endif
+
+CG_NEXT(3);}
+
+PC_936: { /* spawnw_i_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
+
+CG_NEXT(3);}
+
+PC_937: { /* spawnw_i_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
+
+CG_NEXT(3);}
+
+PC_938: { /* spawnw_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
+
+CG_NEXT(3);}
+
+PC_939: { /* err_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = errno;
+
+CG_NEXT(2);}
+
+PC_940: { /* err_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const char * const tmp = strerror(errno);
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
+
+CG_NEXT(2);}
+
+PC_941: { /* err_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const char * const tmp = strerror(IREG(2));
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
+
+CG_NEXT(3);}
+
+PC_942: { /* err_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    const char * const tmp = strerror(ICONST(2));
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp),
+            Parrot_ascii_encoding_ptr, 0);
+
+CG_NEXT(3);}
+
+PC_943: { /* time_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    IREG(1) = Parrot_intval_time();
+
+CG_NEXT(2);}
+
+PC_944: { /* time_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    NREG(1) = Parrot_floatval_time();
+
+CG_NEXT(2);}
+
+PC_945: { /* sleep_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (IREG(1) < 0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");CG_BRANCH(handler);
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) IREG(1), next);CG_BRANCH(next);
+}
+
+PC_946: { /* sleep_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (ICONST(1) < 0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");CG_BRANCH(handler);
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL) ICONST(1), next);CG_BRANCH(next);
+}
+
+PC_947: { /* sleep_n */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (NREG(1) < 0.0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");CG_BRANCH(handler);
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);CG_BRANCH(next);
+}
+
+PC_948: { /* sleep_nc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *next = cur_opcode + 2;
+    if (NCONST(1) < 0.0) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, next,
+            EXCEPTION_NEG_SLEEP,
+            "Cannot go back in time");CG_BRANCH(handler);
+    }
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);CG_BRANCH(next);
+}
+
+PC_949: { /* store_lex_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SREG(1);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found", lex_name);CG_BRANCH(handler);
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+
+CG_NEXT(3);}
+
+PC_950: { /* store_lex_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SCONST(1);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found", lex_name);CG_BRANCH(handler);
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+
+CG_NEXT(3);}
+
+PC_951: { /* store_dynamic_lex_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SREG(1);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found in dynamic scope", lex_name);CG_BRANCH(handler);
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+
+CG_NEXT(3);}
+
+PC_952: { /* store_dynamic_lex_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SCONST(1);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t * const handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_LEX_NOT_FOUND,
+                "Lexical '%Ss' not found in dynamic scope", lex_name);CG_BRANCH(handler);
+    }
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+
+CG_NEXT(3);}
+
+PC_953: { /* find_lex_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SREG(2);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    PMC * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_954: { /* find_lex_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC     * const ctx      = CURRENT_CONTEXT(interp);
+    STRING  * const lex_name = SCONST(2);
+    PMC     * const lex_pad  = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    PMC * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_955: { /* find_dynamic_lex_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SREG(2);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC     * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_956: { /* find_dynamic_lex_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SCONST(2);
+    PMC     * const ctx      =
+        Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC     * const lex_pad  =
+        PMC_IS_NULL(ctx)
+            ? PMCNULL
+            : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC     * const result =
+        PMC_IS_NULL(lex_pad)
+            ? PMCNULL
+            : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_957: { /* find_caller_lex_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SREG(2);
+    PMC     * ctx            = CURRENT_CONTEXT(interp);
+    PMC     * result         = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
+            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
+    {
+        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+        if (!result) result = PMCNULL;
+    }
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_958: { /* find_caller_lex_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING  * const lex_name = SCONST(2);
+    PMC     * ctx            = CURRENT_CONTEXT(interp);
+    PMC     * result         = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+            !PMC_IS_NULL(ctx) && PMC_IS_NULL(result);
+            ctx = Parrot_pcc_get_caller_ctx(interp, ctx))
+    {
+        PMC * const lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+        if (!result) result = PMCNULL;
+    }
+    PREG(1) = result;
+
+CG_NEXT(3);}
+
+PC_959: { /* get_namespace_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = cur_ns;
+
+CG_NEXT(2);}
+
+PC_960: { /* get_namespace_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+
+CG_NEXT(3);}
+
+PC_961: { /* get_namespace_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+
+CG_NEXT(3);}
+
+PC_962: { /* get_hll_namespace_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = hll_ns;
+
+CG_NEXT(2);}
+
+PC_963: { /* get_hll_namespace_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        PREG(1) = ns;
+    }
+
+CG_NEXT(3);}
+
+PC_964: { /* get_hll_namespace_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        PREG(1) = ns;
+    }
+
+CG_NEXT(3);}
+
+PC_965: { /* get_root_namespace_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = root_ns;
+
+CG_NEXT(2);}
+
+PC_966: { /* get_root_namespace_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        PREG(1) = ns;
+    }
+
+CG_NEXT(3);}
+
+PC_967: { /* get_root_namespace_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        PREG(1) = ns;
+    }
+
+CG_NEXT(3);}
+
+PC_968: { /* get_global_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SREG(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_969: { /* get_global_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SCONST(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_970: { /* get_global_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_971: { /* get_global_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_972: { /* get_global_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_973: { /* get_global_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_974: { /* get_hll_global_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_975: { /* get_hll_global_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_976: { /* get_hll_global_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_977: { /* get_hll_global_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_978: { /* get_hll_global_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_979: { /* get_hll_global_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_980: { /* get_root_global_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_981: { /* get_root_global_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_982: { /* get_root_global_p_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_983: { /* get_root_global_p_pc_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_984: { /* get_root_global_p_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_985: { /* get_root_global_p_pc_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    if (PMC_IS_NULL(root_ns))
+        PREG(1) = PMCNULL;
+    else {
+        PMC * const ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+        if (PMC_IS_NULL(ns))
+            PREG(1) = PMCNULL;
+        else
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3), cur_opcode + 4);
+    }
+
+CG_NEXT(4);}
+
+PC_986: { /* set_global_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_987: { /* set_global_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_988: { /* set_global_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_989: { /* set_global_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_990: { /* set_global_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_991: { /* set_global_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_992: { /* set_hll_global_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_993: { /* set_hll_global_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_994: { /* set_hll_global_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_995: { /* set_hll_global_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_996: { /* set_hll_global_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_997: { /* set_hll_global_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC * const ns     = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_998: { /* set_root_global_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_999: { /* set_root_global_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
+
+CG_NEXT(3);}
+
+PC_1000: { /* set_root_global_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_1001: { /* set_root_global_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_1002: { /* set_root_global_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_1003: { /* set_root_global_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const root_ns = interp->root_namespace;
+    PMC * const ns      = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+
+CG_NEXT(4);}
+
+PC_1004: { /* find_name_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!SREG(2)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Tried to find null name");CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_1005: { /* find_name_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    if (!SCONST(2)) {
+        opcode_t *handler = Parrot_ex_throw_from_op_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Tried to find null name");CG_BRANCH(handler);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2), cur_opcode + 3);
+
+CG_NEXT(3);}
+
+PC_1006: { /* find_sub_not_null_p_s */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *dest = cur_opcode + 3;
+    PMC *sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t *handler;
+        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest,
+                       EXCEPTION_GLOBAL_NOT_FOUND,
+                       "Could not find sub %Ss", SREG(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = sub;
+
+CG_NEXT(3);}
+
+PC_1007: { /* find_sub_not_null_p_sc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    opcode_t *dest = cur_opcode + 3;
+    PMC *sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t *handler;
+        Parrot_pcc_set_pc_func(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest,
+                       EXCEPTION_GLOBAL_NOT_FOUND,
+                       "Could not find sub %Ss", SCONST(2));CG_BRANCH(handler);
+    }
+
+    PREG(1) = sub;
+
+CG_NEXT(3);}
+
+PC_1008: { /* trap */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+#if defined(__GNUC__) && defined(i386)
+    __asm__("int3");       /* opcode 0xcc */
+#endif
+#if defined(__GNUC__) && defined(PPC)
+    __asm__("trap");       /* opcode tr 31, 0, 0 */
+#endif
+
+CG_NEXT(1);}
+
+PC_1009: { /* set_label_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    VTABLE_set_pointer(interp, PREG(1), (CUR_OPCODE + ICONST(2)));
+
+CG_NEXT(3);}
+
+PC_1010: { /* get_label_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    void * const ptr = VTABLE_get_pointer(interp, PREG(2));
+    IREG(1) =  PTR2INTVAL(ptr);
+
+CG_NEXT(3);}
+
+PC_1011: { /* fetch_p_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1012: { /* fetch_p_pc_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1013: { /* fetch_p_p_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1014: { /* fetch_p_pc_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1015: { /* fetch_p_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1016: { /* fetch_p_pc_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1017: { /* fetch_p_p_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1018: { /* fetch_p_pc_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1019: { /* fetch_p_p_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1020: { /* fetch_p_pc_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1021: { /* fetch_p_p_ic_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1022: { /* fetch_p_pc_ic_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1023: { /* fetch_p_p_i_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1024: { /* fetch_p_pc_i_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1025: { /* fetch_p_p_ic_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1026: { /* fetch_p_pc_ic_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1027: { /* fetch_p_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1028: { /* fetch_p_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1029: { /* fetch_p_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1030: { /* fetch_p_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1031: { /* fetch_p_p_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1032: { /* fetch_p_pc_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1033: { /* fetch_p_p_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1034: { /* fetch_p_pc_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+    }
+
+CG_NEXT(5);}
+
+PC_1035: { /* vivify_p_p_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1036: { /* vivify_p_pc_p_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1037: { /* vivify_p_p_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1038: { /* vivify_p_pc_pc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1039: { /* vivify_p_p_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1040: { /* vivify_p_pc_p_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1041: { /* vivify_p_p_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1042: { /* vivify_p_pc_pc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1043: { /* vivify_p_p_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1044: { /* vivify_p_pc_i_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1045: { /* vivify_p_p_ic_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1046: { /* vivify_p_pc_ic_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1047: { /* vivify_p_p_i_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1048: { /* vivify_p_pc_i_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1049: { /* vivify_p_p_ic_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1050: { /* vivify_p_pc_ic_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1051: { /* vivify_p_p_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1052: { /* vivify_p_pc_s_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1053: { /* vivify_p_p_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1054: { /* vivify_p_pc_sc_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PREG(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PREG(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PREG(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1055: { /* vivify_p_p_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1056: { /* vivify_p_pc_s_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1057: { /* vivify_p_p_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1058: { /* vivify_p_pc_sc_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PMC * const classobj = Parrot_oo_get_class(interp, PCONST(4));
+        if (!PMC_IS_NULL(classobj))
+            PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+        else {
+            const INTVAL type = Parrot_pmc_get_type(interp, PCONST(4));
+            if (type <= 0) {
+                opcode_t *dest = Parrot_ex_throw_from_op_args(
+                    interp, cur_opcode + 5, EXCEPTION_NO_CLASS,
+                    "Class '%Ss' not found", VTABLE_get_repr(interp, PCONST(4)));CG_BRANCH(dest);
+            }
+
+            PREG(1) = Parrot_pmc_new(interp, type);
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+CG_NEXT(5);}
+
+PC_1059: { /* new_p_s_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_1060: { /* new_p_sc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+CG_NEXT(4);}
+
+PC_1061: { /* new_p_s_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SREG(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_1062: { /* new_p_sc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    STRING * const name   = SCONST(2);
+    PMC    * const _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))
+                          ? Parrot_oo_get_class_str(interp, name)
+                          : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PMC *initial = Parrot_pmc_new(interp,
+                                      Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL type = Parrot_pmc_get_type_str(interp, name);
+        if (type <= 0) {
+            opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+                EXCEPTION_NO_CLASS,
+                "Class '%Ss' not found", name);CG_BRANCH(dest);
+        }
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+CG_NEXT(4);}
+
+PC_1063: { /* new_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1064: { /* new_p_pc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1065: { /* new_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1066: { /* new_p_pc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const _class = Parrot_oo_get_class(interp, name_key);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1067: { /* root_new_p_p_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1068: { /* root_new_p_pc_i */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1069: { /* root_new_p_p_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PREG(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1070: { /* root_new_p_pc_ic */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    PMC * const  name_key = PCONST(2);
+
+    /* get_class() returns a PMCProxy for core types, so check for core PMCs */
+    const INTVAL type = Parrot_pmc_get_type(interp, name_key);
+
+    /* if it's clearly a PIR-level PMC */
+    if (type > enum_class_core_max) {
+        PMC * const root_ns  = interp->root_namespace;
+        PMC * const ns       = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC * const _class   = Parrot_oo_get_class(interp, ns);
+        if (!PMC_IS_NULL(_class)) {
+            PMC *initial = Parrot_pmc_new(interp,
+                Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+    }
+
+    /* if it's a core PMC */
+    else if (type > enum_class_default)
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+
+    /* it's a typo */
+    else {
+        opcode_t *dest = Parrot_ex_throw_from_op_args(interp, cur_opcode + 4,
+            EXCEPTION_NO_CLASS,
+            "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));CG_BRANCH(dest);
+    }
+
+CG_NEXT(4);}
+
+PC_1071: { /* finalize_p */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /* Go to the next op after loop unrolling */
+    opcode_t * const dest = cur_opcode + 2;
+    PMC *eh = PMCNULL;
+    Parrot_warn_experimental(interp, "finalize is experimental");
+    if (!PMC_IS_NULL(PREG(1))) {
+        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
+        if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
+            eh = PREG(1);
+        else if (VTABLE_isa(interp, PREG(1), Parrot_str_new_constant(interp, "Exception"))) {
+            PMC *iter = VTABLE_get_attr_str(interp,
+                                            PREG(1), Parrot_str_new_constant(interp, "handler_iter"));
+            if (!PMC_IS_NULL(iter))
+                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
+        }
+    }
+    if (!PMC_IS_NULL(eh)) {
+        /* Get the runloop_id from the continuation and jump to it. */
+        Parrot_runloop *rl = interp->current_runloop;
+        INTVAL rid;
+        Parrot_pcc_invoke_method_from_c_args(interp,
+                                             eh, Parrot_str_new_constant(interp, "rid"),
+                                             "->I", &rid);
+        while (rl && rl->id != rid)
+            rl = rl->prev;
+        if (rl) {
+            if (rl != interp->current_runloop) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, 3);
+            }
+        }
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION, "missing runloop");
+    }
+
+CG_NEXT(2);}
+
+PC_1072: { /* finalize_pc */
+    const Parrot_Context * const CUR_CTX = Parrot_pcc_get_context_struct(interp, interp->ctx);
+    /* Go to the next op after loop unrolling */
+    opcode_t * const dest = cur_opcode + 2;
+    PMC *eh = PMCNULL;
+    Parrot_warn_experimental(interp, "finalize is experimental");
+    if (!PMC_IS_NULL(PCONST(1))) {
+        /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
+        if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "ExceptionHandler")))
+            eh = PCONST(1);
+        else if (VTABLE_isa(interp, PCONST(1), Parrot_str_new_constant(interp, "Exception"))) {
+            PMC *iter = VTABLE_get_attr_str(interp,
+                                            PCONST(1), Parrot_str_new_constant(interp, "handler_iter"));
+            if (!PMC_IS_NULL(iter))
+                eh = VTABLE_get_pmc_keyed_int(interp, iter, -1);
+        }
+    }
+    if (!PMC_IS_NULL(eh)) {
+        /* Get the runloop_id from the continuation and jump to it. */
+        Parrot_runloop *rl = interp->current_runloop;
+        INTVAL rid;
+        Parrot_pcc_invoke_method_from_c_args(interp,
+                                             eh, Parrot_str_new_constant(interp, "rid"),
+                                             "->I", &rid);
+        while (rl && rl->id != rid)
+            rl = rl->prev;
+        if (rl) {
+            if (rl != interp->current_runloop) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, 3);
+            }
+        }
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION, "missing runloop");
+    }
+
+CG_NEXT(2);}
+
+}
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+
+/*
+** op lib descriptor:
+*/
+
+/* XXX should be static, but C++ doesn't want to play ball */
+op_lib_t core_cg_op_lib = {
+  "core_ops",                /* name */
+  "_cg",                  /* suffix */
+  PARROT_CGOTO_CORE,                       /* core_type = PARROT_XX_CORE */
+  0,                                /* flags */
+  2,    /* major_version */
+  10,    /* minor_version */
+  1,    /* patch_version */
+  1073,             /* op_count */
+  NULL,       /* op_info_table */
+  NULL,       /* op_func_table */
+  ( int (*)(PARROT_INTERP, const char *, int) )NULL          /* op_code() */ 
+};
+static void hop_deinit(SHIM_INTERP) {}PARROT_EXPORT
+op_lib_t *
+Parrot_DynOp_core_cg_2_10_1(PARROT_INTERP, long init) {
+    /* initialize and return op_lib ptr */
+    if (init == 1) {
+
+        if (!core_cg_op_lib.op_info_table) {
+            const op_lib_t * const core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+            core_cg_op_lib.op_info_table = core_lib->op_info_table;
+            core_cg_op_lib.op_func_table = core_lib->op_func_table;
+            core_cg_op_lib._op_code      = core_lib->_op_code;
+        }
+        return &core_cg_op_lib;
+    }
+    /* set op_lib to the passed ptr (in init) */
+    else if (init) {
+
+    }
+    /* deinit - free resources */
+    else {
+        hop_deinit(interp);
+    }
+    return NULL;
+}
+
+
+/*
+ * dynamic lib load function - called once
+ */
+ PMC*
+Parrot_lib_core_ops_cg_load(PARROT_INTERP);
+
+ PMC*
+Parrot_lib_core_ops_cg_load(PARROT_INTERP)
+
+{
+    PMC *const lib = Parrot_pmc_new(interp, enum_class_ParrotLibrary);
+    ((Parrot_ParrotLibrary_attributes*)PMC_data(lib))->oplib_init = (void *) Parrot_DynOp_core_cg_2_10_1;
+    dynop_register(interp, lib);
+    return lib;
+}
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ *   buffer-read-only: t
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -86,7 +86,8 @@ PackFile_ConstTable_dump(PARROT_INTERP, ARGIN(const PackFile_ConstTable *self))
 
     for (i = 0; i < self->pmc.const_count; i++) {
         Parrot_io_printf(interp, "    # %x:\n", (long)i);
-        PackFile_Constant_dump_pmc(interp, self, self->pmc.constants[i]);
+        PackFile_Constant_dump_pmc(interp, self,
+                PackFile_ConstTable_get_pmc(interp, self, i));
     }
 }
 
@@ -129,7 +130,7 @@ PARROT_OBSERVER static const char * const flag_bit_names[] =
     "custom_GC",
     "custom_destroy",
     "report",
-    "data_is_PMC_array",
+    "GC_need_write_barrier",
     "need_finalize",
     "high_priority_gc",
     "needs_early_gc",
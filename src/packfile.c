@@ -29,6 +29,7 @@ about the structure of the frozen bytecode.
 #include "parrot/extend.h"
 #include "parrot/dynext.h"
 #include "parrot/runcore_api.h"
+#include "parrot/imageio.h"
 #include "../compilers/imcc/imc.h"
 #include "packfile.str"
 #include "pmc/pmc_sub.h"
@@ -42,6 +43,15 @@ about the structure of the frozen bytecode.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const opcode_t * annotations_unpack_in_place(
+    ARGMOD(PackFile_Annotations *self),
+    ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -291,7 +301,7 @@ static size_t pf_debug_packed_size(SHIM_INTERP,
         __attribute__nonnull__(2);
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CANNOT_RETURN_NULL
+PARROT_CAN_RETURN_NULL
 static const opcode_t * pf_debug_unpack(PARROT_INTERP,
     ARGOUT(PackFile_Segment *self),
     ARGIN(const opcode_t *cursor))
@@ -300,11 +310,34 @@ static const opcode_t * pf_debug_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*self);
 
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static int pf_in_image(
+    ARGIN(const PackFile *pf),
+    ARGIN_NULLOK(const void *p))
+        __attribute__nonnull__(1);
+
 static void pf_register_standard_funcs(PARROT_INTERP, ARGMOD(PackFile *pf))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pf);
 
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t pf_words_left(
+    ARGIN(const PackFile *pf),
+    ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int pmc_constant_is_lazy(PARROT_INTERP,
+    ARGIN(const PackFile *pf),
+    ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_IGNORABLE_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* run_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
@@ -330,6 +363,17 @@ static int sub_pragma(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+PARROT_CAN_RETURN_NULL
+static void * unshare_in_place(PARROT_INTERP,
+    ARGIN(const PackFile *pf),
+    ARGIN_NULLOK(void *p),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_annotations_unpack_in_place __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_byte_code_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
@@ -440,9 +484,18 @@ static int sub_pragma(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_pf_in_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pf))
 #define ASSERT_ARGS_pf_register_standard_funcs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_pf_words_left __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_pmc_constant_is_lazy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_run_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -455,6 +508,9 @@ static int sub_pragma(PARROT_INTERP,
 #define ASSERT_ARGS_sub_pragma __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_unshare_in_place __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -514,6 +570,10 @@ Parrot_trace_eprintf(ARGIN(const char *s), ...)
 
 Deletes a C<PackFile>.
 
+The constant strings of a packfile used in place point into its mapping
+and may outlive it, so that mapping is handed to the main interpreter and
+only unmapped by C<Parrot_destroy_mappings>.
+
 =cut
 
 */
@@ -527,10 +587,27 @@ PackFile_destroy(PARROT_INTERP, ARGMOD(PackFile *pf))
 #ifdef PARROT_HAS_HEADER_SYSMMAN
     if (pf->is_mmap_ped) {
         DECL_CONST_CAST;
-        /* Cast the result to void to avoid a warning with
-         * some not-so-standard mmap headers
-         */
-        munmap((void *)PARROT_const_cast(opcode_t *, pf->src), pf->size);
+
+        if (PF_IN_PLACE(pf)) {
+            PackFile_Mapping * const map = mem_internal_allocate_typed(PackFile_Mapping);
+            Interp *main_interp          = interp;
+
+            while (main_interp->parent_interpreter)
+                main_interp = main_interp->parent_interpreter;
+
+            map->src  = (void *)PARROT_const_cast(opcode_t *, pf->src);
+            map->size = pf->size;
+
+            LOCK(interpreter_array_mutex);
+            map->next                = main_interp->pf_mappings;
+            main_interp->pf_mappings = map;
+            UNLOCK(interpreter_array_mutex);
+        }
+        else
+            /* Cast the result to void to avoid a warning with
+             * some not-so-standard mmap headers
+             */
+            munmap((void *)PARROT_const_cast(opcode_t *, pf->src), pf->size);
     }
 #endif
 
@@ -862,7 +939,7 @@ find_const_iter(PARROT_INTERP, ARGIN(PackFile_Segment *seg),
 =item C<void mark_const_subs(PARROT_INTERP)>
 
 Iterates over all directories and PackFile_Segments, finding and marking any
-constant Subs.
+constant Subs.  The packfiles restored from a snapshot are marked too.
 
 =cut
 
@@ -875,6 +952,10 @@ mark_const_subs(PARROT_INTERP)
 
     PackFile * const self = interp->initial_pf;
 
+    if (interp->snapshot_pf)
+        PackFile_map_segments(interp, &interp->snapshot_pf->directory,
+                find_const_iter, NULL);
+
     if (!self)
         return;
     else {
@@ -923,7 +1004,8 @@ do_sub_pragmas(PARROT_INTERP, ARGIN(PackFile_ByteCode *self),
         STRING * const SUB = CONST_STRING(interp, "Sub");
         PMC *sub_pmc = ct->pmc.constants[i];
 
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        /* constants not thawed yet are never Subs */
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
@@ -1112,6 +1194,9 @@ PackFile_unpack(PARROT_INTERP, ARGMOD(PackFile *self),
                                      &self->directory.base, cursor);
     Parrot_unblock_GC_mark(interp);
 
+    if (!cursor)
+        return 0;
+
 #ifdef PARROT_HAS_HEADER_SYSMMAN
     if (self->is_mmap_ped
     && (self->need_endianize || self->need_wordsize)) {
@@ -1455,6 +1540,85 @@ PackFile_funcs_register(SHIM_INTERP, ARGOUT(PackFile *pf), UINTVAL type,
 }
 
 
+/*
+
+=item C<static size_t pf_words_left(const PackFile *pf, const opcode_t *cursor)>
+
+Returns the number of file words between C<cursor> and the end of the
+packfile image.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t
+pf_words_left(ARGIN(const PackFile *pf), ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(pf_words_left)
+    const size_t used = (const char *)cursor - (const char *)pf->src;
+
+    if (used >= pf->size)
+        return 0;
+
+    return (pf->size - used) / pf->header->wordsize;
+}
+
+
+/*
+
+=item C<static int pf_in_image(const PackFile *pf, const void *p)>
+
+Returns true if C<p> points into the read-only image of a packfile used in
+place, i.e. it is not ours to free or grow.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static int
+pf_in_image(ARGIN(const PackFile *pf), ARGIN_NULLOK(const void *p))
+{
+    ASSERT_ARGS(pf_in_image)
+    const char * const start = (const char *)pf->src;
+
+    return PF_IN_PLACE(pf) && p
+        && (const char *)p >= start && (const char *)p < start + pf->size;
+}
+
+
+/*
+
+=item C<static void * unshare_in_place(PARROT_INTERP, const PackFile *pf, void
+*p, size_t size)>
+
+Returns C<p>, or a fresh copy of its first C<size> bytes if it points into the
+image of a packfile used in place, so that it can be grown.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+unshare_in_place(PARROT_INTERP, ARGIN(const PackFile *pf), ARGIN_NULLOK(void *p),
+        size_t size)
+{
+    ASSERT_ARGS(unshare_in_place)
+    void *copy;
+
+    if (!pf_in_image(pf, p))
+        return p;
+
+    copy = mem_gc_allocate_n_typed(interp, size ? size : 1, char);
+    memcpy(copy, p, size);
+    return copy;
+}
+
+
 /*
 
 =item C<static const opcode_t * default_unpack(PARROT_INTERP, PackFile_Segment
@@ -1487,11 +1651,16 @@ default_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *self), ARGIN(const opcode
     if (self->size == 0)
         return cursor;
 
+    if (self->size > pf_words_left(self->pf, cursor)) {
+        Parrot_io_eprintf(interp, "PackFile_unpack: Segment %Ss exceeds the packfile\n",
+                self->name);
+        self->size = 0;
+        return NULL;
+    }
+
     /* if the packfile is mmap()ed just point to it if we don't
      * need any fetch transforms */
-    if (self->pf->is_mmap_ped
-    && !self->pf->need_endianize
-    && !self->pf->need_wordsize) {
+    if (PF_IN_PLACE(self->pf)) {
         self->data  = PARROT_const_cast(opcode_t *, cursor);
         cursor     += self->size;
         return cursor;
@@ -2066,6 +2235,15 @@ directory_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *segp), ARGIN(const opco
         seg->op_count    = PF_fetch_opcode(pf, &cursor);
         TRACE_PRINTF_VAL(("Segment op_count %ld.\n", seg->op_count));
 
+        /* segments may be used in place, so they have to lie in the file */
+        if (seg->file_offset + seg->op_count > pf->size / pf->header->wordsize) {
+            Parrot_io_eprintf(interp,
+                     "%Ss: Segment at offset 0x%x exceeds the packfile\n",
+                     seg->name, (int)seg->file_offset);
+            dir->segments[i] = seg;
+            return NULL;
+        }
+
         if (pf->need_wordsize) {
 #if OPCODE_T_SIZE == 8
             if (pf->header->wordsize == 4)
@@ -2199,6 +2377,13 @@ directory_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
         dir->segments     = NULL;
         dir->num_segments = 0;
     }
+
+    /* the directory of a packfile appended by load_bytecode is the last
+     * owner of its header */
+    if (dir == &self->pf->directory && self->pf->header) {
+        mem_gc_free(interp, self->pf->header);
+        self->pf->header = NULL;
+    }
 }
 
 
@@ -2530,10 +2715,15 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     ASSERT_ARGS(byte_code_destroy)
     PackFile_ByteCode * const byte_code = (PackFile_ByteCode *)self;
 
+    if (self->data)
+        Parrot_oo_forget_call_sites(interp, self->data, self->size);
+
     if (byte_code->op_func_table)
         mem_gc_free(interp, byte_code->op_func_table);
     if (byte_code->op_info_table)
         mem_gc_free(interp, byte_code->op_info_table);
+    if (byte_code->op_addr_table)
+        mem_gc_free(interp, byte_code->op_addr_table);
     if (byte_code->op_mapping.libs) {
         opcode_t n_libs = byte_code->op_mapping.n_libs;
         opcode_t i;
@@ -2557,6 +2747,8 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     byte_code->debugs          = NULL;
     byte_code->op_func_table   = NULL;
     byte_code->op_info_table   = NULL;
+    byte_code->op_addr_table   = NULL;
+    byte_code->op_addr_count   = 0;
     byte_code->op_mapping.libs = NULL;
     byte_code->libdeps         = NULL;
 }
@@ -2831,8 +3023,9 @@ pf_debug_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     ASSERT_ARGS(pf_debug_destroy)
     PackFile_Debug * const debug = (PackFile_Debug *) self;
 
-    /* Free mappings pointer array. */
-    mem_gc_free(interp, debug->mappings);
+    /* Free mappings pointer array, unless it is used in place. */
+    if (!pf_in_image(self->pf, debug->mappings))
+        mem_gc_free(interp, debug->mappings);
     debug->mappings     = NULL;
     debug->num_mappings = 0;
 }
@@ -2937,11 +3130,12 @@ Unpacks a debug segment into a PackFile_Debug structure, given the cursor.
 */
 
 PARROT_WARN_UNUSED_RESULT
-PARROT_CANNOT_RETURN_NULL
+PARROT_CAN_RETURN_NULL
 static const opcode_t *
 pf_debug_unpack(PARROT_INTERP, ARGOUT(PackFile_Segment *self), ARGIN(const opcode_t *cursor))
 {
     ASSERT_ARGS(pf_debug_unpack)
+    DECL_CONST_CAST_OF(opcode_t);
     PackFile_Debug * const debug = (PackFile_Debug *)self;
     PackFile_ByteCode     *code;
     int                    i;
@@ -2956,15 +3150,28 @@ pf_debug_unpack(PARROT_INTERP, ARGOUT(PackFile_Segment *self), ARGIN(const opcod
     /* Number of mappings. */
     debug->num_mappings = PF_fetch_opcode(self->pf, &cursor);
 
-    /* Allocate space for mappings vector. */
-    debug->mappings = mem_gc_allocate_n_zeroed_typed(interp,
-            debug->num_mappings, PackFile_DebugFilenameMapping);
+    if (PF_IN_PLACE(self->pf)) {
+        /* a mapping is two opcodes in the file too */
+        if ((size_t)debug->num_mappings * 2 > pf_words_left(self->pf, cursor)) {
+            debug->num_mappings = 0;
+            return NULL;
+        }
+
+        debug->mappings = (PackFile_DebugFilenameMapping *)
+            PARROT_const_cast(opcode_t *, cursor);
+        cursor         += debug->num_mappings * 2;
+    }
+    else {
+        /* Allocate space for mappings vector. */
+        debug->mappings = mem_gc_allocate_n_zeroed_typed(interp,
+                debug->num_mappings, PackFile_DebugFilenameMapping);
 
-    /* Read in each mapping. */
-    for (i = 0; i < debug->num_mappings; ++i) {
-        /* Get offset and filename type. */
-        debug->mappings[i].offset   = PF_fetch_opcode(self->pf, &cursor);
-        debug->mappings[i].filename = PF_fetch_opcode(self->pf, &cursor);
+        /* Read in each mapping. */
+        for (i = 0; i < debug->num_mappings; ++i) {
+            /* Get offset and filename type. */
+            debug->mappings[i].offset   = PF_fetch_opcode(self->pf, &cursor);
+            debug->mappings[i].filename = PF_fetch_opcode(self->pf, &cursor);
+        }
     }
 
     /* find seg e.g. CODE_DB => CODE and attach it */
@@ -3104,6 +3311,9 @@ Parrot_debug_add_mapping(PARROT_INTERP, ARGMOD(PackFile_Debug *debug),
     }
 
     /* Allocate space for the extra entry. */
+    debug->mappings = (PackFile_DebugFilenameMapping *)unshare_in_place(interp,
+            debug->base.pf, debug->mappings,
+            debug->num_mappings * sizeof (PackFile_DebugFilenameMapping));
     debug->mappings = mem_gc_realloc_n_typed(interp,
             debug->mappings, debug->num_mappings + 1,
             PackFile_DebugFilenameMapping);
@@ -3380,10 +3590,10 @@ find_constants(PARROT_INTERP, ARGIN(PackFile_ConstTable *ct))
             new_ct->pmc.const_count = ct->pmc.const_count;
             new_ct->pmc.constants = mem_gc_allocate_n_zeroed_typed(interp,
                                         ct->pmc.const_count, PMC *);
-            memcpy(new_ct->pmc.constants, ct->pmc.constants,
-                    ct->pmc.const_count * sizeof (PMC *));
-            for (i = 0; i < new_ct->pmc.const_count; ++i)
+            for (i = 0; i < new_ct->pmc.const_count; ++i) {
+                new_ct->pmc.constants[i] = PackFile_ConstTable_get_pmc(interp, ct, i);
                 clone_constant(interp, &new_ct->pmc.constants[i]);
+            }
 
             parrot_hash_put(interp, tables, ct, new_ct);
         }
@@ -3427,6 +3637,36 @@ Parrot_destroy_constants(PARROT_INTERP)
     parrot_hash_destroy(interp, hash);
 }
 
+
+/*
+
+=item C<void Parrot_destroy_mappings(PARROT_INTERP)>
+
+Unmaps the in-place packfiles destroyed during the life of the main
+interpreter. Call it only once no string can point into them any more.
+
+=cut
+
+*/
+
+void
+Parrot_destroy_mappings(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_destroy_mappings)
+    PackFile_Mapping *map = interp->pf_mappings;
+
+    while (map) {
+        PackFile_Mapping * const next = map->next;
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+        munmap(map->src, map->size);
+#endif
+        mem_internal_free(map);
+        map = next;
+    }
+
+    interp->pf_mappings = NULL;
+}
+
 /*
 
 =back
@@ -3465,6 +3705,11 @@ PackFile_ConstTable_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
         self->pmc.constants = NULL;
     }
 
+    if (self->pmc.frozen) {
+        mem_gc_free(interp, self->pmc.frozen);
+        self->pmc.frozen = NULL;
+    }
+
     if (self->string_hash) {
         parrot_hash_destroy(interp, self->string_hash);
         self->string_hash = NULL;
@@ -3535,8 +3780,20 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGIN(PackFile_Segment *seg),
     for (i = 0; i < self->str.const_count; i++)
         self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
 
-    for (i = 0; i < self->pmc.const_count; i++)
-        self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
+    for (i = 0; i < self->pmc.const_count; i++) {
+        if (pmc_constant_is_lazy(interp, pf, cursor)) {
+            const size_t size = PF_fetch_opcode(pf, &cursor);
+
+            if (!self->pmc.frozen)
+                self->pmc.frozen = mem_gc_allocate_n_zeroed_typed(interp,
+                                        self->pmc.const_count, const opcode_t *);
+
+            self->pmc.frozen[i] = cursor - 1;
+            cursor += (size + sizeof (opcode_t) - 1) / sizeof (opcode_t);
+        }
+        else
+            self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
+    }
 
     return cursor;
 
@@ -3548,6 +3805,96 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGIN(PackFile_Segment *seg),
 }
 
 
+/*
+
+=item C<PMC * PackFile_ConstTable_get_pmc(PARROT_INTERP, const
+PackFile_ConstTable *self, opcode_t idx)>
+
+Returns the PMC constant C<idx> of C<self>, thawing it from the packfile
+image on first access.  C<PackFile_ConstTable_unpack> leaves PMC constants
+other than Subs frozen in a mapped packfile, so code that wants every
+constant of a table has to go through this function rather than reading
+C<pmc.constants> directly.  The thawed constant is cached in the table, which
+is logically unchanged, so C<self> is taken as const.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+PackFile_ConstTable_get_pmc(PARROT_INTERP, ARGIN(const PackFile_ConstTable *self),
+        opcode_t idx)
+{
+    ASSERT_ARGS(PackFile_ConstTable_get_pmc)
+    PMC *pmc = self->pmc.constants[idx];
+
+    if (!pmc && self->pmc.frozen && self->pmc.frozen[idx]) {
+        DECL_CONST_CAST_OF(PackFile_ConstTable);
+        PackFile_ConstTable * const ct     = PARROT_const_cast(PackFile_ConstTable *, self);
+        const opcode_t             *cursor = self->pmc.frozen[idx];
+
+        pmc                    = PackFile_Constant_unpack_pmc(interp, ct, &cursor);
+        ct->pmc.constants[idx] = pmc;
+        ct->pmc.frozen[idx]    = NULL;
+    }
+
+    return pmc;
+}
+
+
+/*
+
+=item C<static int pmc_constant_is_lazy(PARROT_INTERP, const PackFile *pf, const
+opcode_t *cursor)>
+
+Peeks at the type of the frozen PMC constant at C<cursor> and returns true if
+thawing it can wait until first access.  Subs are always thawed at load time,
+as loading stores them in their namespaces and runs their pragmas.  Lazy
+constants point into the packfile image, so only native images mapped for the
+lifetime of the packfile qualify.  A packfile restored from a snapshot thaws
+none of its constants here, the snapshot supplies them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+pmc_constant_is_lazy(PARROT_INTERP, ARGIN(const PackFile *pf),
+        ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(pmc_constant_is_lazy)
+    STRING * const SUB = CONST_STRING(interp, "Sub");
+    const VTABLE  *vtable;
+    INTVAL         type;
+
+    if (!PF_IN_PLACE(pf))
+        return 0;
+
+    if (pf->options & PFOPT_SNAPSHOT)
+        return 1;
+
+    /* the image is the frozen root PMC id followed by its type */
+    if ((size_t)cursor[0] < 2 * sizeof (opcode_t)
+    ||  PackID_get_FLAGS(cursor[1]) != enum_PackID_normal)
+        return 0;
+
+    type = cursor[2];
+
+    if (type <= 0 || type >= interp->n_vtable_max || !interp->vtables[type])
+        return 0;
+
+    vtable = interp->vtables[type];
+
+    if (STRING_equal(interp, vtable->whoami, SUB))
+        return 0;
+
+    return !vtable->isa_hash || !parrot_hash_exists(interp, vtable->isa_hash, SUB);
+}
+
+
 /*
 
 =item C<static PackFile_Segment * const_new(PARROT_INTERP, PackFile *pf, STRING
@@ -3672,16 +4019,14 @@ PackFile_Annotations_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *seg))
     ASSERT_ARGS(PackFile_Annotations_destroy)
     PackFile_Annotations * const self = (PackFile_Annotations *)seg;
 
-    /* Free any keys. */
-    if (self->keys)
+    /* Free any keys, groups and entries not used in place. */
+    if (self->keys && !pf_in_image(seg->pf, self->keys))
         mem_gc_free(interp, self->keys);
 
-    /* Free any groups. */
-    if (self->groups)
+    if (self->groups && !pf_in_image(seg->pf, self->groups))
         mem_gc_free(interp, self->groups);
 
-    /* Free any entries. */
-    if (self->entries)
+    if (self->entries && !pf_in_image(seg->pf, self->entries))
         mem_gc_free(interp, self->entries);
 
     self->keys    = NULL;
@@ -3769,6 +4114,51 @@ PackFile_Annotations_pack(SHIM_INTERP, ARGIN(PackFile_Segment *seg),
 }
 
 
+/*
+
+=item C<static const opcode_t * annotations_unpack_in_place(PackFile_Annotations
+*self, const opcode_t *cursor)>
+
+Points the keys, groups and entries of an annotations segment into the image
+of a packfile used in place, whose records have the layout of the structs.
+Returns NULL if a table runs past the end of the file.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const opcode_t *
+annotations_unpack_in_place(ARGMOD(PackFile_Annotations *self),
+        ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(annotations_unpack_in_place)
+    DECL_CONST_CAST_OF(opcode_t);
+    PackFile * const pf = self->base.pf;
+
+    self->num_keys = *cursor++;
+    if ((size_t)self->num_keys * 2 + 1 > pf_words_left(pf, cursor))
+        return NULL;
+    self->keys     = (PackFile_Annotations_Key *)PARROT_const_cast(opcode_t *, cursor);
+    cursor        += self->num_keys * 2;
+
+    self->num_groups = *cursor++;
+    if ((size_t)self->num_groups * 2 + 1 > pf_words_left(pf, cursor))
+        return NULL;
+    self->groups     = (PackFile_Annotations_Group *)PARROT_const_cast(opcode_t *, cursor);
+    cursor          += self->num_groups * 2;
+
+    self->num_entries = *cursor++;
+    if ((size_t)self->num_entries * 3 > pf_words_left(pf, cursor))
+        return NULL;
+    self->entries     = (PackFile_Annotations_Entry *)PARROT_const_cast(opcode_t *, cursor);
+    cursor           += self->num_entries * 3;
+
+    return cursor;
+}
+
+
 /*
 
 =item C<const opcode_t * PackFile_Annotations_unpack(PARROT_INTERP,
@@ -3780,7 +4170,7 @@ Unpacks this segment from the bytecode.
 
 */
 
-PARROT_CANNOT_RETURN_NULL
+PARROT_CAN_RETURN_NULL
 const opcode_t *
 PackFile_Annotations_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
         ARGIN(const opcode_t *cursor))
@@ -3794,6 +4184,13 @@ PackFile_Annotations_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
 #endif
     INTVAL               i, str_len;
 
+    if (PF_IN_PLACE(seg->pf)) {
+        cursor = annotations_unpack_in_place(self, cursor);
+        if (!cursor)
+            return NULL;
+        goto find_code;
+    }
+
     /* Unpack keys. */
     self->num_keys = PF_fetch_opcode(seg->pf, &cursor);
 
@@ -3838,6 +4235,7 @@ PackFile_Annotations_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
         entry->value           = PF_fetch_opcode(seg->pf, &cursor);
     }
 
+  find_code:
     /* Need to associate this segment with the applicable code segment. */
     str_len     = Parrot_str_length(interp, self->base.name);
     code_name   = STRING_substr(interp, self->base.name, 0, str_len - 4);
@@ -3948,6 +4346,10 @@ PackFile_Annotations_add_group(PARROT_INTERP, ARGMOD(PackFile_Annotations *self)
     PackFile_Annotations_Group *group;
 
     /* Allocate extra space for the group in the groups array. */
+    self->groups = (PackFile_Annotations_Group *)unshare_in_place(interp,
+            self->base.pf, self->groups,
+            self->num_groups * sizeof (PackFile_Annotations_Group));
+
     if (self->groups)
         self->groups = mem_gc_realloc_n_typed_zeroed(interp, self->groups,
             1 + self->num_groups, self->num_groups, PackFile_Annotations_Group);
@@ -4002,6 +4404,10 @@ PackFile_Annotations_add_entry(PARROT_INTERP, ARGMOD(PackFile_Annotations *self)
 
     if (key_id == -1) {
         /* We do have it. Add key entry. */
+        self->keys = (PackFile_Annotations_Key *)unshare_in_place(interp,
+                self->base.pf, self->keys,
+                self->num_keys * sizeof (PackFile_Annotations_Key));
+
         if (self->keys)
             self->keys = mem_gc_realloc_n_typed_zeroed(interp, self->keys,
                     1 + self->num_keys, self->num_keys, PackFile_Annotations_Key);
@@ -4026,6 +4432,10 @@ PackFile_Annotations_add_entry(PARROT_INTERP, ARGMOD(PackFile_Annotations *self)
     }
 
     /* Add annotations entry. */
+    self->entries = (PackFile_Annotations_Entry *)unshare_in_place(interp,
+            self->base.pf, self->entries,
+            self->num_entries * sizeof (PackFile_Annotations_Entry));
+
     if (self->entries)
         self->entries = mem_gc_realloc_n_typed(interp, self->entries,
                 1 + self->num_entries, PackFile_Annotations_Entry);
@@ -4220,11 +4630,10 @@ compile_or_load_file(PARROT_INTERP, ARGIN(STRING *path),
             Parrot_ex_throw_from_c_args(interp, NULL, 1,
                 "Unable to append PBC to the current directory");
 
-        mem_gc_free(interp, pf->header);
-        pf->header = NULL;
         mem_gc_free(interp, pf->dirp);
         pf->dirp   = NULL;
-        /* no need to free pf here, as directory_destroy will get it */
+        /* no need to free pf here, as directory_destroy will get it; the
+         * header stays until then, lazy constants are thawed through it */
     }
     else {
         STRING *err;
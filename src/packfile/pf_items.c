@@ -946,6 +946,7 @@ fetch_op_le_8(ARGIN(const unsigned char *b))
 =item C<opcode_t PF_fetch_opcode(const PackFile *pf, const opcode_t **stream)>
 
 Fetches an C<opcode_t> from the stream, converting byteorder if needed.
+Native packfiles have no C<fetch_op> and are read directly.
 
 When used for freeze/thaw the C<pf> argument might be NULL.
 
@@ -1340,6 +1341,10 @@ PF_fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
                     "Invalid encoding number '%d' specified", encoding_nr);
 
+    /* strings of a packfile used in place point into its mapping */
+    if (pf && PF_IN_PLACE(pf))
+        flags |= PObj_external_FLAG;
+
     if (size || (encoding != CONST_STRING(interp, "")->encoding))
         s = Parrot_str_new_init(interp, (const char *)*cursor, size,
                 encoding, flags);
@@ -1628,6 +1633,10 @@ PackFile_assign_transforms(ARGMOD(PackFile *pf))
             pf->fetch_op = fetch_op_be_8;
         pf->fetch_iv = pf->fetch_op;
 
+        /* native opcodes are read in place, see PF_fetch_opcode */
+        if (!need_wordsize)
+            pf->fetch_op = NULL;
+
         switch (pf->header->floattype) {
 #  if NUMVAL_SIZE == 8
           case FLOATTYPE_8: /* native */
@@ -1719,6 +1728,10 @@ PackFile_assign_transforms(ARGMOD(PackFile *pf))
             pf->fetch_op = fetch_op_le_8;
         pf->fetch_iv = pf->fetch_op;
 
+        /* native opcodes are read in place, see PF_fetch_opcode */
+        if (!need_wordsize)
+            pf->fetch_op = NULL;
+
         switch (pf->header->floattype) {
 #  if NUMVAL_SIZE == 8
           case FLOATTYPE_8: /* native */
@@ -169,7 +169,7 @@ PackFile_ConstTable_pack_size(PARROT_INTERP, ARGIN(PackFile_Segment *seg))
         size += PF_size_string(self->str.constants[i]);
 
     for (i = 0; i < self->pmc.const_count; i++) {
-        PMC *c = self->pmc.constants[i];
+        PMC *c = PackFile_ConstTable_get_pmc(interp, self, i);
         size += PF_size_strlen(Parrot_freeze_pbc_size(interp, c, self)) - 1;
     }
 
@@ -215,7 +215,7 @@ PackFile_ConstTable_pack(PARROT_INTERP,
         cursor = PF_store_string(cursor, self->str.constants[i]);
 
     for (i = 0; i < self->pmc.const_count; i++) {
-        PMC *c = self->pmc.constants[i];
+        PMC *c = PackFile_ConstTable_get_pmc(interp, self, i);
         cursor   = Parrot_freeze_pbc(interp, c, self, cursor);
     }
 
@@ -447,7 +447,8 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         }
 
         for (j = 0; j < in_seg->pmc.const_count; j++) {
-            PMC *v = pmc_constants[pmc_cursor] = in_seg->pmc.constants[j];
+            PMC *v = pmc_constants[pmc_cursor] =
+                PackFile_ConstTable_get_pmc(interp, in_seg, j);
             inputs[i]->pmc.const_map[j] = pmc_cursor;
             pmc_cursor++;
 
@@ -691,7 +692,7 @@ pbc_fixup_bytecode(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
             op_func == core_ops->op_func_table[PARROT_OP_get_params_pc]  ||
             op_func == core_ops->op_func_table[PARROT_OP_set_returns_pc]) {
             /* Get the signature. */
-            PMC * const sig = bc->const_table->pmc.constants[op_ptr[1]];
+            PMC * const sig = PackFile_ConstTable_get_pmc(interp, bc->const_table, op_ptr[1]);
 
             /* Loop over the arguments to locate any that need a fixup. */
             const int sig_items = VTABLE_elements(interp, sig);
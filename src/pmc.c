@@ -259,6 +259,8 @@ Parrot_pmc_reuse_noinit(PARROT_INTERP, ARGIN(PMC *pmc), INTVAL new_type)
         /* Free the old PMC resources. */
         Parrot_pmc_destroy(interp, pmc);
 
+        /* New attributes will be young */
+        PARROT_GC_WRITE_BARRIER(interp, pmc);
         PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG);
 
         /* Set the right vtable */
@@ -304,6 +306,8 @@ Parrot_pmc_reuse_by_class(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(PMC *class_), U
 
         Parrot_pmc_destroy(interp, pmc);
 
+        /* New attributes will be young */
+        PARROT_GC_WRITE_BARRIER(interp, pmc);
         PObj_flags_SETTO(pmc, PObj_is_PMC_FLAG | flags);
 
         /* Set the right vtable */
@@ -59,6 +59,27 @@ Parrot_freeze(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<void Parrot_freeze_to_handle(PARROT_INTERP, PMC *pmc, PMC *handle)>
+
+Freezes C<pmc> and writes the image to C<handle> in chunks of
+C<IMAGE_CHUNK_BYTES>, so that the image is never held in memory at once.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_freeze_to_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_freeze_to_handle)
+    PMC * const image = Parrot_pmc_new_init(interp, enum_class_ImageIOFreeze, handle);
+    VTABLE_set_pmc(interp, image, pmc);
+}
+
+
 /*
 
 =item C<opcode_t * Parrot_freeze_pbc(PARROT_INTERP, PMC *pmc, const
@@ -230,6 +251,61 @@ Parrot_thaw(PARROT_INTERP, ARGIN(STRING *image))
 }
 
 
+/*
+
+=item C<PMC * Parrot_thaw_from_handle(PARROT_INTERP, PMC *handle)>
+
+Reads an image written by C<Parrot_freeze_to_handle> from C<handle> and
+thaws it.  GC is blocked as in C<Parrot_thaw>.  A stream can end early or
+carry garbage, so exceptions thrown while thawing unblock GC before they are
+passed on.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_thaw_from_handle(PARROT_INTERP, ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_thaw_from_handle)
+    PMC            * const info    = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+    PMC            * const ctx     = CURRENT_CONTEXT(interp);
+    Parrot_runloop * const runloop = interp->current_runloop;
+    Parrot_runloop         jump_point;
+    PMC                   *result;
+
+    if (setjmp(jump_point.resume)) {
+        PMC * const exception = jump_point.exception;
+
+        /* Leave runloops and contexts of thaw methods written in PIR */
+        while (interp->current_runloop != runloop)
+            free_runloop_jump_point(interp);
+        CURRENT_CONTEXT(interp) = ctx;
+
+        Parrot_cx_delete_handler_local(interp, CONST_STRING(interp, "exception"));
+        Parrot_unblock_GC_mark(interp);
+        Parrot_unblock_GC_sweep(interp);
+        Parrot_ex_rethrow_from_c(interp, exception);
+    }
+
+    Parrot_ex_add_c_handler(interp, &jump_point);
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    VTABLE_set_pmc(interp, info, handle);
+    result = VTABLE_get_pmc(interp, info);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+    Parrot_cx_delete_handler_local(interp, CONST_STRING(interp, "exception"));
+
+    return result;
+}
+
+
 /*
 
 =item C<PMC* Parrot_thaw_pbc(PARROT_INTERP, PackFile_ConstTable *ct, const
@@ -327,11 +403,12 @@ Parrot_visit_loop_visit(PARROT_INTERP, ARGIN(PMC *info))
                     EXCEPTION_MALFORMED_PACKFILE,
                     "NULL current PMC at %d in visit_loop_todo_list - %s",
                     (int) i,
-                    action == VISIT_FREEZE_NORMAL ? "feeze" : "thaw");
+                    (action & VISIT_HOW_MASK) == VISIT_HOW_PMC_TO_VISITOR
+                    ? "feeze" : "thaw");
 
         PARROT_ASSERT(current->vtable);
 
-        if (action == VISIT_FREEZE_NORMAL)
+        if ((action & VISIT_HOW_MASK) == VISIT_HOW_PMC_TO_VISITOR)
             VTABLE_freeze(interp, current, info);
         else
             VTABLE_thaw(interp, current, info);
@@ -339,6 +416,10 @@ Parrot_visit_loop_visit(PARROT_INTERP, ARGIN(PMC *info))
         VTABLE_visit(interp, current, info);
 
         VISIT_PMC(interp, info, PMC_metadata(current));
+
+        /* the state a snapshot keeps beyond what freeze stores */
+        if (action & VISIT_SNAPSHOT)
+            Parrot_snapshot_visit(interp, current, info);
     }
 }
 
@@ -67,6 +67,9 @@ Parrot_runcore_init(PARROT_INTERP)
 
     Parrot_runcore_slow_init(interp);
     Parrot_runcore_fast_init(interp);
+#ifdef PARROT_HAS_COMPUTED_GOTO
+    Parrot_runcore_cgoto_init(interp);
+#endif
 
     Parrot_runcore_exec_init(interp);
     Parrot_runcore_gc_debug_init(interp);
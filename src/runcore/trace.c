@@ -314,7 +314,7 @@ trace_op_dump(PARROT_INTERP,
     ||  OPCODE_IS(interp, interp->code, *pc, core_ops, PARROT_OP_get_results_pc)
     ||  OPCODE_IS(interp, interp->code, *pc, core_ops, PARROT_OP_get_params_pc)
     ||  OPCODE_IS(interp, interp->code, *pc, core_ops, PARROT_OP_set_returns_pc)) {
-        sig = interp->code->const_table->pmc.constants[pc[1]];
+        sig = PackFile_ConstTable_get_pmc(interp, interp->code->const_table, pc[1]);
 
         if (!sig)
             Parrot_ex_throw_from_c_args(interp, NULL, 1,
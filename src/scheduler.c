@@ -23,6 +23,7 @@ exceptions, async I/O, and concurrent tasks (threads).
 #include "pmc/pmc_scheduler.h"
 #include "pmc/pmc_task.h"
 #include "pmc/pmc_timer.h"
+#include "pmc/pmc_iotask.h"
 
 #include "scheduler.str"
 
@@ -142,6 +143,9 @@ Parrot_cx_handle_tasks(PARROT_INTERP, ARGMOD(PMC *scheduler))
             else if (STRING_equal(interp, type, CONST_STRING(interp, "timer"))) {
                 Parrot_cx_timer_invoke(interp, task);
             }
+            else if (STRING_equal(interp, type, CONST_STRING(interp, "io"))) {
+                Parrot_cx_io_invoke(interp, task);
+            }
             else if (STRING_equal(interp, type, CONST_STRING(interp, "event"))) {
                 PMC * const handler = Parrot_cx_find_handler_for_task(interp, task);
                 if (!PMC_IS_NULL(handler)) {
@@ -172,8 +176,8 @@ Parrot_cx_handle_tasks(PARROT_INTERP, ARGMOD(PMC *scheduler))
 =item C<void Parrot_cx_refresh_task_list(PARROT_INTERP, PMC *scheduler)>
 
 Tell the scheduler to perform maintenance on its list of active tasks, checking
-for completed timers or sleep events, sorting for priority, checking for
-messages, etc.
+for completed timers or sleep events, finished asynchronous I/O, sorting for
+priority, checking for messages, etc.
 
 =cut
 
@@ -186,6 +190,9 @@ Parrot_cx_refresh_task_list(PARROT_INTERP, ARGMOD(PMC *scheduler))
     scheduler_process_wait_list(interp, scheduler);
     scheduler_process_messages(interp, scheduler);
 
+    if (Parrot_io_reactor_pending(interp, scheduler))
+        Parrot_io_reactor_poll(interp, scheduler, 0.0);
+
     /* TODO: Sort the task list index */
 
     SCHEDULER_cache_valid_SET(scheduler);
@@ -966,6 +973,27 @@ Parrot_cx_timer_invoke(PARROT_INTERP, ARGIN(PMC *timer))
 
 /*
 
+=item C<void Parrot_cx_io_invoke(PARROT_INTERP, PMC *task)>
+
+Run the associated code block for an IOTask, passing it the task, when its
+operation finished.
+
+=cut
+
+*/
+
+void
+Parrot_cx_io_invoke(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_io_invoke)
+    Parrot_IOTask_attributes * const task_struct = PARROT_IOTASK(task);
+    if (!PMC_IS_NULL(task_struct->codeblock)) {
+        Parrot_ext_call(interp, task_struct->codeblock, "P->", task);
+    }
+}
+
+/*
+
 =item C<void Parrot_cx_invoke_callback(PARROT_INTERP, PMC *callback)>
 
 Run the associated code block for a callback event.
@@ -1019,6 +1047,17 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
      * pending tasks. */
     Parrot_cx_runloop_wake(interp, interp->scheduler);
 
+    /* Sleep in the reactor, so asynchronous I/O goes on meanwhile. */
+    if (Parrot_io_reactor_pending(interp, interp->scheduler)) {
+        const FLOATVAL start = Parrot_floatval_time();
+
+        Parrot_cx_run_io(interp, PMCNULL, time);
+
+        time -= Parrot_floatval_time() - start;
+        if (time <= 0.0)
+            return next;
+    }
+
 #ifdef PARROT_HAS_THREADS
     {
         Parrot_cond condition;
@@ -1051,6 +1090,47 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
 }
 
 
+/*
+
+=item C<void Parrot_cx_run_io(PARROT_INTERP, PMC *task, FLOATVAL time)>
+
+Waits for asynchronous I/O and handles the tasks it finishes, until C<task>
+finished, or for up to C<time> seconds if C<task> is null.  Returns early when
+no I/O is left to wait for.  Called by the C<sleep>
+opcode and by C<IOTask.wait>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_cx_run_io(PARROT_INTERP, ARGIN_NULLOK(PMC *task), FLOATVAL time)
+{
+    ASSERT_ARGS(Parrot_cx_run_io)
+    PMC * const    scheduler = interp->scheduler;
+    const FLOATVAL end       = Parrot_floatval_time() + time;
+
+    for (;;) {
+        FLOATVAL timeout = -1.0;
+
+        if (!PMC_IS_NULL(task)) {
+            if (VTABLE_get_bool(interp, task)
+            ||  !Parrot_io_reactor_pending(interp, scheduler))
+                break;
+        }
+        else {
+            timeout = end - Parrot_floatval_time();
+            if (timeout <= 0.0
+            ||  !Parrot_io_reactor_pending(interp, scheduler))
+                break;
+        }
+
+        if (Parrot_io_reactor_poll(interp, scheduler, timeout) > 0)
+            Parrot_cx_handle_tasks(interp, scheduler);
+    }
+}
+
 /*
 
 =back
@@ -0,0 +1,2160 @@
+/*
+Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+src/snapshot.c - Interpreter snapshots
+
+=head1 DESCRIPTION
+
+A snapshot saves the state an interpreter built while starting up: the loaded
+bytecode, the namespaces and their globals, the classes, the HLLs with their
+type maps and the loaded libraries.  Restoring it replaces running the code
+which built that state, which is what makes a compiler start quickly.
+
+The file starts with a C<Snapshot_Header> and a table of the packfiles, which
+follow it 16 byte aligned.  The restoring side maps the file read-only and
+unpacks the packfiles in place, like any other mapped bytecode.  Then comes a
+preamble, frozen with C<Parrot_freeze>, with what has to be in place before
+any PMC is thawed: the HLLs, the type numbers of the dynamic PMCs and classes,
+the libraries and the search paths.  Last is the image of the PMCs, frozen
+with an C<ImageIOFreeze> which refers to the "externs" by number only.
+
+Externs are the PMCs a fresh interpreter creates by itself: the namespaces,
+NCI functions, standard handles, loaded libraries and the interpreter globals.
+The preamble keeps a path to each of them, which the restoring side looks up
+again.  After thawing a fixup pass links the Subs to their mapped bytecode,
+gives the packfiles their constants and puts the classes, globals and methods
+back in place.  C<:load> and C<:init> Subs are not run again.
+
+A snapshot is only valid for the Parrot build which saved it.  Its header
+records the version, the bytecode version and the core PMCs of that build.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/dynext.h"
+#include "parrot/oo_private.h"
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_coroutine.h"
+#include "pmc/pmc_class.h"
+#include "pmc/pmc_namespace.h"
+#include "snapshot.str"
+
+/* HEADERIZER HFILE: include/parrot/pmc_freeze.h */
+
+#define SNAPSHOT_MAGIC "\376PSN\r\n\032\n"
+#define SNAPSHOT_ALIGN 16
+
+typedef struct Snapshot_Header {
+    unsigned char magic[8];
+    opcode_t      wordsize;       /* sizeof (opcode_t) */
+    opcode_t      floatsize;      /* sizeof (FLOATVAL) */
+    opcode_t      bigendian;
+    opcode_t      version[3];     /* Parrot which saved the snapshot */
+    opcode_t      pbc_version[2]; /* its bytecode version, see PBC_COMPAT */
+    opcode_t      core_max;       /* enum_class_core_max */
+    opcode_t      core_types;     /* fingerprint of the core PMC names */
+    opcode_t      n_packfiles;    /* (offset, size) pairs following */
+    opcode_t      preamble;       /* byte offsets and sizes of the images */
+    opcode_t      preamble_size;
+    opcode_t      image;
+    opcode_t      image_size;
+} Snapshot_Header;
+
+/* the parts of the preamble */
+typedef enum {
+    SNAPSHOT_HLLS,          /* names of the HLLs, by id */
+    SNAPSHOT_TYPEMAPS,      /* core => HLL type pairs, by HLL id */
+    SNAPSHOT_TYPES,         /* each type beyond the core ones */
+    SNAPSHOT_LIBS,          /* loaded libraries, in order */
+    SNAPSHOT_LIB_PATHS,
+    SNAPSHOT_PBC_LIBS,
+    SNAPSHOT_EXTERNS,       /* paths to the externs */
+    SNAPSHOT_CLASS_NAMES,   /* class names => type numbers */
+    SNAPSHOT_PREAMBLE_SIZE
+} snapshot_preamble_enum;
+
+/* the parts of the image */
+typedef enum {
+    SNAPSHOT_CONSTANTS,     /* constant tables, by packfile */
+    SNAPSHOT_NAMESPACES,    /* namespace records */
+    SNAPSHOT_CLASSES,       /* classes, aligned with SNAPSHOT_TYPES */
+    SNAPSHOT_PROXIES,       /* methods added to PMCProxy classes */
+    SNAPSHOT_COMPREGS,      /* compilers written in PIR */
+    SNAPSHOT_MULTIS,        /* MultiSubs with native candidates */
+    SNAPSHOT_IMAGE_SIZE
+} snapshot_image_enum;
+
+/* the parts of a namespace record */
+typedef enum {
+    SNAPSHOT_NS,
+    SNAPSHOT_NS_VARS,
+    SNAPSHOT_NS_METHODS,
+    SNAPSHOT_NS_VTABLE,
+    SNAPSHOT_NS_CLASS,
+    SNAPSHOT_NS_SIZE
+} snapshot_ns_enum;
+
+/* an extern path is kind, key, index, then the namespace path */
+#define SNAPSHOT_PATH_NS 3
+
+typedef struct Snapshot_Save {
+    PMC *externs;           /* PMCs the image refers to by number */
+    PMC *paths;             /* how to look up each of the externs */
+    PMC *seen;              /* AddrRegistry of the externs */
+    PMC *ns_records;
+    PMC *proxy_records;
+    PMC *multi_records;
+} Snapshot_Save;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void add_extern(PARROT_INTERP,
+    ARGMOD(Snapshot_Save *save),
+    ARGIN_NULLOK(PMC *pmc),
+    ARGIN(STRING *kind),
+    ARGIN_NULLOK(STRING *key),
+    INTVAL idx,
+    ARGIN_NULLOK(PMC *ns_path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*save);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * box_string(PARROT_INTERP, ARGIN(STRING *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void check_header(PARROT_INTERP,
+    ARGIN(STRING *path),
+    ARGIN(const char *base),
+    size_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void collect_class_names(PARROT_INTERP,
+    ARGIN(PMC *ns),
+    ARGIN(PMC *ns_path),
+    ARGMOD(PMC *names))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*names);
+
+static void collect_externs(PARROT_INTERP,
+    ARGMOD(Snapshot_Save *save),
+    ARGMOD(PMC *libs),
+    ARGMOD(PMC *compregs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*save)
+        FUNC_MODIFIES(*libs)
+        FUNC_MODIFIES(*compregs);
+
+static int collect_multi(PARROT_INTERP,
+    ARGMOD(Snapshot_Save *save),
+    ARGIN(PMC *multi),
+    ARGIN(STRING *key),
+    ARGIN(PMC *ns_path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*save);
+
+static void collect_namespace(PARROT_INTERP,
+    ARGMOD(Snapshot_Save *save),
+    ARGIN(PMC *ns),
+    ARGIN(PMC *ns_path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*save);
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t core_types_fingerprint(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * find_extern(PARROT_INTERP, ARGIN(PMC *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * find_namespace(PARROT_INTERP, ARGIN(PMC *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void install_constants(PARROT_INTERP, ARGIN(PMC *constants))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void install_namespaces(PARROT_INTERP, ARGIN(PMC *records))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void install_registry(PARROT_INTERP,
+    ARGIN(PMC *preamble),
+    ARGIN(PMC *image))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_class_type(PARROT_INTERP, INTVAL type)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_native(ARGIN(const PMC *pmc))
+        __attribute__nonnull__(1);
+
+static void load_types(PARROT_INTERP, ARGIN(PMC *types), ARGIN(PMC *libs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * make_image(PARROT_INTERP,
+    ARGIN(const Snapshot_Save *save),
+    ARGIN(PMC *compregs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * make_preamble(PARROT_INTERP,
+    ARGIN(const Snapshot_Save *save),
+    ARGIN(PMC *libs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void merge_lib_paths(PARROT_INTERP, ARGIN(PMC *saved))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t * pack_packfile(PARROT_INTERP,
+    ARGMOD(PackFile *pf),
+    ARGOUT(size_t *bytes))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pf)
+        FUNC_MODIFIES(*bytes);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PackFile * packfile_at(PARROT_INTERP, INTVAL idx)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL packfile_index(PARROT_INTERP, ARGIN(const PackFile *pf))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int packfile_is_pristine(ARGIN(const PackFile *pf))
+        __attribute__nonnull__(1);
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t snapshot_align(size_t offset);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * snapshot_string(PARROT_INTERP,
+    ARGIN(const char *base),
+    opcode_t offset,
+    opcode_t size)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_add_extern __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(kind))
+#define ASSERT_ARGS_box_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_check_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path) \
+    , PARROT_ASSERT_ARG(base))
+#define ASSERT_ARGS_collect_class_names __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ns) \
+    , PARROT_ASSERT_ARG(ns_path) \
+    , PARROT_ASSERT_ARG(names))
+#define ASSERT_ARGS_collect_externs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(libs) \
+    , PARROT_ASSERT_ARG(compregs))
+#define ASSERT_ARGS_collect_multi __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(multi) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(ns_path))
+#define ASSERT_ARGS_collect_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(ns) \
+    , PARROT_ASSERT_ARG(ns_path))
+#define ASSERT_ARGS_core_types_fingerprint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_find_extern __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_find_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_install_constants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(constants))
+#define ASSERT_ARGS_install_namespaces __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(records))
+#define ASSERT_ARGS_install_registry __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(preamble) \
+    , PARROT_ASSERT_ARG(image))
+#define ASSERT_ARGS_is_class_type __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_is_native __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_load_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(libs))
+#define ASSERT_ARGS_make_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(compregs))
+#define ASSERT_ARGS_make_preamble __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(save) \
+    , PARROT_ASSERT_ARG(libs))
+#define ASSERT_ARGS_merge_lib_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(saved))
+#define ASSERT_ARGS_pack_packfile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(bytes))
+#define ASSERT_ARGS_packfile_at __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_packfile_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_packfile_is_pristine __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pf))
+#define ASSERT_ARGS_snapshot_align __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_snapshot_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static int is_native(const PMC *pmc)>
+
+Returns true if C<pmc> is a function which a library or the core registers
+when it is loaded, so it can't be frozen.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_native(ARGIN(const PMC *pmc))
+{
+    ASSERT_ARGS(is_native)
+
+    return pmc->vtable->base_type == enum_class_NCI
+        || pmc->vtable->base_type == enum_class_NativePCCMethod;
+}
+
+/*
+
+=item C<static PMC * box_string(PARROT_INTERP, STRING *str)>
+
+Returns a String PMC holding C<str>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+box_string(PARROT_INTERP, ARGIN(STRING *str))
+{
+    ASSERT_ARGS(box_string)
+    PMC * const box = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, box, str);
+    return box;
+}
+
+/*
+
+=item C<static int is_class_type(PARROT_INTERP, INTVAL type)>
+
+Returns true if the type number C<type> belongs to a C<Class>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_class_type(PARROT_INTERP, INTVAL type)
+{
+    ASSERT_ARGS(is_class_type)
+    const VTABLE * const vtable = interp->vtables[type];
+
+    return vtable
+        && !PMC_IS_NULL(vtable->pmc_class)
+        && vtable->pmc_class->vtable->base_type == enum_class_Class;
+}
+
+/*
+
+=item C<static PackFile * packfile_at(PARROT_INTERP, INTVAL idx)>
+
+Returns the packfile number C<idx> of a snapshot, or NULL past the last one.
+These are the packfiles restored from an earlier snapshot, then the initial
+packfile and the packfiles loaded into it.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PackFile *
+packfile_at(PARROT_INTERP, INTVAL idx)
+{
+    ASSERT_ARGS(packfile_at)
+    PackFile * const initial = interp->initial_pf;
+    size_t           i;
+
+    if (interp->snapshot_pf) {
+        const PackFile_Directory * const dir = &interp->snapshot_pf->directory;
+
+        for (i = 0; i < dir->num_segments; ++i)
+            if (dir->segments[i]->type == PF_DIR_SEG && idx-- == 0)
+                return dir->segments[i]->pf;
+    }
+
+    if (initial) {
+        if (idx-- == 0)
+            return initial;
+
+        for (i = 0; i < initial->directory.num_segments; ++i) {
+            PackFile_Segment * const seg = initial->directory.segments[i];
+
+            if (seg->type == PF_DIR_SEG && seg->pf != initial && idx-- == 0)
+                return seg->pf;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static INTVAL packfile_index(PARROT_INTERP, const PackFile *pf)>
+
+Returns the number of C<pf> in a snapshot, or -1 if it isn't part of it.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+packfile_index(PARROT_INTERP, ARGIN(const PackFile *pf))
+{
+    ASSERT_ARGS(packfile_index)
+    const PackFile *p;
+    INTVAL          i;
+
+    for (i = 0; (p = packfile_at(interp, i)) != NULL; ++i)
+        if (p == pf)
+            return i;
+
+    return -1;
+}
+
+/*
+
+=item C<void Parrot_snapshot_visit(PARROT_INTERP, PMC *pmc, PMC *info)>
+
+Visits the state of C<pmc> which a snapshot needs beyond what C<freeze> keeps,
+called by the visit loop for every PMC of a snapshot image.  A Sub keeps its
+bytecode segment, namespace and closure contexts, a class its flags.  Types
+whose state lives outside of Parrot, or which the interpreter owns, can't be
+saved, unless they are externs.  Neither can a Coroutine once it has run.
+
+=cut
+
+*/
+
+void
+Parrot_snapshot_visit(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *info))
+{
+    ASSERT_ARGS(Parrot_snapshot_visit)
+    const int freezing = (VTABLE_get_integer(interp, info) & VISIT_HOW_MASK)
+                       == VISIT_HOW_PMC_TO_VISITOR;
+
+    /* a thawing object doesn't know its class yet */
+    if (PObj_is_object_TEST(pmc) || pmc->vtable->base_type == enum_class_Object)
+        return;
+
+    if (freezing) {
+        switch (pmc->vtable->base_type) {
+          case enum_class_Coroutine:
+            {
+                PMC *ctx;
+
+                /* a coroutine which never ran is a plain Sub */
+                GETATTR_Coroutine_ctx(interp, pmc, ctx);
+
+                if (!PMC_IS_NULL(ctx))
+                    Parrot_ex_throw_from_c_args(interp, NULL,
+                        EXCEPTION_INVALID_OPERATION,
+                        "Cannot snapshot a running Coroutine");
+            }
+            break;
+          case enum_class_AddrRegistry:
+          case enum_class_ArrayIterator:
+          case enum_class_BigInt:
+          case enum_class_BigNum:
+          case enum_class_Continuation:
+          case enum_class_Eval:
+          case enum_class_EventHandler:
+          case enum_class_Exception:
+          case enum_class_ExceptionHandler:
+          case enum_class_Exporter:
+          case enum_class_FileHandle:
+          case enum_class_Handle:
+          case enum_class_HashIterator:
+          case enum_class_HashIteratorKey:
+          case enum_class_ImageIOFreeze:
+          case enum_class_ImageIOSize:
+          case enum_class_ImageIOStrings:
+          case enum_class_ImageIOThaw:
+          case enum_class_IOTask:
+          case enum_class_Iterator:
+          case enum_class_ManagedStruct:
+          case enum_class_MappedByteArray:
+          case enum_class_NameSpace:
+          case enum_class_NativePCCMethod:
+          case enum_class_NCI:
+          case enum_class_OpLib:
+          case enum_class_Opcode:
+          case enum_class_OrderedHashIterator:
+          case enum_class_Packfile:
+          case enum_class_PackfileAnnotation:
+          case enum_class_PackfileAnnotations:
+          case enum_class_PackfileConstantTable:
+          case enum_class_PackfileDebug:
+          case enum_class_PackfileDirectory:
+          case enum_class_PackfileRawSegment:
+          case enum_class_PackfileSegment:
+          case enum_class_ParrotInterpreter:
+          case enum_class_ParrotLibrary:
+          case enum_class_ParrotThread:
+          case enum_class_PMCProxy:
+          case enum_class_Pointer:
+          case enum_class_Role:
+          case enum_class_Scheduler:
+          case enum_class_SchedulerMessage:
+          case enum_class_Sockaddr:
+          case enum_class_Socket:
+          case enum_class_StringHandle:
+          case enum_class_StringIterator:
+          case enum_class_Task:
+          case enum_class_ThreadInterpreter:
+          case enum_class_Timer:
+          case enum_class_UnManagedStruct:
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION, "Cannot snapshot a PMC of type %Ss",
+                pmc->vtable->whoami);
+          default:
+            break;
+        }
+    }
+
+    /* a class inheriting from Sub isa Sub too */
+    if (pmc->vtable->base_type == enum_class_Class) {
+        Parrot_Class_attributes * const _class = PARROT_CLASS(pmc);
+        const UINTVAL mask = CLASS_instantiated_FLAG | CLASS_is_anon_FLAG
+                           | CLASS_has_alien_parents_FLAG;
+
+        if (freezing) {
+            VTABLE_push_integer(interp, info, _class->instantiated);
+            VTABLE_push_integer(interp, info, PObj_get_FLAGS(pmc) & mask);
+        }
+        else {
+            _class->instantiated  = VTABLE_shift_integer(interp, info);
+            PObj_get_FLAGS(pmc)  &= ~mask;
+            PObj_get_FLAGS(pmc)  |= VTABLE_shift_integer(interp, info) & mask;
+        }
+    }
+    else if (VTABLE_isa(interp, pmc, CONST_STRING(interp, "Sub"))) {
+        Parrot_Sub_attributes *sub;
+
+        PMC_get_sub(interp, pmc, sub);
+
+        if (freezing) {
+            STRING * const no_seg = CONST_STRING(interp, "");
+            const INTVAL   pf_idx = sub->seg
+                                  ? packfile_index(interp, sub->seg->base.pf)
+                                  : -1;
+
+            if (sub->seg
+            && (pf_idx < 0
+            ||  PackFile_find_segment(interp, &sub->seg->base.pf->directory,
+                    sub->seg->base.name, 0) != &sub->seg->base))
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "Cannot snapshot a Sub compiled at runtime");
+
+            VTABLE_push_integer(interp, info, pf_idx);
+            VTABLE_push_string(interp, info,
+                sub->seg ? sub->seg->base.name : no_seg);
+            VTABLE_push_integer(interp, info,
+                PObj_get_FLAGS(pmc) & SUB_FLAG_IS_OUTER);
+        }
+        else {
+            const INTVAL   pf_idx = VTABLE_shift_integer(interp, info);
+            STRING * const name   = VTABLE_shift_string(interp, info);
+            const INTVAL   flags  = VTABLE_shift_integer(interp, info);
+
+            if (pf_idx >= 0) {
+                PackFile * const  pf  = packfile_at(interp, pf_idx);
+                PackFile_Segment *seg = pf
+                                      ? PackFile_find_segment(interp,
+                                            &pf->directory, name, 0)
+                                      : NULL;
+
+                if (!seg || seg->type != PF_BYTEC_SEG)
+                    Parrot_ex_throw_from_c_args(interp, NULL,
+                        EXCEPTION_MALFORMED_PACKFILE,
+                        "Snapshot has no bytecode segment '%Ss'", name);
+
+                sub->seg = (PackFile_ByteCode *)seg;
+            }
+
+            PObj_get_FLAGS(pmc) |= flags & SUB_FLAG_IS_OUTER;
+        }
+
+        VISIT_PMC(interp, info, sub->namespace_stash);
+        VISIT_PMC(interp, info, sub->outer_ctx);
+        VISIT_PMC(interp, info, sub->ctx);
+    }
+}
+
+/*
+
+=item C<static void add_extern(PARROT_INTERP, Snapshot_Save *save, PMC *pmc,
+STRING *kind, STRING *key, INTVAL idx, PMC *ns_path)>
+
+Adds C<pmc> to the externs, unless it is one already.  The path to look it up
+again is made of C<kind>, C<key>, C<idx> and the namespace path C<ns_path>,
+each of them optional.
+
+=cut
+
+*/
+
+static void
+add_extern(PARROT_INTERP, ARGMOD(Snapshot_Save *save), ARGIN_NULLOK(PMC *pmc),
+        ARGIN(STRING *kind), ARGIN_NULLOK(STRING *key), INTVAL idx,
+        ARGIN_NULLOK(PMC *ns_path))
+{
+    ASSERT_ARGS(add_extern)
+    STRING * const empty = CONST_STRING(interp, "");
+    PMC           *path;
+
+    if (PMC_IS_NULL(pmc) || VTABLE_get_integer_keyed(interp, save->seen, pmc))
+        return;
+
+    path = PMC_IS_NULL(ns_path)
+         ? Parrot_pmc_new(interp, enum_class_ResizableStringArray)
+         : VTABLE_clone(interp, ns_path);
+
+    VTABLE_unshift_string(interp, path,
+        idx >= 0 ? Parrot_str_from_int(interp, idx) : empty);
+    VTABLE_unshift_string(interp, path, key ? key : empty);
+    VTABLE_unshift_string(interp, path, kind);
+
+    VTABLE_set_pmc_keyed(interp, save->seen, pmc, PMCNULL);
+    VTABLE_push_pmc(interp, save->externs, pmc);
+    VTABLE_push_pmc(interp, save->paths, path);
+}
+
+/*
+
+=item C<static int collect_multi(PARROT_INTERP, Snapshot_Save *save, PMC *multi,
+STRING *key, PMC *ns_path)>
+
+Adds the native candidates of the MultiSub C<multi> to the externs, numbered
+among the native candidates only, and returns whether there were any.  A
+MultiSub with native and other candidates gets a record to fill it again.
+
+=cut
+
+*/
+
+static int
+collect_multi(PARROT_INTERP, ARGMOD(Snapshot_Save *save), ARGIN(PMC *multi),
+        ARGIN(STRING *key), ARGIN(PMC *ns_path))
+{
+    ASSERT_ARGS(collect_multi)
+    PMC * const  candidates = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    const INTVAL n          = VTABLE_elements(interp, multi);
+    INTVAL       natives    = 0;
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const candidate = VTABLE_get_pmc_keyed_int(interp, multi, i);
+
+        if (is_native(candidate))
+            add_extern(interp, save, candidate, CONST_STRING(interp, "multi"),
+                key, natives++, ns_path);
+
+        VTABLE_push_pmc(interp, candidates, candidate);
+    }
+
+    if (natives && natives < n) {
+        PMC * const record = Parrot_pmc_new_init_int(interp,
+                                enum_class_FixedPMCArray, 2);
+
+        VTABLE_set_pmc_keyed_int(interp, record, 0, multi);
+        VTABLE_set_pmc_keyed_int(interp, record, 1, candidates);
+        VTABLE_push_pmc(interp, save->multi_records, record);
+    }
+
+    return natives > 0;
+}
+
+/*
+
+=item C<static void collect_namespace(PARROT_INTERP, Snapshot_Save *save, PMC
+*ns, PMC *ns_path)>
+
+Adds the namespace C<ns>, its native functions and those of its nested
+namespaces to the externs.  A namespace holding anything else gets a record
+with its globals, methods, vtable overrides and class.
+
+=cut
+
+*/
+
+static void
+collect_namespace(PARROT_INTERP, ARGMOD(Snapshot_Save *save), ARGIN(PMC *ns),
+        ARGIN(PMC *ns_path))
+{
+    ASSERT_ARGS(collect_namespace)
+    Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(ns);
+    const Hash * const hash = (const Hash *)VTABLE_get_pointer(interp, ns);
+    PMC        * const keys = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    PMC        * const vars = Parrot_pmc_new(interp, enum_class_Hash);
+    int                 keep = 0;
+    INTVAL              i, n;
+
+    add_extern(interp, save, ns, CONST_STRING(interp, "ns"), NULL, -1, ns_path);
+
+    parrot_hash_iterate(hash,
+        VTABLE_push_string(interp, keys, (STRING *)_bucket->key););
+
+    n = VTABLE_elements(interp, keys);
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key   = VTABLE_get_string_keyed_int(interp, keys, i);
+        PMC    * const child = VTABLE_get_pmc_keyed_str(interp, ns, key);
+        PMC    * const var   = (PMC *)VTABLE_get_pointer_keyed_str(interp, ns, key);
+
+        if (!PMC_IS_NULL(var) && var->vtable->base_type != enum_class_NameSpace) {
+            if (is_native(var)
+            || (var->vtable->base_type == enum_class_MultiSub
+            &&  collect_multi(interp, save, var, key, ns_path)))
+                add_extern(interp, save, var, CONST_STRING(interp, "var"),
+                    key, -1, ns_path);
+            else
+                VTABLE_set_pmc_keyed_str(interp, vars, key, var);
+        }
+
+        if (!PMC_IS_NULL(child)
+        &&  child->vtable->base_type == enum_class_NameSpace
+        &&  PARROT_NAMESPACE(child)->parent == ns
+        &&  STRING_equal(interp, PARROT_NAMESPACE(child)->name, key)) {
+            PMC * const child_path = VTABLE_clone(interp, ns_path);
+
+            VTABLE_push_string(interp, child_path, key);
+            collect_namespace(interp, save, child, child_path);
+        }
+    }
+
+    if (!PMC_IS_NULL(nsinfo->methods)) {
+        PMC * const iter = VTABLE_get_iter(interp, nsinfo->methods);
+
+        while (VTABLE_get_bool(interp, iter)) {
+            STRING * const key    = VTABLE_shift_string(interp, iter);
+            PMC    * const method = VTABLE_get_pmc_keyed_str(interp,
+                                        nsinfo->methods, key);
+
+            if (is_native(method))
+                add_extern(interp, save, method, CONST_STRING(interp, "method"),
+                    key, -1, ns_path);
+            else
+                keep = 1;
+        }
+    }
+
+    if (!PMC_IS_NULL(nsinfo->vtable) && VTABLE_elements(interp, nsinfo->vtable))
+        keep = 1;
+
+    if (PMC_IS_NULL(nsinfo->_class))
+        ; /* nothing attached */
+    else if (nsinfo->_class->vtable->base_type == enum_class_PMCProxy) {
+        PMC * const proxy   = nsinfo->_class;
+        PMC * const methods = PARROT_CLASS(proxy)->methods;
+        PMC * const added   = Parrot_pmc_new(interp, enum_class_Hash);
+        PMC * const iter    = VTABLE_get_iter(interp, methods);
+
+        add_extern(interp, save, proxy, CONST_STRING(interp, "proxy"),
+            NULL, -1, ns_path);
+
+        while (VTABLE_get_bool(interp, iter)) {
+            STRING * const key    = VTABLE_shift_string(interp, iter);
+            PMC    * const method = VTABLE_get_pmc_keyed_str(interp, methods, key);
+
+            if (!is_native(method))
+                VTABLE_set_pmc_keyed_str(interp, added, key, method);
+        }
+
+        if (VTABLE_elements(interp, added)) {
+            PMC * const record = Parrot_pmc_new_init_int(interp,
+                                    enum_class_FixedPMCArray, 2);
+
+            VTABLE_set_pmc_keyed_int(interp, record, 0, proxy);
+            VTABLE_set_pmc_keyed_int(interp, record, 1, added);
+            VTABLE_push_pmc(interp, save->proxy_records, record);
+        }
+    }
+    else
+        keep = 1;
+
+    if (keep || VTABLE_elements(interp, vars)) {
+        PMC * const record = Parrot_pmc_new_init_int(interp,
+                                enum_class_FixedPMCArray, SNAPSHOT_NS_SIZE);
+
+        VTABLE_set_pmc_keyed_int(interp, record, SNAPSHOT_NS, ns);
+        VTABLE_set_pmc_keyed_int(interp, record, SNAPSHOT_NS_VARS, vars);
+        VTABLE_set_pmc_keyed_int(interp, record, SNAPSHOT_NS_METHODS,
+            nsinfo->methods);
+        VTABLE_set_pmc_keyed_int(interp, record, SNAPSHOT_NS_VTABLE,
+            nsinfo->vtable);
+        VTABLE_set_pmc_keyed_int(interp, record, SNAPSHOT_NS_CLASS,
+            nsinfo->_class);
+        VTABLE_push_pmc(interp, save->ns_records, record);
+    }
+}
+
+/*
+
+=item C<static void collect_class_names(PARROT_INTERP, PMC *ns, PMC *ns_path,
+PMC *names)>
+
+Appends the names of the classes in the class name registry C<ns> to
+C<names>, as pairs of the key path and the type number.
+
+=cut
+
+*/
+
+static void
+collect_class_names(PARROT_INTERP, ARGIN(PMC *ns), ARGIN(PMC *ns_path),
+        ARGMOD(PMC *names))
+{
+    ASSERT_ARGS(collect_class_names)
+    const Hash * const hash = (const Hash *)VTABLE_get_pointer(interp, ns);
+    PMC        * const keys = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    INTVAL              i, n;
+
+    parrot_hash_iterate(hash,
+        VTABLE_push_string(interp, keys, (STRING *)_bucket->key););
+
+    n = VTABLE_elements(interp, keys);
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key   = VTABLE_get_string_keyed_int(interp, keys, i);
+        PMC    * const child = VTABLE_get_pmc_keyed_str(interp, ns, key);
+        PMC    * const item  = (PMC *)VTABLE_get_pointer_keyed_str(interp, ns, key);
+        PMC    * const path  = VTABLE_clone(interp, ns_path);
+
+        VTABLE_push_string(interp, path, key);
+
+        if (!PMC_IS_NULL(item) && item->vtable->base_type == enum_class_Integer) {
+            const INTVAL type = VTABLE_get_integer(interp, item);
+
+            if (type >= enum_class_core_max && type < interp->n_vtable_max
+            &&  is_class_type(interp, type)) {
+                PMC * const pair = Parrot_pmc_new_init_int(interp,
+                                    enum_class_FixedPMCArray, 2);
+
+                VTABLE_set_pmc_keyed_int(interp, pair, 0, path);
+                VTABLE_set_pmc_keyed_int(interp, pair, 1, item);
+                VTABLE_push_pmc(interp, names, pair);
+            }
+        }
+
+        if (!PMC_IS_NULL(child) && child->vtable->base_type == enum_class_NameSpace)
+            collect_class_names(interp, child, path, names);
+    }
+}
+
+/*
+
+=item C<static void collect_externs(PARROT_INTERP, Snapshot_Save *save, PMC
+*libs, PMC *compregs)>
+
+Collects the externs of the interpreter into C<save>, the keys of the loaded
+libraries into C<libs> and the compilers written in PIR into C<compregs>.
+
+=cut
+
+*/
+
+static void
+collect_externs(PARROT_INTERP, ARGMOD(Snapshot_Save *save), ARGMOD(PMC *libs),
+        ARGMOD(PMC *compregs))
+{
+    ASSERT_ARGS(collect_externs)
+    PMC * const dyn_libs = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_DYN_LIBS);
+    PMC * const compreg  = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_COMPREG_HASH);
+    PMC        *iter;
+    INTVAL      i;
+
+    add_extern(interp, save, interp->iglobals, CONST_STRING(interp, "iglobals"),
+        NULL, -1, PMCNULL);
+
+    /* the arguments and executable name belong to the run, not the state */
+    for (i = 0; i < IGLOBALS_SIZE; ++i) {
+        STRING * const kind = CONST_STRING(interp, "iglobal");
+
+        if (i != IGLOBALS_ARGV_LIST && i != IGLOBALS_EXECUTABLE)
+            add_extern(interp, save,
+                VTABLE_get_pmc_keyed_int(interp, interp->iglobals, i),
+                kind, NULL, i, PMCNULL);
+    }
+
+    for (i = 0; i < 3; ++i) {
+        STRING * const kind = CONST_STRING(interp, "std");
+
+        add_extern(interp, save, Parrot_io_stdhandle(interp, i, PMCNULL),
+            kind, NULL, i, PMCNULL);
+    }
+
+    collect_namespace(interp, save, interp->root_namespace,
+        Parrot_pmc_new(interp, enum_class_ResizableStringArray));
+
+    iter = VTABLE_get_iter(interp, dyn_libs);
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const kind = CONST_STRING(interp, "lib");
+        STRING * const key  = VTABLE_shift_string(interp, iter);
+
+        VTABLE_push_string(interp, libs, key);
+        add_extern(interp, save, VTABLE_get_pmc_keyed_str(interp, dyn_libs, key),
+            kind, key, -1, PMCNULL);
+    }
+
+    iter = VTABLE_get_iter(interp, compreg);
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const key      = VTABLE_shift_string(interp, iter);
+        PMC    * const compiler = VTABLE_get_pmc_keyed_str(interp, compreg, key);
+
+        if (is_native(compiler))
+            add_extern(interp, save, compiler, CONST_STRING(interp, "compreg"),
+                key, -1, PMCNULL);
+        else
+            VTABLE_set_pmc_keyed_str(interp, compregs, key, compiler);
+    }
+}
+
+/*
+
+=item C<static PMC * make_preamble(PARROT_INTERP, const Snapshot_Save *save, PMC
+*libs)>
+
+Returns the preamble of a snapshot: the HLLs, the types, the libraries C<libs>,
+the search paths and the paths to the externs.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+make_preamble(PARROT_INTERP, ARGIN(const Snapshot_Save *save), ARGIN(PMC *libs))
+{
+    ASSERT_ARGS(make_preamble)
+    PMC * const  preamble = Parrot_pmc_new_init_int(interp,
+                                enum_class_FixedPMCArray, SNAPSHOT_PREAMBLE_SIZE);
+    PMC * const  hlls     = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    PMC * const  typemaps = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC * const  types    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC * const  names    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    const INTVAL n_hlls   = VTABLE_elements(interp, interp->HLL_info);
+    INTVAL       i;
+
+    for (i = 0; i < n_hlls; ++i) {
+        STRING * const name  = Parrot_hll_get_HLL_name(interp, i);
+        PMC    * const entry = VTABLE_get_pmc_keyed_int(interp, interp->HLL_info, i);
+        PMC    * const map   = VTABLE_get_pmc_keyed_int(interp, entry, e_HLL_typemap);
+        PMC    * const pairs = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+
+        if (STRING_IS_NULL(name))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Cannot snapshot an HLL without a name");
+
+        if (!PMC_IS_NULL(map)) {
+            const Hash * const hash = (const Hash *)VTABLE_get_pointer(interp, map);
+
+            parrot_hash_iterate(hash,
+                VTABLE_push_integer(interp, pairs, (INTVAL)_bucket->key);
+                VTABLE_push_integer(interp, pairs, (INTVAL)_bucket->value););
+        }
+
+        VTABLE_push_string(interp, hlls, name);
+        VTABLE_push_pmc(interp, typemaps, pairs);
+    }
+
+    for (i = enum_class_core_max; i < interp->n_vtable_max; ++i) {
+        const VTABLE * const vtable = interp->vtables[i];
+
+        if (!vtable)
+            VTABLE_push_pmc(interp, types, PMCNULL);
+        else if (is_class_type(interp, i))
+            VTABLE_push_pmc(interp, types,
+                Parrot_pmc_new_init_int(interp, enum_class_Integer, i));
+        else
+            VTABLE_push_pmc(interp, types,
+                box_string(interp, vtable->whoami));
+    }
+
+    collect_class_names(interp, interp->class_hash,
+        Parrot_pmc_new(interp, enum_class_ResizableStringArray), names);
+
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_HLLS, hlls);
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_TYPEMAPS, typemaps);
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_TYPES, types);
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_LIBS, libs);
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_LIB_PATHS,
+        VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_LIB_PATHS));
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_PBC_LIBS,
+        VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_PBC_LIBS));
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_EXTERNS, save->paths);
+    VTABLE_set_pmc_keyed_int(interp, preamble, SNAPSHOT_CLASS_NAMES, names);
+
+    return preamble;
+}
+
+/*
+
+=item C<static PMC * make_image(PARROT_INTERP, const Snapshot_Save *save, PMC
+*compregs)>
+
+Returns the root of the PMC image of a snapshot: the constants of every
+packfile, the namespace records, the classes, the methods added to PMCProxy
+classes, the compilers C<compregs> and the MultiSubs to fill again.  Constants
+which were never thawed stay in their packfile.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+make_image(PARROT_INTERP, ARGIN(const Snapshot_Save *save), ARGIN(PMC *compregs))
+{
+    ASSERT_ARGS(make_image)
+    PMC * const  root      = Parrot_pmc_new_init_int(interp,
+                                enum_class_FixedPMCArray, SNAPSHOT_IMAGE_SIZE);
+    PMC * const  constants = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    const INTVAL n_types   = interp->n_vtable_max - enum_class_core_max;
+    PMC * const  classes   = Parrot_pmc_new_init_int(interp,
+                                enum_class_FixedPMCArray, n_types);
+    PackFile    *pf;
+    INTVAL       i;
+
+    for (i = 0; (pf = packfile_at(interp, i)) != NULL; ++i) {
+        PMC * const tables = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        size_t      j;
+
+        for (j = 0; j < pf->directory.num_segments; ++j) {
+            const PackFile_ConstTable * const ct =
+                (const PackFile_ConstTable *)pf->directory.segments[j];
+            PMC   *table, *values;
+            INTVAL k;
+
+            if (ct->base.type != PF_CONST_SEG)
+                continue;
+
+            table  = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray, 2);
+            values = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray,
+                        ct->pmc.const_count);
+
+            for (k = 0; k < ct->pmc.const_count; ++k)
+                if (!ct->pmc.frozen || !ct->pmc.frozen[k])
+                    VTABLE_set_pmc_keyed_int(interp, values, k,
+                        ct->pmc.constants[k]);
+
+            VTABLE_set_pmc_keyed_int(interp, table, 0,
+                box_string(interp, ct->base.name));
+            VTABLE_set_pmc_keyed_int(interp, table, 1, values);
+            VTABLE_push_pmc(interp, tables, table);
+        }
+
+        VTABLE_push_pmc(interp, constants, tables);
+    }
+
+    for (i = 0; i < n_types; ++i)
+        if (is_class_type(interp, enum_class_core_max + i))
+            VTABLE_set_pmc_keyed_int(interp, classes, i,
+                interp->vtables[enum_class_core_max + i]->pmc_class);
+
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_CONSTANTS, constants);
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_NAMESPACES, save->ns_records);
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_CLASSES, classes);
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_PROXIES, save->proxy_records);
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_COMPREGS, compregs);
+    VTABLE_set_pmc_keyed_int(interp, root, SNAPSHOT_MULTIS, save->multi_records);
+
+    return root;
+}
+
+/*
+
+=item C<static int packfile_is_pristine(const PackFile *pf)>
+
+Returns true if the mapped file of C<pf> holds all of its segments, so it can
+be copied as is.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+packfile_is_pristine(ARGIN(const PackFile *pf))
+{
+    ASSERT_ARGS(packfile_is_pristine)
+    size_t i;
+
+    if (!PF_IN_PLACE(pf))
+        return 0;
+
+    /* segments added at runtime don't have a place in the file */
+    for (i = 0; i < pf->directory.num_segments; ++i) {
+        const PackFile_Segment * const seg = pf->directory.segments[i];
+
+        if (seg->type != PF_DIR_SEG && !seg->file_offset)
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static opcode_t * pack_packfile(PARROT_INTERP, PackFile *pf, size_t
+*bytes)>
+
+Packs C<pf> without the packfiles loaded into it, returning the allocated
+image and its size in C<bytes>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static opcode_t *
+pack_packfile(PARROT_INTERP, ARGMOD(PackFile *pf), ARGOUT(size_t *bytes))
+{
+    ASSERT_ARGS(pack_packfile)
+    PackFile_Directory * const dir          = &pf->directory;
+    PackFile_Segment  ** const segments     = dir->segments;
+    const size_t               num_segments = dir->num_segments;
+    const opcode_t     * const src          = pf->src;
+    PackFile_Segment         **own;
+    opcode_t                  *image;
+    opcode_t                   size;
+    size_t                     i, n = 0;
+
+    own = mem_gc_allocate_n_zeroed_typed(interp, num_segments + 1,
+            PackFile_Segment *);
+
+    for (i = 0; i < num_segments; ++i)
+        if (segments[i]->type != PF_DIR_SEG)
+            own[n++] = segments[i];
+
+    dir->segments     = own;
+    dir->num_segments = n;
+
+    size  = PackFile_pack_size(interp, pf);
+    image = mem_gc_allocate_n_zeroed_typed(interp, size, opcode_t);
+    PackFile_pack(interp, pf, image);
+
+    dir->segments     = segments;
+    dir->num_segments = num_segments;
+    pf->src           = src;
+    mem_gc_free(interp, own);
+
+    *bytes = size * sizeof (opcode_t);
+    return image;
+}
+
+/*
+
+=item C<static opcode_t core_types_fingerprint(PARROT_INTERP)>
+
+Returns an FNV-1a hash of the names of the core PMCs, in the order of their
+type numbers.  Builds with other core PMCs number them differently, which
+would thaw a snapshot into the wrong types.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t
+core_types_fingerprint(PARROT_INTERP)
+{
+    ASSERT_ARGS(core_types_fingerprint)
+    UINTVAL hash = 2166136261u;
+    INTVAL  i;
+
+    for (i = 0; i < enum_class_core_max; ++i) {
+        const STRING * const name = interp->vtables[i]
+                                  ? interp->vtables[i]->whoami
+                                  : STRINGNULL;
+        UINTVAL j;
+
+        if (!STRING_IS_NULL(name))
+            for (j = 0; j < name->bufused; ++j)
+                hash = (hash ^ (unsigned char)name->strstart[j]) * 16777619u;
+
+        /* separate the names */
+        hash = (hash ^ 0xff) * 16777619u;
+    }
+
+    return (opcode_t)hash;
+}
+
+/*
+
+=item C<static size_t snapshot_align(size_t offset)>
+
+Rounds C<offset> up to the alignment of the blocks of a snapshot.
+
+=cut
+
+*/
+
+PARROT_CONST_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static size_t
+snapshot_align(size_t offset)
+{
+    ASSERT_ARGS(snapshot_align)
+    return (offset + SNAPSHOT_ALIGN - 1) / SNAPSHOT_ALIGN * SNAPSHOT_ALIGN;
+}
+
+/*
+
+=item C<void Parrot_snapshot_save(PARROT_INTERP, STRING *path)>
+
+Saves the state of the interpreter to the snapshot file C<path>.  Throws an
+exception if the state holds something a snapshot can't restore, like an open
+file, a running coroutine or a Sub compiled at runtime.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_snapshot_save(PARROT_INTERP, ARGIN(STRING *path))
+{
+    ASSERT_ARGS(Parrot_snapshot_save)
+    static const unsigned char zeros[SNAPSHOT_ALIGN] = { 0 };
+    Snapshot_Header  header;
+    Snapshot_Save    save;
+    PMC             *libs, *compregs, *freezer;
+    STRING          *preamble, *image;
+    PackFile        *pf;
+    const opcode_t **blocks;
+    opcode_t       **packed;
+    opcode_t        *table;
+    size_t          *sizes;
+    size_t           offset;
+    INTVAL           n, i;
+    char            *filename;
+    FILE            *file;
+    int              ok;
+
+    for (n = 0; (pf = packfile_at(interp, n)) != NULL; ++n)
+        if (pf->need_endianize || pf->need_wordsize || pf->fetch_nv)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Cannot snapshot a foreign bytecode file");
+
+    save.externs       = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    save.paths         = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    save.seen          = Parrot_pmc_new(interp, enum_class_AddrRegistry);
+    save.ns_records    = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    save.proxy_records = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    save.multi_records = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    libs               = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    compregs           = Parrot_pmc_new(interp, enum_class_Hash);
+
+    collect_externs(interp, &save, libs, compregs);
+
+    freezer = Parrot_pmc_new(interp, enum_class_ImageIOFreeze);
+    VTABLE_assign_pmc(interp, freezer, save.externs);
+    VTABLE_set_pmc(interp, freezer, make_image(interp, &save, compregs));
+    image    = VTABLE_get_string(interp, freezer);
+    preamble = Parrot_freeze(interp, make_preamble(interp, &save, libs));
+
+    /* nothing throws past here, before the buffers are freed */
+    blocks = mem_gc_allocate_n_zeroed_typed(interp, n, const opcode_t *);
+    packed = mem_gc_allocate_n_zeroed_typed(interp, n, opcode_t *);
+    sizes  = mem_gc_allocate_n_zeroed_typed(interp, n, size_t);
+    table  = mem_gc_allocate_n_zeroed_typed(interp, 2 * n, opcode_t);
+
+    for (i = 0; i < n; ++i) {
+        pf = packfile_at(interp, i);
+
+        if (packfile_is_pristine(pf)) {
+            blocks[i] = pf->src;
+            sizes[i]  = pf->size;
+        }
+        else
+            blocks[i] = packed[i] = pack_packfile(interp, pf, &sizes[i]);
+    }
+
+    memset(&header, 0, sizeof (header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof (header.magic));
+    header.wordsize       = sizeof (opcode_t);
+    header.floatsize      = sizeof (FLOATVAL);
+    header.bigendian      = PARROT_BIGENDIAN;
+    header.version[0]     = PARROT_MAJOR_VERSION;
+    header.version[1]     = PARROT_MINOR_VERSION;
+    header.version[2]     = PARROT_PATCH_VERSION;
+    header.pbc_version[0] = PARROT_PBC_MAJOR;
+    header.pbc_version[1] = PARROT_PBC_MINOR;
+    header.core_max       = enum_class_core_max;
+    header.core_types     = core_types_fingerprint(interp);
+    header.n_packfiles    = n;
+
+    offset = snapshot_align(sizeof (header) + 2 * n * sizeof (opcode_t));
+
+    for (i = 0; i < n; ++i) {
+        table[2 * i]     = offset;
+        table[2 * i + 1] = sizes[i];
+        offset           = snapshot_align(offset + sizes[i]);
+    }
+
+    header.preamble      = offset;
+    header.preamble_size = Parrot_str_byte_length(interp, preamble);
+    offset               = snapshot_align(offset + header.preamble_size);
+    header.image         = offset;
+    header.image_size    = Parrot_str_byte_length(interp, image);
+
+    filename = Parrot_str_to_cstring(interp, path);
+    file     = fopen(filename, "wb");
+    Parrot_str_free_cstring(filename);
+    ok       = file != NULL;
+
+    if (ok) {
+        size_t written = sizeof (header) + 2 * n * sizeof (opcode_t);
+
+        ok = fwrite(&header, sizeof (header), 1, file) == 1
+          && (!n || fwrite(table, 2 * n * sizeof (opcode_t), 1, file) == 1);
+
+        for (i = 0; ok && i < n; ++i) {
+            ok = fwrite(zeros, 1, table[2 * i] - written, file)
+                    == (size_t)table[2 * i] - written
+              && fwrite(blocks[i], 1, sizes[i], file) == sizes[i];
+            written = table[2 * i] + sizes[i];
+        }
+
+        ok = ok
+          && fwrite(zeros, 1, header.preamble - written, file)
+                == (size_t)header.preamble - written
+          && fwrite(preamble->strstart, 1, header.preamble_size, file)
+                == (size_t)header.preamble_size
+          && fwrite(zeros, 1, header.image - header.preamble - header.preamble_size,
+                file) == (size_t)(header.image - header.preamble - header.preamble_size)
+          && fwrite(image->strstart, 1, header.image_size, file)
+                == (size_t)header.image_size;
+
+        ok = fclose(file) == 0 && ok;
+    }
+
+    for (i = 0; i < n; ++i)
+        if (packed[i])
+            mem_gc_free(interp, packed[i]);
+
+    mem_gc_free(interp, blocks);
+    mem_gc_free(interp, packed);
+    mem_gc_free(interp, sizes);
+    mem_gc_free(interp, table);
+
+    if (!ok)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot write snapshot '%Ss'", path);
+}
+
+/*
+
+=item C<static STRING * snapshot_string(PARROT_INTERP, const char *base,
+opcode_t offset, opcode_t size)>
+
+Returns a binary string over the C<size> bytes at C<offset> in the mapped
+snapshot C<base>, without copying them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+snapshot_string(PARROT_INTERP, ARGIN(const char *base), opcode_t offset,
+        opcode_t size)
+{
+    ASSERT_ARGS(snapshot_string)
+    return Parrot_str_new_init(interp, base + offset, (UINTVAL)size,
+            Parrot_binary_encoding_ptr, PObj_external_FLAG);
+}
+
+/*
+
+=item C<static void check_header(PARROT_INTERP, STRING *path, const char *base,
+size_t size)>
+
+Throws an exception unless the C<size> bytes at C<base> start with a valid
+snapshot header and table of packfiles, saved by this Parrot.
+
+=cut
+
+*/
+
+static void
+check_header(PARROT_INTERP, ARGIN(STRING *path), ARGIN(const char *base),
+        size_t size)
+{
+    ASSERT_ARGS(check_header)
+    const Snapshot_Header * const header = (const Snapshot_Header *)base;
+    const opcode_t        * const table  = (const opcode_t *)(header + 1);
+    INTVAL                        i;
+
+    if (size < sizeof (Snapshot_Header)
+    ||  memcmp(header->magic, SNAPSHOT_MAGIC, sizeof (header->magic)) != 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "'%Ss' is not a snapshot", path);
+
+    if (header->wordsize   != sizeof (opcode_t)
+    ||  header->floatsize  != sizeof (FLOATVAL)
+    ||  header->bigendian  != PARROT_BIGENDIAN
+    ||  header->version[0] != PARROT_MAJOR_VERSION
+    ||  header->version[1] != PARROT_MINOR_VERSION
+    ||  header->version[2] != PARROT_PATCH_VERSION)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Snapshot '%Ss' was saved by another Parrot", path);
+
+    if (header->pbc_version[0] != PARROT_PBC_MAJOR
+    ||  header->pbc_version[1] != PARROT_PBC_MINOR)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Snapshot '%Ss' has bytecode version %d.%d, this Parrot needs %d.%d",
+            path, (int)header->pbc_version[0], (int)header->pbc_version[1],
+            PARROT_PBC_MAJOR, PARROT_PBC_MINOR);
+
+    if (header->core_max   != enum_class_core_max
+    ||  header->core_types != core_types_fingerprint(interp))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Snapshot '%Ss' was saved by a Parrot with other core PMCs", path);
+
+    if (header->n_packfiles < 0
+    ||  (size_t)header->n_packfiles
+            > (size - sizeof (Snapshot_Header)) / (2 * sizeof (opcode_t)))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
+            "Snapshot '%Ss' is truncated", path);
+
+    for (i = -1; i <= header->n_packfiles; ++i) {
+        const opcode_t offset = i < 0 ? header->preamble
+                              : i < header->n_packfiles ? table[2 * i]
+                              : header->image;
+        const opcode_t bytes  = i < 0 ? header->preamble_size
+                              : i < header->n_packfiles ? table[2 * i + 1]
+                              : header->image_size;
+
+        if (offset < 0 || bytes < 0 || offset % SNAPSHOT_ALIGN
+        ||  (size_t)offset > size || (size_t)bytes > size - offset)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_MALFORMED_PACKFILE,
+                "Snapshot '%Ss' is truncated", path);
+    }
+}
+
+/*
+
+=item C<static void load_types(PARROT_INTERP, PMC *types, PMC *libs)>
+
+Loads the libraries C<libs> in order, checking that each type of C<types> gets
+the same number as when the snapshot was saved.  The numbers of classes are
+taken by placeholder vtables until the classes are thawed.
+
+=cut
+
+*/
+
+static void
+load_types(PARROT_INTERP, ARGIN(PMC *types), ARGIN(PMC *libs))
+{
+    ASSERT_ARGS(load_types)
+    const INTVAL n_types = VTABLE_elements(interp, types);
+    const INTVAL n_libs  = VTABLE_elements(interp, libs);
+    INTVAL       next    = 0;
+    INTVAL       i;
+
+    for (i = 0; i <= n_types; ++i) {
+        const INTVAL type  = enum_class_core_max + i;
+        PMC * const  entry = i < n_types
+                           ? VTABLE_get_pmc_keyed_int(interp, types, i)
+                           : PMCNULL;
+        const int    named = !PMC_IS_NULL(entry)
+                          && entry->vtable->base_type == enum_class_String;
+
+        /* load libraries until the type turns up, or all of them at the end */
+        while (next < n_libs && (i == n_types
+            || interp->n_vtable_max < type
+            || (named && interp->n_vtable_max == type))) {
+            STRING * const key = VTABLE_get_string_keyed_int(interp, libs, next++);
+            PMC    * const lib = Parrot_dyn_load_lib(interp,
+                                    STRING_IS_EMPTY(key) ? STRINGNULL : key, PMCNULL);
+
+            if (PMC_IS_NULL(lib) || !VTABLE_defined(interp, lib))
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_LIBRARY_ERROR,
+                    "Cannot load library '%Ss' for the snapshot", key);
+        }
+
+        if (i == n_types)
+            break;
+
+        if (named) {
+            if (interp->n_vtable_max <= type || !interp->vtables[type]
+            ||  !STRING_equal(interp, interp->vtables[type]->whoami,
+                    VTABLE_get_string(interp, entry)))
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_LIBRARY_ERROR,
+                    "Snapshot type %d is not %Ss", (int)type,
+                    VTABLE_get_string(interp, entry));
+        }
+        else {
+            if (interp->n_vtable_max != type)
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_LIBRARY_ERROR,
+                    "Snapshot type %d is taken", (int)type);
+
+            (void)Parrot_pmc_get_new_vtable_index(interp);
+
+            if (!PMC_IS_NULL(entry)) {
+                VTABLE * const placeholder = Parrot_vtbl_clone_vtable(interp,
+                                                interp->vtables[enum_class_Class]);
+
+                placeholder->base_type         = type;
+                placeholder->ro_variant_vtable = NULL;
+                interp->vtables[type]          = placeholder;
+            }
+        }
+    }
+}
+
+/*
+
+=item C<static PMC * find_namespace(PARROT_INTERP, PMC *path)>
+
+Returns the namespace at the namespace part of the extern path C<path>,
+creating it if needed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+find_namespace(PARROT_INTERP, ARGIN(PMC *path))
+{
+    ASSERT_ARGS(find_namespace)
+    const INTVAL n  = VTABLE_elements(interp, path);
+    PMC         *ns = interp->root_namespace;
+    INTVAL       i;
+
+    for (i = SNAPSHOT_PATH_NS; i < n; ++i)
+        ns = Parrot_ns_make_namespace_keyed_str(interp, ns,
+                VTABLE_get_string_keyed_int(interp, path, i));
+
+    return ns;
+}
+
+/*
+
+=item C<static PMC * find_extern(PARROT_INTERP, PMC *path)>
+
+Looks up the extern at C<path> in this interpreter.  Throws an exception if
+there is none.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+find_extern(PARROT_INTERP, ARGIN(PMC *path))
+{
+    ASSERT_ARGS(find_extern)
+    STRING * const kind    = VTABLE_get_string_keyed_int(interp, path, 0);
+    STRING * const key     = VTABLE_get_string_keyed_int(interp, path, 1);
+    const INTVAL   idx     = VTABLE_get_integer_keyed_int(interp, path, 2);
+    PMC    * const globals = interp->iglobals;
+    PMC           *pmc     = PMCNULL;
+
+    if (STRING_equal(interp, kind, CONST_STRING(interp, "iglobals")))
+        pmc = globals;
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "iglobal")))
+        pmc = idx < IGLOBALS_SIZE
+            ? VTABLE_get_pmc_keyed_int(interp, globals, idx)
+            : PMCNULL;
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "std")))
+        pmc = Parrot_io_stdhandle(interp, idx, PMCNULL);
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "ns")))
+        pmc = find_namespace(interp, path);
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "var")))
+        pmc = (PMC *)VTABLE_get_pointer_keyed_str(interp,
+                find_namespace(interp, path), key);
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "multi"))) {
+        PMC * const multi = (PMC *)VTABLE_get_pointer_keyed_str(interp,
+                                find_namespace(interp, path), key);
+
+        /* counted among the native candidates only */
+        if (!PMC_IS_NULL(multi) && multi->vtable->base_type == enum_class_MultiSub) {
+            const INTVAL n     = VTABLE_elements(interp, multi);
+            INTVAL       count = idx;
+            INTVAL       i;
+
+            for (i = 0; i < n; ++i) {
+                PMC * const candidate = VTABLE_get_pmc_keyed_int(interp, multi, i);
+
+                if (is_native(candidate) && count-- == 0) {
+                    pmc = candidate;
+                    break;
+                }
+            }
+        }
+    }
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "method"))) {
+        PMC * const ns      = find_namespace(interp, path);
+        PMC * const methods = PARROT_NAMESPACE(ns)->methods;
+        PMC * const _class  = PARROT_NAMESPACE(ns)->_class;
+
+        if (!PMC_IS_NULL(methods))
+            pmc = VTABLE_get_pmc_keyed_str(interp, methods, key);
+
+        if (PMC_IS_NULL(pmc) && !PMC_IS_NULL(_class))
+            pmc = VTABLE_get_pmc_keyed_str(interp, PARROT_CLASS(_class)->methods, key);
+    }
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "proxy")))
+        pmc = Parrot_oo_get_class(interp, find_namespace(interp, path));
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "lib")))
+        pmc = VTABLE_get_pmc_keyed_str(interp,
+                VTABLE_get_pmc_keyed_int(interp, globals, IGLOBALS_DYN_LIBS), key);
+    else if (STRING_equal(interp, kind, CONST_STRING(interp, "compreg")))
+        pmc = VTABLE_get_pmc_keyed_str(interp,
+                VTABLE_get_pmc_keyed_int(interp, globals, IGLOBALS_COMPREG_HASH), key);
+
+    if (PMC_IS_NULL(pmc)) {
+        STRING * const sep = CONST_STRING(interp, ";");
+
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_LIBRARY_ERROR,
+            "Snapshot needs the %Ss '%Ss' missing here", kind,
+            Parrot_str_join(interp, sep, path));
+    }
+
+    return pmc;
+}
+
+/*
+
+=item C<static void merge_lib_paths(PARROT_INTERP, PMC *saved)>
+
+Puts the search paths of the snapshot C<saved> missing here in front of the
+search paths of the interpreter.
+
+=cut
+
+*/
+
+static void
+merge_lib_paths(PARROT_INTERP, ARGIN(PMC *saved))
+{
+    ASSERT_ARGS(merge_lib_paths)
+    PMC * const  lib_paths = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_LIB_PATHS);
+    const INTVAL n         = VTABLE_elements(interp, saved);
+    INTVAL       i;
+
+    for (i = 0; i < n && i < PARROT_LIB_PATH_SIZE; ++i) {
+        PMC * const  paths   = VTABLE_get_pmc_keyed_int(interp, lib_paths, i);
+        PMC * const  wanted  = VTABLE_get_pmc_keyed_int(interp, saved, i);
+        INTVAL       j;
+
+        for (j = VTABLE_elements(interp, wanted) - 1; j >= 0; --j) {
+            STRING * const dir = VTABLE_get_string_keyed_int(interp, wanted, j);
+            const INTVAL   m   = VTABLE_elements(interp, paths);
+            INTVAL         k;
+
+            for (k = 0; k < m; ++k)
+                if (STRING_equal(interp, dir,
+                        VTABLE_get_string_keyed_int(interp, paths, k)))
+                    break;
+
+            if (k == m)
+                VTABLE_unshift_string(interp, paths, dir);
+        }
+    }
+}
+
+/*
+
+=item C<static void install_constants(PARROT_INTERP, PMC *constants)>
+
+Gives the restored packfiles the constants thawed from the snapshot.  The
+other constants get thawed from the packfiles when first used.
+
+=cut
+
+*/
+
+static void
+install_constants(PARROT_INTERP, ARGIN(PMC *constants))
+{
+    ASSERT_ARGS(install_constants)
+    const INTVAL n = VTABLE_elements(interp, constants);
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        PackFile * const pf       = packfile_at(interp, i);
+        PMC      * const tables   = VTABLE_get_pmc_keyed_int(interp, constants, i);
+        const INTVAL     n_tables = VTABLE_elements(interp, tables);
+        INTVAL           j;
+
+        for (j = 0; j < n_tables; ++j) {
+            PMC    * const table  = VTABLE_get_pmc_keyed_int(interp, tables, j);
+            STRING * const name   = VTABLE_get_string_keyed_int(interp, table, 0);
+            PMC    * const values = VTABLE_get_pmc_keyed_int(interp, table, 1);
+            PackFile_ConstTable * const ct = pf
+                ? (PackFile_ConstTable *)PackFile_find_segment(interp,
+                        &pf->directory, name, 0)
+                : NULL;
+            INTVAL k;
+
+            if (!ct || ct->base.type != PF_CONST_SEG
+            ||  ct->pmc.const_count != VTABLE_elements(interp, values))
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_MALFORMED_PACKFILE,
+                    "Snapshot has no constant segment '%Ss'", name);
+
+            for (k = 0; k < ct->pmc.const_count; ++k) {
+                PMC * const value = VTABLE_get_pmc_keyed_int(interp, values, k);
+
+                if (!PMC_IS_NULL(value)) {
+                    ct->pmc.constants[k] = value;
+
+                    if (ct->pmc.frozen)
+                        ct->pmc.frozen[k] = NULL;
+                }
+            }
+        }
+    }
+}
+
+/*
+
+=item C<static void install_namespaces(PARROT_INTERP, PMC *records)>
+
+Puts the globals, methods, vtable overrides and classes of the namespace
+records C<records> back into their namespaces.
+
+=cut
+
+*/
+
+static void
+install_namespaces(PARROT_INTERP, ARGIN(PMC *records))
+{
+    ASSERT_ARGS(install_namespaces)
+    const INTVAL n = VTABLE_elements(interp, records);
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const record = VTABLE_get_pmc_keyed_int(interp, records, i);
+        PMC * const ns     = VTABLE_get_pmc_keyed_int(interp, record, SNAPSHOT_NS);
+        PMC * const vars   = VTABLE_get_pmc_keyed_int(interp, record, SNAPSHOT_NS_VARS);
+        PMC * const iter   = VTABLE_get_iter(interp, vars);
+        Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(ns);
+
+        /* with no class, storing Subs leaves the class alone */
+        PARROT_GC_WRITE_BARRIER(interp, ns);
+        nsinfo->_class = PMCNULL;
+
+        while (VTABLE_get_bool(interp, iter)) {
+            STRING * const key   = VTABLE_shift_string(interp, iter);
+            PMC    * const value = VTABLE_get_pmc_keyed_str(interp, vars, key);
+
+            if (value != (PMC *)VTABLE_get_pointer_keyed_str(interp, ns, key))
+                VTABLE_set_pmc_keyed_str(interp, ns, key, value);
+        }
+
+        PARROT_GC_WRITE_BARRIER(interp, ns);
+        nsinfo->methods = VTABLE_get_pmc_keyed_int(interp, record,
+                            SNAPSHOT_NS_METHODS);
+        nsinfo->vtable  = VTABLE_get_pmc_keyed_int(interp, record,
+                            SNAPSHOT_NS_VTABLE);
+        nsinfo->_class  = VTABLE_get_pmc_keyed_int(interp, record,
+                            SNAPSHOT_NS_CLASS);
+    }
+}
+
+/*
+
+=item C<static void install_registry(PARROT_INTERP, PMC *preamble, PMC *image)>
+
+Puts back what the snapshot keeps in the registries of the interpreter: the
+HLL type maps, the compilers, the loaded bytecode libraries, the class names,
+the methods added to PMCProxy classes and the MultiSubs with native
+candidates.
+
+=cut
+
+*/
+
+static void
+install_registry(PARROT_INTERP, ARGIN(PMC *preamble), ARGIN(PMC *image))
+{
+    ASSERT_ARGS(install_registry)
+    PMC * const typemaps = VTABLE_get_pmc_keyed_int(interp, preamble,
+                                SNAPSHOT_TYPEMAPS);
+    PMC * const pbc_libs = VTABLE_get_pmc_keyed_int(interp, preamble,
+                                SNAPSHOT_PBC_LIBS);
+    PMC * const names    = VTABLE_get_pmc_keyed_int(interp, preamble,
+                                SNAPSHOT_CLASS_NAMES);
+    PMC * const compregs = VTABLE_get_pmc_keyed_int(interp, image,
+                                SNAPSHOT_COMPREGS);
+    PMC * const proxies  = VTABLE_get_pmc_keyed_int(interp, image,
+                                SNAPSHOT_PROXIES);
+    PMC * const multis   = VTABLE_get_pmc_keyed_int(interp, image,
+                                SNAPSHOT_MULTIS);
+    PMC * const globals  = interp->iglobals;
+    PMC        *iter;
+    INTVAL      i, n;
+
+    n = VTABLE_elements(interp, typemaps);
+    for (i = PARROT_HLL_PARROT + 1; i < n; ++i) {
+        PMC * const  pairs = VTABLE_get_pmc_keyed_int(interp, typemaps, i);
+        const INTVAL m     = VTABLE_elements(interp, pairs);
+        INTVAL       j;
+
+        for (j = 0; j + 1 < m; j += 2)
+            Parrot_hll_register_HLL_type(interp, i,
+                VTABLE_get_integer_keyed_int(interp, pairs, j),
+                VTABLE_get_integer_keyed_int(interp, pairs, j + 1));
+    }
+
+    iter = VTABLE_get_iter(interp, compregs);
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const key = VTABLE_shift_string(interp, iter);
+
+        VTABLE_set_pmc_keyed_str(interp,
+            VTABLE_get_pmc_keyed_int(interp, globals, IGLOBALS_COMPREG_HASH),
+            key, VTABLE_get_pmc_keyed_str(interp, compregs, key));
+    }
+
+    iter = VTABLE_get_iter(interp, pbc_libs);
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const key    = VTABLE_shift_string(interp, iter);
+        PMC    * const loaded = VTABLE_get_pmc_keyed_int(interp, globals,
+                                    IGLOBALS_PBC_LIBS);
+
+        if (!VTABLE_exists_keyed_str(interp, loaded, key))
+            VTABLE_set_string_keyed_str(interp, loaded, key,
+                VTABLE_get_string_keyed_str(interp, pbc_libs, key));
+    }
+
+    n = VTABLE_elements(interp, names);
+    for (i = 0; i < n; ++i) {
+        PMC * const  pair = VTABLE_get_pmc_keyed_int(interp, names, i);
+        PMC * const  path = VTABLE_get_pmc_keyed_int(interp, pair, 0);
+        const INTVAL last = VTABLE_elements(interp, path) - 1;
+        PMC         *ns   = interp->class_hash;
+        STRING      *key;
+        INTVAL       j;
+
+        for (j = 0; j < last; ++j)
+            ns = Parrot_ns_make_namespace_keyed_str(interp, ns,
+                    VTABLE_get_string_keyed_int(interp, path, j));
+
+        key = VTABLE_get_string_keyed_int(interp, path, last);
+
+        if (PMC_IS_NULL((PMC *)VTABLE_get_pointer_keyed_str(interp, ns, key)))
+            VTABLE_set_pmc_keyed_str(interp, ns, key,
+                VTABLE_get_pmc_keyed_int(interp, pair, 1));
+    }
+
+    n = VTABLE_elements(interp, proxies);
+    for (i = 0; i < n; ++i) {
+        PMC * const record  = VTABLE_get_pmc_keyed_int(interp, proxies, i);
+        PMC * const proxy   = VTABLE_get_pmc_keyed_int(interp, record, 0);
+        PMC * const methods = VTABLE_get_pmc_keyed_int(interp, record, 1);
+
+        iter = VTABLE_get_iter(interp, methods);
+        while (VTABLE_get_bool(interp, iter)) {
+            STRING * const key = VTABLE_shift_string(interp, iter);
+
+            VTABLE_set_pmc_keyed_str(interp, PARROT_CLASS(proxy)->methods, key,
+                VTABLE_get_pmc_keyed_str(interp, methods, key));
+        }
+    }
+
+    n = VTABLE_elements(interp, multis);
+    for (i = 0; i < n; ++i) {
+        PMC * const  record     = VTABLE_get_pmc_keyed_int(interp, multis, i);
+        PMC * const  multi      = VTABLE_get_pmc_keyed_int(interp, record, 0);
+        PMC * const  candidates = VTABLE_get_pmc_keyed_int(interp, record, 1);
+        const INTVAL m          = VTABLE_elements(interp, candidates);
+        INTVAL       j;
+
+        VTABLE_set_integer_native(interp, multi, 0);
+        for (j = 0; j < m; ++j)
+            VTABLE_push_pmc(interp, multi,
+                VTABLE_get_pmc_keyed_int(interp, candidates, j));
+    }
+}
+
+/*
+
+=item C<void Parrot_snapshot_load(PARROT_INTERP, STRING *path)>
+
+Restores the state saved to the snapshot file C<path> into a freshly
+initialized interpreter.  The file stays mapped until the interpreter is
+destroyed, as the restored bytecode is used in place.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_snapshot_load(PARROT_INTERP, ARGIN(STRING *path))
+{
+    ASSERT_ARGS(Parrot_snapshot_load)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    const Snapshot_Header *header;
+    const opcode_t        *table;
+    PackFile              *container;
+    PMC                   *preamble, *paths, *externs, *thawer, *image;
+    PMC                   *types, *classes;
+    char                  *base;
+    char                  *filename;
+    size_t                 size;
+    INTVAL                 i, n;
+    int                    fd;
+
+    if (interp->snapshot_pf)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "A snapshot is loaded already");
+
+    filename = Parrot_str_to_cstring(interp, path);
+    fd       = open(filename, O_RDONLY | O_BINARY);
+    Parrot_str_free_cstring(filename);
+
+    if (fd < 0)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot open snapshot '%Ss'", path);
+
+    size = (size_t)Parrot_stat_info_intval(interp, path, STAT_FILESIZE);
+    base = size
+         ? (char *)mmap(0, size, PROT_READ, MAP_PRIVATE, fd, (off_t)0)
+         : (char *)MAP_FAILED;
+    close(fd);
+
+    if (base == (char *)MAP_FAILED)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot map snapshot '%Ss'", path);
+
+    /* the container owns the mapping from here on */
+    container             = PackFile_new(interp, 1);
+    container->src        = (const opcode_t *)base;
+    container->size       = size;
+    interp->snapshot_pf   = container;
+
+    check_header(interp, path, base, size);
+    header = (const Snapshot_Header *)base;
+    table  = (const opcode_t *)(header + 1);
+
+    preamble = Parrot_thaw(interp,
+                snapshot_string(interp, base, header->preamble,
+                    header->preamble_size));
+
+    merge_lib_paths(interp,
+        VTABLE_get_pmc_keyed_int(interp, preamble, SNAPSHOT_LIB_PATHS));
+
+    {
+        PMC * const hlls = VTABLE_get_pmc_keyed_int(interp, preamble,
+                                SNAPSHOT_HLLS);
+
+        n = VTABLE_elements(interp, hlls);
+        for (i = 0; i < n; ++i) {
+            STRING * const name = VTABLE_get_string_keyed_int(interp, hlls, i);
+
+            if (Parrot_hll_register_HLL(interp, name) != i)
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "Snapshot HLL %Ss gets another id", name);
+        }
+    }
+
+    types = VTABLE_get_pmc_keyed_int(interp, preamble, SNAPSHOT_TYPES);
+    load_types(interp, types,
+        VTABLE_get_pmc_keyed_int(interp, preamble, SNAPSHOT_LIBS));
+
+    for (i = 0; i < header->n_packfiles; ++i) {
+        PackFile * const pf = PackFile_new(interp, 1);
+
+        pf->options |= PFOPT_SNAPSHOT;
+
+        if (!PackFile_unpack(interp, pf, (const opcode_t *)(base + table[2 * i]),
+                (size_t)table[2 * i + 1])
+        ||  !PF_IN_PLACE(pf))
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_MALFORMED_PACKFILE,
+                "Snapshot '%Ss' has a bad packfile", path);
+
+        PackFile_add_segment(interp, &container->directory, &pf->directory.base);
+    }
+
+    paths   = VTABLE_get_pmc_keyed_int(interp, preamble, SNAPSHOT_EXTERNS);
+    n       = VTABLE_elements(interp, paths);
+    externs = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray, n);
+
+    for (i = 0; i < n; ++i)
+        VTABLE_set_pmc_keyed_int(interp, externs, i,
+            find_extern(interp, VTABLE_get_pmc_keyed_int(interp, paths, i)));
+
+    thawer = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+    VTABLE_assign_pmc(interp, thawer, externs);
+
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+    VTABLE_set_string_native(interp, thawer,
+        snapshot_string(interp, base, header->image, header->image_size));
+    image = VTABLE_get_pmc(interp, thawer);
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+
+    /* swap the placeholders for the vtables of the classes */
+    classes = VTABLE_get_pmc_keyed_int(interp, image, SNAPSHOT_CLASSES);
+    n       = VTABLE_elements(interp, classes);
+
+    for (i = 0; i < n; ++i) {
+        PMC * const classobj = VTABLE_get_pmc_keyed_int(interp, classes, i);
+
+        if (!PMC_IS_NULL(classobj)) {
+            Parrot_vtbl_destroy_vtable(interp,
+                interp->vtables[enum_class_core_max + i]);
+            interp->vtables[enum_class_core_max + i] = NULL;
+            Parrot_oo_set_class_vtable(interp, classobj, enum_class_core_max + i);
+        }
+    }
+
+    install_constants(interp,
+        VTABLE_get_pmc_keyed_int(interp, image, SNAPSHOT_CONSTANTS));
+    install_namespaces(interp,
+        VTABLE_get_pmc_keyed_int(interp, image, SNAPSHOT_NAMESPACES));
+    install_registry(interp, preamble, image);
+
+    Parrot_invalidate_method_cache(interp, NULL);
+#else
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+        "Cannot load snapshot '%Ss' without mmap", path);
+#endif
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc_freeze.c>, F<src/packfile.c>, F<docs/running.pod>.
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4:
+ */
@@ -123,8 +123,10 @@ Parrot_str_init(PARROT_INTERP)
     const size_t n_parrot_cstrings =
         sizeof (parrot_cstrings) / sizeof (parrot_cstrings[0]);
 
-    if (interp->parent_interpreter)
-        interp->hash_seed = interp->parent_interpreter->hash_seed;
+    if (interp->parent_interpreter) {
+        interp->hash_seed    = interp->parent_interpreter->hash_seed;
+        interp->hash_siphash = interp->parent_interpreter->hash_siphash;
+    }
 
     /* interp is initialized from zeroed memory, so this is fine */
     else if (interp->hash_seed == 0) {
@@ -198,6 +200,47 @@ Parrot_str_finish(PARROT_INTERP)
         Parrot_deinit_encodings(interp);
         parrot_hash_destroy(interp, interp->const_cstring_hash);
     }
+
+    if (interp->str_index_table) {
+        Hash * const table = interp->str_index_table;
+
+        parrot_hash_iterate(table,
+            mem_internal_free(_bucket->value););
+        parrot_hash_destroy(interp, table);
+        interp->str_index_table = NULL;
+    }
+}
+
+
+/*
+
+=item C<void Parrot_str_drop_index(PARROT_INTERP, STRING *s)>
+
+Frees the codepoint index built for C<s> by its encoding, if any.  The GC
+calls this (through C<Parrot_str_forget_index>) before it frees a string
+header, and the encodings call it when they modify a string in place.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_str_drop_index(PARROT_INTERP, ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_drop_index)
+    Hash * const table = interp->str_index_table;
+
+    PObj_flag_CLEAR(str_indexed, s);
+
+    if (table) {
+        void * const index = parrot_hash_get(interp, table, s);
+
+        if (index) {
+            parrot_hash_delete(interp, table, s);
+            mem_internal_free(index);
+        }
+    }
 }
 
 
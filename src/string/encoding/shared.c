@@ -23,6 +23,12 @@ Functions starting with unicode_ work with unicode strings.
 #include "tables.h"
 #include "shared.h"
 
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
 #if PARROT_HAS_ICU
 #  include <unicode/ucnv.h>
 #  include <unicode/utypes.h>
@@ -31,6 +37,41 @@ Functions starting with unicode_ work with unicode strings.
 #  include <unicode/unorm.h>
 #endif
 
+/* 64 bit constant from two 32 bit halves, C89 has no long long literals */
+#define HASH_C64(hi, lo) (((UHUGEINTVAL)(hi) << 32) | (UHUGEINTVAL)(lo))
+#define HASH_ROTL(x, n)  (((x) << (n)) | ((x) >> (64 - (n))))
+
+/* xxHash64 primes */
+#define HASH_P1 HASH_C64(0x9E3779B1UL, 0x85EBCA87UL)
+#define HASH_P2 HASH_C64(0xC2B2AE3DUL, 0x27D4EB4FUL)
+#define HASH_P3 HASH_C64(0x165667B1UL, 0x9E3779F9UL)
+#define HASH_P4 HASH_C64(0x85EBCA77UL, 0xC2B2AE63UL)
+#define HASH_P5 HASH_C64(0x27D4EB2FUL, 0x165667C5UL)
+
+/* The high bit of every byte in a word */
+#define ASCII_HIGH_BITS ((size_t)-1 / 0xFF * 0x80)
+
+/* Strings are hashed in blocks of this many bytes, a word for each lane */
+#define HASH_BLOCK_SIZE 32
+
+#define SIP_ROUND(v) do {                                              \
+    (v)[0] += (v)[1]; (v)[1] = HASH_ROTL((v)[1], 13); (v)[1] ^= (v)[0]; \
+    (v)[0]  = HASH_ROTL((v)[0], 32);                                    \
+    (v)[2] += (v)[3]; (v)[3] = HASH_ROTL((v)[3], 16); (v)[3] ^= (v)[2]; \
+    (v)[0] += (v)[3]; (v)[3] = HASH_ROTL((v)[3], 21); (v)[3] ^= (v)[0]; \
+    (v)[2] += (v)[1]; (v)[1] = HASH_ROTL((v)[1], 17); (v)[1] ^= (v)[2]; \
+    (v)[2]  = HASH_ROTL((v)[2], 32);                                    \
+} while (0)
+
+/* State of a string hash in progress. All encodings feed the same stream:
+ * the codepoints as bytes if they fit, as 32 bit words otherwise, so equal
+ * strings hash equal whatever their encoding */
+typedef struct str_hash_state {
+    UHUGEINTVAL v[4];       /* lanes, or the SipHash state */
+    UHUGEINTVAL len;        /* total length of the stream in bytes */
+    int         siphash;    /* use SipHash-2-4 */
+} str_hash_state;
+
 /* HEADERIZER HFILE: src/string/encoding/shared.h */
 
 /* HEADERIZER BEGIN: static */
@@ -46,6 +87,76 @@ static size_t convert_case_buf(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*dest_buf);
 
+PARROT_PURE_FUNCTION
+static UINTVAL encoding_ascii_width(ARGIN(const STR_VTABLE *encoding))
+        __attribute__nonnull__(1);
+
+static UINTVAL encoding_copy_ascii(
+    ARGIN(const STRING *src),
+    ARGMOD(String_iter *src_iter),
+    UINTVAL src_width,
+    ARGMOD(STRING *dest),
+    ARGMOD(String_iter *dest_iter),
+    UINTVAL dest_width)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*src_iter)
+        FUNC_MODIFIES(*dest)
+        FUNC_MODIFIES(*dest_iter);
+
+static void str_hash_block(
+    ARGMOD(str_hash_state *st),
+    ARGIN(const unsigned char *p))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*st);
+
+PARROT_WARN_UNUSED_RESULT
+static size_t str_hash_bytes(PARROT_INTERP,
+    ARGIN_NULLOK(const unsigned char *p),
+    UINTVAL len,
+    size_t seed)
+        __attribute__nonnull__(1);
+
+static int str_hash_codepoints(PARROT_INTERP,
+    ARGIN(const STRING *s),
+    size_t seed,
+    int width,
+    ARGOUT(size_t *hashval))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*hashval);
+
+PARROT_WARN_UNUSED_RESULT
+static size_t str_hash_final(
+    ARGMOD(str_hash_state *st),
+    ARGIN_NULLOK(const unsigned char *p),
+    size_t rest)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*st);
+
+static void str_hash_init(PARROT_INTERP,
+    ARGOUT(str_hash_state *st),
+    size_t seed,
+    UHUGEINTVAL len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*st);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+PARROT_INLINE
+static UHUGEINTVAL str_hash_round(UHUGEINTVAL acc, UHUGEINTVAL input);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static UHUGEINTVAL str_hash_word(ARGIN(const unsigned char *p))
+        __attribute__nonnull__(1);
+
 static int u_iscclass(PARROT_INTERP, UINTVAL codepoint, INTVAL flags)
         __attribute__nonnull__(1);
 
@@ -59,6 +170,30 @@ static STRING* unicode_convert_case(PARROT_INTERP,
 #define ASSERT_ARGS_convert_case_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src_buf))
+#define ASSERT_ARGS_encoding_ascii_width __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_encoding_copy_ascii __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(src_iter) \
+    , PARROT_ASSERT_ARG(dest) \
+    , PARROT_ASSERT_ARG(dest_iter))
+#define ASSERT_ARGS_str_hash_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st) \
+    , PARROT_ASSERT_ARG(p))
+#define ASSERT_ARGS_str_hash_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_str_hash_codepoints __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(hashval))
+#define ASSERT_ARGS_str_hash_final __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_str_hash_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(st))
+#define ASSERT_ARGS_str_hash_round __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_str_hash_word __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p))
 #define ASSERT_ARGS_u_iscclass __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_unicode_convert_case __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -89,7 +224,13 @@ encoding_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
     STRING           *result;
     String_iter       src_iter, dest_iter;
     UINTVAL           src_len, alloc_bytes;
-    UINTVAL           max_bytes = encoding->max_bytes_per_codepoint;
+    UINTVAL           max_bytes  = encoding->max_bytes_per_codepoint;
+    UINTVAL           src_width  = encoding_ascii_width(src->encoding);
+    UINTVAL           dest_width = encoding_ascii_width(encoding);
+
+    /* ASCII runs are only copied in bulk between UTF-8 and a wider encoding */
+    if ((src_width == 1) == (dest_width == 1))
+        src_width = dest_width = 0;
 
     if (src->encoding == encoding)
         return Parrot_str_clone(interp, src);
@@ -112,8 +253,15 @@ encoding_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
     STRING_ITER_INIT(interp, &dest_iter);
 
     while (src_iter.charpos < src_len) {
-        const UINTVAL c      = STRING_iter_get_and_advance(interp, src, &src_iter);
-        const UINTVAL needed = dest_iter.bytepos + max_bytes;
+        UINTVAL c, needed;
+
+        if (src_width
+        &&  encoding_copy_ascii(src, &src_iter, src_width,
+                result, &dest_iter, dest_width))
+            continue;
+
+        c      = STRING_iter_get_and_advance(interp, src, &src_iter);
+        needed = dest_iter.bytepos + max_bytes;
 
         if (needed > result->bufused) {
             alloc_bytes  = src_len - src_iter.charpos;
@@ -132,6 +280,209 @@ encoding_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
 }
 
 
+/*
+
+=item C<static UINTVAL encoding_ascii_width(const STR_VTABLE *encoding)>
+
+Returns the number of bytes an ASCII character takes in C<encoding> if it
+is one of the Unicode encodings, 0 otherwise.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static UINTVAL
+encoding_ascii_width(ARGIN(const STR_VTABLE *encoding))
+{
+    ASSERT_ARGS(encoding_ascii_width)
+
+    if (encoding == Parrot_utf8_encoding_ptr)
+        return 1;
+    if (encoding == Parrot_utf16_encoding_ptr
+    ||  encoding == Parrot_ucs2_encoding_ptr)
+        return 2;
+    if (encoding == Parrot_ucs4_encoding_ptr)
+        return 4;
+
+    return 0;
+}
+
+
+/*
+
+=item C<static UINTVAL encoding_copy_ascii(const STRING *src, String_iter
+*src_iter, UINTVAL src_width, STRING *dest, String_iter *dest_iter, UINTVAL
+dest_width)>
+
+Copies the run of ASCII characters at C<src_iter> to C<dest> at
+C<dest_iter>, as far as the space already allocated in C<dest> allows, and
+advances both iterators.  One of C<src_width> and C<dest_width> must be 1,
+that is, this converts between UTF-8 and UTF-16, UCS-2 or UCS-4.  Returns
+the number of characters copied.
+
+=cut
+
+*/
+
+static UINTVAL
+encoding_copy_ascii(ARGIN(const STRING *src), ARGMOD(String_iter *src_iter),
+        UINTVAL src_width, ARGMOD(STRING *dest), ARGMOD(String_iter *dest_iter),
+        UINTVAL dest_width)
+{
+    ASSERT_ARGS(encoding_copy_ascii)
+    const char * const from  = src->strstart + src_iter->bytepos;
+    char       * const to    = dest->strstart + dest_iter->bytepos;
+    const UINTVAL      space = (dest->bufused - dest_iter->bytepos) / dest_width;
+    UINTVAL            n     = src->strlen - src_iter->charpos;
+    UINTVAL            i;
+
+    if (n > space)
+        n = space;
+
+    if (src_width == 1) {
+        n = encoding_ascii_prefix((const unsigned char *)from, n);
+        encoding_widen_ascii(to, (const unsigned char *)from, n, dest_width);
+    }
+    else if (src_width == 2) {
+        const Parrot_UInt2 * const p = (const Parrot_UInt2 *)from;
+
+        for (i = 0; i < n && p[i] < 0x80; ++i)
+            to[i] = (char)p[i];
+
+        n = i;
+    }
+    else {
+        const Parrot_UInt4 * const p = (const Parrot_UInt4 *)from;
+
+        for (i = 0; i < n && p[i] < 0x80; ++i)
+            to[i] = (char)p[i];
+
+        n = i;
+    }
+
+    src_iter->charpos  += n;
+    src_iter->bytepos  += n * src_width;
+    dest_iter->charpos += n;
+    dest_iter->bytepos += n * dest_width;
+
+    return n;
+}
+
+
+/*
+
+=item C<UINTVAL encoding_ascii_prefix(const unsigned char *ptr, UINTVAL len)>
+
+Returns the number of ASCII bytes at the start of the C<len> bytes at
+C<ptr>, which may be NULL if C<len> is 0.  Tests 16 or 32 bytes at a time
+where SSE2 or AVX2 is available and a machine word at a time otherwise.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+UINTVAL
+encoding_ascii_prefix(ARGIN_NULLOK(const unsigned char *ptr), UINTVAL len)
+{
+    ASSERT_ARGS(encoding_ascii_prefix)
+    UINTVAL i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32) {
+        if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)(ptr + i))))
+            break;
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 16 <= len; i += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(ptr + i))))
+            break;
+    }
+#else
+    for (; i + sizeof (size_t) <= len; i += sizeof (size_t)) {
+        size_t word;
+
+        memcpy(&word, ptr + i, sizeof (size_t));
+
+        if (word & ASCII_HIGH_BITS)
+            break;
+    }
+#endif
+
+    while (i < len && ptr[i] < 0x80)
+        ++i;
+
+    return i;
+}
+
+
+/*
+
+=item C<void encoding_widen_ascii(void *dest, const unsigned char *src, UINTVAL
+len, UINTVAL width)>
+
+Zero extends the C<len> bytes at C<src> to units of C<width> bytes (1, 2 or
+4) at C<dest>, which is how UTF-16, UCS-2 and UCS-4 store characters below
+256.
+
+=cut
+
+*/
+
+void
+encoding_widen_ascii(ARGOUT_NULLOK(void *dest), ARGIN_NULLOK(const unsigned char *src),
+        UINTVAL len, UINTVAL width)
+{
+    ASSERT_ARGS(encoding_widen_ascii)
+    UINTVAL i = 0;
+
+    if (!len)
+        return;
+
+    if (width == 1) {
+        memcpy(dest, src, len);
+    }
+    else if (width == 2) {
+        Parrot_UInt2 * const d = (Parrot_UInt2 *)dest;
+#if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= len; i += 16) {
+            const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+
+            _mm_storeu_si128((__m128i *)(d + i),     _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128((__m128i *)(d + i + 8), _mm_unpackhi_epi8(v, zero));
+        }
+#endif
+
+        for (; i < len; ++i)
+            d[i] = src[i];
+    }
+    else {
+        Parrot_UInt4 * const d = (Parrot_UInt4 *)dest;
+#if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= len; i += 16) {
+            const __m128i v  = _mm_loadu_si128((const __m128i *)(src + i));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+            _mm_storeu_si128((__m128i *)(d + i),      _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(d + i + 4),  _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(d + i + 8),  _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(d + i + 12), _mm_unpackhi_epi16(hi, zero));
+        }
+#endif
+
+        for (; i < len; ++i)
+            d[i] = src[i];
+    }
+}
+
+
 /*
 
 =item C<INTVAL encoding_equal(PARROT_INTERP, const STRING *lhs, const STRING
@@ -285,12 +636,287 @@ encoding_rindex(PARROT_INTERP, SHIM(const STRING *src),
 }
 
 
+/*
+
+=item C<static void str_hash_init(PARROT_INTERP, str_hash_state *st, size_t
+seed, UHUGEINTVAL len)>
+
+Starts hashing a stream of C<len> bytes with the given C<seed>. The fast hash
+is xxHash64, running four independent lanes over each block; with
+C<< interp->hash_siphash >> set, the keyed SipHash-2-4 is used instead,
+which resists hash flooding at some cost.
+
+=cut
+
+*/
+
+static void
+str_hash_init(PARROT_INTERP, ARGOUT(str_hash_state *st), size_t seed, UHUGEINTVAL len)
+{
+    ASSERT_ARGS(str_hash_init)
+    const UHUGEINTVAL k0 = (UHUGEINTVAL)seed;
+
+    st->len     = len;
+    st->siphash = interp->hash_siphash != 0;
+
+    if (st->siphash) {
+        /* stretch the seed to the 128 bit key */
+        UHUGEINTVAL k1 = (k0 ^ HASH_P5) * HASH_P2;
+        k1 ^= k1 >> 29;
+        st->v[0] = k0 ^ HASH_C64(0x736F6D65UL, 0x70736575UL);
+        st->v[1] = k1 ^ HASH_C64(0x646F7261UL, 0x6E646F6DUL);
+        st->v[2] = k0 ^ HASH_C64(0x6C796765UL, 0x6E657261UL);
+        st->v[3] = k1 ^ HASH_C64(0x74656462UL, 0x79746573UL);
+    }
+    else {
+        st->v[0] = k0 + HASH_P1 + HASH_P2;
+        st->v[1] = k0 + HASH_P2;
+        st->v[2] = k0;
+        st->v[3] = k0 - HASH_P1;
+    }
+}
+
+/*
+
+=item C<static UHUGEINTVAL str_hash_word(const unsigned char *p)>
+
+Reads eight bytes of the stream at C<p>, which need not be aligned.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+PARROT_INLINE
+static UHUGEINTVAL
+str_hash_word(ARGIN(const unsigned char *p))
+{
+    ASSERT_ARGS(str_hash_word)
+    UHUGEINTVAL w;
+    memcpy(&w, p, sizeof (w));
+    return w;
+}
+
+/*
+
+=item C<static UHUGEINTVAL str_hash_round(UHUGEINTVAL acc, UHUGEINTVAL input)>
+
+Mixes a word into an xxHash64 lane.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CONST_FUNCTION
+PARROT_INLINE
+static UHUGEINTVAL
+str_hash_round(UHUGEINTVAL acc, UHUGEINTVAL input)
+{
+    ASSERT_ARGS(str_hash_round)
+    acc += input * HASH_P2;
+    acc  = HASH_ROTL(acc, 31);
+    return acc * HASH_P1;
+}
+
+/*
+
+=item C<static void str_hash_block(str_hash_state *st, const unsigned char *p)>
+
+Feeds the next C<HASH_BLOCK_SIZE> bytes of the stream.
+
+=cut
+
+*/
+
+static void
+str_hash_block(ARGMOD(str_hash_state *st), ARGIN(const unsigned char *p))
+{
+    ASSERT_ARGS(str_hash_block)
+    if (st->siphash) {
+        int i;
+        for (i = 0; i < HASH_BLOCK_SIZE; i += 8) {
+            const UHUGEINTVAL m = str_hash_word(p + i);
+            st->v[3] ^= m;
+            SIP_ROUND(st->v);
+            SIP_ROUND(st->v);
+            st->v[0] ^= m;
+        }
+    }
+    else {
+        st->v[0] = str_hash_round(st->v[0], str_hash_word(p));
+        st->v[1] = str_hash_round(st->v[1], str_hash_word(p + 8));
+        st->v[2] = str_hash_round(st->v[2], str_hash_word(p + 16));
+        st->v[3] = str_hash_round(st->v[3], str_hash_word(p + 24));
+    }
+}
+
+/*
+
+=item C<static size_t str_hash_final(str_hash_state *st, const unsigned char *p,
+size_t rest)>
+
+Feeds the last C<rest> bytes of the stream, less than a block, and returns the
+hash value.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static size_t
+str_hash_final(ARGMOD(str_hash_state *st), ARGIN_NULLOK(const unsigned char *p), size_t rest)
+{
+    ASSERT_ARGS(str_hash_final)
+    UHUGEINTVAL h;
+
+    if (st->siphash) {
+        UHUGEINTVAL b = st->len << 56;
+        for (; rest >= 8; rest -= 8, p += 8) {
+            const UHUGEINTVAL m = str_hash_word(p);
+            st->v[3] ^= m;
+            SIP_ROUND(st->v);
+            SIP_ROUND(st->v);
+            st->v[0] ^= m;
+        }
+        while (rest--)
+            b |= (UHUGEINTVAL)p[rest] << (8 * rest);
+
+        st->v[3] ^= b;
+        SIP_ROUND(st->v);
+        SIP_ROUND(st->v);
+        st->v[0] ^= b;
+        st->v[2] ^= 0xFF;
+        SIP_ROUND(st->v);
+        SIP_ROUND(st->v);
+        SIP_ROUND(st->v);
+        SIP_ROUND(st->v);
+
+        return (size_t)(st->v[0] ^ st->v[1] ^ st->v[2] ^ st->v[3]);
+    }
+
+    if (st->len >= HASH_BLOCK_SIZE) {
+        int i;
+        h = HASH_ROTL(st->v[0], 1)  + HASH_ROTL(st->v[1], 7)
+          + HASH_ROTL(st->v[2], 12) + HASH_ROTL(st->v[3], 18);
+        for (i = 0; i < 4; ++i) {
+            h ^= str_hash_round(0, st->v[i]);
+            h  = h * HASH_P1 + HASH_P4;
+        }
+    }
+    else
+        h = st->v[2] + HASH_P5;
+
+    h += st->len;
+
+    for (; rest >= 8; rest -= 8, p += 8) {
+        h ^= str_hash_round(0, str_hash_word(p));
+        h  = HASH_ROTL(h, 27) * HASH_P1 + HASH_P4;
+    }
+    for (; rest; --rest, ++p) {
+        h ^= *p * HASH_P5;
+        h  = HASH_ROTL(h, 11) * HASH_P1;
+    }
+
+    h ^= h >> 33;
+    h *= HASH_P2;
+    h ^= h >> 29;
+    h *= HASH_P3;
+    h ^= h >> 32;
+
+    return (size_t)h;
+}
+
+/*
+
+=item C<static size_t str_hash_bytes(PARROT_INTERP, const unsigned char *p,
+UINTVAL len, size_t seed)>
+
+Hashes C<len> bytes at C<p>, the stream of a string whose codepoints are its
+bytes. C<p> may be NULL for an empty string.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static size_t
+str_hash_bytes(PARROT_INTERP, ARGIN_NULLOK(const unsigned char *p), UINTVAL len, size_t seed)
+{
+    ASSERT_ARGS(str_hash_bytes)
+    str_hash_state st;
+
+    str_hash_init(interp, &st, seed, len);
+
+    for (; len >= HASH_BLOCK_SIZE; len -= HASH_BLOCK_SIZE, p += HASH_BLOCK_SIZE)
+        str_hash_block(&st, p);
+
+    return str_hash_final(&st, p, len);
+}
+
+/*
+
+=item C<static int str_hash_codepoints(PARROT_INTERP, const STRING *s, size_t
+seed, int width, size_t *hashval)>
+
+Hashes the codepoints of C<s> into C<*hashval>, each stored into the stream in
+C<width> bytes, 1 or 4. Returns 0 if a codepoint doesn't fit into a single
+byte; the string then has to be hashed with a C<width> of 4.
+
+=cut
+
+*/
+
+static int
+str_hash_codepoints(PARROT_INTERP, ARGIN(const STRING *s), size_t seed, int width,
+        ARGOUT(size_t *hashval))
+{
+    ASSERT_ARGS(str_hash_codepoints)
+    const UHUGEINTVAL total   = (UHUGEINTVAL)s->strlen * width;
+    UHUGEINTVAL       blocks  = total / HASH_BLOCK_SIZE;
+    unsigned char     buf[HASH_BLOCK_SIZE];
+    size_t            used    = 0;
+    str_hash_state    st;
+    String_iter       iter;
+
+    str_hash_init(interp, &st, seed, total);
+    STRING_ITER_INIT(interp, &iter);
+
+    while (iter.charpos < s->strlen) {
+        const UINTVAL c = STRING_iter_get_and_advance(interp, s, &iter);
+
+        if (width == 1) {
+            if (c > 0xFF)
+                return 0;
+            buf[used++] = (unsigned char)c;
+        }
+        else {
+            const Parrot_UInt4 c4 = (Parrot_UInt4)c;
+            memcpy(buf + used, &c4, 4);
+            used += 4;
+        }
+
+        if (used == HASH_BLOCK_SIZE && blocks) {
+            str_hash_block(&st, buf);
+            used = 0;
+            --blocks;
+        }
+    }
+
+    *hashval = str_hash_final(&st, buf, used);
+    return 1;
+}
+
 /*
 
 =item C<size_t encoding_hash(PARROT_INTERP, const STRING *src, size_t hashval)>
 
 Computes the hash of the given STRING C<src> with starting seed value C<seed>.
 
+Strings of single byte characters are hashed straight from their buffer, a
+word at a time. Otherwise the codepoints are fed through the iterator.
+
 =cut
 
 */
@@ -302,15 +928,12 @@ encoding_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
     ASSERT_ARGS(encoding_hash)
     DECL_CONST_CAST;
     STRING * const s = PARROT_const_cast(STRING *, src);
-    String_iter iter;
-
-    STRING_ITER_INIT(interp, &iter);
 
-    while (iter.charpos < s->strlen) {
-        const UINTVAL c = STRING_iter_get_and_advance(interp, s, &iter);
-        hashval += hashval << 5;
-        hashval += c;
-    }
+    if (s->bufused == s->strlen)
+        hashval = str_hash_bytes(interp,
+                    (const unsigned char *)s->strstart, s->strlen, hashval);
+    else if (!str_hash_codepoints(interp, s, hashval, 1, &hashval))
+        (void)str_hash_codepoints(interp, s, hashval, 4, &hashval);
 
     s->hashval = hashval;
 
@@ -700,18 +1323,13 @@ fixed8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src),
     STRING        *dest;
     const UINTVAL  limit = enc == Parrot_ascii_encoding_ptr ? 0x80 : 0x100;
 
-    if (STRING_max_bytes_per_codepoint(src) == 1) {
-        if (limit < 0x100) {
-            const unsigned char * const ptr = (unsigned char *)src->strstart;
-            UINTVAL i;
-
-            for (i = 0; i < src->strlen; ++i) {
-                if (ptr[i] >= limit)
-                    Parrot_ex_throw_from_c_args(interp, NULL,
-                        EXCEPTION_LOSSY_CONVERSION,
-                        "Lossy conversion to single byte encoding");
-            }
-        }
+    if (STRING_stores_bytes(src)) {
+        if (limit < 0x100
+        &&  encoding_ascii_prefix((unsigned char *)src->strstart, src->strlen)
+                < src->strlen)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_LOSSY_CONVERSION,
+                "Lossy conversion to single byte encoding");
 
         dest           = Parrot_str_copy(interp, src);
         dest->encoding = enc;
@@ -924,22 +1542,14 @@ Returns the hashed value of the string, given a seed in hashval.
 
 PARROT_WARN_UNUSED_RESULT
 size_t
-fixed8_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
+fixed8_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
 {
     ASSERT_ARGS(fixed8_hash)
     DECL_CONST_CAST;
     STRING * const s = PARROT_const_cast(STRING *, src);
-    const unsigned char *pos;
-    UINTVAL len;
-
-    pos = (const unsigned char *)s->strstart;
-    len = s->strlen;
-
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(pos++);
-    }
 
+    hashval    = str_hash_bytes(interp,
+                    (const unsigned char *)s->strstart, s->strlen, hashval);
     s->hashval = hashval;
 
     return hashval;
@@ -11,9 +11,20 @@
 #ifndef PARROT_ENCODING_SHARED_H_GUARD
 #define PARROT_ENCODING_SHARED_H_GUARD
 
+/* True if every character of the string takes one byte, as in the fixed8
+ * encodings and in UTF-8 strings holding only ASCII */
+#define STRING_stores_bytes(s) \
+    (STRING_max_bytes_per_codepoint(s) == 1 \
+    || ((s)->encoding == Parrot_utf8_encoding_ptr && (s)->bufused == (s)->strlen))
+
 /* HEADERIZER BEGIN: src/string/encoding/shared.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_PURE_FUNCTION
+UINTVAL encoding_ascii_prefix(
+    ARGIN_NULLOK(const unsigned char *ptr),
+    UINTVAL len);
+
 PARROT_WARN_UNUSED_RESULT
 INTVAL encoding_compare(PARROT_INTERP,
     ARGIN(const STRING *lhs),
@@ -116,6 +127,13 @@ STRING * encoding_to_encoding(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+void encoding_widen_ascii(
+    ARGOUT_NULLOK(void *dest),
+    ARGIN_NULLOK(const unsigned char *src),
+    UINTVAL len,
+    UINTVAL width)
+        FUNC_MODIFIES(*dest);
+
 PARROT_WARN_UNUSED_RESULT
 INTVAL fixed8_compare(PARROT_INTERP,
     ARGIN(const STRING *lhs),
@@ -156,7 +174,8 @@ INTVAL fixed8_find_not_cclass(PARROT_INTERP,
         __attribute__nonnull__(3);
 
 PARROT_WARN_UNUSED_RESULT
-size_t fixed8_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
+size_t fixed8_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
 PARROT_WARN_UNUSED_RESULT
@@ -277,6 +296,7 @@ PARROT_CANNOT_RETURN_NULL
 STRING* unicode_upcase_first(PARROT_INTERP, SHIM(const STRING *src))
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_encoding_ascii_prefix __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_encoding_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lhs) \
@@ -318,6 +338,7 @@ STRING* unicode_upcase_first(PARROT_INTERP, SHIM(const STRING *src))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src) \
     , PARROT_ASSERT_ARG(encoding))
+#define ASSERT_ARGS_encoding_widen_ascii __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_fixed8_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lhs) \
@@ -336,7 +357,8 @@ STRING* unicode_upcase_first(PARROT_INTERP, SHIM(const STRING *src))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_fixed8_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(src))
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_fixed8_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src) \
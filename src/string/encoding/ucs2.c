@@ -30,11 +30,6 @@ PARROT_INLINE
 static void ucs2_check_codepoint(PARROT_INTERP, UINTVAL c)
         __attribute__nonnull__(1);
 
-static size_t ucs2_hash(SHIM_INTERP,
-    ARGIN(const STRING *src),
-    size_t hashval)
-        __attribute__nonnull__(2);
-
 static UINTVAL ucs2_iter_get(SHIM_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -83,8 +78,6 @@ static STRING * ucs2_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 
 #define ASSERT_ARGS_ucs2_check_codepoint __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
-#define ASSERT_ARGS_ucs2_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_ucs2_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
@@ -315,36 +308,6 @@ ucs2_iter_set_and_advance(PARROT_INTERP,
     i->bytepos += 2;
 }
 
-/*
-
-=item C<static size_t ucs2_hash(PARROT_INTERP, const STRING *src, size_t
-hashval)>
-
-Returns the hashed value of the string, given a seed in hashval.
-
-=cut
-
-*/
-
-static size_t
-ucs2_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
-{
-    ASSERT_ARGS(ucs2_hash)
-    DECL_CONST_CAST;
-    STRING * const s   = PARROT_const_cast(STRING *, src);
-    const utf16_t *ptr = (utf16_t *)s->strstart;
-    UINTVAL        len = s->strlen;
-
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
-    }
-
-    s->hashval = hashval;
-
-    return hashval;
-}
-
 static STR_VTABLE Parrot_ucs2_encoding = {
     0,
     "ucs2",
@@ -358,7 +321,7 @@ static STR_VTABLE Parrot_ucs2_encoding = {
     encoding_compare,
     encoding_index,
     encoding_rindex,
-    ucs2_hash,
+    encoding_hash,
 
     ucs2_scan,
     ucs2_ord,
@@ -26,11 +26,6 @@ UCS-4 encoding
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
-static size_t ucs4_hash(SHIM_INTERP,
-    ARGIN(const STRING *src),
-    size_t hashval)
-        __attribute__nonnull__(2);
-
 static UINTVAL ucs4_iter_get(SHIM_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -77,8 +72,6 @@ static STRING * ucs4_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-#define ASSERT_ARGS_ucs4_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_ucs4_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
@@ -121,34 +114,18 @@ ucs4_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(ucs4_to_encoding)
     const UINTVAL  len = src->strlen;
-    UINTVAL        i;
     STRING        *res;
-    utf32_t       *ptr;
 
     if (src->encoding == Parrot_ucs4_encoding_ptr)
         return Parrot_str_copy(interp, src);
 
+    if (!STRING_stores_bytes(src))
+        return encoding_to_encoding(interp, src, Parrot_ucs4_encoding_ptr, 4.0);
+
     res = Parrot_str_new_init(interp, NULL, len * 4,
             Parrot_ucs4_encoding_ptr, 0);
-    ptr = (utf32_t *)res->strstart;
-
-    if (STRING_max_bytes_per_codepoint(src) == 1) {
-        const unsigned char *s = (unsigned char *)src->strstart;
-
-        for (i = 0; i < len; i++) {
-            ptr[i] = s[i];
-        }
-    }
-    else {
-        String_iter iter;
 
-        STRING_ITER_INIT(interp, &iter);
-
-        while (iter.charpos < len) {
-            i      = iter.charpos;
-            ptr[i] = STRING_iter_get_and_advance(interp, src, &iter);
-        }
-    }
+    encoding_widen_ascii(res->strstart, (unsigned char *)src->strstart, len, 4);
 
     res->strlen  = len;
     res->bufused = len * 4;
@@ -319,37 +296,6 @@ ucs4_iter_set_and_advance(PARROT_INTERP,
 }
 
 
-/*
-
-=item C<static size_t ucs4_hash(PARROT_INTERP, const STRING *src, size_t
-hashval)>
-
-Returns the hashed value of the string, given a seed in hashval.
-
-=cut
-
-*/
-
-static size_t
-ucs4_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
-{
-    ASSERT_ARGS(ucs4_hash)
-    DECL_CONST_CAST;
-    STRING * const  s   = PARROT_const_cast(STRING *, src);
-    const utf32_t  *ptr = (utf32_t *)s->strstart;
-    UINTVAL         len = s->strlen;
-
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
-    }
-
-    s->hashval = hashval;
-
-    return hashval;
-}
-
-
 static STR_VTABLE Parrot_ucs4_encoding = {
     0,
     "ucs4",
@@ -363,7 +309,7 @@ static STR_VTABLE Parrot_ucs4_encoding = {
     encoding_compare,
     encoding_index,
     encoding_rindex,
-    ucs4_hash,
+    encoding_hash,
 
     ucs4_scan,
     ucs4_ord,
@@ -167,22 +167,16 @@ utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 
     src_len = STRING_length(src);
 
-    if (STRING_max_bytes_per_codepoint(src) == 1) {
+    if (STRING_stores_bytes(src)) {
         result           = Parrot_gc_new_string_header(interp, 0);
         result->encoding = Parrot_ucs2_encoding_ptr;
         result->bufused  = 2 * src_len;
         result->strlen   = src_len;
 
         if (src_len) {
-            UINTVAL       i;
-            Parrot_UInt2 *p;
-
             Parrot_gc_allocate_string_storage(interp, result, 2 * src_len);
-            p = (Parrot_UInt2 *)result->strstart;
-
-            for (i = 0; i < src_len; ++i) {
-                p[i] = (unsigned char)src->strstart[i];
-            }
+            encoding_widen_ascii(result->strstart,
+                (unsigned char *)src->strstart, src_len, 2);
         }
     }
     else if (src->encoding == Parrot_utf16_encoding_ptr
@@ -23,6 +23,19 @@ UTF-8 (L<http://www.utf-8.com/>).
 
 /* HEADERIZER HFILE: none */
 
+/* Long strings get a side table holding the byte offset of every
+ * UTF8_INDEX_STEP-th codepoint, so random access skips at most
+ * UTF8_INDEX_STEP - 1 characters instead of scanning from the start. */
+#define UTF8_INDEX_STEP       64
+#define UTF8_INDEX_MIN_LENGTH 256
+
+typedef struct utf8_index_t {
+    UINTVAL strlen;         /* length and layout the index was built for */
+    UINTVAL bufused;
+    INTVAL  start;          /* strstart - bufstart, survives compaction */
+    UINTVAL offsets[1];     /* byte offset of codepoint n * UTF8_INDEX_STEP */
+} Utf8_index;
+
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -36,6 +49,17 @@ static utf8_t * utf8_encode(PARROT_INTERP, ARGMOD(utf8_t *ptr), UINTVAL c)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ptr);
 
+PARROT_CANNOT_RETURN_NULL
+static STRING * utf8_from_fixed8(PARROT_INTERP, ARGIN(const STRING *src))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static UINTVAL utf8_index_seek(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static UINTVAL utf8_iter_get(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -62,10 +86,11 @@ static void utf8_iter_set_and_advance(PARROT_INTERP,
         FUNC_MODIFIES(*str)
         FUNC_MODIFIES(*i);
 
-static void utf8_iter_skip(SHIM_INTERP,
+static void utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGMOD(String_iter *i),
     INTVAL skip)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*i);
@@ -94,12 +119,22 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_PURE_FUNCTION
+static int utf8_use_index(ARGIN(const STRING *str), INTVAL skip)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_utf8_decode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ptr))
 #define ASSERT_ARGS_utf8_encode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_utf8_from_fixed8 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf8_index_seek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf8_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str) \
@@ -113,7 +148,8 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_iter_skip __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(str) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_ord __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -128,6 +164,8 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf8_to_encoding __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf8_use_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(str))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -177,6 +215,9 @@ utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
         result           = Parrot_str_clone(interp, src);
         result->encoding = Parrot_utf8_encoding_ptr;
     }
+    else if (STRING_max_bytes_per_codepoint(src) == 1) {
+        result = utf8_from_fixed8(interp, src);
+    }
     else {
         result = encoding_to_encoding(interp, src, Parrot_utf8_encoding_ptr, 1.2);
     }
@@ -185,6 +226,67 @@ utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 }
 
 
+/*
+
+=item C<static STRING * utf8_from_fixed8(PARROT_INTERP, const STRING *src)>
+
+Converts the latin1 or binary string C<src> to UTF-8.  Runs of ASCII are
+copied as they are, the other bytes become two byte sequences.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+utf8_from_fixed8(PARROT_INTERP, ARGIN(const STRING *src))
+{
+    ASSERT_ARGS(utf8_from_fixed8)
+    const UINTVAL        len   = src->strlen;
+    const unsigned char *s     = (const unsigned char *)src->strstart;
+    UINTVAL              bytes = encoding_ascii_prefix(s, len);
+    UINTVAL              i;
+    STRING              *result;
+    utf8_t              *d;
+
+    if (bytes == len) {
+        result           = Parrot_str_clone(interp, src);
+        result->encoding = Parrot_utf8_encoding_ptr;
+        return result;
+    }
+
+    for (i = bytes; i < len; ++i)
+        bytes += 1 + (s[i] >> 7);
+
+    result = Parrot_str_new_init(interp, NULL, bytes,
+                Parrot_utf8_encoding_ptr, 0);
+
+    /* allocating may have moved the source buffer */
+    s = (const unsigned char *)src->strstart;
+    d = (utf8_t *)result->strstart;
+    i = 0;
+
+    while (i < len) {
+        const UINTVAL run = encoding_ascii_prefix(s + i, len - i);
+
+        memcpy(d, s + i, run);
+        d += run;
+        i += run;
+
+        if (i < len) {
+            *d++ = (utf8_t)(0xC0 | (s[i] >> 6));
+            *d++ = (utf8_t)(0x80 | (s[i] & 0x3F));
+            ++i;
+        }
+    }
+
+    result->bufused = bytes;
+    result->strlen  = len;
+
+    return result;
+}
+
+
 /*
 
 =item C<static UINTVAL utf8_scan(PARROT_INTERP, const STRING *src)>
@@ -204,7 +306,16 @@ utf8_scan(PARROT_INTERP, ARGIN(const STRING *src))
     UINTVAL characters = 0;
 
     while (u8ptr < u8end) {
-        UINTVAL c = *u8ptr;
+        const UINTVAL ascii = encoding_ascii_prefix(u8ptr, u8end - u8ptr);
+        UINTVAL       c;
+
+        u8ptr      += ascii;
+        characters += ascii;
+
+        if (u8ptr == u8end)
+            break;
+
+        c = *u8ptr;
 
         if (UTF8_IS_START(c)) {
             size_t len = UTF8SKIP(u8ptr);
@@ -271,7 +382,12 @@ utf8_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     if ((UINTVAL)idx >= len)
         encoding_ord_error(interp, src, idx);
 
-    start = utf8_skip_forward((utf8_t *)src->strstart, idx);
+    if (src->bufused == len)
+        start = (utf8_t *)src->strstart + idx;
+    else if (idx >= UTF8_INDEX_STEP && len >= UTF8_INDEX_MIN_LENGTH)
+        start = (utf8_t *)src->strstart + utf8_index_seek(interp, src, idx);
+    else
+        start = utf8_skip_forward((utf8_t *)src->strstart, idx);
 
     return utf8_decode(interp, start);
 }
@@ -394,6 +510,101 @@ utf8_skip_backward(ARGIN(const utf8_t *ptr), UINTVAL n)
 }
 
 
+/*
+
+=item C<static int utf8_use_index(const STRING *str, INTVAL skip)>
+
+Returns true if moving C<skip> characters within C<str> should go through
+the codepoint index instead of walking the bytes.  Pure ASCII strings map
+codepoints to bytes directly and count as indexed.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static int
+utf8_use_index(ARGIN(const STRING *str), INTVAL skip)
+{
+    ASSERT_ARGS(utf8_use_index)
+
+    if (str->bufused == str->strlen)
+        return skip != 0;
+
+    return (skip > UTF8_INDEX_STEP || skip < -UTF8_INDEX_STEP)
+        && str->strlen >= UTF8_INDEX_MIN_LENGTH;
+}
+
+
+/*
+
+=item C<static UINTVAL utf8_index_seek(PARROT_INTERP, const STRING *src, UINTVAL
+n)>
+
+Returns the byte offset of codepoint C<n> in C<src>, building the codepoint
+index of C<src> on first use.
+
+The index lives in C<interp-E<gt>str_index_table>, keyed by the string
+header.  It is dropped by the GC when the header dies and by
+C<utf8_iter_set_and_advance> when the string is modified; an entry whose
+length or layout no longer matches its string is rebuilt here.
+
+=cut
+
+*/
+
+static UINTVAL
+utf8_index_seek(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL n)
+{
+    ASSERT_ARGS(utf8_index_seek)
+    const utf8_t * const start = (const utf8_t *)src->strstart;
+    const INTVAL         shift = src->strstart - (char *)Buffer_bufstart(src);
+    Hash                *table = interp->str_index_table;
+    Utf8_index          *index = NULL;
+    DECL_CONST_CAST;
+
+    if (src->bufused == src->strlen)
+        return n;
+
+    if (!table)
+        table = interp->str_index_table = parrot_new_pointer_hash(interp);
+    else
+        index = (Utf8_index *)parrot_hash_get(interp, table, src);
+
+    if (index
+    && (index->strlen != src->strlen
+    ||  index->bufused != src->bufused
+    ||  index->start   != shift)) {
+        mem_internal_free(index);
+        index = NULL;
+    }
+
+    if (!index) {
+        const UINTVAL  count = src->strlen / UTF8_INDEX_STEP + 1;
+        const utf8_t  *ptr   = start;
+        UINTVAL        k;
+
+        index = (Utf8_index *)mem_internal_allocate(sizeof (Utf8_index)
+                    + (count - 1) * sizeof (UINTVAL));
+        index->strlen     = src->strlen;
+        index->bufused    = src->bufused;
+        index->start      = shift;
+        index->offsets[0] = 0;
+
+        for (k = 1; k < count; ++k) {
+            ptr = utf8_skip_forward(ptr, UTF8_INDEX_STEP);
+            index->offsets[k] = ptr - start;
+        }
+
+        parrot_hash_put(interp, table, PARROT_const_cast(STRING *, src), index);
+        PObj_flag_SET(str_indexed, PARROT_const_cast(STRING *, src));
+    }
+
+    return utf8_skip_forward(start + index->offsets[n / UTF8_INDEX_STEP],
+                n % UTF8_INDEX_STEP) - start;
+}
+
+
 /*
 
 =item C<static UINTVAL utf8_iter_get(PARROT_INTERP, const STRING *str, const
@@ -414,7 +625,10 @@ utf8_iter_get(PARROT_INTERP,
 
     PARROT_ASSERT(i->charpos + offset < str->strlen);
 
-    if (offset > 0)
+    if (utf8_use_index(str, offset))
+        ptr = (utf8_t *)str->strstart
+            + utf8_index_seek(interp, str, i->charpos + offset);
+    else if (offset > 0)
         ptr = utf8_skip_forward(ptr, offset);
     else if (offset < 0)
         ptr = utf8_skip_backward(ptr, -offset);
@@ -435,7 +649,7 @@ Moves the string iterator C<i> by C<skip> characters.
 */
 
 static void
-utf8_iter_skip(SHIM_INTERP,
+utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str), ARGMOD(String_iter *i), INTVAL skip)
 {
     ASSERT_ARGS(utf8_iter_skip)
@@ -445,6 +659,11 @@ utf8_iter_skip(SHIM_INTERP,
 
     PARROT_ASSERT(i->charpos <= str->strlen);
 
+    if (utf8_use_index(str, skip)) {
+        i->bytepos = utf8_index_seek(interp, str, i->charpos);
+        return;
+    }
+
     if (skip > 0)
         ptr = utf8_skip_forward(ptr, skip);
     else if (skip < 0)
@@ -505,6 +724,9 @@ utf8_iter_set_and_advance(PARROT_INTERP,
     utf8_t * const ptr = (utf8_t *)(str->strstart + i->bytepos);
     utf8_t * const end = utf8_encode(interp, ptr, c);
 
+    if (PObj_flag_TEST(str_indexed, str))
+        Parrot_str_drop_index(interp, str);
+
     i->charpos += 1;
     i->bytepos += end - ptr;
 
@@ -427,6 +427,8 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
                 PMC_get_sub(interp, child_sub->outer_sub, child_outer_sub);
                 if (STRING_equal(interp, current_sub->subid,
                                       child_outer_sub->subid)) {
+                    Parrot_pcc_capture_context(interp, ctx);
+                    PARROT_GC_WRITE_BARRIER(interp, child_pmc);
                     child_sub->outer_ctx = ctx;
                 }
             }
@@ -440,6 +442,8 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
         return;
 
     /* set the sub's outer context to the current context */
+    Parrot_pcc_capture_context(interp, ctx);
+    PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
     sub->outer_ctx = ctx;
 }
 
@@ -472,6 +476,43 @@ Parrot_sub_new_closure(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 }
 
 
+/*
+
+=item C<PMC* Parrot_sub_new_return_continuation(PARROT_INTERP)>
+
+Creates the return continuation of a call made from the current context.
+Unlike a Continuation created with C<new>, it does not mark the context as
+escaped: it is only reachable through the callee's context, and returning
+through it pops the callee's frame.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC*
+Parrot_sub_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_sub_new_return_continuation)
+    PMC * const cont   = Parrot_pmc_new_noinit(interp, enum_class_Continuation);
+    PMC * const to_ctx = CURRENT_CONTEXT(interp);
+    Parrot_Continuation_attributes * const cc = PARROT_CONTINUATION(cont);
+
+    cc->to_ctx         = to_ctx;
+    cc->to_call_object = Parrot_pcc_get_signature(interp, to_ctx);
+    cc->from_ctx       = to_ctx;
+    cc->runloop_id     = 0;
+    cc->invoked        = 0;
+    cc->seg            = interp->code;
+    cc->address        = NULL;
+
+    PObj_custom_mark_SET(cont);
+
+    return cont;
+}
+
+
 /*
 
 =item C<void Parrot_sub_continuation_check(PARROT_INTERP, const PMC *pmc)>
@@ -520,9 +561,10 @@ Parrot_sub_continuation_rewind_environment(PARROT_INTERP, ARGIN(PMC *pmc))
                     interp->dynamic_env);
     }
 
-    /* set context */
+    /* set context, popping the frames of everything it called */
     CURRENT_CONTEXT(interp) = to_ctx;
     Parrot_pcc_set_signature(interp, to_ctx, sig);
+    Parrot_pcc_release_frames(interp, to_ctx);
 }
 
 
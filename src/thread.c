@@ -23,6 +23,22 @@ Threads are created by creating new C<ParrotInterpreter> objects.
 #include "parrot/runcore_api.h"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_parrotinterpreter.h"
+#include "pmc/pmc_hash.h"
+#include "pmc/pmc_fixedpmcarray.h"
+#include "pmc/pmc_fixedstringarray.h"
+#include "pmc/pmc_string.h"
+#include "pmc/pmc_sharedref.h"
+
+/* PMCs to visit while publishing or reclaiming */
+typedef struct _Shared_walk {
+    Hash   *seen;
+    PMC   **queue;
+    size_t  count;
+    size_t  size;
+} Shared_walk;
+
+typedef void (*shared_pmc_slot_f)(PARROT_INTERP, PMC **slot, void *data);
+typedef void (*shared_string_slot_f)(PARROT_INTERP, STRING **slot, void *data);
 
 /* HEADERIZER HFILE: include/parrot/thread.h */
 
@@ -92,6 +108,75 @@ static void pt_thread_signal(ARGIN(Parrot_Interp self), PARROT_INTERP)
 static void pt_thread_wait(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void shared_collect_published(PARROT_INTERP,
+    ARGIN(PMC **slot),
+    ARGMOD(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data);
+
+static void shared_collect_unpublished(PARROT_INTERP,
+    ARGIN(PMC **slot),
+    ARGMOD(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data);
+
+static void shared_copy_string(PARROT_INTERP,
+    ARGMOD(STRING **slot),
+    SHIM(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*slot);
+
+static void shared_each_child(PARROT_INTERP,
+    ARGIN(PMC *pmc),
+    ARGIN_NULLOK(shared_pmc_slot_f pmc_fn),
+    ARGIN_NULLOK(shared_string_slot_f string_fn),
+    ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int shared_is_publishable(SHIM_INTERP, ARGIN(const PMC *pmc))
+        __attribute__nonnull__(2);
+
+static void shared_publish_graph(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void shared_rcu_free(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void shared_reclaim(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void shared_release_string(PARROT_INTERP,
+    ARGMOD(STRING **slot),
+    SHIM(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*slot);
+
+static void shared_unpin(PARROT_INTERP, ARGIN(const Shared_pin *pin))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void shared_walk_destroy(PARROT_INTERP, ARGMOD(Shared_walk *walk))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*walk);
+
+static void shared_walk_push(PARROT_INTERP,
+    ARGMOD(Shared_walk *walk),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*walk);
+
 PARROT_CAN_RETURN_NULL
 static void* thread_func(ARGIN_NULLOK(void *arg));
 
@@ -129,6 +214,42 @@ static void* thread_func(ARGIN_NULLOK(void *arg));
     , PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_pt_thread_wait __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_shared_collect_published __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(slot) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_shared_collect_unpublished __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(slot) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_shared_copy_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(slot))
+#define ASSERT_ARGS_shared_each_child __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_shared_is_publishable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_shared_publish_graph __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_shared_rcu_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_shared_reclaim __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_shared_release_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(slot))
+#define ASSERT_ARGS_shared_unpin __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pin))
+#define ASSERT_ARGS_shared_walk_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(walk))
+#define ASSERT_ARGS_shared_walk_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(walk) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_thread_func __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
@@ -171,6 +292,18 @@ make_local_copy(PARROT_INTERP, ARGIN(Parrot_Interp from), ARGIN(PMC *arg))
     }
     else if (PObj_is_PMC_shared_TEST(arg)) {
         ret_val = arg;
+
+        /* a published version: keep it until the receiver quiesces */
+        if (PObj_constant_TEST(arg) && shared_rcu_info
+        &&  interp->thread_data && interp->thread_data->tid
+        &&  arg->vtable->base_type != enum_class_SharedRef) {
+            const UINTVAL epoch = from->thread_data && from->thread_data->tid
+                                ? from->thread_data->shared_epoch
+                                : shared_rcu_info->reclaimed;
+
+            if (epoch < interp->thread_data->shared_epoch)
+                interp->thread_data->shared_epoch = epoch;
+        }
     }
     else if (VTABLE_isa(from, arg, _multi_sub)) {
         INTVAL i = 0;
@@ -1243,7 +1376,8 @@ pt_thread_join(ARGIN(Parrot_Interp parent), UINTVAL tid)
 =item C<void pt_join_threads(PARROT_INTERP)>
 
 Possibly waits for other running threads. This is called when destroying
-C<interp>.
+C<interp>.  Published PMCs are unpinned afterwards, to be destroyed with all
+others.
 
 =cut
 
@@ -1261,6 +1395,7 @@ pt_join_threads(PARROT_INTERP)
     if (n_interpreters <= 1) {
         n_interpreters = 0;
         UNLOCK(interpreter_array_mutex);
+        shared_rcu_free(interp);
         return;
     }
 
@@ -1285,6 +1420,7 @@ pt_join_threads(PARROT_INTERP)
         }
     }
     UNLOCK(interpreter_array_mutex);
+    shared_rcu_free(interp);
     return;
 }
 
@@ -1406,6 +1542,8 @@ pt_add_to_interpreters(PARROT_INTERP, ARGIN_NULLOK(Parrot_Interp new_interp))
         PARROT_ATOMIC_INT_INIT(shared_gc_info->gc_block_level);
         PARROT_ATOMIC_INT_SET(shared_gc_info->gc_block_level, 0);
 
+        shared_rcu_info = mem_internal_allocate_zeroed_typed(Shared_rcu_info);
+
         /* XXX try to defer this until later */
         PARROT_ASSERT(interp == interpreter_array[0]);
         interp->thread_data      = mem_internal_allocate_zeroed_typed(Thread_data);
@@ -1418,6 +1556,13 @@ pt_add_to_interpreters(PARROT_INTERP, ARGIN_NULLOK(Parrot_Interp new_interp))
 
     new_interp->thread_data = mem_internal_allocate_zeroed_typed(Thread_data);
     INTERPRETER_LOCK_INIT(new_interp);
+
+    /* it may get whatever its creator holds */
+    if (shared_rcu_info)
+        new_interp->thread_data->shared_epoch =
+            interp->thread_data && interp->thread_data->tid
+                ? interp->thread_data->shared_epoch
+                : shared_rcu_info->reclaimed;
     ++running_threads;
     if (Interp_debug_TEST(interp, PARROT_THREAD_DEBUG_FLAG))
         fprintf(stderr, "running threads %d\n", running_threads);
@@ -1649,6 +1794,640 @@ Parrot_shared_gc_unblock(PARROT_INTERP)
     }
 }
 
+/*
+
+=back
+
+=head2 Read-copy-update publication
+
+A published PMC graph is pinned: the collectors neither trace nor free it, and
+its PMCs are read-only, so every thread interpreter reads it without locks or
+copies.  Only the main interpreter publishes.  Replacing a version retires the
+old one.  A retired version is unpinned and writable again after a grace
+period: once every running thread interpreter has passed a quiescent state,
+see C<Parrot_shared_quiescent>, or has finished.
+
+Strings of a published graph are copied into system memory, which is never
+compacted, and made constant.  Each copy belongs to the published PMC holding
+it, and goes back to the collector when that PMC is unpinned.
+
+=over 4
+
+=item C<static int shared_is_publishable(PARROT_INTERP, const PMC *pmc)>
+
+Check that C<pmc> is of a type whose children C<shared_each_child> knows, and
+which has a read-only variant.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+shared_is_publishable(SHIM_INTERP, ARGIN(const PMC *pmc))
+{
+    ASSERT_ARGS(shared_is_publishable)
+
+    if (PObj_is_object_TEST(pmc))
+        return 0;
+
+    switch (pmc->vtable->base_type) {
+      case enum_class_SharedRef:
+        return 1;
+      case enum_class_Hash:
+      case enum_class_FixedPMCArray:
+      case enum_class_ResizablePMCArray:
+      case enum_class_FixedStringArray:
+      case enum_class_ResizableStringArray:
+      case enum_class_FixedIntegerArray:
+      case enum_class_ResizableIntegerArray:
+      case enum_class_FixedFloatArray:
+      case enum_class_ResizableFloatArray:
+      case enum_class_FixedBooleanArray:
+      case enum_class_ResizableBooleanArray:
+      case enum_class_String:
+      case enum_class_Integer:
+      case enum_class_Float:
+      case enum_class_Boolean:
+        return pmc->vtable->ro_variant_vtable != NULL;
+      default:
+        return 0;
+    }
+}
+
+/*
+
+=item C<static void shared_each_child(PARROT_INTERP, PMC *pmc, shared_pmc_slot_f
+pmc_fn, shared_string_slot_f string_fn, void *data)>
+
+Call C<pmc_fn> on every PMC slot and C<string_fn> on every STRING slot of
+publishable C<pmc>.  Either function can be NULL.
+
+=cut
+
+*/
+
+static void
+shared_each_child(PARROT_INTERP, ARGIN(PMC *pmc),
+        ARGIN_NULLOK(shared_pmc_slot_f pmc_fn),
+        ARGIN_NULLOK(shared_string_slot_f string_fn), ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(shared_each_child)
+
+    switch (pmc->vtable->base_type) {
+      case enum_class_Hash:
+        {
+            Hash * const hash = PARROT_HASH(pmc)->hash;
+            const int    pmc_keys = hash->key_type == Hash_key_type_PMC
+                                 || hash->key_type == Hash_key_type_PMC_ptr;
+            const int    str_keys = hash->key_type == Hash_key_type_STRING
+                                 || hash->key_type == Hash_key_type_STRING_enc;
+
+            parrot_hash_iterate(hash,
+                if (pmc_keys && pmc_fn)
+                    pmc_fn(interp, (PMC **)&_bucket->key, data);
+                else if (str_keys && string_fn)
+                    string_fn(interp, (STRING **)&_bucket->key, data);
+
+                if (hash->entry_type == enum_type_PMC && pmc_fn)
+                    pmc_fn(interp, (PMC **)&_bucket->value, data);
+                else if (hash->entry_type == enum_type_STRING && string_fn)
+                    string_fn(interp, (STRING **)&_bucket->value, data););
+        }
+        break;
+      case enum_class_FixedPMCArray:
+      case enum_class_ResizablePMCArray:
+        if (pmc_fn) {
+            Parrot_FixedPMCArray_attributes * const attrs =
+                PARROT_FIXEDPMCARRAY(pmc);
+            INTVAL i;
+
+            for (i = 0; i < attrs->size; ++i)
+                pmc_fn(interp, &attrs->pmc_array[i], data);
+        }
+        break;
+      case enum_class_FixedStringArray:
+      case enum_class_ResizableStringArray:
+        if (string_fn) {
+            Parrot_FixedStringArray_attributes * const attrs =
+                PARROT_FIXEDSTRINGARRAY(pmc);
+            UINTVAL i;
+
+            for (i = 0; i < attrs->size; ++i)
+                string_fn(interp, &attrs->str_array[i], data);
+        }
+        break;
+      case enum_class_String:
+        if (string_fn)
+            string_fn(interp, &PARROT_STRING(pmc)->str_val, data);
+        break;
+      case enum_class_SharedRef:
+        if (pmc_fn) {
+            void *current;
+            PMC  *value;
+
+            PARROT_ATOMIC_PTR_GET(current, PARROT_SHAREDREF(pmc)->current);
+            value = (PMC *)current;
+            pmc_fn(interp, &value, data);
+        }
+        break;
+      default:
+        break;
+    }
+
+    if (pmc_fn && PMC_metadata(pmc))
+        pmc_fn(interp, &PMC_metadata(pmc), data);
+}
+
+/*
+
+=item C<static void shared_walk_push(PARROT_INTERP, Shared_walk *walk, PMC
+*pmc)>
+
+Queue C<pmc> on C<walk>, unless it was seen already.
+
+=cut
+
+*/
+
+static void
+shared_walk_push(PARROT_INTERP, ARGMOD(Shared_walk *walk), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(shared_walk_push)
+
+    if (parrot_hash_exists(interp, walk->seen, pmc))
+        return;
+
+    parrot_hash_put(interp, walk->seen, pmc, pmc);
+
+    if (walk->count == walk->size) {
+        walk->size  = walk->size ? walk->size * 2 : 16;
+        mem_realloc_n_typed(walk->queue, walk->size, PMC *);
+    }
+
+    walk->queue[walk->count++] = pmc;
+}
+
+/*
+
+=item C<static void shared_collect_unpublished(PARROT_INTERP, PMC **slot, void
+*data)>
+
+Queue a child not published yet.  Constant children are published or live
+for good anyway.
+
+=cut
+
+*/
+
+static void
+shared_collect_unpublished(PARROT_INTERP, ARGIN(PMC **slot), ARGMOD(void *data))
+{
+    ASSERT_ARGS(shared_collect_unpublished)
+    PMC * const pmc = *slot;
+
+    if (!PMC_IS_NULL(pmc) && !PObj_constant_TEST(pmc))
+        shared_walk_push(interp, (Shared_walk *)data, pmc);
+}
+
+/*
+
+=item C<static void shared_collect_published(PARROT_INTERP, PMC **slot, void
+*data)>
+
+Queue a published child.
+
+=cut
+
+*/
+
+static void
+shared_collect_published(PARROT_INTERP, ARGIN(PMC **slot), ARGMOD(void *data))
+{
+    ASSERT_ARGS(shared_collect_published)
+    PMC * const pmc = *slot;
+
+    if (!PMC_IS_NULL(pmc) && PObj_constant_TEST(pmc)
+    &&  PObj_is_PMC_shared_TEST(pmc))
+        shared_walk_push(interp, (Shared_walk *)data, pmc);
+}
+
+/*
+
+=item C<static void shared_copy_string(PARROT_INTERP, STRING **slot, void
+*data)>
+
+Replace the string in C<slot> by a constant copy in system memory, with its
+hash value computed in advance, so readers never write to it.  A copy made for
+another published PMC is copied again, so every copy has a single owner.
+
+=cut
+
+*/
+
+static void
+shared_copy_string(PARROT_INTERP, ARGMOD(STRING **slot), SHIM(void *data))
+{
+    ASSERT_ARGS(shared_copy_string)
+    STRING * const s = *slot;
+
+    if (!STRING_IS_NULL(s) && (!PObj_constant_TEST(s) || PObj_sysmem_TEST(s))) {
+        STRING * const copy   = Parrot_gc_new_string_header(interp, 0);
+        char   * const memory = (char *)mem_internal_allocate(s->bufused + 1);
+
+        mem_sys_memcopy(memory, s->strstart, s->bufused);
+        Buffer_bufstart(copy) = memory;
+        Buffer_buflen(copy)   = s->bufused;
+        copy->strstart        = memory;
+        copy->bufused         = s->bufused;
+        copy->strlen          = s->strlen;
+        copy->encoding        = s->encoding;
+        copy->hashval         = Parrot_str_to_hashval(interp, copy);
+        PObj_sysmem_SET(copy);
+        PObj_constant_SET(copy);
+        *slot = copy;
+    }
+}
+
+/*
+
+=item C<static void shared_release_string(PARROT_INTERP, STRING **slot, void
+*data)>
+
+Hand a copy made by C<shared_copy_string> back to the collector.  The main
+interpreter may still refer to it, so it is moved back into managed memory
+rather than freed.
+
+=cut
+
+*/
+
+static void
+shared_release_string(PARROT_INTERP, ARGMOD(STRING **slot), SHIM(void *data))
+{
+    ASSERT_ARGS(shared_release_string)
+    STRING * const s = *slot;
+
+    if (!STRING_IS_NULL(s) && PObj_constant_TEST(s) && PObj_sysmem_TEST(s)) {
+        PObj_constant_CLEAR(s);
+        PObj_live_CLEAR(s);
+        Parrot_str_unpin(interp, s);
+    }
+}
+
+/*
+
+=item C<static void shared_walk_destroy(PARROT_INTERP, Shared_walk *walk)>
+
+Free the bookkeeping of C<walk>.
+
+=cut
+
+*/
+
+static void
+shared_walk_destroy(PARROT_INTERP, ARGMOD(Shared_walk *walk))
+{
+    ASSERT_ARGS(shared_walk_destroy)
+
+    parrot_hash_destroy(interp, walk->seen);
+    if (walk->queue)
+        mem_internal_free(walk->queue);
+}
+
+/*
+
+=item C<static void shared_publish_graph(PARROT_INTERP, PMC *pmc)>
+
+Publish C<pmc> and everything it refers to.  Nothing is published if any of
+it can't be.
+
+=cut
+
+*/
+
+static void
+shared_publish_graph(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(shared_publish_graph)
+    Shared_rcu_info * const info = shared_rcu_info;
+    Shared_walk             walk;
+    size_t                  i;
+
+    if (!info || !interp->thread_data || interp->thread_data->tid)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Only the main interpreter can publish shared PMCs");
+
+    if (PMC_IS_NULL(pmc) || PObj_constant_TEST(pmc))
+        return;
+
+    walk.seen  = parrot_new_pointer_hash(interp);
+    walk.queue = NULL;
+    walk.count = 0;
+    walk.size  = 0;
+
+    shared_walk_push(interp, &walk, pmc);
+
+    for (i = 0; i < walk.count; ++i) {
+        PMC * const child = walk.queue[i];
+
+        if (!shared_is_publishable(interp, child)) {
+            STRING * const name = child->vtable->whoami;
+            shared_walk_destroy(interp, &walk);
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_INVALID_OPERATION,
+                "Can't publish a %Ss for sharing", name);
+        }
+
+        shared_each_child(interp, child, shared_collect_unpublished, NULL,
+            &walk);
+    }
+
+    if (info->pin_count + walk.count > info->pin_size) {
+        while (info->pin_count + walk.count > info->pin_size)
+            info->pin_size = info->pin_size ? info->pin_size * 2 : 64;
+        mem_realloc_n_typed(info->pins, info->pin_size, Shared_pin);
+    }
+
+    Parrot_block_GC_mark(interp);
+
+    for (i = 0; i < walk.count; ++i) {
+        PMC        * const child = walk.queue[i];
+        Shared_pin * const pin   = &info->pins[info->pin_count++];
+
+        shared_each_child(interp, child, NULL, shared_copy_string, NULL);
+
+        Parrot_gc_pin_pmc(interp, child);
+        PObj_is_PMC_shared_SET(child);
+
+        pin->pmc     = child;
+        pin->made_ro = child->vtable->base_type != enum_class_SharedRef
+                    && !(child->vtable->flags & VTABLE_IS_READONLY_FLAG);
+
+        if (pin->made_ro)
+            child->vtable = child->vtable->ro_variant_vtable;
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    shared_walk_destroy(interp, &walk);
+}
+
+/*
+
+=item C<static void shared_unpin(PARROT_INTERP, const Shared_pin *pin)>
+
+Hand a published PMC and its string copies back to its owner, the main
+interpreter.
+
+=cut
+
+*/
+
+static void
+shared_unpin(PARROT_INTERP, ARGIN(const Shared_pin *pin))
+{
+    ASSERT_ARGS(shared_unpin)
+    PMC * const pmc = pin->pmc;
+
+    shared_each_child(interp, pmc, NULL, shared_release_string, NULL);
+
+    if (pin->made_ro)
+        pmc->vtable = pmc->vtable->ro_variant_vtable;
+
+    PObj_is_PMC_shared_CLEAR(pmc);
+    Parrot_gc_unpin_pmc(interp, pmc);
+}
+
+/*
+
+=item C<static void shared_reclaim(PARROT_INTERP)>
+
+Unpin the retired versions whose grace period is over, except for the parts
+still published by a root or by a younger version.
+
+=cut
+
+*/
+
+static void
+shared_reclaim(PARROT_INTERP)
+{
+    ASSERT_ARGS(shared_reclaim)
+    Shared_rcu_info * const info = shared_rcu_info;
+    Shared_walk             walk;
+    UINTVAL                 safe;
+    size_t                  i, kept;
+
+    LOCK(interpreter_array_mutex);
+    safe = info->epoch;
+    for (i = 1; i < n_interpreters; ++i) {
+        const Parrot_Interp other = interpreter_array[i];
+        if (other && other->thread_data->shared_epoch < safe)
+            safe = other->thread_data->shared_epoch;
+    }
+    UNLOCK(interpreter_array_mutex);
+
+    if (safe <= info->reclaimed)
+        return;
+
+    walk.seen  = parrot_new_pointer_hash(interp);
+    walk.queue = NULL;
+    walk.count = 0;
+    walk.size  = 0;
+
+    for (i = 0; i < info->root_count; ++i)
+        shared_walk_push(interp, &walk, info->roots[i]);
+
+    for (i = kept = 0; i < info->retired_count; ++i) {
+        if (info->retired[i].epoch > safe) {
+            shared_walk_push(interp, &walk, info->retired[i].pmc);
+            info->retired[kept++] = info->retired[i];
+        }
+    }
+    info->retired_count = kept;
+
+    for (i = 0; i < walk.count; ++i)
+        shared_each_child(interp, walk.queue[i], shared_collect_published,
+            NULL, &walk);
+
+    Parrot_block_GC_mark(interp);
+
+    for (i = kept = 0; i < info->pin_count; ++i) {
+        if (parrot_hash_exists(interp, walk.seen, info->pins[i].pmc))
+            info->pins[kept++] = info->pins[i];
+        else
+            shared_unpin(interp, &info->pins[i]);
+    }
+    info->pin_count = kept;
+
+    Parrot_unblock_GC_mark(interp);
+
+    info->reclaimed = safe;
+    shared_walk_destroy(interp, &walk);
+}
+
+/*
+
+=item C<void Parrot_shared_publish(PARROT_INTERP, PMC *pmc)>
+
+Publish C<pmc> for good: it stays pinned and read-only until the main
+interpreter exits.  Throws if C<pmc> refers to something not publishable, or
+if called in a thread interpreter.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_shared_publish(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_shared_publish)
+    Shared_rcu_info * const info = shared_rcu_info;
+
+    shared_publish_graph(interp, pmc);
+
+    if (info->root_count == info->root_size) {
+        info->root_size = info->root_size ? info->root_size * 2 : 16;
+        mem_realloc_n_typed(info->roots, info->root_size, PMC *);
+    }
+
+    info->roots[info->root_count++] = pmc;
+}
+
+/*
+
+=item C<void Parrot_shared_publish_version(PARROT_INTERP, PMC *pmc)>
+
+Publish C<pmc> as a new version of some shared data.  It stays published
+while reachable from a root, see C<Parrot_shared_publish>, and for the grace
+period after C<Parrot_shared_retire>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_shared_publish_version(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_shared_publish_version)
+    shared_publish_graph(interp, pmc);
+}
+
+/*
+
+=item C<void Parrot_shared_retire(PARROT_INTERP, PMC *pmc)>
+
+Retire the published version C<pmc>, which readers can't find anymore, and
+reclaim the versions whose grace period is over.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_shared_retire(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_shared_retire)
+    Shared_rcu_info * const info = shared_rcu_info;
+    Shared_version   *version;
+
+    if (!info || !PObj_is_PMC_shared_TEST(pmc) || !PObj_constant_TEST(pmc))
+        return;
+
+    if (info->retired_count == info->retired_size) {
+        info->retired_size = info->retired_size ? info->retired_size * 2 : 16;
+        mem_realloc_n_typed(info->retired, info->retired_size, Shared_version);
+    }
+
+    version      = &info->retired[info->retired_count++];
+    version->pmc = pmc;
+
+    LOCK(interpreter_array_mutex);
+    version->epoch = ++info->epoch;
+    UNLOCK(interpreter_array_mutex);
+
+    shared_reclaim(interp);
+}
+
+/*
+
+=item C<void Parrot_shared_quiescent(PARROT_INTERP)>
+
+Declare that the thread interpreter holds no references to published PMCs
+obtained so far, other than through roots.  In the main interpreter, reclaim
+the retired versions whose grace period is over.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_shared_quiescent(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_shared_quiescent)
+    Shared_rcu_info * const info = shared_rcu_info;
+
+    if (!info || !interp->thread_data)
+        return;
+
+    if (!interp->thread_data->tid) {
+        shared_reclaim(interp);
+        return;
+    }
+
+    LOCK(interpreter_array_mutex);
+    interp->thread_data->shared_epoch = info->epoch;
+    UNLOCK(interpreter_array_mutex);
+}
+
+/*
+
+=item C<static void shared_rcu_free(PARROT_INTERP)>
+
+Unpin everything published, so interpreter destruction frees it, and free
+the bookkeeping.
+
+=cut
+
+*/
+
+static void
+shared_rcu_free(PARROT_INTERP)
+{
+    ASSERT_ARGS(shared_rcu_free)
+    Shared_rcu_info * const info = shared_rcu_info;
+    size_t                  i;
+
+    if (!info)
+        return;
+
+    for (i = 0; i < info->pin_count; ++i)
+        shared_unpin(interp, &info->pins[i]);
+
+    if (info->roots)
+        mem_internal_free(info->roots);
+    if (info->retired)
+        mem_internal_free(info->retired);
+    if (info->pins)
+        mem_internal_free(info->pins);
+
+    mem_internal_free(info);
+    shared_rcu_info = NULL;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
 /*
  * Local variables:
  *   c-file-style: "parrot"
@@ -4,7 +4,7 @@
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
-use Parrot::Test tests => 77;
+use Parrot::Test tests => 80;
 use Parrot::Config;
 
 my $output;
@@ -1203,6 +1203,83 @@ CODE
 /
 OUT
 
+##############################
+pir_2_pasm_is( <<'CODE', <<'OUT', "superinstructions" );
+.loadlib 'super_ops'
+.sub _main
+    $I0 = 0
+L1:
+    inc $I0
+    if $I0 < 10 goto L1
+L2:
+    dec $I0
+    if $I0 > 5 goto L2
+L3:
+    $I0 -= 2
+    if $I0 goto L3
+    end
+.end
+CODE
+# IMCC does produce b0rken PASM files
+# see http://guest@rt.perl.org/rt3/Ticket/Display.html?id=32392
+_main:
+    null I0
+L1:
+    inc_lt I0, 10, L1
+L2:
+    dec_gt I0, 5, L2
+L3:
+    sub_if I0, 2, L3
+    end
+OUT
+
+##############################
+pir_2_pasm_is( <<'CODE', <<'OUT', "superinstructions - branch target not fused" );
+.loadlib 'super_ops'
+.sub _main
+    $I0 = 0
+L1:
+    inc $I0
+L2:
+    if $I0 < 10 goto L1
+    $I1 = 1
+    if $I1 < 10 goto L2
+    end
+.end
+CODE
+# IMCC does produce b0rken PASM files
+# see http://guest@rt.perl.org/rt3/Ticket/Display.html?id=32392
+_main:
+    null I0
+L1:
+    inc I0
+L2:
+    lt I0, 10, L1
+    set I1, 1
+    lt I1, 10, L2
+    end
+OUT
+
+##############################
+pir_2_pasm_is( <<'CODE', <<'OUT', "superinstructions - need super_ops" );
+.sub _main
+    $I0 = 0
+L1:
+    inc $I0
+    if $I0 < 10 goto L1
+    end
+.end
+CODE
+# IMCC does produce b0rken PASM files
+# see http://guest@rt.perl.org/rt3/Ticket/Display.html?id=32392
+_main:
+    null I0
+L1:
+    inc I0
+    lt I0, 10, L1
+    end
+OUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
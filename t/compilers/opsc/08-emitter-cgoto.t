@@ -0,0 +1,90 @@
+#! ./parrot-nqp
+# Copyright (C) 2010, Parrot Foundation.
+
+pir::load_bytecode("opsc.pbc");
+
+plan(13);
+
+my $trans := Ops::Trans::CGoto.new();
+
+my @files := <
+    src/ops/io.ops
+    src/ops/sys.ops
+    src/ops/cmp.ops
+>;
+
+my $lib := Ops::OpLib.new();
+my $emitter := Ops::Emitter.new(
+    :ops_file(Ops::File.new(
+        :oplib($lib),
+        :core(1),
+        |@files)
+    ),
+    :trans($trans),
+    :script('ops2c'),
+    :flags(
+        hash( dir => 'tmp/', core => 1 )
+    ),
+);
+
+ok( $emitter, "Emitter created");
+ok( $emitter<include> eq 'parrot/oplib/core_ops_cg.h', 'Include is correct');
+say('# ' ~ $emitter<include>);
+
+my $fh := pir::new__Ps('StringHandle');
+$fh.open('header.h', 'w');
+$emitter.emit_c_op_func_header($fh);
+
+$fh.close();
+my $header := $fh.readall();
+
+ok($header ~~ /define \s PARROT_OPLIB_CORE_OPS_CG_H_GUARD/, 'Guard generated');
+ok($header ~~ /Parrot_DynOp_core_cg_ \d+ _ \d+ _ \d+/, '... and contains init_func');
+ok($header ~~ /'opcode_t * cg_core('/, '... and the runloop');
+
+$fh := pir::new__Ps('StringHandle');
+$fh.open('core.c', 'w');
+$emitter.emit_c_source_file($fh);
+
+$fh.close();
+my $source := $fh.readall();
+
+ok($source ~~ /PARROT_CGOTO_CORE/, 'Trans::CGoto core_type preserved');
+ok($source ~~ /'&&PC_0,'/, 'Label table generated');
+ok($source ~~ /'PC_0: {'/, 'Labelled op bodies generated');
+ok($source ~! /static \s size_t \s hash_str/, 'Op lookup shared with Trans::C');
+ok($source ~~ /'core_lib->op_func_table'/, 'Op tables shared with Trans::C');
+
+my $op_body := '
+inline op branch(in LABEL) :base_loop :flow {
+    goto OFFSET($1);
+}';
+my $new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'CG_BRANCH(cur_opcode + IREG(1));'/, "goto OFFSET() translated to a branch");
+
+$op_body := '
+inline op thingy(in PMC) {
+    opcode * next = expr NEXT();
+}';
+$new_body := translate_op_body($trans, $op_body);
+ok($new_body ~~ /'cur_opcode + 2;'/, "expr NEXT() translated ok");
+ok($new_body ~~ /'CG_NEXT(2);'/, "implicit goto NEXT() dispatches directly");
+
+sub translate_op_body($trans, $body) {
+    my $file  := Ops::File.new_str(
+        :oplib($lib), $body);
+    my $emitter := Ops::Emitter.new(
+        :ops_file($file),
+        :trans($trans),
+        :script("opsc"),
+        :flags( hash(core => '1') )
+    );
+
+    my $sh := pir::new__Ps('StringHandle');
+    $sh.open('your_bank_account_information.txt', 'w');
+    $emitter.emit_c_source_file($sh);
+    $sh.close();
+    $sh.readall();
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -15,7 +15,7 @@ Tests various io opcodes.
 
 =cut
 
-.const int TESTS = 12
+.const int TESTS = 17
 
 .loadlib 'io_ops'
 
@@ -32,6 +32,8 @@ Tests various io opcodes.
     getfd_fdopen()
     printerr_tests()
     stat_tests()
+    freeze_thaw_handle()
+    thaw_truncated_handle()
 
     # must come after (these don't use test_more)
     open_pipe_for_writing()
@@ -159,7 +161,7 @@ Tests various io opcodes.
     pipe = open command, 'wp'
     unless pipe goto open_pipe_for_writing_failed
 
-    pipe.'puts'("ok 9 - open pipe for writing\n")
+    pipe.'puts'("ok 14 - open pipe for writing\n")
     close pipe
     .return ()
 
@@ -181,6 +183,106 @@ Tests various io opcodes.
     ok($I0, 'fdopen - no close')
 .end
 
+.sub 'freeze_thaw_handle'
+    .local pmc array, fh, thawed
+    .local string filename
+    filename = 'freeze_thaw_handle.tmp'
+
+    # large enough to span several chunks
+    array = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    $P0 = new ['Integer']
+    $P0 = $I0
+    push array, $P0
+    $S0 = $I0
+    push array, $S0
+    inc $I0
+    if $I0 < 20000 goto fill
+    push array, array
+
+    fh = new ['FileHandle']
+    fh.'open'(filename, 'w')
+    fh.'encoding'('binary')
+    freeze fh, array
+    fh.'close'()
+
+    fh.'open'(filename, 'r')
+    fh.'encoding'('binary')
+    thaw thawed, fh
+    fh.'close'()
+
+    $I0 = elements thawed
+    is($I0, 40001, 'thaw from handle - elements')
+    $I0 = thawed[39998]
+    is($I0, 19999, 'thaw from handle - values')
+    $P0 = thawed[40000]
+    $I0 = issame $P0, thawed
+    ok($I0, 'thaw from handle - shared references')
+
+    $P0 = loadlib 'os'
+    $P0 = new 'OS'
+    $P0.'rm'(filename)
+.end
+
+.include 'interpinfo.pasm'
+.sub 'thaw_truncated_handle'
+    .local pmc array, fh, thawed
+    .local string filename, image
+    .local int runs
+    filename = 'thaw_truncated_handle.tmp'
+
+    array = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    $P0 = new ['Integer']
+    $P0 = $I0
+    push array, $P0
+    inc $I0
+    if $I0 < 100000 goto fill
+
+    fh = new ['FileHandle']
+    fh.'open'(filename, 'w')
+    fh.'encoding'('binary')
+    freeze fh, array
+    fh.'close'()
+
+    fh.'open'(filename, 'r')
+    fh.'encoding'('binary')
+    image = fh.'readall'()
+    fh.'close'()
+    image = substr image, 0, 200
+    fh.'open'(filename, 'w')
+    fh.'encoding'('binary')
+    print fh, image
+    fh.'close'()
+
+    fh.'open'(filename, 'r')
+    fh.'encoding'('binary')
+    push_eh truncated
+    thaw thawed, fh
+    pop_eh
+    ok(0, 'thaw from truncated handle throws')
+    goto check_gc
+  truncated:
+    .get_results ($P0)
+    pop_eh
+    $S0 = $P0['message']
+    is($S0, 'Truncated image stream', 'thaw from truncated handle throws')
+
+  check_gc:
+    fh.'close'()
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I0 = $I0 > runs
+    ok($I0, 'thaw from truncated handle leaves GC running')
+
+    $P0 = loadlib 'os'
+    $P0 = new 'OS'
+    $P0.'rm'(filename)
+.end
+
 .sub 'read_on_null'
     .const string description = "read on null PMC throws exception"
     push_eh eh
@@ -203,7 +305,7 @@ Tests various io opcodes.
     print "not "
 
 _readline_handler:
-        print "ok 10\n"
+        print "ok 15\n"
         pop_eh
 
     push_eh _read_handler
@@ -211,7 +313,7 @@ _readline_handler:
     print "not "
 
 _read_handler:
-        print "ok 11\n"
+        print "ok 16\n"
         pop_eh
 
     push_eh _print_handler
@@ -219,7 +321,7 @@ _read_handler:
     print "not "
 
 _print_handler:
-        print "ok 12\n"
+        print "ok 17\n"
         pop_eh
 .end
 
@@ -0,0 +1,129 @@
+#!./parrot
+# Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+t/dynoplibs/super.t - Tests for superinstructions
+
+=head1 SYNOPSIS
+
+        % prove t/dynoplibs/super.t
+
+=head1 DESCRIPTION
+
+Tests super.ops
+
+=cut
+
+.loadlib 'super_ops'
+
+.sub main :main
+    .include 'test_more.pir'
+    plan(16)
+    ok(1, "load super_ops")
+    test_inc_cmp()
+    test_dec_cmp()
+    test_add_cmp()
+    test_sub_cmp()
+    test_update_bool()
+.end
+
+.sub test_inc_cmp
+    $I0 = 0
+    $I1 = 0
+  loop_lt:
+    inc $I1
+    inc_lt $I0, 10, loop_lt
+    is($I0, 10, 'inc_lt counts up to the limit')
+    is($I1, 10, '... and branches while below it')
+
+    $I0 = 0
+    $I2 = 10
+  loop_le:
+    inc_le $I0, $I2, loop_le
+    is($I0, 11, 'inc_le branches while not above the limit')
+
+    $I0 = 5
+    inc_eq $I0, 7, skip
+    inc_eq $I0, 7, done
+    ok(0, 'inc_eq branches when equal')
+    .return ()
+  skip:
+    ok(0, 'inc_eq does not branch when not equal')
+    .return ()
+  done:
+    is($I0, 7, 'inc_eq branches when equal')
+.end
+
+.sub test_dec_cmp
+    $I0 = 10
+  loop_gt:
+    dec_gt $I0, 3, loop_gt
+    is($I0, 3, 'dec_gt counts down to the limit')
+
+    $I0 = 10
+    $I1 = 3
+  loop_ge:
+    dec_ge $I0, $I1, loop_ge
+    is($I0, 2, 'dec_ge branches while not below the limit')
+
+    $I0 = 3
+  loop_ne:
+    dec_ne $I0, 0, loop_ne
+    is($I0, 0, 'dec_ne branches until equal')
+.end
+
+.sub test_add_cmp
+    $I0 = 0
+    $I1 = 3
+  loop_lt:
+    add_lt $I0, $I1, 10, loop_lt
+    is($I0, 12, 'add_lt adds until the limit is reached')
+
+    $I0 = 0
+    $I2 = 9
+  loop_le:
+    add_le $I0, 3, $I2, loop_le
+    is($I0, 12, 'add_le with a constant increment')
+.end
+
+.sub test_sub_cmp
+    $I0 = 20
+  loop_gt:
+    sub_gt $I0, 4, 0, loop_gt
+    is($I0, 0, 'sub_gt subtracts down to the limit')
+
+    $I0 = 20
+    $I1 = 6
+  loop_ge:
+    sub_ge $I0, $I1, $I1, loop_ge
+    is($I0, 2, 'sub_ge with register operands')
+.end
+
+.sub test_update_bool
+    $I0 = 5
+    $I1 = 0
+  loop_dec:
+    inc $I1
+    dec_if $I0, loop_dec
+    is($I0, 0, 'dec_if loops until zero')
+    is($I1, 5, '... running the body each time')
+
+    $I0 = -3
+  loop_inc:
+    inc_unless $I0, done_inc
+    branch loop_inc
+  done_inc:
+    is($I0, 0, 'inc_unless branches when zero')
+
+    $I0 = 12
+  loop_sub:
+    sub_if $I0, 4, loop_sub
+    is($I0, 0, 'sub_if loops until zero')
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
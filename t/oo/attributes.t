@@ -18,9 +18,12 @@ Tests OO features related to adding and removing attributes.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(3)
+    plan(6)
 
     remove_1()
+    shared_access_site()
+    overridden_get_attr_str()
+    freeze_thaw_attributes()
 .end
 
 .sub remove_1
@@ -71,6 +74,112 @@ Tests OO features related to adding and removing attributes.
 
 .end
 
+.sub shared_access_site
+    .local pmc classes, parent, child, object
+    .local string result
+    classes = new 'ResizablePMCArray'
+
+    parent = newclass 'SiteParent'
+    addattribute parent, 'x'
+    addattribute parent, 'data'
+    push classes, parent
+
+    child = subclass parent, 'SiteChild'
+    addattribute child, 'extra'
+    push classes, child
+
+    $I0 = 0
+  make_class:
+    $S0 = $I0
+    $S0 = concat 'SiteOther', $S0
+    $P0 = newclass $S0
+    $I1 = 0
+  add_padding:
+    unless $I1 < $I0 goto add_data
+    $S1 = $I1
+    $S1 = concat 'pad', $S1
+    addattribute $P0, $S1
+    inc $I1
+    goto add_padding
+  add_data:
+    addattribute $P0, 'data'
+    push classes, $P0
+    inc $I0
+    if $I0 < 4 goto make_class
+
+    result = ''
+    $I1 = 0
+  again:
+    $I0 = 0
+  next_class:
+    $P0 = classes[$I0]
+    object = new $P0
+    $S0 = $I0
+    $P1 = box $S0
+    set_data(object, $P1)
+    $P2 = get_data(object)
+    $S0 = $P2
+    result = concat result, $S0
+    inc $I0
+    if $I0 < 6 goto next_class
+    inc $I1
+    if $I1 < 2 goto again
+
+    is(result, '012345012345', 'one access site used with many classes')
+.end
+
+.sub set_data
+    .param pmc object
+    .param pmc value
+    setattribute object, 'data', value
+.end
+
+.sub get_data
+    .param pmc object
+    $P0 = getattribute object, 'data'
+    .return ($P0)
+.end
+
+.sub overridden_get_attr_str
+    .local pmc class, object
+    class = newclass 'AttrOverride'
+    addattribute class, 'data'
+    object = new class
+    $P0 = box 'stored'
+    setattribute object, 'data', $P0
+    $P1 = getattribute object, 'data'
+    is($P1, 'overridden', 'get_attr_str override wins over the slot')
+.end
+
+.namespace ['AttrOverride']
+.sub 'get_attr_str' :vtable :method
+    .param string name
+    $P0 = box 'overridden'
+    .return ($P0)
+.end
+.namespace []
+
+.sub freeze_thaw_attributes
+    .local pmc class, object, copy
+    class = newclass 'AttrFrozen'
+    addattribute class, 'a'
+    addattribute class, 'b'
+    object = new class
+    $P0 = box 'first'
+    setattribute object, 'a', $P0
+    $P0 = box 'second'
+    setattribute object, 'b', $P0
+
+    $S0  = freeze object
+    copy = thaw $S0
+    $P1  = getattribute copy, 'a'
+    $P2  = getattribute copy, 'b'
+    $S1  = $P1
+    $S2  = $P2
+    $S1  = concat $S1, $S2
+    is($S1, 'firstsecond', 'attributes survive freeze and thaw')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -22,7 +22,7 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     create_library()
 
-    plan(6)
+    plan(10)
 
     loading_methods_from_file()
     loading_methods_from_eval()
@@ -30,6 +30,10 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     overridden_core_pmc()
 
+    polymorphic_call_site()
+    redefined_method_at_call_site()
+    call_sites_in_freed_code()
+
     try_delete_library()
 
 .end
@@ -149,6 +153,135 @@ END
     .return(1)
 .end
 
+.namespace []
+
+.sub 'polymorphic_call_site'
+    .local pmc classes, obj
+    .local string result
+    classes = new ['ResizablePMCArray']
+    $I0 = 0
+  make_class:
+    $S0 = $I0
+    $S0 = concat 'Site', $S0
+    $P0 = newclass $S0
+    push classes, $P0
+    inc $I0
+    if $I0 < 5 goto make_class
+
+    result = ''
+    $I1 = 0
+  again:
+    $I0 = 0
+  next_class:
+    $P0 = classes[$I0]
+    obj = new $P0
+    $S0 = obj.'name'()
+    result = concat result, $S0
+    result = concat result, ' '
+    inc $I0
+    if $I0 < 5 goto next_class
+    inc $I1
+    if $I1 < 2 goto again
+
+    $S0 = 'call site with more receiver types than it remembers'
+    is(result, 'Site0 Site1 Site2 Site3 Site4 Site0 Site1 Site2 Site3 Site4 ', $S0)
+.end
+
+.sub 'call_sites_in_freed_code'
+    .local pmc compiler, code, obj
+    .local string result
+    compiler = compreg 'PIR'
+    result = ''
+    $I0 = 0
+  loop:
+    code = compiler(<<'END')
+.sub '' :anon
+    .param pmc obj
+    $S0 = obj.'name'()
+    .return ($S0)
+.end
+END
+    $I1 = $I0 % 5
+    $S0 = $I1
+    $S0 = concat 'Site', $S0
+    obj = new $S0
+    $S0 = code(obj)
+    result = concat result, $S0
+    result = concat result, ' '
+    null code
+    sweep 1
+    inc $I0
+    if $I0 < 10 goto loop
+
+    $S0 = 'call sites in freed code are forgotten'
+    is(result, 'Site0 Site1 Site2 Site3 Site4 Site0 Site1 Site2 Site3 Site4 ', $S0)
+.end
+
+.namespace ['Site0']
+.sub 'name' :method
+    .return ('Site0')
+.end
+
+.namespace ['Site1']
+.sub 'name' :method
+    .return ('Site1')
+.end
+
+.namespace ['Site2']
+.sub 'name' :method
+    .return ('Site2')
+.end
+
+.namespace ['Site3']
+.sub 'name' :method
+    .return ('Site3')
+.end
+
+.namespace ['Site4']
+.sub 'name' :method
+    .return ('Site4')
+.end
+
+.namespace []
+
+.sub 'old_name' :method
+    .return ('old')
+.end
+
+.sub 'new_name' :method
+    .return ('new')
+.end
+
+.sub 'redefined_method_at_call_site'
+    .local pmc cls, obj
+    .local string result
+    .const 'Sub' old_name = 'old_name'
+    .const 'Sub' new_name = 'new_name'
+    cls = newclass 'Redefined'
+    cls.'add_method'('name', old_name)
+
+    result = ''
+    $I0 = 0
+  loop:
+    obj = new cls
+    $S0 = obj.'name'()
+    result = concat result, $S0
+    result = concat result, ' '
+    if $I0 != 1 goto next
+    cls.'remove_method'('name')
+    cls.'add_method'('name', new_name)
+    cls.'clear_method_cache'()
+  next:
+    inc $I0
+    if $I0 < 4 goto loop
+    is(result, 'old old new new ', 'call site sees a redefined method')
+
+    $S0 = 'na'
+    $S0 = concat $S0, 'me'
+    $S1 = obj.$S0()
+    is($S1, 'new', 'call with a computed method name')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 99;
+use Parrot::Test tests => 101;
 
 =head1 NAME
 
@@ -2593,6 +2593,136 @@ p2
 p1
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "register frames survive deep and tail calls" );
+.sub 'depth'
+    .param int n
+    .local int mine
+    .local num half
+    .local string tag
+    mine = n
+    half = n / 2.0
+    tag  = n
+    if n == 0 goto bottom
+    $I0 = n - 1
+    $I1 = 'depth'($I0)
+    $I1 += mine
+    $N0 = mine / 2.0
+    if $N0 != half goto bad
+    $S0 = mine
+    if $S0 != tag goto bad
+    .return ($I1)
+  bottom:
+    .return (0)
+  bad:
+    die "caller registers clobbered"
+.end
+
+.sub 'sum_to'
+    .param int n
+    .param int acc
+    if n == 0 goto done
+    acc += n
+    dec n
+    .tailcall 'sum_to'(n, acc)
+  done:
+    .return (acc)
+.end
+
+.sub 'thrower'
+    .param int n
+    if n == 0 goto throw
+    $I0 = n - 1
+    'thrower'($I0)
+  throw:
+    die "from the bottom"
+.end
+
+.sub 'main' :main
+    .local int keep
+    keep = 42
+    $I0 = 'depth'(900)
+    say $I0
+    $I0 = 'sum_to'(100000, 0)
+    say $I0
+    push_eh caught
+    'thrower'(500)
+  caught:
+    pop_eh
+    $I0 = 'depth'(10)
+    say $I0
+    say keep
+.end
+CODE
+405450
+5000050000
+55
+42
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "arguments passed register to register" );
+.sub 'all_types'
+    .param int i
+    .param num n
+    .param string s
+    .param pmc p
+    print i
+    print ' '
+    print n
+    print ' '
+    print s
+    print ' '
+    say p
+.end
+
+.sub 'boxed'
+    .param pmc p
+    $S0 = typeof p
+    print $S0
+    print ' '
+    say p
+.end
+
+.sub 'optional'
+    .param int i
+    .param int j :optional
+    .param int has_j :opt_flag
+    print i
+    print ' '
+    say has_j
+.end
+
+.sub 'main' :main
+    .local pmc p
+    p = box 'pmc'
+    $I0 = 1
+    $N0 = 2.5
+    $S0 = 'str'
+    'all_types'($I0, $N0, $S0, p)
+    'all_types'(3, 4.5, 'const', p)
+    $I1 = 0
+  again:
+    'all_types'($I1, $N0, $S0, p)
+    inc $I1
+    if $I1 < 2 goto again
+    'boxed'(7)
+    'boxed'(p)
+    'optional'(8)
+    'optional'(9, 10)
+    $P0 = get_global 'all_types'
+    $P0($I0, $N0, $S0, p)
+.end
+CODE
+1 2.5 str pmc
+3 4.5 const pmc
+0 2.5 str pmc
+1 2.5 str pmc
+Integer 7
+String pmc
+8 0
+9 1
+1 2.5 str pmc
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
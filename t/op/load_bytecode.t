@@ -5,7 +5,9 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 3;
+use Parrot::Test::Util 'create_tempfile';
+use Parrot::Test tests => 5;
+use Parrot::Config;
 
 =head1 NAME
 
@@ -45,6 +47,64 @@ CODE
 /"load_bytecode" couldn't find file 'no_file_by_this_name'/
 OUTPUT
 
+my ($TEMP, $temp_pir) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+my (undef, $temp_pbc) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+
+print $TEMP <<'EOF';
+.sub 'constants'
+    .const 'Sub' callee = 'callee'
+    $P0 = new ['Hash']
+    $P0['key'] = 'keyed'
+    $S0 = $P0['key']
+    $S1 = callee($S0, 'call')
+    .return ($S1)
+.end
+
+.sub 'callee'
+    .param string a
+    .param string b
+    $S0 = a . ' '
+    $S0 .= b
+    .return ($S0)
+.end
+EOF
+close $TEMP;
+
+system(".$PConfig{slash}parrot$PConfig{exe}", '-o', $temp_pbc, $temp_pir);
+
+pir_output_is( <<"CODE", <<'OUTPUT', "PMC constants of loaded bytecode" );
+.sub main :main
+    load_bytecode "$temp_pbc"
+    \$P0 = get_global 'constants'
+    \$S0 = \$P0()
+    say \$S0
+    \$S0 = \$P0()
+    say \$S0
+.end
+CODE
+keyed call
+keyed call
+OUTPUT
+
+my (undef, $short_pbc) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+{
+    open my $IN, '<:raw', $temp_pbc or die "Can't read $temp_pbc: $!";
+    local $/;
+    my $pbc = <$IN>;
+    close $IN;
+    open my $OUT, '>:raw', $short_pbc or die "Can't write $short_pbc: $!";
+    print $OUT substr( $pbc, 0, int( length($pbc) * 2 / 3 ) );
+    close $OUT;
+}
+
+pir_error_output_like( <<"CODE", <<'OUTPUT', "load_bytecode on truncated bytecode" );
+.sub main :main
+    load_bytecode "$short_pbc"
+.end
+CODE
+/exceeds the packfile.*Unable to append PBC/s
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 47;
+use Parrot::Test tests => 49;
 use Parrot::Config;
 
 =head1 NAME
@@ -1155,6 +1155,99 @@ ok
 ok
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'random access into long utf8 string' );
+.sub main :main
+    .local string s, t
+    .local int i, c, sum
+
+    s = utf8:"a\x{e9}\x{4e2d}z"
+    s = repeat s, 1000
+    i = length s
+    say i
+
+    sum = 0
+  loop:
+    dec i
+    if i < 0 goto done
+    c = ord s, i
+    sum += c
+    goto loop
+  done:
+    say sum
+
+    c = ord s, 2002
+    say c
+    c = ord s, -3999
+    say c
+    t = substr s, 3001, 3
+    c = ord t, 1
+    say c
+    c = length t
+    say c
+    t = substr s, 129, 3870
+    c = length t
+    say c
+    c = ord t, 3869
+    say c
+.end
+CODE
+4000
+20465000
+20013
+233
+20013
+3
+3870
+20013
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'transcoding with long ascii runs' );
+.sub main :main
+    .local string s, t
+    .local int utf8, utf16, ucs4, latin1
+
+    utf8   = find_encoding 'utf8'
+    utf16  = find_encoding 'utf16'
+    ucs4   = find_encoding 'ucs4'
+    latin1 = find_encoding 'iso-8859-1'
+
+    s = iso-8859-1:"caf\xe9 and a long run of plain ascii text after it, na\xefve"
+    t = trans_encoding s, utf8
+    $I0 = bytelength t
+    say $I0
+    $I0 = length t
+    say $I0
+
+    t = trans_encoding t, utf16
+    $I0 = encoding t
+    $S0 = encodingname $I0
+    say $S0
+    t = trans_encoding t, ucs4
+    t = trans_encoding t, utf8
+    t = trans_encoding t, latin1
+    $I0 = iseq s, t
+    say $I0
+
+    s = utf8:"ascii only, but long enough for a couple of vector blocks"
+    t = trans_encoding s, ucs4
+    $I0 = bytelength t
+    say $I0
+    t = trans_encoding t, utf8
+    $I0 = iseq s, t
+    say $I0
+    $I0 = bytelength t
+    say $I0
+.end
+CODE
+57
+55
+ucs2
+1
+228
+1
+57
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -21,7 +21,7 @@ Tests C<ByteBuffer> PMC..
 
 .sub 'main' :main
     .include 'test_more.pir'
-    plan(38)
+    plan(40)
 
     test_init()
     test_set_string()
@@ -236,6 +236,14 @@ end:
     n = elements bb
     is(n, 0, 'resize to zero from allocated content')
 
+    bb = 'abcdef'
+    bb = 2
+    bb = 4
+    n = elements bb
+    is(n, 4, 'increase size within the kept allocation')
+    s = bb.'get_string_as'(binary:"")
+    is(s, binary:"ab\x{0}\x{0}", '... is zero filled past the reduced size')
+
     .local pmc eh
     eh = new ['ExceptionHandler']
     eh.'handle_types'(.EXCEPTION_OUT_OF_BOUNDS)
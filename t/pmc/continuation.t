@@ -17,12 +17,13 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(4)
+    plan(5)
 
     test_new()
     invoke_with_init()
     returns_tt1511()
     returns_tt1528()
+    resume_popped_frames()
 .end
 
 .sub test_new
@@ -140,6 +141,36 @@ end:
     is('lala nyny bosbos ', $S0, 'Results processed correctly - without .tailcall')
 .end
 
+.sub 'deep'
+    .param int n
+    .local int mine
+    mine = n * 10
+    if n goto recurse
+    $P0 = new 'Continuation'
+    set_label $P0, resumed
+    set_global '!deepcc', $P0
+    .return (0)
+  resumed:
+    .return (1)
+  recurse:
+    $I0 = n - 1
+    $I1 = 'deep'($I0)
+    $I1 += mine
+    .return ($I1)
+.end
+
+.sub 'resume_popped_frames'
+    .local int count
+    count = 0
+    $I0 = 'deep'(3)
+    inc count
+    if count > 1 goto done
+    $P0 = get_global '!deepcc'
+    $P0()
+  done:
+    is($I0, 61, 'continuation resumes frames after they returned')
+.end
+
 # end of tests.
 
 # Local Variables:
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 24;
+use Parrot::Test tests => 25;
 use Parrot::Test::Util 'create_tempfile';
 use Parrot::Test::Util 'create_tempfile';
 
@@ -357,6 +357,46 @@ CODE
 ok 1 - read 10,000 lines
 OUT
 
+($LINES, $temp_file) = create_tempfile( UNLINK => 1 );
+
+print $LINES 'x' x 20000, "\n", "short\n", "last";
+close $LINES;
+
+pir_output_is( <<"CODE", <<'OUT', 'readlines' );
+.sub 'test' :main
+    .local pmc filehandle, lines
+    filehandle = new ['FileHandle']
+    filehandle.'open'('$temp_file')
+
+    lines = filehandle.'readlines'(2)
+    \$I0 = elements lines
+    say \$I0
+    \$S0 = lines[0]
+    \$I0 = length \$S0
+    say \$I0
+    \$S0 = lines[1]
+    print \$S0
+
+    lines = filehandle.'readlines'()
+    \$I0 = elements lines
+    say \$I0
+    \$S0 = lines[0]
+    say \$S0
+
+    lines = filehandle.'readlines'()
+    \$I0 = elements lines
+    say \$I0
+    filehandle.'close'()
+.end
+CODE
+2
+20001
+short
+1
+last
+0
+OUT
+
 
 # TT #1204 test reading long chunks, eof, and across newlines
 
@@ -24,7 +24,7 @@ well.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(174)
+    plan(182)
 
     initial_hash_tests()
     more_than_one_hash()
@@ -61,6 +61,7 @@ well.
     cloning_keys()
     cloning_pmc_vals()
     delete_and_free_list()
+    delete_and_reinsert_many_keys()
     exists_with_constant_string_key()
     hash_in_pir()
     setting_with_compound_keys()
@@ -70,6 +71,7 @@ well.
     broken_delete()
     unicode_keys_register_rt_39249()
     unicode_keys_literal_rt_39249()
+    keys_in_other_encodings()
 
     integer_keys()
     value_types_convertion()
@@ -1069,6 +1071,36 @@ lp:
     is( $I0, 10, 'hash has size 10' )
 .end
 
+# keep the size constant while keys move on, so deleted slots pile up
+.sub delete_and_reinsert_many_keys
+    .local pmc hash
+    .local int i
+    hash = new ['Hash']
+    hash.'set_key_type'(.Hash_key_type_int)
+
+    i = 1
+  fill:
+    hash[i] = i
+    inc i
+    if i <= 1000 goto fill
+
+  churn:
+    $I0 = i - 1000
+    delete hash[$I0]
+    hash[i] = i
+    inc i
+    if i <= 50000 goto churn
+
+    $I0 = elements hash
+    is( $I0, 1000, 'size stays constant' )
+    $I0 = exists hash[49000]
+    is( $I0, 0, 'deleted key is gone' )
+    $I0 = hash[49001]
+    is( $I0, 49001, 'oldest key kept' )
+    $I0 = hash[50000]
+    is( $I0, 50000, 'newest key kept' )
+.end
+
 ## XXX already tested?
 .sub exists_with_constant_string_key
     new $P16, ['Hash']
@@ -1328,6 +1360,35 @@ postit_end:
   is( $S1, 'ok', 'literal unicode key lookup via var' )
 .end
 
+# equal strings hash equal whatever their encoding, short or long
+.sub keys_in_other_encodings
+    .local pmc hash
+    hash = new ['Hash']
+    $S0 = iso-8859-1:"caf\xe9 au lait, long enough to take more than one block"
+    hash[$S0] = 'latin1'
+    $S1 = utf8:"\u2603 snowman"
+    hash[$S1] = 'wide'
+
+    $I0 = find_encoding 'utf8'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'latin1', 'latin1 key found as utf8' )
+
+    $I0 = find_encoding 'ucs2'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'latin1', 'latin1 key found as ucs2' )
+
+    $I0 = find_encoding 'utf16'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'latin1', 'latin1 key found as utf16' )
+
+    $S2 = trans_encoding $S1, $I0
+    $S3 = hash[$S2]
+    is( $S3, 'wide', 'utf8 key found as utf16' )
+.end
+
 # Switch to use integer keys instead of strings.
 .sub integer_keys
     .include "hash_key_type.pasm"
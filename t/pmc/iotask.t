@@ -0,0 +1,237 @@
+#!./parrot
+# Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+t/pmc/iotask.t - test the IOTask PMC
+
+=head1 SYNOPSIS
+
+    % prove t/pmc/iotask.t
+
+=head1 DESCRIPTION
+
+Tests asynchronous reads, writes and accepts on FileHandles and Sockets.
+
+=cut
+
+.include 'iglobals.pasm'
+.include 'socket.pasm'
+
+.sub 'main' :main
+    .include 'test_more.pir'
+
+    plan(19)
+
+    test_new()
+
+    $P0 = getinterp
+    $P1 = $P0[.IGLOBALS_CONFIG_HASH]
+    $S0 = $P1['i_sysepoll']
+    if $S0 == 'define' goto async
+    skip(17, 'No asynchronous I/O on this platform')
+    .return ()
+  async:
+    test_read_file()
+    test_read_many()
+    test_write_file()
+    test_read_pipe()
+    test_closed()
+    test_socket()
+    test_callback()
+.end
+
+.sub 'test_new'
+    $P0 = new ['IOTask']
+    $P1 = getattribute $P0, 'type'
+    $S0 = $P1
+    is($S0, 'io', 'new IOTask has type io')
+    $I0 = istrue $P0
+    is($I0, 0, '... and has not finished')
+.end
+
+.sub 'test_read_file'
+    .local pmc fh, task
+    fh = new ['FileHandle']
+    fh.'open'('t/pmc/iotask.t', 'r')
+    task = fh.'read_async'(10)
+    $S0 = task.'wait'()
+    is($S0, '#!./parrot', 'read_async on a file')
+    $P0 = getattribute task, 'status'
+    $S0 = $P0
+    is($S0, 'completed', '... completes the task')
+
+    $S0 = fh.'readline'()
+    is($S0, "\n", '... and moves the file position')
+    fh.'close'()
+.end
+
+.sub 'test_read_many'
+    .local pmc handles, tasks, fh, task
+    .local int i, good
+    handles = new ['ResizablePMCArray']
+    tasks   = new ['ResizablePMCArray']
+    i = 0
+  start:
+    fh = new ['FileHandle']
+    fh.'open'('t/pmc/iotask.t', 'r')
+    push handles, fh
+    task = fh.'read_async'(10)
+    push tasks, task
+    inc i
+    if i < 8 goto start
+
+    good = 0
+    i = 0
+  check:
+    task = tasks[i]
+    $S0 = task.'wait'()
+    if $S0 != '#!./parrot' goto next
+    inc good
+  next:
+    fh = handles[i]
+    fh.'close'()
+    inc i
+    if i < 8 goto check
+    is(good, 8, 'read_async on many files at once')
+
+    fh = new ['FileHandle']
+    fh.'open'('t/pmc/iotask.t', 'r')
+    task = fh.'read_async'(2)
+    $P0 = fh.'read_async'(8)
+    $S0 = task.'wait'()
+    $S1 = $P0.'wait'()
+    $S0 .= $S1
+    is($S0, '#!./parrot', '... and reads queued on one file in order')
+    fh.'close'()
+.end
+
+.sub 'test_write_file'
+    .local pmc fh, task
+    .local string name
+    name = 'iotask_write.tmp'
+    fh = new ['FileHandle']
+    fh.'open'(name, 'w')
+    task = fh.'write_async'('asynchronous ')
+    $P0 = fh.'write_async'('write')
+    $I0 = task.'wait'()
+    $I1 = $P0.'wait'()
+    $I0 += $I1
+    is($I0, 18, 'write_async on a file')
+    fh.'close'()
+
+    fh.'open'(name, 'r')
+    $S0 = fh.'readall'()
+    fh.'close'()
+    is($S0, 'asynchronous write', '... writes in order')
+
+    $P0 = loadlib 'os'
+    $P0 = new ['OS']
+    $P0.'rm'(name)
+.end
+
+.sub 'test_read_pipe'
+    .local pmc fh, task
+    fh = new ['FileHandle']
+    fh.'open'('echo hello', 'rp')
+    task = fh.'read_async'()
+    $S0 = task.'wait'()
+    is($S0, "hello\n", 'read_async on a pipe')
+
+    task = fh.'read_async'()
+    $S0 = task.'wait'()
+    is($S0, '', '... reads an empty string at the end')
+    fh.'close'()
+.end
+
+.sub 'test_closed'
+    .local pmc fh
+    fh = new ['FileHandle']
+    push_eh closed
+    fh.'read_async'()
+    pop_eh
+    ok(0, 'read_async on a closed handle throws')
+    .return ()
+  closed:
+    pop_eh
+    ok(1, 'read_async on a closed handle throws')
+.end
+
+.sub 'test_socket'
+    .local pmc server, client, conn, task, addr
+    .local int port
+    server = new ['Socket']
+    server.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 38100
+  try_port:
+    addr = server.'sockaddr'('localhost', port)
+    $I0 = server.'bind'(addr)
+    if $I0 == 0 goto bound
+    inc port
+    if port < 38200 goto try_port
+    skip(5, 'No free port')
+    .return ()
+  bound:
+    server.'listen'(5)
+
+    task = server.'accept_async'()
+    $P0 = getattribute task, 'status'
+    $S0 = $P0
+    is($S0, 'waiting', 'accept_async waits for a connection')
+
+    client = new ['Socket']
+    client.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    client.'connect'(addr)
+    conn = task.'wait'()
+    $S0 = typeof conn
+    is($S0, 'Socket', '... and returns the new Socket')
+
+    task = conn.'read_async'(100)
+    $P0 = getattribute task, 'status'
+    $S0 = $P0
+    is($S0, 'waiting', 'read_async on a socket waits for data')
+
+    $P0 = client.'write_async'('ping')
+    $I0 = $P0.'wait'()
+    is($I0, 4, 'write_async returns the bytes written')
+
+    $S0 = task.'wait'()
+    is($S0, 'ping', 'read_async on a socket')
+
+    client.'close'()
+    conn.'close'()
+    server.'close'()
+.end
+
+.sub 'test_callback'
+    .local pmc fh, task, done
+    done = new ['Integer']
+    set_global 'done', done
+
+    fh = new ['FileHandle']
+    fh.'open'('sleep 0.2; echo late', 'rp')
+    $P0 = get_global 'on_read'
+    task = fh.'read_async'(100, $P0)
+    sleep 1
+    done = get_global 'done'
+    $S0 = done
+    is($S0, "late\n", 'callback gets the finished task while sleeping')
+    $I0 = task.'error'()
+    is($I0, 0, '... which did not fail')
+    fh.'close'()
+.end
+
+.sub 'on_read'
+    .param pmc task
+    $P0 = task.'result'()
+    $S0 = $P0
+    $P1 = new ['String']
+    $P1 = $S0
+    set_global 'done', $P1
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -19,7 +19,7 @@ Tests the creation and invocation of Perl6 multi subs.
 .sub main :main
     .include 'test_more.pir'
 
-    plan( 8 )
+    plan( 12 )
 
     $P0 = new ['MultiSub']
     $I0 = defined $P0
@@ -51,6 +51,79 @@ Tests the creation and invocation of Perl6 multi subs.
     $S0 = foo($P1 :flat, $P2 :flat)
     is($S0, "testing 42, goodbye", "Int and String double :flat")
 
+    cached_candidates()
+    cached_dispatch_allocates_nothing()
+.end
+
+.sub cached_candidates
+    .local pmc i, n, multi
+    i = box 1
+    n = box 1.5
+
+    $S0 = bar(i)
+    $S1 = bar(n)
+    $S0 .= $S1
+    $S1 = bar(i)
+    $S0 .= $S1
+    is($S0, "anyanyany", "same candidate for repeated argument types")
+
+    multi = get_global 'bar'
+    $P0 = get_global 'bar_integer'
+    $P0 = $P0[0]
+    push multi, $P0
+
+    $S0 = bar(i)
+    $S1 = bar(n)
+    $S0 .= $S1
+    is($S0, "Integerany", "new candidate is seen after dispatch")
+
+    $P0 = pop multi
+    $S0 = bar(i)
+    is($S0, "any", "removed candidate is no longer chosen")
+.end
+
+.sub cached_dispatch_allocates_nothing
+    .include 'interpinfo.pasm'
+    .local pmc i
+    .local int k, before, multi, plain
+    i = box 1
+    $S0 = bar(i)
+
+    before = interpinfo .INTERPINFO_HEADER_ALLOCS_SINCE_COLLECT
+    k = 0
+  multi_loop:
+    $S0 = bar(i)
+    inc k
+    if k < 10 goto multi_loop
+    multi = interpinfo .INTERPINFO_HEADER_ALLOCS_SINCE_COLLECT
+    multi -= before
+
+    before = interpinfo .INTERPINFO_HEADER_ALLOCS_SINCE_COLLECT
+    k = 0
+  plain_loop:
+    $S0 = plain_bar(i)
+    inc k
+    if k < 10 goto plain_loop
+    plain = interpinfo .INTERPINFO_HEADER_ALLOCS_SINCE_COLLECT
+    plain -= before
+
+    $I0 = multi <= plain
+    ok($I0, "cached dispatch allocates no more than a plain call")
+.end
+
+.sub plain_bar
+    .param pmc x
+    .return ('any')
+.end
+
+.sub bar :multi(_)
+    .param pmc x
+    .return ('any')
+.end
+
+.sub bar_integer :multi(Integer)
+    .param pmc x
+    .return ('Integer')
 .end
 
 .sub foo :multi()
@@ -0,0 +1,207 @@
+#!./parrot
+# Copyright (C) 2010, Parrot Foundation.
+
+=head1 NAME
+
+t/pmc/sharedref.t - test the SharedRef PMC
+
+=head1 SYNOPSIS
+
+    % prove t/pmc/sharedref.t
+
+=head1 DESCRIPTION
+
+Tests publishing read-mostly data to thread interpreters through SharedRef
+cells.
+
+=cut
+
+.include 'iglobals.pasm'
+.include 'cloneflags.pasm'
+.include 'interpinfo.pasm'
+
+.sub 'main' :main
+    .include 'test_more.pir'
+
+    plan(12)
+
+    test_publish()
+    test_unpublishable()
+    test_reclaim_strings()
+
+    $P0 = getinterp
+    $P1 = $P0[.IGLOBALS_CONFIG_HASH]
+    $I0 = $P1['HAS_THREADS']
+    if $I0 goto threads
+    skip(5, 'No threading enabled')
+    .return ()
+  threads:
+    test_thread_reads()
+    test_grace_period()
+.end
+
+.sub 'test_publish'
+    .local pmc ref, h, list
+    ref = new ['SharedRef']
+    $I0 = istrue ref
+    is($I0, 0, 'new cell is empty')
+
+    h = new ['Hash']
+    h['name'] = 'first'
+    list = new ['ResizablePMCArray']
+    push list, 1
+    push list, 'two'
+    h['list'] = list
+    setref ref, h
+    sweep 1
+
+    $S0 = ref['name']
+    is($S0, 'first', 'cell reads the published hash')
+    $P0 = ref['list']
+    $S0 = $P0[1]
+    is($S0, 'two', '... and what it refers to')
+
+    push_eh write_failed
+    h['name'] = 'changed'
+    pop_eh
+    ok(0, 'published hash is read-only')
+    goto array
+  write_failed:
+    pop_eh
+    ok(1, 'published hash is read-only')
+  array:
+    push_eh push_failed
+    push list, 3
+    pop_eh
+    ok(0, 'published array is read-only')
+    .return ()
+  push_failed:
+    pop_eh
+    ok(1, 'published array is read-only')
+.end
+
+.sub 'test_unpublishable'
+    .local pmc ref, sub
+    ref = new ['SharedRef']
+    sub = get_global 'reader'
+    push_eh bad_type
+    setref ref, sub
+    pop_eh
+    ok(0, 'a Sub cannot be published')
+    .return ()
+  bad_type:
+    .get_results($P0)
+    pop_eh
+    $S0 = $P0
+    is($S0, "Can't publish a Sub for sharing", 'a Sub cannot be published')
+.end
+
+.sub 'test_reclaim_strings'
+    .local pmc ref
+    .local int before, after
+    ref = new ['SharedRef']
+    publish_versions(ref, 100)
+    sweep 1
+    collect
+    before = interpinfo .INTERPINFO_TOTAL_MEM_ALLOC
+
+    publish_versions(ref, 2000)
+    sweep 1
+    collect
+    after = interpinfo .INTERPINFO_TOTAL_MEM_ALLOC
+
+    $I0 = after - before
+    $I1 = $I0 < 1000000
+    ok($I1, 'strings of retired versions are reclaimed')
+.end
+
+.sub 'publish_versions'
+    .param pmc ref
+    .param int count
+    .local pmc h
+    .local string big
+    big = repeat 'x', 4096
+  loop:
+    unless count goto done
+    h = new ['Hash']
+    $S0 = count
+    $S0 = big . $S0
+    h['name'] = $S0
+    setref ref, h
+    dec count
+    goto loop
+  done:
+.end
+
+.sub 'test_thread_reads'
+    .local pmc ref, h, thread, reader, result
+    ref = new ['SharedRef']
+    h = new ['Hash']
+    h['name'] = 'shared'
+    setref ref, h
+
+    reader = get_global 'reader'
+    thread = new ['ParrotThread']
+    thread.'run'(.PARROT_CLONE_CODE, reader, ref)
+    result = thread.'join'()
+    $S0 = result
+    is($S0, 'shared', 'thread reads the published hash')
+.end
+
+.sub 'test_grace_period'
+    .local pmc ref, old, young, thread, waiter
+    ref = new ['SharedRef']
+    old = new ['Hash']
+    old['name'] = 'old'
+    setref ref, old
+
+    waiter = get_global 'waiter'
+    thread = new ['ParrotThread']
+    thread.'run'(.PARROT_CLONE_CODE, waiter, ref)
+
+    young = new ['Hash']
+    young['name'] = 'new'
+    setref ref, young
+    $S0 = ref['name']
+    is($S0, 'new', 'cell reads the new version')
+
+    push_eh still_published
+    old['name'] = 'changed'
+    pop_eh
+    ok(0, 'old version stays published while a thread may read it')
+    goto join
+  still_published:
+    pop_eh
+    ok(1, 'old version stays published while a thread may read it')
+  join:
+    thread.'join'()
+    ref.'quiescent'()
+
+    old['name'] = 'changed'
+    $S0 = old['name']
+    is($S0, 'changed', '... and is reclaimed after it finished')
+    $S0 = ref['name']
+    is($S0, 'new', '... but not the current version')
+.end
+
+.sub 'reader'
+    .param pmc ref
+    $S0 = ref['name']
+    ref.'quiescent'()
+    $P0 = new ['String']
+    $P0 = $S0
+    .return ($P0)
+.end
+
+.sub 'waiter'
+    .param pmc ref
+    $S0 = ref['name']
+    sleep 1
+    ref.'quiescent'()
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
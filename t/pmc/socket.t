@@ -16,10 +16,11 @@ Tests the Socket PMC.
 =cut
 
 .include 'socket.pasm'
+.include 'except_types.pasm'
 .sub main :main
     .include 'test_more.pir'
 
-    plan(19)
+    plan(33)
 
     test_init()
     test_get_fd()
@@ -37,6 +38,8 @@ Tests the Socket PMC.
     test_udp_socket6()
     test_raw_udp_socket()
     test_raw_udp_socket6()
+    test_recv_buffer_size()
+    test_connected()
 
 .end
 
@@ -161,6 +164,102 @@ CODE
     ok(sock, 'Created a raw UDP Socket')
 .end
 
+.sub test_recv_buffer_size
+    .local pmc sock
+    sock = new ['Socket']
+    $I0 = sock.'recv_buffer_size'()
+    is($I0, 65536, 'Socket has a 64k receive buffer by default')
+    sock.'recv_buffer_size'(1024)
+    $I0 = sock.'recv_buffer_size'()
+    is($I0, 1024, 'recv_buffer_size sets the size')
+
+    push_eh bad_size
+    sock.'recv_buffer_size'(0)
+    pop_eh
+    ok(0, 'recv_buffer_size(0) throws')
+    .return ()
+  bad_size:
+    pop_eh
+    ok(1, 'recv_buffer_size(0) throws')
+.end
+
+.sub test_connected
+    .local pmc server, client, conn, addr, parts, buf
+    .local int port
+    server = new ['Socket']
+    server.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 38200
+  try_port:
+    addr = server.'sockaddr'('127.0.0.1', port)
+    $I0 = server.'bind'(addr)
+    if $I0 == 0 goto bound
+    inc port
+    if port < 38300 goto try_port
+    skip(10, 'No free port')
+    .return ()
+  bound:
+    server.'listen'(5)
+    client = new ['Socket']
+    client.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    client.'connect'(addr)
+    conn = server.'accept'()
+
+    parts = new ['ResizableStringArray']
+    push parts, 'ab'
+    push parts, 'cd'
+    push parts, 'ef'
+    $I0 = client.'writev'(parts)
+    is($I0, 6, 'writev sends every string')
+
+    buf = new ['ByteBuffer']
+    buf = 'xy'
+    $I0 = conn.'recv_into'(buf, 6)
+    is($I0, 6, 'recv_into returns the bytes received')
+    $S0 = buf.'get_string_as'(ascii:"")
+    is($S0, 'xyabcdef', '... and appends them to the ByteBuffer')
+
+    .local pmc fh
+    fh = new ['FileHandle']
+    fh.'open'('t/pmc/socket.t', 'r')
+    $I0 = client.'sendfile'(fh, 2, 6)
+    is($I0, 6, 'sendfile sends a part of a file')
+    $S0 = conn.'recv'()
+    is($S0, './parr', '... from the offset')
+    $S0 = fh.'read'(2)
+    is($S0, '#!', '... without moving the file position')
+    push_eh negative_offset
+    $I0 = client.'sendfile'(fh, -1, 6)
+    pop_eh
+    ok(0, 'sendfile throws on a negative offset')
+    goto negative_offset_done
+  negative_offset:
+    .get_results($P0)
+    pop_eh
+    $I0 = $P0['type']
+    is($I0, .EXCEPTION_OUT_OF_BOUNDS, 'sendfile throws on a negative offset')
+  negative_offset_done:
+    fh.'close'()
+
+    fh.'open'('echo hello', 'rp')
+    $S0 = fh.'read'(1)
+    $I0 = client.'sendfile'(fh)
+    is($I0, 5, 'sendfile sends a pipe to its end')
+    $S0 = conn.'recv'()
+    is($S0, "ello\n", '... from where it was read')
+    fh.'close'()
+
+    conn.'set_blocking'(0)
+    $S0 = conn.'recv'()
+    $I0 = isnull $S0
+    ok($I0, 'recv on a non-blocking socket without data returns a null string')
+    $I0 = conn.'recv_into'(buf)
+    is($I0, -2, '... and recv_into returns -2')
+
+    client.'close'()
+    conn.'close'()
+    server.'close'()
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
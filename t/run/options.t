@@ -19,7 +19,7 @@ use strict;
 use warnings;
 use lib qw( lib . ../lib ../../lib );
 
-use Test::More tests => 30;
+use Test::More tests => 58;
 use Parrot::Config;
 use File::Temp 0.13 qw/tempfile/;
 use File::Spec;
@@ -90,6 +90,28 @@ is( `"$PARROT" --trace "$first_pir_file" "$second_pir_file" $redir`,
     like( qx{$cmd}, qr/Parrot VM: slow core/, "-r option <$cmd>" );
 }
 
+## the cgoto core has its own dispatch table, run some op tests with it
+SKIP: {
+    my @op_tests = map { File::Spec->catfile( 't', split m{/} ) }
+        qw( op/arithmetics.t op/integer.t op/string.t op/ifunless.t
+            op/cc_params.t dynoplibs/bit.t );
+
+    my $output = qx{"$PARROT" -R cgoto "$second_pir_file" 2>&1};
+    skip 'cgoto core not available', 1 + @op_tests
+        if $output =~ /Invalid runcore|not available/;
+
+    is( $output, "second\n", '-R cgoto' );
+
+    for my $test (@op_tests) {
+        $output = qx{"$PARROT" -R cgoto "$test" 2>&1};
+
+        my ($planned) = $output =~ /^1\.\.(\d+)/m;
+        my $passed    = () = $output =~ /^(?:ok \d+|not ok \d+ # TODO)/mg;
+        ok( !$? && defined $planned && $passed == $planned, "$test under -R cgoto" )
+            or diag $output;
+    }
+}
+
 ## TT #1150 test remaining options
 
 # Test --runtime-prefix
@@ -102,6 +124,425 @@ like( $output, qr/--gc-threshold needs an argument/,
                  '--gc-threshold needs argument warning' );
 is( $exit, 0, '... and should not crash' );
 
+# GC modes: objects stored in the array stay alive.  Prints the sum, whether
+# the GC marked while allocating, and whether C<sweep 1> marked again
+{
+    my ( $fh, $gen_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.sub main :main
+    .local pmc keep, str
+    .local int i, sum, runs
+    keep = new ['ResizablePMCArray']
+    i = 0
+  loop:
+    str  = new ['String']
+    str  = i
+    keep[i] = str
+    $P0  = new ['Hash']
+    $P0['x'] = str
+    inc i
+    if i < 20000 goto loop
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I0  = isgt runs, 0
+    sweep 1
+    $I1  = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I1  = isgt $I1, runs
+    sum = 0
+    i   = 0
+  check:
+    $P1  = keep[i]
+    $I2  = $P1
+    sum += $I2
+    inc i
+    if i < 20000 goto check
+    say sum
+    say $I0
+    say $I1
+.end
+END_PIR
+    close $fh;
+
+    is( qx{"$PARROT" --gc-nursery-size=16 "$gen_pir_file"}, "199990000\n1\n1\n",
+        '--gc-nursery-size keeps young objects referenced from old ones' );
+
+    $output = qx{$PARROT --gc-nursery-size=lots "$gen_pir_file" 2>&1 };
+    like( $output, qr/invalid GC nursery size/,
+                   '--gc-nursery-size needs a number' );
+
+    is( qx{"$PARROT" --gc-max-pause-us=100 --gc-alloc-threshold=256 "$gen_pir_file"},
+        "199990000\n1\n1\n",
+        '--gc-max-pause-us keeps objects stored while marking' );
+
+    $output = qx{$PARROT --gc-max-pause-us=short "$gen_pir_file" 2>&1 };
+    like( $output, qr/invalid GC pause/, '--gc-max-pause-us needs a number' );
+
+    is( qx{"$PARROT" --gc-alloc-threshold=256 "$gen_pir_file"}, "199990000\n1\n1\n",
+        '--gc-alloc-threshold collects while allocating' );
+
+    $output = qx{$PARROT --gc-alloc-threshold=some "$gen_pir_file" 2>&1 };
+    like( $output, qr/invalid GC allocation threshold/,
+                   '--gc-alloc-threshold needs a number' );
+
+    is( qx{"$PARROT" --gc-mark-threads=4 --gc-alloc-threshold=256 "$gen_pir_file"},
+        "199990000\n1\n1\n", '--gc-mark-threads marks everything with ms2' );
+
+    like( qx{"$PARROT" --gc-mark-threads=4 -g ms "$gen_pir_file"}, qr/^199990000\n\d\n1\n$/,
+        '--gc-mark-threads marks everything with ms' );
+
+    $output = qx{$PARROT --gc-mark-threads=many "$gen_pir_file" 2>&1 };
+    like( $output, qr/invalid GC mark threads/,
+                   '--gc-mark-threads needs a number' );
+}
+
+# Incremental marking under a real workload: compiling and running NQP
+{
+    my ( $fh, $nqp_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub main :main
+    load_bytecode 'nqp-rx.pbc'
+    .local pmc nqp, code
+    nqp  = compreg 'NQP-rx'
+    code = nqp.'compile'(<<'END_NQP')
+my %seen; my @words; my $i := 0;
+while $i < 2000 { @words.push('w' ~ $i); %seen{'w' ~ $i} := $i; $i := $i + 1; }
+sub fib($n) { $n < 2 ?? $n !! fib($n - 1) + fib($n - 2) }
+my $sum := 0;
+for @words { $sum := $sum + %seen{$_}; }
+say($sum ~ ' ' ~ fib(15));
+END_NQP
+    code()
+.end
+END_PIR
+    close $fh;
+
+    is( qx{"$PARROT" --gc-max-pause-us=1 --gc-alloc-threshold=16 "$nqp_pir_file" 2>&1},
+        "1999000 610\n", '--gc-max-pause-us runs nqp-rx' );
+}
+
+# Lazy sweeping: survivors, finalizers and when the string pool compacts
+{
+    my ( $fh, $lazy_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.include 'interpinfo.pasm'
+.sub main :main
+    .param pmc argv
+    .local string file
+    .local pmc keep
+    .local int i, sum, start, runs, compacts, deferred
+    file = argv[1]
+    # Nothing left to sweep before the handle dies
+    sweep 1
+    write_and_drop(file)
+    start    = interpinfo .INTERPINFO_GC_MARK_RUNS
+    compacts = interpinfo .INTERPINFO_GC_COLLECT_RUNS
+    deferred = -1
+    keep     = new ['ResizablePMCArray']
+    i        = 0
+  loop:
+    $P0 = new ['String']
+    $S0 = i
+    $P0 = $S0
+    $S1 = repeat 'x', 64
+    $I0 = i % 10
+    if $I0 goto check
+    push keep, $P0
+  check:
+    runs = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if deferred >= 0 goto next
+    if runs == start goto next
+    # The first collection leaves compacting to the end of its sweep
+    $I1      = interpinfo .INTERPINFO_GC_COLLECT_RUNS
+    deferred = iseq $I1, compacts
+  next:
+    inc i
+    if i < 20000 goto loop
+    sum = 0
+    i   = 0
+  add:
+    $P1  = keep[i]
+    $I2  = $P1
+    sum += $I2
+    inc i
+    if i < 2000 goto add
+    say sum
+    runs -= start
+    $I3  = isgt runs, 1
+    say $I3
+    say deferred
+    $P2 = new ['FileHandle']
+    $S2 = $P2.'readall'(file)
+    print $S2
+.end
+
+.sub write_and_drop
+    .param string file
+    $P0 = new ['FileHandle']
+    $P0.'open'(file, 'w')
+    $P0.'print'("finalized\n")
+.end
+END_PIR
+    close $fh;
+    ( $fh, my $lazy_out_file ) = tempfile( SUFFIX => '.txt', UNLINK => 1 );
+    close $fh;
+
+    is( qx{"$PARROT" --gc-alloc-threshold=128 "$lazy_pir_file" "$lazy_out_file" 2>&1},
+        "19990000\n1\n1\nfinalized\n", '--gc-alloc-threshold sweeps lazily' );
+}
+
+# --hash-siphash: keys hash the same in every encoding
+{
+    my ( $fh, $hash_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    .local pmc hash
+    hash = new ['Hash']
+    $S0 = iso-8859-1:"caf\xe9 au lait, long enough to take more than one block"
+    hash[$S0] = 'latin1'
+    $S1 = utf8:"\u2603 snowman"
+    hash[$S1] = 'wide'
+
+    $I0 = find_encoding 'utf8'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    say $S3
+
+    $I0 = find_encoding 'ucs2'
+    $S2 = trans_encoding $S0, $I0
+    $S3 = hash[$S2]
+    say $S3
+
+    $I0 = find_encoding 'utf16'
+    $S2 = trans_encoding $S1, $I0
+    $S3 = hash[$S2]
+    say $S3
+.end
+END_PIR
+    close $fh;
+
+    is( qx{"$PARROT" --hash-siphash "$hash_pir_file"}, "latin1\nlatin1\nwide\n",
+        '--hash-siphash finds keys stored in another encoding' );
+}
+
+# --snapshot: the state built by :init subs, restored without running them
+{
+    my ( $fh, $save_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.loadlib 'rational'
+
+.sub 'setup' :init :load
+    say 'setup'
+    $P0 = newclass 'Point'
+    addattribute $P0, 'x'
+    $P1 = new 'Point'
+    $P2 = box 7
+    setattribute $P1, 'x', $P2
+    set_global 'origin', $P1
+    $P3 = 'make_counter'()
+    set_global 'counter', $P3
+    $P4 = new 'Hash'
+    $P4['key'] = 'value'
+    set_global 'table', $P4
+.end
+
+.sub 'make_counter'
+    .local pmc n
+    n = box 0
+    .lex 'n', n
+    .const 'Sub' c = 'count'
+    $P0 = newclosure c
+    .return ($P0)
+.end
+
+.sub 'count' :outer('make_counter')
+    $P0 = find_lex 'n'
+    inc $P0
+    .return ($P0)
+.end
+
+.sub 'describe' :multi(Integer)
+    .return ('integer')
+.end
+
+.sub 'describe' :multi(String)
+    .return ('string')
+.end
+
+.sub 'main' :main
+    .param pmc args
+    $S0 = args[1]
+    $P0 = getinterp
+    $P0.'snapshot'($S0)
+.end
+
+.namespace ['Point']
+.sub 'x' :method
+    $P0 = getattribute self, 'x'
+    .return ($P0)
+.end
+
+.HLL 'snapshot_test'
+
+.sub 'map_integers' :init :load
+    $P0 = getinterp
+    $P1 = get_class 'Integer'
+    $P2 = subclass $P1, 'MyInt'
+    $P0.'hll_map'($P1, $P2)
+.end
+
+.sub 'hll_box'
+    $P0 = box 5
+    .return ($P0)
+.end
+END_PIR
+    close $fh;
+
+    ( $fh, my $use_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    $P0 = get_global 'origin'
+    $P1 = $P0.'x'()
+    say $P1
+    $P2 = get_global 'counter'
+    $P2()
+    $P3 = $P2()
+    say $P3
+    $P4 = box 1
+    $S0 = 'describe'($P4)
+    say $S0
+    $P4 = box 'a'
+    $S0 = 'describe'($P4)
+    say $S0
+    $P5 = get_global 'table'
+    $S0 = $P5['key']
+    say $S0
+    $P6 = new 'Point'
+    $S0 = typeof $P6
+    say $S0
+    $P7 = new 'Rational'
+    $P7 = '1/2'
+    say $P7
+    $P8 = get_root_global ['snapshot_test'], 'hll_box'
+    $P9 = $P8()
+    $S0 = typeof $P9
+    say $S0
+.end
+END_PIR
+    close $fh;
+
+    ( $fh, my $snapshot_file ) = tempfile( SUFFIX => '.snap', UNLINK => 1 );
+    close $fh;
+
+    is( qx{"$PARROT" "$save_pir_file" "$snapshot_file"}, "setup\n",
+        'snapshot method saves the interpreter' );
+
+    is( qx{"$PARROT" --snapshot="$snapshot_file" "$use_pir_file"},
+        "7\n2\ninteger\nstring\nvalue\nPoint\n1/2\nMyInt\n",
+        '--snapshot restores it without running :init subs' );
+
+    $output = qx{"$PARROT" --snapshot="$use_pir_file" "$use_pir_file" 2>&1};
+    like( $output, qr/is not a snapshot/, '--snapshot checks the file' );
+
+    ( $fh, my $handle_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    .param pmc args
+    $P0 = new 'FileHandle'
+    $P1 = args[0]
+    $P0.'open'($P1, 'r')
+    set_global 'handle', $P0
+    $S0 = args[1]
+    $P2 = getinterp
+    $P2.'snapshot'($S0)
+.end
+END_PIR
+    close $fh;
+
+    $output = qx{"$PARROT" "$handle_pir_file" "$snapshot_file" 2>&1};
+    like( $output, qr/Cannot snapshot a PMC of type FileHandle/,
+        'snapshot method refuses open files' );
+
+    ( $fh, my $pge_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    .param pmc args
+    load_bytecode 'PGE.pbc'
+    load_bytecode 'PCT.pbc'
+    $S0 = args[1]
+    $P0 = getinterp
+    $P0.'snapshot'($S0)
+.end
+END_PIR
+    close $fh;
+
+    ( $fh, my $regex_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    $P0 = compreg 'PGE::Perl6Regex'
+    $P1 = $P0('a+b')
+    $P2 = $P1('xaaab')
+    say $P2
+    $P3 = get_hll_global ['PCT'], 'HLLCompiler'
+    $S0 = typeof $P3
+    say $S0
+.end
+END_PIR
+    close $fh;
+
+    is( qx{"$PARROT" "$pge_pir_file" "$snapshot_file" 2>&1}, '',
+        'snapshot method saves PGE and PCT with their coroutines' );
+
+    is( qx{"$PARROT" --snapshot="$snapshot_file" "$regex_pir_file" 2>&1},
+        "aaab\nPCT::HLLCompiler\n", '--snapshot restores PGE and PCT' );
+
+    # the header: 8 magic bytes, then opcode_t fields up to the bytecode
+    # version at 6 and the core PMC fingerprint at 9
+    my $snapshot = do {
+        open my $in, '<:raw', $snapshot_file or die "Cannot read snapshot: $!";
+        local $/;
+        <$in>;
+    };
+    my $opsize = $PConfig{opcode_t_size};
+    for my $field ( [ 6, qr/has bytecode version/, 'bytecode version' ],
+                    [ 9, qr/with other core PMCs/, 'core PMCs' ] ) {
+        my ( $index, $error, $what ) = @$field;
+        my $copy = $snapshot;
+        my $at   = 8 + $index * $opsize;
+        substr( $copy, $at, 1 ) = chr( ord( substr( $copy, $at, 1 ) ) ^ 1 );
+
+        ( $fh, my $bad_file ) = tempfile( SUFFIX => '.snap', UNLINK => 1 );
+        binmode $fh;
+        print $fh $copy;
+        close $fh;
+
+        $output = qx{"$PARROT" --snapshot="$bad_file" "$regex_pir_file" 2>&1};
+        like( $output, $error, "--snapshot checks the $what of the file" );
+    }
+
+    ( $fh, my $coro_pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh <<'END_PIR';
+.sub 'main' :main
+    .param pmc args
+    .const 'Sub' gen = 'gen'
+    gen()
+    set_global 'gen', gen
+    $S0 = args[1]
+    $P0 = getinterp
+    $P0.'snapshot'($S0)
+.end
+
+.sub 'gen'
+    .yield (1)
+    .yield (2)
+.end
+END_PIR
+    close $fh;
+
+    $output = qx{"$PARROT" "$coro_pir_file" "$snapshot_file" 2>&1};
+    like( $output, qr/Cannot snapshot a running Coroutine/,
+        'snapshot method refuses running coroutines' );
+}
+
 # clean up temporary files
 unlink $first_pir_file;
 unlink $second_pir_file;
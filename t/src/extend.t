@@ -11,7 +11,7 @@ use Parrot::Test::Util 'create_tempfile';
 use Parrot::Test;
 use Parrot::Config;
 
-plan tests => 18;
+plan tests => 19;
 
 =head1 NAME
 
@@ -754,6 +754,44 @@ CODE
 Result is 300.
 OUTPUT
 
+c_output_is( <<"CODE", <<'OUTPUT', 'constant strings outlive a destroyed packfile' );
+#include <parrot/parrot.h>
+#include <parrot/embed.h>
+#include <parrot/extend.h>
+
+int
+main(int argc, const char *argv[])
+{
+    Parrot_PackFile pf;
+    Parrot_Interp   interp = Parrot_new(NULL);
+
+    if (interp) {
+        PackFile_ConstTable *ct;
+        Parrot_String        add  = Parrot_str_new_constant( interp, "add" );
+        Parrot_String        kept = NULL;
+        char                *c;
+        opcode_t             i;
+
+        pf = Parrot_pbc_read( interp, "$temp_pbc", 0 );
+        ct = pf->cur_cs->const_table;
+
+        for (i = 0; i < ct->str.const_count; ++i)
+            if (Parrot_str_equal( interp, ct->str.constants[i], add ))
+                kept = ct->str.constants[i];
+
+        PackFile_destroy( interp, pf );
+
+        c = Parrot_str_to_cstring( interp, kept );
+        printf( "%s\\n", c );
+        Parrot_str_free_cstring( c );
+        Parrot_destroy(interp);
+    }
+    return 0;
+}
+CODE
+add
+OUTPUT
+
 c_output_is( <<'CODE', <<'OUTPUT', 'multiple Parrot_new/Parrot_x_exit cycles' );
 
 #include <stdio.h>
@@ -4,7 +4,7 @@
 
 use strict;
 use warnings;
-use Test::More tests =>  20;
+use Test::More tests =>  22;
 use Carp;
 use lib qw( lib t/configure/testlib );
 use_ok('config::auto::headers');
@@ -97,6 +97,20 @@ ok(! $conf->data->get('i_niin'), "Mapping made correctly");
     ok($extra_headers{'sal.h'}, "Special header set for $os");
 }
 
+{
+    $conf->data->set( OSNAME_provisional => 'linux' );
+    my %extra_headers =
+        map {$_, 1} auto::headers::_list_extra_headers($conf);
+    ok($extra_headers{'linux/io_uring.h'}, "io_uring header probed by default");
+
+    $conf->options->set( 'without-io-uring' => 1 );
+    %extra_headers =
+        map {$_, 1} auto::headers::_list_extra_headers($conf);
+    ok(! $extra_headers{'linux/io_uring.h'},
+        "io_uring header not probed with --without-io-uring");
+    $conf->options->set( 'without-io-uring' => undef );
+}
+
 pass("Completed all tests in $0");
 
 ################### DOCUMENTATION ###################
@@ -0,0 +1,173 @@
+#! perl
+
+# Copyright (C) 2010, Parrot Foundation.
+
+use strict;
+use warnings;
+use Getopt::Long;
+
+=head1 NAME
+
+tools/dev/pprof2super.pl
+
+=head1 DESCRIPTION
+
+Find the op sequences executed most often in the output of Parrot's profiling
+runcore.  These are the candidates for new superinstructions in
+F<src/dynoplibs/super.ops>.
+
+=head1 SYNOPSIS
+
+perl tools/dev/pprof2super.pl [--length 2] [--top 20] \
+    [--ops src/dynoplibs/super.ops] parrot.pprof.1234 ...
+
+=head1 USAGE
+
+Generate a profile by passing C<-Rprofiling> to parrot, for example C<./parrot
+-Rprofiling foo.pir>.  Then run this script with one or more pprof files as
+arguments.  It prints the most frequently executed sequences of C<--length>
+consecutive ops within the same context, together with the share of all
+executed ops they account for and the total time spent in them.
+
+Sequences of two ops which IMCC already fuses into an op of the oplib named
+by C<--ops> are marked with the name of that op.  Only ops executed back to
+back in the same context are counted; context switches and the end of a
+runloop start a new sequence.
+
+=cut
+
+main();
+
+=head1 FUNCTIONS
+
+=over 4
+
+=item C<main>
+
+Parse the command line, count the sequences of every profile and print the
+report.
+
+=cut
+
+sub main {
+    my $length = 2;
+    my $top    = 20;
+    my $ops    = 'src/dynoplibs/super.ops';
+
+    GetOptions(
+        'length=i' => \$length,
+        'top=i'    => \$top,
+        'ops=s'    => \$ops,
+    ) or die "Usage: $0 [--length n] [--top n] [--ops file] filename ...\n";
+
+    die "Usage: $0 [--length n] [--top n] [--ops file] filename ...\n"
+        unless @ARGV && $length > 1;
+
+    my $stats = { total => 0, seqs => {} };
+
+    for my $filename (@ARGV) {
+        open(my $in_fh, '<', $filename) or die "couldn't open $filename for reading: $!";
+        process_input($in_fh, $stats, $length);
+        close($in_fh) or die "couldn't close $filename: $!";
+    }
+
+    my $fused = -e $ops ? read_fused_ops($ops) : {};
+
+    print_report($stats, $fused, $top);
+}
+
+=item C<process_input>
+
+Count every sequence of C<$length> consecutive ops in the profile read from
+C<$input>, along with the time spent in it, in C<$stats>.
+
+=cut
+
+sub process_input {
+    my ($input, $stats, $length) = @_;
+    my @window;
+
+    while (my $line = <$input>) {
+        if ($line =~ /^OP:(.*)$/) {
+            # Decode string in the format C<{x{key1:value1}x}{x{key2:value2}x}>
+            my %op_hash = $1 =~ /\{x\{([^:]+):(.*?)\}x\}/g
+                or die "invalidly formed line '$line'";
+
+            push @window, [ $op_hash{op}, $op_hash{time} ];
+            shift @window if @window > $length;
+            $stats->{total}++;
+
+            next unless @window == $length;
+
+            my $seq   = join ' ', map { $_->[0] } @window;
+            my $entry = $stats->{seqs}{$seq} ||= { count => 0, time => 0 };
+            $entry->{count}++;
+            $entry->{time} += $_->[1] for @window;
+        }
+        elsif ($line =~ /^(?:CS|END_OF_RUNLOOP):/) {
+            @window = ();
+        }
+    }
+}
+
+=item C<read_fused_ops>
+
+Return a hash mapping the op pairs fused by the oplib source in C<$file> to
+the name of the fused op.  Fused ops are named after the ops they replace,
+e.g. C<inc_lt> for C<inc> followed by C<lt>.
+
+=cut
+
+sub read_fused_ops {
+    my ($file) = @_;
+    my %fused;
+
+    open(my $ops_fh, '<', $file) or die "couldn't open $file for reading: $!";
+    while (my $line = <$ops_fh>) {
+        next unless $line =~ /^(?:inline\s+)?op\s+([a-z]+)_([a-z]+)\s*\(/;
+        $fused{"$1 $2"} = "$1_$2";
+
+        # gt and ge are emitted as lt and le with swapped operands
+        $fused{"$1 lt"} ||= "$1_$2" if $2 eq 'gt';
+        $fused{"$1 le"} ||= "$1_$2" if $2 eq 'ge';
+    }
+    close($ops_fh) or die "couldn't close $file: $!";
+
+    return \%fused;
+}
+
+=item C<print_report>
+
+Print the C<$top> most frequent sequences in C<$stats>.
+
+=cut
+
+sub print_report {
+    my ($stats, $fused, $top) = @_;
+    my $seqs  = $stats->{seqs};
+    my @order = sort { $seqs->{$b}{count} <=> $seqs->{$a}{count} || $a cmp $b } keys %$seqs;
+
+    splice @order, $top if @order > $top;
+
+    printf "%12s %7s %14s  %s\n", 'count', 'ops %', 'time', 'sequence';
+    for my $seq (@order) {
+        my $entry = $seqs->{$seq};
+        printf "%12d %6.2f%% %14d  %s%s\n",
+            $entry->{count},
+            $stats->{total} ? 100 * $entry->{count} / $stats->{total} : 0,
+            $entry->{time},
+            $seq,
+            exists $fused->{$seq} ? "  (fused: $fused->{$seq})" : '';
+    }
+}
+
+=back
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: